@@ -351,6 +351,7 @@ extern bg96_shared_variables_t bg96_shared;
 /* Exported functions ------------------------------------------------------- */
 void        ATCustom_BG96_init(atparser_context_t *p_atp_ctxt);
 uint8_t     ATCustom_BG96_checkEndOfMsgCallback(uint8_t rxChar);
+uint16_t    ATCustom_BG96_checkEndOfMsgBlockCallback(const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg);
 at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t ATCustom_BG96_extractElement(atparser_context_t *p_atp_ctxt,
                                          const IPC_RxMessage_t *p_msg_in,
@@ -367,6 +368,8 @@ at_status_t ATCustom_BG96_get_rsp(atparser_context_t *p_atp_ctxt, at_buf_t *p_rs
 at_status_t ATCustom_BG96_get_urc(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_BG96_get_error(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_BG96_hw_event(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+at_status_t ATCustom_BG96_suspend_SID(atparser_context_t *p_atp_ctxt);
+void ATCustom_BG96_resume_SID(atparser_context_t *p_atp_ctxt);
 
 #ifdef __cplusplus
 }
@@ -48,6 +48,7 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   /* init function pointers with BG96 functions */
   funcPtrs->f_init = ATCustom_BG96_init;
   funcPtrs->f_checkEndOfMsgCallback = ATCustom_BG96_checkEndOfMsgCallback;
+  funcPtrs->f_checkEndOfMsgBlockCallback = ATCustom_BG96_checkEndOfMsgBlockCallback;
   funcPtrs->f_getCmd = ATCustom_BG96_getCmd;
   funcPtrs->f_extractElement = ATCustom_BG96_extractElement;
   funcPtrs->f_analyzeCmd = ATCustom_BG96_analyzeCmd;
@@ -57,6 +58,8 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   funcPtrs->f_get_urc = ATCustom_BG96_get_urc;
   funcPtrs->f_get_error = ATCustom_BG96_get_error;
   funcPtrs->f_hw_event = ATCustom_BG96_hw_event;
+  funcPtrs->f_suspend_SID = ATCustom_BG96_suspend_SID;
+  funcPtrs->f_resume_SID = ATCustom_BG96_resume_SID;
 #else
 #error AT custom does not match with selected modem
 #endif /* USE_MODEM_BG96 */
@@ -616,6 +616,15 @@ at_action_rsp_t fRspAnalyze_Error_BG96(at_context_t *p_at_ctxt, atcustom_modem_c
   at_action_rsp_t retval = ATACTION_RSP_ERROR;
   PRINT_API("enter fRspAnalyze_Error_BG96()")
 
+  /* error on a line of concatenated commands: they are sent again one per line and
+   * the treatments below apply to the command in error
+   */
+  if (atcm_concat_line_error(p_modem_ctxt, p_atp_ctxt) == AT_TRUE)
+  {
+    retval = ATACTION_RSP_FRC_CONTINUE;
+    goto exit_fRspAnalyze_Error_BG96;
+  }
+
   switch (p_atp_ctxt->current_SID)
   {
     case SID_CS_DIAL_COMMAND:
@@ -625,6 +634,13 @@ at_action_rsp_t fRspAnalyze_Error_BG96(at_context_t *p_at_ctxt, atcustom_modem_c
       (void) atcm_socket_release_modem_cid(p_modem_ctxt, p_modem_ctxt->socket_ctxt.socket_info->socket_handle);
       break;
 
+    case SID_CS_ACTIVATE_PDN:
+      /* PDN activation (AT+QIACT) rejected: the PDN settings may have been lost by the modem,
+       * they will be sent again at next PDN definition
+       */
+      atcm_cfg_cache_invalidate();
+      break;
+
     default:
       /* nothing to do */
       break;
@@ -686,6 +702,7 @@ at_action_rsp_t fRspAnalyze_Error_BG96(at_context_t *p_at_ctxt, atcustom_modem_c
       break;
   }
 
+exit_fRspAnalyze_Error_BG96:
   return (retval);
 }
 
@@ -1367,9 +1384,11 @@ at_action_rsp_t fRspAnalyze_QCCID_BG96(at_context_t *p_at_ctxt, atcustom_modem_c
   at_action_rsp_t retval = ATACTION_RSP_INTERMEDIATE; /* received a valid intermediate answer */
   PRINT_API("enter fRspAnalyze_QCCID_BG96()")
 
-  /* analyze parameters for +QCCID */
+  /* analyze parameters for +QCCID
+   * (device_info is only available for SID_CS_GET_DEVICE_INFO, +QCCID is also sent during modem init)
+   */
   START_PARAM_LOOP()
-  if (element_infos->param_rank == 2U)
+  if ((element_infos->param_rank == 2U) && (p_modem_ctxt->SID_ctxt.device_info != NULL))
   {
     PRINT_DBG("ICCID:")
     PRINT_BUF((const uint8_t *)&p_msg_in->buffer[element_infos->str_start_idx], element_infos->str_size)
@@ -269,12 +269,12 @@ at_status_t fCmdBuild_QISEND_WRITE_DATA_BG96(atparser_context_t *p_atp_ctxt,
   /* only for raw command, set parameters */
   if (p_atp_ctxt->current_atcmd.type == ATTYPE_RAW_CMD)
   {
-    if (p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send != NULL)
+    if ((p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send != NULL)
+        || (p_modem_ctxt->SID_ctxt.socketSendData_struct.p_iov_send != NULL))
     {
-      uint32_t str_size = p_modem_ctxt->SID_ctxt.socketSendData_struct.buffer_size;
-      (void) memcpy((void *)p_atp_ctxt->current_atcmd.params,
-                    (const CS_CHAR_t *)p_modem_ctxt->SID_ctxt.socketSendData_struct.p_buffer_addr_send,
-                    (size_t) str_size);
+      /* copy the buffer (or the segments of a vectored send) */
+      uint32_t str_size = atcm_socket_copy_send_data(&p_modem_ctxt->SID_ctxt.socketSendData_struct,
+                                                     p_atp_ctxt->current_atcmd.params);
 
       /* set raw command size */
       p_atp_ctxt->current_atcmd.raw_cmd_size = str_size;
@@ -82,10 +82,12 @@
 #define CHECK_STEP_EXCEEDS(stepval) (p_atp_ctxt->step >= ((stepval)+1U))
 #define CHECK_STEP_BETWEEN(low_step, high_step) ((p_atp_ctxt->step >= ((low_step)+1U)) &&\
                                                  (p_atp_ctxt->step <= ((high_step)+1U)))
+#define SID_SEQ_STEP ((uint8_t)(p_atp_ctxt->step - 1U))
 #else
 #define CHECK_STEP(stepval) (p_atp_ctxt->step == stepval)
 #define CHECK_STEP_EXCEEDS(stepval) (p_atp_ctxt->step >= stepval)
 #define CHECK_STEP_BETWEEN(low_step, high_step) ((p_atp_ctxt->step >= low_step) && (p_atp_ctxt->step <= high_step))
+#define SID_SEQ_STEP (p_atp_ctxt->step)
 #endif /* ENABLE_BG96_LOW_POWER_MODE == 1U */
 
 /* ###########################  START CUSTOMIZATION PART  ########################### */
@@ -184,6 +186,110 @@ static bool is_waiting_modem_wakeup(void);
 
 #endif /* ENABLE_BG96_LOW_POWER_MODE == 1U */
 
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+static void bg96_seq_prepare_QICSGP_config(atcustom_modem_context_t *p_modem_ctxt);
+static void bg96_seq_prepare_QICSGP_auth(atcustom_modem_context_t *p_modem_ctxt);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+
+/* SID sequences: SID whose AT commands sequence is static (see atcm_program_SID_sequence) */
+static const atcm_SID_seq_step_t BG96_SEQ_AT[] =
+{
+  /* cmd enum - cmd type - options - skip ftion - prepare ftion */
+  {CMD_AT,             ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t BG96_SEQ_GET_SIGNAL_QUALITY[] =
+{
+  /* sent on a single line: AT+CSQ;+QCSQ */
+  {CMD_AT_CSQ,         ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_QCSQ,        ATTYPE_EXECUTION_CMD, ATCM_SEQ_CONCAT,     NULL, NULL},
+#if (BG96_OPTION_NETWORK_INFO == 1)
+  /* answer is optional: if requested here, it's just a bonus and should not generate an error */
+  {CMD_AT_QNWINFO,     ATTYPE_EXECUTION_CMD, ATCM_SEQ_ANSWER_OPT, NULL, NULL},
+#endif /* BG96_OPTION_NETWORK_INFO */
+#if (BG96_OPTION_ENGINEERING_MODE == 1)
+  {CMD_AT_QENG,        ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+#endif /* BG96_OPTION_ENGINEERING_MODE */
+};
+
+static const atcm_SID_seq_step_t BG96_SEQ_GET_ATTACHSTATUS[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t BG96_SEQ_REGISTER_NET[] =
+{
+  {CMD_AT_COPS,        ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  /* always write registration status: due to problem observed on simu (does not register after reboot) */
+  {CMD_AT_COPS,        ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+  /* sent on a single line: AT+CEREG?;+CREG?;+CGREG? */
+  {CMD_AT_CEREG,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_CREG,        ATTYPE_READ_CMD,      ATCM_SEQ_CONCAT,     NULL, NULL},
+  {CMD_AT_CGREG,       ATTYPE_READ_CMD,      ATCM_SEQ_CONCAT,     NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t BG96_SEQ_GET_NETSTATUS[] =
+{
+  /* sent on a single line: AT+CEREG?;+CREG?;+CGREG?;+COPS? */
+  {CMD_AT_CEREG,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_CREG,        ATTYPE_READ_CMD,      ATCM_SEQ_CONCAT,     NULL, NULL},
+  {CMD_AT_CGREG,       ATTYPE_READ_CMD,      ATCM_SEQ_CONCAT,     NULL, NULL},
+  {CMD_AT_COPS,        ATTYPE_READ_CMD,      ATCM_SEQ_CONCAT,     NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t BG96_SEQ_ATTACH_PS_DOMAIN[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_CGATT_attach},
+};
+
+static const atcm_SID_seq_step_t BG96_SEQ_DETACH_PS_DOMAIN[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_CGATT_detach},
+};
+
+/* PDN settings are saved in modem non-volatile memory: not sent again if unchanged since last commit
+ * to this modem (IMEI read first if not known since the modem power on)
+ */
+static const atcm_SID_seq_step_t BG96_SEQ_DEFINE_PDN[] =
+{
+  {CMD_AT_GSN,     ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE, atcm_cfg_cache_modem_id_is_known, NULL},
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  /* SOCKET MODE */
+  {CMD_AT_QICSGP,  ATTYPE_WRITE_CMD, ATCM_SEQ_NONE, atcm_cfg_cache_PDN_is_committed, bg96_seq_prepare_QICSGP_config},
+  {CMD_AT_QICSGP,  ATTYPE_WRITE_CMD, ATCM_SEQ_NONE, atcm_cfg_cache_PDN_is_committed, bg96_seq_prepare_QICSGP_auth},
+#else
+  /* DATA MODE */
+  {CMD_AT_CGDCONT, ATTYPE_WRITE_CMD, ATCM_SEQ_NONE, atcm_cfg_cache_PDN_is_committed, NULL},
+#endif /* USE_SOCKETS_TYPE */
+};
+
+static const atcm_SID_seq_step_t BG96_SEQ_GET_IP_ADDRESS[] =
+{
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  /* SOCKET MODE */
+  {CMD_AT_QIACT,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+#else
+  /* DATA MODE */
+  {CMD_AT_CGPADDR,     ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+#endif /* USE_SOCKETS_TYPE */
+};
+
+static const atcm_SID_seq_t BG96_SID_SEQ_LUT[] =
+{
+  /* SID - sequence - sequence size */
+  {(at_msg_t) SID_CS_CHECK_CNX,          BG96_SEQ_AT,                 ATCM_SEQ_STEPS_NB(BG96_SEQ_AT)},
+  {(at_msg_t) SID_CS_MODEM_CONFIG,       BG96_SEQ_AT,                 ATCM_SEQ_STEPS_NB(BG96_SEQ_AT)},
+  {(at_msg_t) SID_CS_GET_SIGNAL_QUALITY, BG96_SEQ_GET_SIGNAL_QUALITY, ATCM_SEQ_STEPS_NB(BG96_SEQ_GET_SIGNAL_QUALITY)},
+  {(at_msg_t) SID_CS_GET_ATTACHSTATUS,   BG96_SEQ_GET_ATTACHSTATUS,   ATCM_SEQ_STEPS_NB(BG96_SEQ_GET_ATTACHSTATUS)},
+  {(at_msg_t) SID_CS_REGISTER_NET,       BG96_SEQ_REGISTER_NET,       ATCM_SEQ_STEPS_NB(BG96_SEQ_REGISTER_NET)},
+  {(at_msg_t) SID_CS_GET_NETSTATUS,      BG96_SEQ_GET_NETSTATUS,      ATCM_SEQ_STEPS_NB(BG96_SEQ_GET_NETSTATUS)},
+  {(at_msg_t) SID_ATTACH_PS_DOMAIN,      BG96_SEQ_ATTACH_PS_DOMAIN,   ATCM_SEQ_STEPS_NB(BG96_SEQ_ATTACH_PS_DOMAIN)},
+  {(at_msg_t) SID_DETACH_PS_DOMAIN,      BG96_SEQ_DETACH_PS_DOMAIN,   ATCM_SEQ_STEPS_NB(BG96_SEQ_DETACH_PS_DOMAIN)},
+  {(at_msg_t) SID_CS_DEFINE_PDN,         BG96_SEQ_DEFINE_PDN,         ATCM_SEQ_STEPS_NB(BG96_SEQ_DEFINE_PDN)},
+  {(at_msg_t) SID_CS_GET_IP_ADDRESS,     BG96_SEQ_GET_IP_ADDRESS,     ATCM_SEQ_STEPS_NB(BG96_SEQ_GET_IP_ADDRESS)},
+};
+#define SIZE_BG96_SID_SEQ_LUT ((uint32_t) (sizeof (BG96_SID_SEQ_LUT) / sizeof (atcm_SID_seq_t)))
+
 /* ###########################  END CUSTOMIZATION PART  ########################### */
 
 /* Functions Definition ------------------------------------------------------*/
@@ -297,8 +403,7 @@ void ATCustom_BG96_init(atparser_context_t *p_atp_ctxt)
   bg96_modem_init(&BG96_ctxt);
 
   /* ###########################  START CUSTOMIZATION PART  ########################### */
-  BG96_ctxt.modem_LUT_size = SIZE_ATCMD_BG96_LUT;
-  BG96_ctxt.p_modem_LUT = (const atcustom_LUT_t *)ATCMD_BG96_LUT;
+  atcm_set_modem_LUT(&BG96_ctxt, (const atcustom_LUT_t *)ATCMD_BG96_LUT, SIZE_ATCMD_BG96_LUT);
 
   /* override default termination string for AT command: <CR> */
   (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->endstr, "\r");
@@ -517,6 +622,12 @@ uint8_t ATCustom_BG96_checkEndOfMsgCallback(uint8_t rxChar)
   return (last_char);
 }
 
+uint16_t ATCustom_BG96_checkEndOfMsgBlockCallback(const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg)
+{
+  /* same analysis than ATCustom_BG96_checkEndOfMsgCallback() applied to each char, done by blocks */
+  return (atcm_checkEndOfMsgBlock(&BG96_ctxt, ATCustom_BG96_checkEndOfMsgCallback, p_data, size, p_endOfMsg));
+}
+
 at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout)
 {
   /* static variables */
@@ -526,6 +637,7 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
   at_status_t retval = ATSTATUS_OK;
   atparser_context_t *p_atp_ctxt = &(p_at_ctxt->parser);
   at_msg_t curSID = p_atp_ctxt->current_SID;
+  const atcm_SID_seq_t *p_SID_seq;
 
   PRINT_API("enter ATCustom_BG96_getCmd() for SID %d", curSID)
 
@@ -581,29 +693,11 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
 #endif /* ENABLE_BG96_LOW_POWER_MODE == 1U */
 
   /* ###########################  START CUSTOMIZATION PART  ########################### */
-  if (curSID == (at_msg_t) SID_CS_CHECK_CNX)
+  p_SID_seq = atcm_get_SID_sequence(BG96_SID_SEQ_LUT, SIZE_BG96_SID_SEQ_LUT, curSID);
+  if (p_SID_seq != NULL)
   {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_MODEM_CONFIG)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
+    /* static sequence of AT commands */
+    retval = atcm_program_SID_sequence(&BG96_ctxt, p_atp_ctxt, p_SID_seq, SID_SEQ_STEP);
   }
   else if ((curSID == (at_msg_t) SID_CS_POWER_ON) ||
            (curSID == (at_msg_t) SID_CS_RESET))
@@ -688,38 +782,40 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
       }
       else if CHECK_STEP((common_start_sequence_step + 1U))
       {
-        /* disable echo */
+        /* on a single line (ATE0+CMEE=1;V1&D0):
+         * disable echo, request detailed error report, enable full response format and deactivate DTR
+         */
         BG96_ctxt.CMD_ctxt.command_echo = AT_FALSE;
+        BG96_ctxt.CMD_ctxt.dce_full_resp_format = AT_TRUE;
         atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_ATE, INTERMEDIATE_CMD);
+        (void) atcm_program_AT_CMD_CONCAT(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CMEE);
+        (void) atcm_program_AT_CMD_CONCAT(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_ATV);
+        (void) atcm_program_AT_CMD_CONCAT(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_AND_D);
       }
       else if CHECK_STEP((common_start_sequence_step + 2U))
-      {
-        /* request detailed error report */
-        atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CMEE, INTERMEDIATE_CMD);
-      }
-      else if CHECK_STEP((common_start_sequence_step + 3U))
-      {
-        /* enable full response format */
-        BG96_ctxt.CMD_ctxt.dce_full_resp_format = AT_TRUE;
-        atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_ATV, INTERMEDIATE_CMD);
-      }
-      else if CHECK_STEP((common_start_sequence_step + 4U))
-      {
-        /* deactivate DTR */
-        atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_AND_D, INTERMEDIATE_CMD);
-      }
-      else if CHECK_STEP((common_start_sequence_step + 5U))
       {
         /* Read FW revision */
         atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_CGMR, INTERMEDIATE_CMD);
+        if (atcm_concat_allowed(&BG96_ctxt, p_atp_ctxt) == AT_TRUE)
+        {
+          /* on a single line (AT+CGMR;+CFUN=0;+CPSMS=0): commands of the 2 next steps, whose answer is empty,
+           * are sent after AT+CGMR whose answer is not prefixed
+           */
+          BG96_ctxt.CMD_ctxt.cfun_value = 0U;
+          BG96_ctxt.SID_ctxt.set_power_config.psm_present = CELLULAR_TRUE;
+          BG96_ctxt.SID_ctxt.set_power_config.psm_mode = PSM_MODE_DISABLE;
+          (void) atcm_program_AT_CMD_CONCAT(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CFUN);
+          (void) atcm_program_AT_CMD_CONCAT(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CPSMS);
+          atcm_concat_line_programmed(&BG96_ctxt, p_atp_ctxt, 2U);
+        }
       }
-      else if CHECK_STEP((common_start_sequence_step + 6U))
+      else if CHECK_STEP((common_start_sequence_step + 3U))
       {
         /* power on with AT+CFUN=0 */
         BG96_ctxt.CMD_ctxt.cfun_value = 0U;
         atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CFUN, INTERMEDIATE_CMD);
       }
-      else if CHECK_STEP((common_start_sequence_step + 7U))
+      else if CHECK_STEP((common_start_sequence_step + 4U))
       {
         /* force to disable PSM in case modem was switched off with PSM enabled */
         BG96_ctxt.SID_ctxt.set_power_config.psm_present = CELLULAR_TRUE;
@@ -730,31 +826,31 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
         * BG96_AT_Commands_Manual_V2.0
         */
       /* Check bands parameters */
-      else if CHECK_STEP((common_start_sequence_step + 8U))
+      else if CHECK_STEP((common_start_sequence_step + 5U))
       {
         bg96_shared.QCFG_command_write = AT_FALSE;
         bg96_shared.QCFG_command_param = QCFG_band;
         atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_QCFG, INTERMEDIATE_CMD);
       }
-      else if CHECK_STEP((common_start_sequence_step + 9U))
+      else if CHECK_STEP((common_start_sequence_step + 6U))
       {
         bg96_shared.QCFG_command_write = AT_FALSE;
         bg96_shared.QCFG_command_param = QCFG_iotopmode;
         atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_QCFG, INTERMEDIATE_CMD);
       }
-      else if CHECK_STEP((common_start_sequence_step + 10U))
+      else if CHECK_STEP((common_start_sequence_step + 7U))
       {
         bg96_shared.QCFG_command_write = AT_FALSE;
         bg96_shared.QCFG_command_param = QCFG_nwscanseq;
         atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_QCFG, INTERMEDIATE_CMD);
       }
-      else if CHECK_STEP((common_start_sequence_step + 11U))
+      else if CHECK_STEP((common_start_sequence_step + 8U))
       {
         bg96_shared.QCFG_command_write = AT_FALSE;
         bg96_shared.QCFG_command_param = QCFG_nwscanmode;
         atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_QCFG, FINAL_CMD);
       }
-      else if CHECK_STEP_EXCEEDS((common_start_sequence_step + 12U))
+      else if CHECK_STEP_EXCEEDS((common_start_sequence_step + 9U))
       {
         /* error, invalid step */
         retval = ATSTATUS_ERROR;
@@ -789,6 +885,17 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
       atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CFUN, INTERMEDIATE_CMD);
       bg96_shared.bg96_sim_status_retries = 0U;
       bg96_shared.QINISTAT_error = AT_FALSE;
+      if ((BG96_ctxt.SID_ctxt.modem_init.init != CS_CMI_MINI) &&
+          (atcm_concat_allowed(&BG96_ctxt, p_atp_ctxt) == AT_TRUE))
+      {
+        /* on a single line (AT+CFUN=1;+QCCID;+QINISTAT): commands of the 2 next steps (first SIM status request),
+         * whose answers are prefixed. AT+CPIN? is not concatenated: it is only sent once SIM status is known.
+         */
+        BG96_ctxt.persist.modem_sim_ready = AT_FALSE;
+        (void) atcm_program_AT_CMD_CONCAT(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_QCCID);
+        (void) atcm_program_AT_CMD_CONCAT(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_QINISTAT);
+        atcm_concat_line_programmed(&BG96_ctxt, p_atp_ctxt, 2U);
+      }
     }
     else if CHECK_STEP((1U))
     {
@@ -966,133 +1073,6 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
       retval = ATSTATUS_ERROR;
     }
   }
-  else if (curSID == (at_msg_t) SID_CS_GET_SIGNAL_QUALITY)
-  {
-
-    if CHECK_STEP((0U))
-    {
-      /* get signal strength */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_CSQ, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* get signal strength */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_QCSQ, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((2U))
-    {
-#if (BG96_OPTION_NETWORK_INFO == 1)
-      /* NB: cmd answer is optional ie no error will be raised if no answer received from modem
-        *  indeed, if requested here, it's just a bonus and should not generate an error
-        */
-      atcm_program_AT_CMD_ANSWER_OPTIONAL(&BG96_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_QNWINFO,
-                                          INTERMEDIATE_CMD);
-#else
-      atcm_program_SKIP_CMD(p_atp_ctxt);
-#endif /* BG96_OPTION_NETWORK_INFO */
-    }
-    else if CHECK_STEP((3U))
-    {
-#if (BG96_OPTION_ENGINEERING_MODE == 1)
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_QENG, FINAL_CMD);
-#else
-      atcm_program_NO_MORE_CMD(p_atp_ctxt);
-#endif /* BG96_OPTION_ENGINEERING_MODE */
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_GET_ATTACHSTATUS)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_REGISTER_NET)
-  {
-    if CHECK_STEP((0U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_COPS, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-#if 0 /* check actual registration status */
-      /* check if actual registration status is the expected one */
-      CS_OperatorSelector_t *operatorSelect = &(BG96_ctxt.SID_ctxt.write_operator_infos);
-      if (BG96_ctxt.SID_ctxt.read_operator_infos.mode != operatorSelect->mode)
-      {
-        /* write registration status */
-        atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_COPS, INTERMEDIATE_CMD);
-      }
-      else
-      {
-        /* skip this step */
-        atcm_program_SKIP_CMD(p_atp_ctxt);
-      }
-#else
-      /* due to problem observed on simu: does not register after reboot */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_COPS, INTERMEDIATE_CMD);
-#endif /* 0 */
-    }
-    else if CHECK_STEP((2U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CEREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((3U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((4U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CGREG, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_GET_NETSTATUS)
-  {
-    if CHECK_STEP((0U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CEREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((2U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CGREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((3U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_COPS, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
   else if (curSID == (at_msg_t) SID_CS_SUSBCRIBE_NET_EVENT)
   {
     if CHECK_STEP((0U))
@@ -1222,32 +1202,6 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
       retval = ATSTATUS_ERROR;
     }
   }
-  else if (curSID == (at_msg_t) SID_ATTACH_PS_DOMAIN)
-  {
-    if CHECK_STEP((0U))
-    {
-      BG96_ctxt.CMD_ctxt.cgatt_write_cmd_param = CGATT_ATTACHED;
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_DETACH_PS_DOMAIN)
-  {
-    if CHECK_STEP((0U))
-    {
-      BG96_ctxt.CMD_ctxt.cgatt_write_cmd_param = CGATT_DETACHED;
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
   else if (curSID == (at_msg_t) SID_CS_ACTIVATE_PDN)
   {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
@@ -1310,41 +1264,6 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
     /* not implemented yet */
     retval = ATSTATUS_ERROR;
   }
-  else if (curSID == (at_msg_t) SID_CS_DEFINE_PDN)
-  {
-#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-    /* SOCKET MODE */
-    if CHECK_STEP((0U))
-    {
-      bg96_shared.QICGSP_config_command = AT_TRUE;
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_QICSGP, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      bg96_shared.QICGSP_config_command = AT_FALSE;
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_QICSGP, FINAL_CMD);
-    }
-
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#else
-    /* DATA MODE*/
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGDCONT, FINAL_CMD);
-      /* add AT+CGAUTH for username and password if required */
-      /* could also use AT+QICSGP */
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#endif /* USE_SOCKETS_TYPE */
-  }
   else if (curSID == (at_msg_t) SID_CS_SET_DEFAULT_PDN)
   {
     /* nothing to do here
@@ -1353,17 +1272,6 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
       */
     atcm_program_NO_MORE_CMD(p_atp_ctxt);
   }
-  else if (curSID == (at_msg_t) SID_CS_GET_IP_ADDRESS)
-  {
-    /* get IP address */
-#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-    /* SOCKET MODE */
-    atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_QIACT, FINAL_CMD);
-#else
-    /* DATA MODE*/
-    atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGPADDR, FINAL_CMD);
-#endif /* USE_SOCKETS_TYPE */
-  }
   else if (curSID == (at_msg_t) SID_CS_DIAL_COMMAND)
   {
     /* SOCKET CONNECTION FOR COMMAND DATA MODE */
@@ -1886,6 +1794,8 @@ at_status_t ATCustom_BG96_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeo
   {
     if CHECK_STEP((0U))
     {
+      /* the settings stored in the modem can be changed by the direct command */
+      atcm_cfg_cache_invalidate();
       atcm_program_AT_CMD(&BG96_ctxt, p_atp_ctxt, ATTYPE_RAW_CMD, (CMD_ID_t) CMD_AT_DIRECT_CMD, FINAL_CMD);
       atcm_program_CMD_TIMEOUT(&BG96_ctxt, p_atp_ctxt, BG96_ctxt.SID_ctxt.direct_cmd_tx->cmd_timeout);
     }
@@ -2143,7 +2053,12 @@ at_action_rsp_t ATCustom_BG96_analyzeCmd(at_context_t *p_at_ctxt,
   }
   else
   {
-    /* cmd_id has been found in the LUT: determine next action */
+    /* cmd_id has been found in the LUT: if several commands are sent on the same line,
+     * the answer is analyzed as the answer of the matching command
+     */
+    atcm_select_concat_cmd(p_atp_ctxt, element_infos->cmd_id_received);
+
+    /* determine next action */
     switch (element_infos->cmd_id_received)
     {
       case CMD_AT_OK:
@@ -2535,6 +2450,11 @@ at_status_t ATCustom_BG96_get_rsp(atparser_context_t *p_atp_ctxt, at_buf_t *p_rs
       display_user_friendly_mode_and_bands_config();
       break;
 
+    case SID_CS_DEFINE_PDN:
+      /* PDN settings are now stored in modem non-volatile memory */
+      atcm_cfg_cache_PDN_commit(&BG96_ctxt);
+      break;
+
     case SID_CS_POWER_OFF:
       /* reinit context for power off case */
       bg96_modem_reset(&BG96_ctxt);
@@ -2629,6 +2549,37 @@ at_status_t ATCustom_BG96_hw_event(sysctrl_device_type_t deviceType, at_hw_event
   return (retval);
 }
 
+at_status_t ATCustom_BG96_suspend_SID(atparser_context_t *p_atp_ctxt)
+{
+  at_status_t retval = ATSTATUS_ERROR;
+  PRINT_API("enter ATCustom_BG96_suspend_SID()")
+
+  /* ###########################  START CUSTOMIZATION PART  ########################### */
+  /* the SIDs of this modem which can be suspended do not use its specific variables */
+  if (atcm_SID_can_be_suspended(p_atp_ctxt->current_SID) == AT_TRUE)
+  {
+    retval = ATSTATUS_OK;
+  }
+  /* ###########################  END CUSTOMIZATION PART  ########################### */
+
+  if (retval == ATSTATUS_OK)
+  {
+    /* save the SID contexts - common part */
+    atcm_suspend_SID_context(&BG96_ctxt);
+  }
+
+  return (retval);
+}
+
+void ATCustom_BG96_resume_SID(atparser_context_t *p_atp_ctxt)
+{
+  UNUSED(p_atp_ctxt);
+  PRINT_API("enter ATCustom_BG96_resume_SID()")
+
+  /* restore the SID contexts - common part */
+  atcm_resume_SID_context(&BG96_ctxt);
+}
+
 /* Private function Definition -----------------------------------------------*/
 
 /* BG96 modem init function
@@ -3291,5 +3242,29 @@ static bool is_waiting_modem_wakeup(void)
 
 #endif /* ENABLE_BG96_LOW_POWER_MODE == 1U */
 
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+/**
+  * @brief  SID sequence prepare function: AT+QICSGP configures the PDN context
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+static void bg96_seq_prepare_QICSGP_config(atcustom_modem_context_t *p_modem_ctxt)
+{
+  UNUSED(p_modem_ctxt);
+  bg96_shared.QICGSP_config_command = AT_TRUE;
+}
+
+/**
+  * @brief  SID sequence prepare function: AT+QICSGP configures the PDN context authentication
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+static void bg96_seq_prepare_QICSGP_auth(atcustom_modem_context_t *p_modem_ctxt)
+{
+  UNUSED(p_modem_ctxt);
+  bg96_shared.QICGSP_config_command = AT_FALSE;
+}
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
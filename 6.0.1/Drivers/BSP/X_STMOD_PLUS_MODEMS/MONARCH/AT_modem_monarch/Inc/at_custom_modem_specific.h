@@ -130,6 +130,7 @@ extern monarch_shared_variables_t monarch_shared;
 /* Exported functions ------------------------------------------------------- */
 void        ATCustom_MONARCH_init(atparser_context_t *p_atp_ctxt);
 uint8_t     ATCustom_MONARCH_checkEndOfMsgCallback(uint8_t rxChar);
+uint16_t    ATCustom_MONARCH_checkEndOfMsgBlockCallback(const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg);
 at_status_t ATCustom_MONARCH_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t ATCustom_MONARCH_extractElement(atparser_context_t *p_atp_ctxt,
                                             const IPC_RxMessage_t *p_msg_in,
@@ -146,6 +147,8 @@ at_status_t ATCustom_MONARCH_get_rsp(atparser_context_t *p_atp_ctxt, at_buf_t *p
 at_status_t ATCustom_MONARCH_get_urc(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_MONARCH_get_error(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_MONARCH_hw_event(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+at_status_t ATCustom_MONARCH_suspend_SID(atparser_context_t *p_atp_ctxt);
+void ATCustom_MONARCH_resume_SID(atparser_context_t *p_atp_ctxt);
 
 #ifdef __cplusplus
 }
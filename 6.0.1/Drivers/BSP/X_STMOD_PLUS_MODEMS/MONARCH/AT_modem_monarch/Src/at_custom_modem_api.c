@@ -41,6 +41,7 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   /* init function pointers with MONARCH functions */
   funcPtrs->f_init = ATCustom_MONARCH_init;
   funcPtrs->f_checkEndOfMsgCallback = ATCustom_MONARCH_checkEndOfMsgCallback;
+  funcPtrs->f_checkEndOfMsgBlockCallback = ATCustom_MONARCH_checkEndOfMsgBlockCallback;
   funcPtrs->f_getCmd = ATCustom_MONARCH_getCmd;
   funcPtrs->f_extractElement = ATCustom_MONARCH_extractElement;
   funcPtrs->f_analyzeCmd = ATCustom_MONARCH_analyzeCmd;
@@ -50,6 +51,8 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   funcPtrs->f_get_urc = ATCustom_MONARCH_get_urc;
   funcPtrs->f_get_error = ATCustom_MONARCH_get_error;
   funcPtrs->f_hw_event = ATCustom_MONARCH_hw_event;
+  funcPtrs->f_suspend_SID = ATCustom_MONARCH_suspend_SID;
+  funcPtrs->f_resume_SID = ATCustom_MONARCH_resume_SID;
 #else
 #error AT custom does not match with selected modem
 #endif /* USE_MODEM_GM01Q */
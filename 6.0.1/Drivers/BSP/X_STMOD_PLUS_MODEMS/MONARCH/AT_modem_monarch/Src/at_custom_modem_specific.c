@@ -130,9 +130,92 @@ static void init_dns_info(void);
 
 static at_bool_t init_monarch_low_power(atcustom_modem_context_t *p_modem_ctxt);
 static at_bool_t set_monarch_low_power(atcustom_modem_context_t *p_modem_ctxt);
+static at_bool_t monarch_seq_skip_COPS_write(const atcustom_modem_context_t *p_modem_ctxt);
 
 #define CHECK_STEP(stepval) (p_atp_ctxt->step == stepval)
 
+/* SID sequences: SID whose AT commands sequence is static (see atcm_program_SID_sequence) */
+static const atcm_SID_seq_step_t MONARCH_SEQ_AT[] =
+{
+  /* cmd enum - cmd type - options - skip ftion - prepare ftion */
+  {CMD_AT,             ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_GET_SIGNAL_QUALITY[] =
+{
+  {CMD_AT_CSQ,         ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_CESQ,        ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_GET_ATTACHSTATUS[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_REGISTER_NET[] =
+{
+  {CMD_AT_COPS,        ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_COPS,        ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       monarch_seq_skip_COPS_write, NULL},
+  {CMD_AT_CEREG,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_GET_NETSTATUS[] =
+{
+  {CMD_AT_CEREG,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_COPS,        ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_ATTACH_PS_DOMAIN[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_CGATT_attach},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_DETACH_PS_DOMAIN[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_CGATT_detach},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_ACTIVATE_PDN[] =
+{
+  {CMD_AT_CGACT,       ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_PDN_activate},
+  {CMD_AT_CGPADDR,     ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+#if (USE_SOCKETS_TYPE != USE_SOCKETS_MODEM)
+  {CMD_AT_CGDATA,      ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+#endif /* USE_SOCKETS_TYPE != USE_SOCKETS_MODEM */
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_DEFINE_PDN[] =
+{
+  {CMD_AT_CGDCONT,     ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_CGAUTH,      ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_INVALID,     ATTYPE_NO_CMD,        ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t MONARCH_SEQ_GET_IP_ADDRESS[] =
+{
+  {CMD_AT_CGPADDR,     ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_t MONARCH_SID_SEQ_LUT[] =
+{
+  /* SID - sequence - sequence size */
+  {(at_msg_t) SID_CS_CHECK_CNX,          MONARCH_SEQ_AT,              ATCM_SEQ_STEPS_NB(MONARCH_SEQ_AT)},
+  {(at_msg_t) SID_CS_MODEM_CONFIG,       MONARCH_SEQ_AT,              ATCM_SEQ_STEPS_NB(MONARCH_SEQ_AT)},
+  {
+    (at_msg_t) SID_CS_GET_SIGNAL_QUALITY, MONARCH_SEQ_GET_SIGNAL_QUALITY,
+    ATCM_SEQ_STEPS_NB(MONARCH_SEQ_GET_SIGNAL_QUALITY)
+  },
+  {(at_msg_t) SID_CS_GET_ATTACHSTATUS,   MONARCH_SEQ_GET_ATTACHSTATUS, ATCM_SEQ_STEPS_NB(MONARCH_SEQ_GET_ATTACHSTATUS)},
+  {(at_msg_t) SID_CS_REGISTER_NET,       MONARCH_SEQ_REGISTER_NET,    ATCM_SEQ_STEPS_NB(MONARCH_SEQ_REGISTER_NET)},
+  {(at_msg_t) SID_CS_GET_NETSTATUS,      MONARCH_SEQ_GET_NETSTATUS,   ATCM_SEQ_STEPS_NB(MONARCH_SEQ_GET_NETSTATUS)},
+  {(at_msg_t) SID_ATTACH_PS_DOMAIN,      MONARCH_SEQ_ATTACH_PS_DOMAIN, ATCM_SEQ_STEPS_NB(MONARCH_SEQ_ATTACH_PS_DOMAIN)},
+  {(at_msg_t) SID_DETACH_PS_DOMAIN,      MONARCH_SEQ_DETACH_PS_DOMAIN, ATCM_SEQ_STEPS_NB(MONARCH_SEQ_DETACH_PS_DOMAIN)},
+  {(at_msg_t) SID_CS_ACTIVATE_PDN,       MONARCH_SEQ_ACTIVATE_PDN,    ATCM_SEQ_STEPS_NB(MONARCH_SEQ_ACTIVATE_PDN)},
+  {(at_msg_t) SID_CS_DEFINE_PDN,         MONARCH_SEQ_DEFINE_PDN,      ATCM_SEQ_STEPS_NB(MONARCH_SEQ_DEFINE_PDN)},
+  {(at_msg_t) SID_CS_GET_IP_ADDRESS,     MONARCH_SEQ_GET_IP_ADDRESS,  ATCM_SEQ_STEPS_NB(MONARCH_SEQ_GET_IP_ADDRESS)},
+};
+#define SIZE_MONARCH_SID_SEQ_LUT ((uint32_t) (sizeof (MONARCH_SID_SEQ_LUT) / sizeof (atcm_SID_seq_t)))
+
 /* ###########################  END CUSTOMIZATION PART  ########################### */
 
 /* Functions Definition ------------------------------------------------------*/
@@ -237,8 +320,7 @@ void ATCustom_MONARCH_init(atparser_context_t *p_atp_ctxt)
   monarch_modem_init(&SEQMONARCH_ctxt);
 
   /* ###########################  START CUSTOMIZATION PART  ########################### */
-  SEQMONARCH_ctxt.modem_LUT_size = SIZE_ATCMD_SEQMONARCH_LUT;
-  SEQMONARCH_ctxt.p_modem_LUT = (const atcustom_LUT_t *)ATCMD_SEQMONARCH_LUT;
+  atcm_set_modem_LUT(&SEQMONARCH_ctxt, (const atcustom_LUT_t *)ATCMD_SEQMONARCH_LUT, SIZE_ATCMD_SEQMONARCH_LUT);
 
   /* set default termination char for AT command: <CR> */
   (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->endstr, "\r");
@@ -453,6 +535,12 @@ uint8_t ATCustom_MONARCH_checkEndOfMsgCallback(uint8_t rxChar)
   return (last_char);
 }
 
+uint16_t ATCustom_MONARCH_checkEndOfMsgBlockCallback(const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg)
+{
+  /* same analysis than ATCustom_MONARCH_checkEndOfMsgCallback() applied to each char, done by blocks */
+  return (atcm_checkEndOfMsgBlock(&SEQMONARCH_ctxt, ATCustom_MONARCH_checkEndOfMsgCallback, p_data, size, p_endOfMsg));
+}
+
 at_status_t ATCustom_MONARCH_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout)
 {
   /********************************************************************
@@ -461,6 +549,7 @@ at_status_t ATCustom_MONARCH_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
   at_status_t retval = ATSTATUS_OK;
   atparser_context_t *p_atp_ctxt = &(p_at_ctxt->parser);
   at_msg_t curSID = p_atp_ctxt->current_SID;
+  const atcm_SID_seq_t *p_SID_seq;
 
   PRINT_API("enter ATCustom_MONARCH_getCmd() for SID %d", curSID)
 
@@ -479,30 +568,11 @@ at_status_t ATCustom_MONARCH_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
     */
 
   /* ###########################  START CUSTOMIZATION PART  ########################### */
-  if (curSID == (at_msg_t) SID_CS_CHECK_CNX)
+  p_SID_seq = atcm_get_SID_sequence(MONARCH_SID_SEQ_LUT, SIZE_MONARCH_SID_SEQ_LUT, curSID);
+  if (p_SID_seq != NULL)
   {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_MODEM_CONFIG)
-  {
-    if CHECK_STEP((0U))
-    {
-      /* NOT IMPLEMENTED */
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
+    /* static sequence of AT commands */
+    retval = atcm_program_SID_sequence(&SEQMONARCH_ctxt, p_atp_ctxt, p_SID_seq, p_atp_ctxt->step);
   }
   else if ((curSID == (at_msg_t) SID_CS_POWER_ON) ||
            (curSID == (at_msg_t) SID_CS_RESET))
@@ -780,85 +850,6 @@ at_status_t ATCustom_MONARCH_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
       retval = ATSTATUS_ERROR;
     }
   }
-  else if (curSID == (at_msg_t) SID_CS_GET_SIGNAL_QUALITY)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_CSQ, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_CESQ, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_GET_ATTACHSTATUS)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_REGISTER_NET)
-  {
-    if CHECK_STEP((0U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_COPS, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* check if actual registration status is the expected one */
-      const CS_OperatorSelector_t *operatorSelect = &(SEQMONARCH_ctxt.SID_ctxt.write_operator_infos);
-      if (SEQMONARCH_ctxt.SID_ctxt.read_operator_infos.mode != operatorSelect->mode)
-      {
-        /* write registration status */
-        atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_COPS, INTERMEDIATE_CMD);
-      }
-      else
-      {
-        /* skip this step */
-        atcm_program_SKIP_CMD(p_atp_ctxt);
-      }
-    }
-    else if CHECK_STEP((2U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CEREG, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_GET_NETSTATUS)
-  {
-    if CHECK_STEP((0U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CEREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_COPS, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
   else if (curSID == (at_msg_t) SID_CS_SUSBCRIBE_NET_EVENT)
   {
     if CHECK_STEP((0U))
@@ -959,109 +950,16 @@ at_status_t ATCustom_MONARCH_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
       retval = ATSTATUS_ERROR;
     }
   }
-  else if (curSID == (at_msg_t) SID_ATTACH_PS_DOMAIN)
-  {
-    if CHECK_STEP((0U))
-    {
-      SEQMONARCH_ctxt.CMD_ctxt.cgatt_write_cmd_param = CGATT_ATTACHED;
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_DETACH_PS_DOMAIN)
-  {
-    if CHECK_STEP((0U))
-    {
-      SEQMONARCH_ctxt.CMD_ctxt.cgatt_write_cmd_param = CGATT_DETACHED;
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_ACTIVATE_PDN)
-  {
-#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-    if CHECK_STEP((0U))
-    {
-      /* PDN activation */
-      SEQMONARCH_ctxt.CMD_ctxt.pdn_state = PDN_STATE_ACTIVATE;
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGACT, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* get IP address */
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGPADDR, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#else
-    if CHECK_STEP((0U))
-    {
-      /* PDN activation */
-      SEQMONARCH_ctxt.CMD_ctxt.pdn_state = PDN_STATE_ACTIVATE;
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGACT, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* get IP address */
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGPADDR, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((2U))
-    {
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGDATA, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#endif /* USE_SOCKETS_TYPE */
-  }
   else if (curSID == (at_msg_t) SID_CS_DEACTIVATE_PDN)
   {
     /* not implemented yet */
     retval = ATSTATUS_ERROR;
   }
-  else if (curSID == (at_msg_t) SID_CS_DEFINE_PDN)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGDCONT, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGAUTH, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((2U))
-    {
-      /* nothing to do here */
-      atcm_program_NO_MORE_CMD(p_atp_ctxt);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
   else if (curSID == (at_msg_t) SID_CS_SET_DEFAULT_PDN)
   {
     /* nothing to do here */
     atcm_program_NO_MORE_CMD(p_atp_ctxt);
   }
-  else if (curSID == (at_msg_t) SID_CS_GET_IP_ADDRESS)
-  {
-    atcm_program_AT_CMD(&SEQMONARCH_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGPADDR, FINAL_CMD);
-  }
   else if (curSID == (at_msg_t) SID_CS_DIAL_COMMAND)
   {
     /* SOCKET CONNECTION FOR COMMAND DATA MODE */
@@ -1654,7 +1552,12 @@ at_action_rsp_t ATCustom_MONARCH_analyzeCmd(at_context_t *p_at_ctxt,
   }
   else
   {
-    /* cmd_id has been found in the LUT: determine next action */
+    /* cmd_id has been found in the LUT: if several commands are sent on the same line,
+     * the answer is analyzed as the answer of the matching command
+     */
+    atcm_select_concat_cmd(p_atp_ctxt, element_infos->cmd_id_received);
+
+    /* determine next action */
     switch (element_infos->cmd_id_received)
     {
       case CMD_AT_OK:
@@ -2065,6 +1968,37 @@ at_status_t ATCustom_MONARCH_hw_event(sysctrl_device_type_t deviceType, at_hw_ev
   return (retval);
 }
 
+at_status_t ATCustom_MONARCH_suspend_SID(atparser_context_t *p_atp_ctxt)
+{
+  at_status_t retval = ATSTATUS_ERROR;
+  PRINT_API("enter ATCustom_MONARCH_suspend_SID()")
+
+  /* ###########################  START CUSTOMIZATION PART  ########################### */
+  /* the SIDs of this modem which can be suspended do not use its specific variables */
+  if (atcm_SID_can_be_suspended(p_atp_ctxt->current_SID) == AT_TRUE)
+  {
+    retval = ATSTATUS_OK;
+  }
+  /* ###########################  END CUSTOMIZATION PART  ########################### */
+
+  if (retval == ATSTATUS_OK)
+  {
+    /* save the SID contexts - common part */
+    atcm_suspend_SID_context(&SEQMONARCH_ctxt);
+  }
+
+  return (retval);
+}
+
+void ATCustom_MONARCH_resume_SID(atparser_context_t *p_atp_ctxt)
+{
+  UNUSED(p_atp_ctxt);
+  PRINT_API("enter ATCustom_MONARCH_resume_SID()")
+
+  /* restore the SID contexts - common part */
+  atcm_resume_SID_context(&SEQMONARCH_ctxt);
+}
+
 /* Private function Definition -----------------------------------------------*/
 
 /* MONARCH modem init function
@@ -2349,6 +2283,24 @@ static at_bool_t set_monarch_low_power(atcustom_modem_context_t *p_modem_ctxt)
   return (lp_set_and_enabled);
 }
 
+/**
+  * @brief  SID sequence skip function: AT+COPS write command is skipped if actual registration mode is the
+  *         expected one
+  * @param  p_modem_ctxt
+  * @retval at_bool_t AT_TRUE if the command has to be skipped
+  */
+static at_bool_t monarch_seq_skip_COPS_write(const atcustom_modem_context_t *p_modem_ctxt)
+{
+  at_bool_t retval = AT_FALSE;
+
+  if (p_modem_ctxt->SID_ctxt.read_operator_infos.mode == p_modem_ctxt->SID_ctxt.write_operator_infos.mode)
+  {
+    retval = AT_TRUE;
+  }
+
+  return (retval);
+}
+
 /* ###########################  END CUSTOMIZATION PART  ########################### */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -150,6 +150,7 @@ extern type1sc_shared_variables_t type1sc_shared;
 /* Exported functions ------------------------------------------------------- */
 void        ATCustom_TYPE1SC_init(atparser_context_t *p_atp_ctxt);
 uint8_t     ATCustom_TYPE1SC_checkEndOfMsgCallback(uint8_t rxChar);
+uint16_t    ATCustom_TYPE1SC_checkEndOfMsgBlockCallback(const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg);
 at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t ATCustom_TYPE1SC_extractElement(atparser_context_t *p_atp_ctxt,
                                             const IPC_RxMessage_t *p_msg_in,
@@ -166,6 +167,8 @@ at_status_t ATCustom_TYPE1SC_get_rsp(atparser_context_t *p_atp_ctxt, at_buf_t *p
 at_status_t ATCustom_TYPE1SC_get_urc(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_TYPE1SC_get_error(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATCustom_TYPE1SC_hw_event(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+at_status_t ATCustom_TYPE1SC_suspend_SID(atparser_context_t *p_atp_ctxt);
+void ATCustom_TYPE1SC_resume_SID(atparser_context_t *p_atp_ctxt);
 
 #ifdef __cplusplus
 }
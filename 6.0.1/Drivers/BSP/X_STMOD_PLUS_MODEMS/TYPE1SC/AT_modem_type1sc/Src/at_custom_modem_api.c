@@ -44,6 +44,7 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   /* init function pointers with TYPE1SC functions */
   funcPtrs->f_init = ATCustom_TYPE1SC_init;
   funcPtrs->f_checkEndOfMsgCallback = ATCustom_TYPE1SC_checkEndOfMsgCallback;
+  funcPtrs->f_checkEndOfMsgBlockCallback = ATCustom_TYPE1SC_checkEndOfMsgBlockCallback;
   funcPtrs->f_getCmd = ATCustom_TYPE1SC_getCmd;
   funcPtrs->f_extractElement = ATCustom_TYPE1SC_extractElement;
   funcPtrs->f_analyzeCmd = ATCustom_TYPE1SC_analyzeCmd;
@@ -53,6 +54,8 @@ void atcma_init_at_func_ptrs(atcustom_funcPtrs_t *funcPtrs)
   funcPtrs->f_get_urc = ATCustom_TYPE1SC_get_urc;
   funcPtrs->f_get_error = ATCustom_TYPE1SC_get_error;
   funcPtrs->f_hw_event = ATCustom_TYPE1SC_hw_event;
+  funcPtrs->f_suspend_SID = ATCustom_TYPE1SC_suspend_SID;
+  funcPtrs->f_resume_SID = ATCustom_TYPE1SC_resume_SID;
 #else
 #error AT custom does not match with selected modem
 #endif /* USE_MODEM_TYPE1SC */
@@ -132,6 +132,88 @@ static void type1sc_modem_reset(atcustom_modem_context_t *p_modem_ctxt);
 static at_bool_t init_type1sc_low_power(atcustom_modem_context_t *p_modem_ctxt);
 static at_bool_t set_type1sc_low_power(atcustom_modem_context_t *p_modem_ctxt);
 static void low_power_event(ATCustom_T1SC_LP_event_t event, bool called_under_it);
+static at_bool_t type1sc_seq_skip_COPS_write(const atcustom_modem_context_t *p_modem_ctxt);
+
+/* SID sequences: SID whose AT commands sequence is static (see atcm_program_SID_sequence) */
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_AT[] =
+{
+  /* cmd enum - cmd type - options - skip ftion - prepare ftion */
+  {CMD_AT,             ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_GET_SIGNAL_QUALITY[] =
+{
+  {CMD_AT_CSQ,         ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_GET_ATTACHSTATUS[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_REGISTER_NET[] =
+{
+  {CMD_AT_COPS,        ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_COPS,        ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       type1sc_seq_skip_COPS_write, NULL},
+  {CMD_AT_CEREG,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_GET_NETSTATUS[] =
+{
+  {CMD_AT_CEREG,       ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_CREG,        ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_AT_CEER,        ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL}, /* read extended error report */
+  {CMD_AT_COPS,        ATTYPE_READ_CMD,      ATCM_SEQ_NONE,       NULL, NULL},
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_ATTACH_PS_DOMAIN[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_CGATT_attach},
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_DETACH_PS_DOMAIN[] =
+{
+  {CMD_AT_CGATT,       ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_CGATT_detach},
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_ACTIVATE_PDN[] =
+{
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  /* SOCKET MODE */
+  {CMD_AT_PDNACT,      ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, atcm_seq_prepare_PDN_activate},
+#else
+  /* DATA MODE */
+  {CMD_AT_CGPADDR,     ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+  {CMD_ATD,            ATTYPE_EXECUTION_CMD, ATCM_SEQ_NONE,       NULL, NULL},
+#endif /* USE_SOCKETS_TYPE */
+};
+
+static const atcm_SID_seq_step_t TYPE1SC_SEQ_GET_IP_ADDRESS[] =
+{
+  {CMD_AT_CGPADDR,     ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  {CMD_AT_PDNRDP,      ATTYPE_WRITE_CMD,     ATCM_SEQ_NONE,       NULL, NULL},
+#endif /* USE_SOCKETS_TYPE */
+};
+
+static const atcm_SID_seq_t TYPE1SC_SID_SEQ_LUT[] =
+{
+  /* SID - sequence - sequence size */
+  {(at_msg_t) SID_CS_CHECK_CNX,          TYPE1SC_SEQ_AT,              ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_AT)},
+  {(at_msg_t) SID_CS_MODEM_CONFIG,       TYPE1SC_SEQ_AT,              ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_AT)},
+  {
+    (at_msg_t) SID_CS_GET_SIGNAL_QUALITY, TYPE1SC_SEQ_GET_SIGNAL_QUALITY,
+    ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_GET_SIGNAL_QUALITY)
+  },
+  {(at_msg_t) SID_CS_GET_ATTACHSTATUS,   TYPE1SC_SEQ_GET_ATTACHSTATUS, ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_GET_ATTACHSTATUS)},
+  {(at_msg_t) SID_CS_REGISTER_NET,       TYPE1SC_SEQ_REGISTER_NET,    ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_REGISTER_NET)},
+  {(at_msg_t) SID_CS_GET_NETSTATUS,      TYPE1SC_SEQ_GET_NETSTATUS,   ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_GET_NETSTATUS)},
+  {(at_msg_t) SID_ATTACH_PS_DOMAIN,      TYPE1SC_SEQ_ATTACH_PS_DOMAIN, ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_ATTACH_PS_DOMAIN)},
+  {(at_msg_t) SID_DETACH_PS_DOMAIN,      TYPE1SC_SEQ_DETACH_PS_DOMAIN, ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_DETACH_PS_DOMAIN)},
+  {(at_msg_t) SID_CS_ACTIVATE_PDN,       TYPE1SC_SEQ_ACTIVATE_PDN,    ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_ACTIVATE_PDN)},
+  {(at_msg_t) SID_CS_GET_IP_ADDRESS,     TYPE1SC_SEQ_GET_IP_ADDRESS,  ATCM_SEQ_STEPS_NB(TYPE1SC_SEQ_GET_IP_ADDRESS)},
+};
+#define SIZE_TYPE1SC_SID_SEQ_LUT ((uint32_t) (sizeof (TYPE1SC_SID_SEQ_LUT) / sizeof (atcm_SID_seq_t)))
 
 /* Functions Definition ------------------------------------------------------*/
 void ATCustom_TYPE1SC_init(atparser_context_t *p_atp_ctxt)
@@ -264,8 +346,7 @@ void ATCustom_TYPE1SC_init(atparser_context_t *p_atp_ctxt)
   type1sc_modem_init(&TYPE1SC_ctxt);
 
   /* ###########################  START CUSTOMIZATION PART  ########################### */
-  TYPE1SC_ctxt.modem_LUT_size = SIZE_ATCMD_TYPE1SC_LUT;
-  TYPE1SC_ctxt.p_modem_LUT = (const atcustom_LUT_t *)ATCMD_TYPE1SC_LUT;
+  atcm_set_modem_LUT(&TYPE1SC_ctxt, (const atcustom_LUT_t *)ATCMD_TYPE1SC_LUT, SIZE_ATCMD_TYPE1SC_LUT);
 
   /* override default termination string for AT command: <CR> */
   (void) sprintf((CRC_CHAR_t *)p_atp_ctxt->endstr, "\r");
@@ -354,11 +435,18 @@ uint8_t ATCustom_TYPE1SC_checkEndOfMsgCallback(uint8_t rxChar)
   return (last_char);
 }
 
+uint16_t ATCustom_TYPE1SC_checkEndOfMsgBlockCallback(const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg)
+{
+  /* same analysis than ATCustom_TYPE1SC_checkEndOfMsgCallback() applied to each char, done by blocks */
+  return (atcm_checkEndOfMsgBlock(&TYPE1SC_ctxt, ATCustom_TYPE1SC_checkEndOfMsgCallback, p_data, size, p_endOfMsg));
+}
+
 at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout)
 {
   at_status_t retval = ATSTATUS_OK;
   atparser_context_t *p_atp_ctxt = &(p_at_ctxt->parser);
   at_msg_t curSID = p_atp_ctxt->current_SID;
+  const atcm_SID_seq_t *p_SID_seq;
 
   PRINT_API("enter ATCustom_TYPE1SC_getCmd() for SID %d", curSID)
 
@@ -377,29 +465,11 @@ at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
   */
 
   /* ###########################  START CUSTOMIZATION PART  ########################### */
-  if (curSID == (at_msg_t) SID_CS_CHECK_CNX)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_MODEM_CONFIG)
+  p_SID_seq = atcm_get_SID_sequence(TYPE1SC_SID_SEQ_LUT, SIZE_TYPE1SC_SID_SEQ_LUT, curSID);
+  if (p_SID_seq != NULL)
   {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
+    /* static sequence of AT commands */
+    retval = atcm_program_SID_sequence(&TYPE1SC_ctxt, p_atp_ctxt, p_SID_seq, p_atp_ctxt->step);
   }
   else if ((curSID == (at_msg_t) SID_CS_POWER_ON) ||
            (curSID == (at_msg_t) SID_CS_RESET))
@@ -838,94 +908,6 @@ at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
       retval = ATSTATUS_ERROR;
     }
   }
-  else if (curSID == (at_msg_t) SID_CS_GET_SIGNAL_QUALITY)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_AT_CSQ, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_GET_ATTACHSTATUS)
-  {
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_REGISTER_NET)
-  {
-    if CHECK_STEP((0U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_COPS, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* check if actual registration status is the expected one or if AcT is explicitly specified */
-      CS_OperatorSelector_t *operatorSelect = &(TYPE1SC_ctxt.SID_ctxt.write_operator_infos);
-      if ((TYPE1SC_ctxt.SID_ctxt.read_operator_infos.mode != operatorSelect->mode) ||
-          (operatorSelect->AcT_present == CELLULAR_TRUE))
-      {
-        /* write registration status */
-        atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_COPS, INTERMEDIATE_CMD);
-      }
-      else
-      {
-        /* skip this step
-          * allow the modem to re-use the last cell that has been found.
-          */
-        atcm_program_SKIP_CMD(p_atp_ctxt);
-      }
-    }
-    else if CHECK_STEP((2U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CEREG, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_GET_NETSTATUS)
-  {
-    if CHECK_STEP((0U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CEREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CREG, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((2U))
-    {
-      /* read extended error report */
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_CEER, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((3U))
-    {
-      /* read registration status */
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_READ_CMD, (CMD_ID_t) CMD_AT_COPS, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
   else if (curSID == (at_msg_t) SID_CS_SUSBCRIBE_NET_EVENT)
   {
     if CHECK_STEP((0U))
@@ -1042,65 +1024,6 @@ at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
       retval = ATSTATUS_ERROR;
     }
   }
-  else if (curSID == (at_msg_t) SID_ATTACH_PS_DOMAIN)
-  {
-    if CHECK_STEP((0U))
-    {
-      TYPE1SC_ctxt.CMD_ctxt.cgatt_write_cmd_param = CGATT_ATTACHED;
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_DETACH_PS_DOMAIN)
-  {
-    if CHECK_STEP((0U))
-    {
-      TYPE1SC_ctxt.CMD_ctxt.cgatt_write_cmd_param = CGATT_DETACHED;
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGATT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-  }
-  else if (curSID == (at_msg_t) SID_CS_ACTIVATE_PDN)
-  {
-#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-    /* SOCKET MODE */
-    if CHECK_STEP((0U))
-    {
-      /* PDN activation */
-      TYPE1SC_ctxt.CMD_ctxt.pdn_state = PDN_STATE_ACTIVATE;
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_PDNACT, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#else
-    /* DATA MODE */
-    if CHECK_STEP((0U))
-    {
-      /* get IP address */
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGPADDR, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_EXECUTION_CMD, (CMD_ID_t) CMD_ATD, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#endif /* USE_SOCKETS_TYPE */
-  }
   else if (curSID == (at_msg_t) SID_CS_DEACTIVATE_PDN)
   {
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
@@ -1154,36 +1077,6 @@ at_status_t ATCustom_TYPE1SC_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTi
       */
     atcm_program_NO_MORE_CMD(p_atp_ctxt);
   }
-  else if (curSID == (at_msg_t) SID_CS_GET_IP_ADDRESS)
-  {
-    /* get IP address */
-#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGPADDR, INTERMEDIATE_CMD);
-    }
-    else if CHECK_STEP((1U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_PDNRDP, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#else
-    /* DATA MODE*/
-    if CHECK_STEP((0U))
-    {
-      atcm_program_AT_CMD(&TYPE1SC_ctxt, p_atp_ctxt, ATTYPE_WRITE_CMD, (CMD_ID_t) CMD_AT_CGPADDR, FINAL_CMD);
-    }
-    else
-    {
-      /* error, invalid step */
-      retval = ATSTATUS_ERROR;
-    }
-#endif /* USE_SOCKETS_TYPE */
-  }
   else if (curSID == (at_msg_t) SID_CS_DIAL_COMMAND)
   {
     if CHECK_STEP((0U))
@@ -1756,7 +1649,12 @@ at_action_rsp_t ATCustom_TYPE1SC_analyzeCmd(at_context_t *p_at_ctxt,
   }
   else
   {
-    /* cmd_id has been found in the LUT: determine next action */
+    /* cmd_id has been found in the LUT: if several commands are sent on the same line,
+     * the answer is analyzed as the answer of the matching command
+     */
+    atcm_select_concat_cmd(p_atp_ctxt, element_infos->cmd_id_received);
+
+    /* determine next action */
     switch (element_infos->cmd_id_received)
     {
       case CMD_AT_OK:
@@ -2133,6 +2031,37 @@ at_status_t ATCustom_TYPE1SC_hw_event(sysctrl_device_type_t deviceType, at_hw_ev
   return (retval);
 }
 
+at_status_t ATCustom_TYPE1SC_suspend_SID(atparser_context_t *p_atp_ctxt)
+{
+  at_status_t retval = ATSTATUS_ERROR;
+  PRINT_API("enter ATCustom_TYPE1SC_suspend_SID()")
+
+  /* ###########################  START CUSTOMIZATION PART  ########################### */
+  /* the SIDs of this modem which can be suspended do not use its specific variables */
+  if (atcm_SID_can_be_suspended(p_atp_ctxt->current_SID) == AT_TRUE)
+  {
+    retval = ATSTATUS_OK;
+  }
+  /* ###########################  END CUSTOMIZATION PART  ########################### */
+
+  if (retval == ATSTATUS_OK)
+  {
+    /* save the SID contexts - common part */
+    atcm_suspend_SID_context(&TYPE1SC_ctxt);
+  }
+
+  return (retval);
+}
+
+void ATCustom_TYPE1SC_resume_SID(atparser_context_t *p_atp_ctxt)
+{
+  UNUSED(p_atp_ctxt);
+  PRINT_API("enter ATCustom_TYPE1SC_resume_SID()")
+
+  /* restore the SID contexts - common part */
+  atcm_resume_SID_context(&TYPE1SC_ctxt);
+}
+
 /* Private function Definition -----------------------------------------------*/
 static void reinitSyntaxAutomaton_TYPE1SC(void)
 {
@@ -2405,5 +2334,26 @@ static void low_power_event(ATCustom_T1SC_LP_event_t event, bool called_under_it
     }
   }
 }
+
+/**
+  * @brief  SID sequence skip function: AT+COPS write command is skipped if actual registration mode is the
+  *         expected one and AcT is not explicitly specified (allow the modem to re-use the last cell found)
+  * @param  p_modem_ctxt
+  * @retval at_bool_t AT_TRUE if the command has to be skipped
+  */
+static at_bool_t type1sc_seq_skip_COPS_write(const atcustom_modem_context_t *p_modem_ctxt)
+{
+  at_bool_t retval = AT_FALSE;
+  const CS_OperatorSelector_t *operatorSelect = &(p_modem_ctxt->SID_ctxt.write_operator_infos);
+
+  if ((p_modem_ctxt->SID_ctxt.read_operator_infos.mode == operatorSelect->mode) &&
+      (operatorSelect->AcT_present != CELLULAR_TRUE))
+  {
+    retval = AT_TRUE;
+  }
+
+  return (retval);
+}
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -40,6 +40,8 @@ extern "C" {
 #else
 #define ATCMD_MAX_CMD_SIZE   ((uint16_t) 128U)
 #endif /* USE_SOCKETS_TYPE */
+/* max number of AT commands sent on the same command line */
+#define ATCMD_MAX_CONCAT_NB  ((uint8_t) 4U)
 
 /* LowPower, and especially PSM, is currently not supported with LwIP due to unpredictable modem behavior.
  * PSM is supported with Socket mode only. */
@@ -132,12 +134,41 @@ typedef struct
   uint8_t      name[ATCMD_MAX_NAME_SIZE];
   uint8_t      params[ATCMD_MAX_CMD_SIZE];
   uint32_t     raw_cmd_size;                   /* raw_cmd_size is used only for raw commands */
+  uint8_t      concat_nb;                      /* nbr of commands sent on the same line (0 if not concatenated) */
+  at_type_t    concat_type[ATCMD_MAX_CONCAT_NB]; /* type of each command of the line (first one is the main cmd) */
+  uint32_t     concat_id[ATCMD_MAX_CONCAT_NB];   /* id of each command of the line (first one is the main cmd) */
 } atcmd_desc_t;
 
 typedef uint16_t at_msg_t;
 typedef int16_t at_handle_t;
 typedef uint8_t  at_buf_t;
 typedef void (* urc_callback_t)(at_buf_t *p_rsp_buf);
+/* completion callback of an asynchronous request (called by ATCore task, see AT_sendcmd_async) */
+typedef void (* at_req_callback_t)(at_msg_t msg_id, at_status_t status, at_buf_t *p_rsp_buf, void *p_cb_ctx);
+
+/* statistics of AT messages reception (to tune USE_AT_CORE_RX_BATCH) */
+typedef struct
+{
+  uint32_t wakeup_nb;          /* number of ATCore task wake-ups to parse received messages */
+  uint32_t msg_nb;             /* number of received messages parsed */
+  uint32_t max_msg_per_wakeup; /* maximum number of messages parsed in one wake-up */
+} at_rx_stats_t;
+
+/* statistics of AT messages transmission (number of AT exchanges with the modem) */
+typedef struct
+{
+  uint32_t cmd_nb;             /* number of AT commands and data buffers sent to the modem */
+} at_tx_stats_t;
+
+/* step boundary of an AT transaction: between the answer of a command and the next command of the same SID */
+typedef enum
+{
+  ATSTEP_CHECK_YIELD = 0, /* step callback returns true if the transaction lets other transactions run */
+  ATSTEP_YIELD,           /* transaction suspended: step callback returns when it can be resumed */
+} at_step_event_t;
+/* step callback (ATSTEP_CHECK_YIELD called by ATCore task, ATSTEP_YIELD by the client thread of the transaction,
+ * see AT_set_step_callback) */
+typedef bool (* at_step_callback_t)(at_msg_t msg_id, at_step_event_t event);
 
 typedef uint16_t at_hw_event_t;
 #define HWEVT_UNKNOWN            ((at_hw_event_t) 0U)  /* unknown HW event */
@@ -152,9 +183,14 @@ at_status_t  AT_init(void);
 at_handle_t  AT_open(sysctrl_info_t *p_device_infos, urc_callback_t urc_callback);
 at_status_t  AT_reset_context(at_handle_t athandle);
 at_status_t  AT_sendcmd(at_handle_t athandle, at_msg_t msg_in_id, at_buf_t *p_cmd_in_buf, at_buf_t *p_rsp_buf);
+at_status_t  AT_sendcmd_async(at_handle_t athandle, at_msg_t msg_in_id, at_buf_t *p_cmd_in_buf, at_buf_t *p_rsp_buf,
+                              at_req_callback_t req_callback, void *p_cb_ctx);
 at_status_t  AT_open_channel(at_handle_t athandle);
 at_status_t  AT_close_channel(at_handle_t athandle);
 void         AT_internalEvent(sysctrl_device_type_t deviceType);
+void         AT_get_rx_stats(at_rx_stats_t *p_stats);
+void         AT_get_tx_stats(at_tx_stats_t *p_stats);
+void         AT_set_step_callback(at_step_callback_t step_callback);
 at_status_t  atcore_task_start(osPriority taskPrio, uint16_t stackSize);
 
 #ifdef __cplusplus
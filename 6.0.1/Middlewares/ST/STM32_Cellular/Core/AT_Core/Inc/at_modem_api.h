@@ -43,6 +43,8 @@ typedef enum
 
 typedef void (*ATC_initTypeDef)(atparser_context_t *p_atp_ctxt);
 typedef uint8_t (*ATC_checkEndOfMsgCallbackTypeDef)(uint8_t rxChar);
+typedef uint16_t (*ATC_checkEndOfMsgBlockCallbackTypeDef)(const uint8_t *p_data, uint16_t size,
+                                                          uint8_t *p_endOfMsg);
 typedef at_status_t (*ATC_getCmdTypeDef)(at_context_t *p_at_ctxt,
                                          uint32_t *p_ATcmdTimeout);
 typedef at_endmsg_t (*ATC_extractElementTypeDef)(atparser_context_t *p_atp_ctxt,
@@ -59,12 +61,15 @@ typedef at_status_t (*ATC_get_rsp)(atparser_context_t *p_atp_ctxt, at_buf_t *p_r
 typedef at_status_t (*ATC_get_urc)(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 typedef at_status_t (*ATC_get_error)(atparser_context_t *p_atp_ctxt, at_buf_t *p_rsp_buf);
 typedef at_status_t (*ATC_hw_event)(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+typedef at_status_t (*ATC_suspend_SID)(atparser_context_t *p_atp_ctxt);
+typedef void (*ATC_resume_SID)(atparser_context_t *p_atp_ctxt);
 
 typedef struct
 {
   uint8_t                            initialized;
   ATC_initTypeDef                    f_init;
   ATC_checkEndOfMsgCallbackTypeDef   f_checkEndOfMsgCallback;
+  ATC_checkEndOfMsgBlockCallbackTypeDef f_checkEndOfMsgBlockCallback;
   ATC_getCmdTypeDef                  f_getCmd;
   ATC_extractElementTypeDef          f_extractElement;
   ATC_analyzeCmdTypeDef              f_analyzeCmd;
@@ -74,6 +79,8 @@ typedef struct
   ATC_get_urc                        f_get_urc;
   ATC_get_error                      f_get_error;
   ATC_hw_event                       f_hw_event;
+  ATC_suspend_SID                    f_suspend_SID;  /* NULL if the modem does not support SID suspension */
+  ATC_resume_SID                     f_resume_SID;
 
 } atcustom_funcPtrs_t;
 
@@ -85,6 +92,7 @@ typedef struct
 at_status_t atcc_initParsers(sysctrl_device_type_t device_type);
 void atcc_init(at_context_t *p_at_ctxt);
 ATC_checkEndOfMsgCallbackTypeDef atcc_checkEndOfMsgCallback(const at_context_t *p_at_ctxt);
+ATC_checkEndOfMsgBlockCallbackTypeDef atcc_checkEndOfMsgBlockCallback(const at_context_t *p_at_ctxt);
 at_status_t atcc_getCmd(at_context_t *p_at_ctxt, uint32_t *p_ATcmdTimeout);
 at_endmsg_t atcc_extractElement(at_context_t *p_at_ctxt,
                                 const IPC_RxMessage_t *p_msg_in,
@@ -100,6 +108,8 @@ at_status_t atcc_get_rsp(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t atcc_get_urc(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t atcc_get_error(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 void atcc_hw_event(sysctrl_device_type_t deviceType, at_hw_event_t hwEvent, GPIO_PinState gstate);
+at_status_t atcc_suspend_SID(at_context_t *p_at_ctxt);
+void atcc_resume_SID(at_context_t *p_at_ctxt);
 
 #ifdef __cplusplus
 }
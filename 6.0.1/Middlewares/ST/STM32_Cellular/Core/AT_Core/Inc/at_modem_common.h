@@ -39,6 +39,40 @@ extern "C" {
 #define MODEM_PDP_MAX_APN_SIZE     ((uint32_t) 64U)
 #define MODEM_MAX_NB_PDP_CTXT      ((uint8_t) CS_PDN_CONFIG_MAX + 1U) /* max. nbr of local PDP context configs */
 
+/* modem LUT indexes (built when the LUT is registered, see atcm_set_modem_LUT)
+ * The indexes are computed at modem init in the modem context (RAM: 1 + MODEM_LUT_MAX_CMD_ID + MODEM_LUT_HASH_SIZE
+ * + MODEM_LUT_MAX_SIZE = 513 bytes) instead of being generated as const tables at build time: the modem LUTs are
+ * C initializers of each driver and the project has no code generation step.
+ */
+#define MODEM_LUT_MAX_SIZE         (128U)            /* max. nbr of LUT entries indexed */
+#define MODEM_LUT_MAX_CMD_ID       ((uint16_t) 128U) /* cmd_id above this value are searched linearly */
+#define MODEM_LUT_HASH_SIZE        ((uint16_t) 256U) /* size of the cmd string hash table (power of 2) */
+#define MODEM_LUT_INDEX_NONE       ((uint8_t) 0xFFU)  /* no entry in the indexes */
+#define MODEM_LUT_ENTRY_NONE       ((uint16_t) 0xFFFFU) /* no entry in the LUT (LUT not indexed: any size) */
+
+/* LUT entries are stored on 8 bits in the indexes */
+#if (MODEM_LUT_MAX_SIZE >= 0xFFU)
+#error "MODEM_LUT_MAX_SIZE must be lower than MODEM_LUT_INDEX_NONE"
+#endif /* (MODEM_LUT_MAX_SIZE >= 0xFFU) */
+
+/* modem configuration cache (see atcm_cfg_cache_PDN_is_committed): one item per PDN configuration */
+#define MODEM_CFG_CACHE_NB_ITEMS   ((uint8_t) MODEM_MAX_NB_PDP_CTXT)
+#if !defined(MODEM_CFG_CACHE_SECTION)
+/* default: cache in standard RAM, kept while the MCU is running (modem reboot, PSM...) but lost on MCU reset
+ * can be overwritten in plf_sw_config.h with a no-init RAM section to keep the cache over MCU reset
+ */
+#define MODEM_CFG_CACHE_SECTION
+#endif /* MODEM_CFG_CACHE_SECTION */
+/* MODEM_CFG_CACHE_RTC_BKP_FIRST (plf_sw_config.h): cache also saved in the RTC backup registers
+ * MODEM_CFG_CACHE_RTC_BKP_FIRST to MODEM_CFG_CACHE_RTC_BKP_FIRST + MODEM_CFG_CACHE_NB_ITEMS + 2
+ * of MODEM_CFG_CACHE_RTC_HANDLE (plf_hw_config.h), ignored if these registers do not exist
+ */
+
+/* SID sequence step options */
+#define ATCM_SEQ_NONE              ((uint8_t) 0x00U) /* answer mandatory, command sent alone on its line */
+#define ATCM_SEQ_ANSWER_OPT        ((uint8_t) 0x01U) /* no error raised if no answer received */
+#define ATCM_SEQ_CONCAT            ((uint8_t) 0x02U) /* command sent on the same line as the previous step command */
+
 /* Exported types ------------------------------------------------------------*/
 typedef enum
 {
@@ -205,6 +239,7 @@ typedef struct
 
   uint8_t                flowCtrl_RTS;       /* is RTS flow control activated ? (from AT+IFC) */
   uint8_t                flowCtrl_CTS;       /* is CTS flow control activated ? (from AT+IFC) */
+  CS_CHAR_t              imei[MAX_SIZE_IMEI]; /* modem IMEI (from AT+GSN), empty string if not read yet */
 
   /* Ping infos:
    * Some modems are receiving ping responses as URC after the end of the ping command and some modems are receiving
@@ -296,10 +331,33 @@ typedef struct
 
 } atcustom_SOCKET_context_t;
 
+typedef struct
+{
+  uint8_t  indexed;                               /* 1 if indexes below are valid */
+  uint8_t  idx_by_cmd_id[MODEM_LUT_MAX_CMD_ID];   /* LUT entry for each cmd_id */
+  uint8_t  idx_by_str_hash[MODEM_LUT_HASH_SIZE];  /* LUT entry for each cmd string (open addressing) */
+  uint8_t  str_len[MODEM_LUT_MAX_SIZE];           /* length of cmd string of each LUT entry */
+} atcustom_LUT_index_t;
+
+/* steps of a command line made of concatenated commands (see atcm_concat_line_programmed) */
+typedef struct
+{
+  at_msg_t  sid;         /* SID of the line, SID_INVALID if none */
+  uint8_t   first_step;  /* parser step of the first command of the line */
+  uint8_t   last_step;   /* parser step of the last command of the line */
+} atcustom_concat_steps_t;
+
+typedef struct
+{
+  atcustom_concat_steps_t  line;    /* steps of the line sent, they are replayed if the line answers an error */
+  atcustom_concat_steps_t  replay;  /* steps sent one command per line until the end of the SID */
+} atcustom_concat_context_t;
+
 typedef struct
 {
   uint32_t                           modem_LUT_size;
   const struct atcustom_LUT_struct   *p_modem_LUT;
+  atcustom_LUT_index_t               LUT_index;
 
   /* received command syntax analysis: state of automaton which analyzes cmd syntax */
   atcustom_modem_SyntaxAutomatonState_t   state_SyntaxAutomaton;
@@ -316,6 +374,9 @@ typedef struct
   /* SOCKET context */
   atcustom_SOCKET_context_t           socket_ctxt;
 
+  /* concatenated commands context */
+  atcustom_concat_context_t           concat_ctxt;
+
 } atcustom_modem_context_t;
 
 typedef at_status_t (*CmdBuildFuncTypeDef)(atparser_context_t  *p_atp_ctxt,
@@ -342,11 +403,42 @@ typedef struct atcustom_LUT_struct
   CmdAnalyzeFuncTypeDef rsp_AnalyzeFunc;
 } atcustom_LUT_t;
 
+/* SID sequence description: const list of the AT commands to send for a SID.
+ * Step N of the SID programs entry N of the sequence, the last entry is the final command.
+ * Entries with ATCM_SEQ_CONCAT option are sent on the command line of the previous entry and consume their step:
+ * they must not depend on the answer of the previous commands nor share command parameters with them.
+ * If the line answers an error, its entries are sent again one per line (see atcm_concat_line_error).
+ */
+typedef at_bool_t (*SeqSkipFuncTypeDef)(const atcustom_modem_context_t *p_modem_ctxt);
+typedef void (*SeqPrepareFuncTypeDef)(atcustom_modem_context_t *p_modem_ctxt);
+
+struct atcm_SID_seq_step_struct;
+typedef struct atcm_SID_seq_step_struct
+{
+  uint32_t              cmd_id;          /* command to send (not used if cmd_type is ATTYPE_NO_CMD) */
+  at_type_t             cmd_type;        /* ATTYPE_NO_CMD: nothing to send for this step */
+  uint8_t               options;         /* ATCM_SEQ_xxx options of the step */
+  SeqSkipFuncTypeDef    skip_Func;       /* NULL or returns AT_TRUE when the step has to be skipped */
+  SeqPrepareFuncTypeDef prepare_Func;    /* NULL or sets the command parameters before to program it */
+} atcm_SID_seq_step_t;
+
+struct atcm_SID_seq_struct;
+typedef struct atcm_SID_seq_struct
+{
+  at_msg_t                   sid;
+  const atcm_SID_seq_step_t *p_steps;
+  uint8_t                    steps_nb;
+} atcm_SID_seq_t;
+
 /* External variables --------------------------------------------------------*/
 
 /* Exported macros -----------------------------------------------------------*/
+/* number of steps of a SID sequence steps table */
+#define ATCM_SEQ_STEPS_NB(steps_table) ((uint8_t)(sizeof(steps_table) / sizeof(atcm_SID_seq_step_t)))
 
 /* Exported functions ------------------------------------------------------- */
+void                   atcm_set_modem_LUT(atcustom_modem_context_t *p_modem_ctxt,
+                                          const atcustom_LUT_t *p_modem_LUT, uint32_t modem_LUT_size);
 const AT_CHAR_t       *atcm_get_CmdStr(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
 uint32_t               atcm_get_CmdTimeout(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
 CmdBuildFuncTypeDef    atcm_get_CmdBuildFunc(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
@@ -357,6 +449,13 @@ void atcm_program_AT_CMD(atcustom_modem_context_t *p_modem_ctxt, atparser_contex
                          uint32_t cmd_id, atcustom_FinalCmd_t final);
 void atcm_program_AT_CMD_ANSWER_OPTIONAL(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
                                          at_type_t cmd_type, uint32_t cmd_id, atcustom_FinalCmd_t final);
+at_status_t atcm_program_AT_CMD_CONCAT(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
+                                       at_type_t cmd_type, uint32_t cmd_id);
+void atcm_select_concat_cmd(atparser_context_t *p_atp_ctxt, uint32_t cmd_id_received);
+at_bool_t atcm_concat_allowed(const atcustom_modem_context_t *p_modem_ctxt, const atparser_context_t *p_atp_ctxt);
+void atcm_concat_line_programmed(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
+                                 uint8_t steps_nb);
+at_bool_t atcm_concat_line_error(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt);
 void atcm_program_CMD_TIMEOUT(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
                               uint32_t new_timeout);
 void atcm_program_WAIT_EVENT(atparser_context_t *p_atp_ctxt, uint32_t tempo_value, atcustom_FinalCmd_t final);
@@ -364,8 +463,22 @@ void atcm_program_TEMPO(atparser_context_t *p_atp_ctxt, uint32_t tempo_value, at
 void atcm_program_NO_MORE_CMD(atparser_context_t *p_atp_ctxt);
 void atcm_program_SKIP_CMD(atparser_context_t *p_atp_ctxt);
 
+const atcm_SID_seq_t *atcm_get_SID_sequence(const atcm_SID_seq_t *p_seq_LUT, uint32_t seq_LUT_size, at_msg_t sid);
+at_status_t atcm_program_SID_sequence(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
+                                      const atcm_SID_seq_t *p_seq, uint8_t seq_step);
+void atcm_seq_prepare_CGATT_attach(atcustom_modem_context_t *p_modem_ctxt);
+void atcm_seq_prepare_CGATT_detach(atcustom_modem_context_t *p_modem_ctxt);
+void atcm_seq_prepare_PDN_activate(atcustom_modem_context_t *p_modem_ctxt);
+
+uint16_t atcm_checkEndOfMsgBlock(atcustom_modem_context_t *p_modem_ctxt,
+                                 ATC_checkEndOfMsgCallbackTypeDef checkEndOfMsgCallback,
+                                 const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg);
+
 void atcm_modem_init(atcustom_modem_context_t *p_modem_ctxt);
 void atcm_modem_reset(atcustom_modem_context_t *p_modem_ctxt);
+at_bool_t atcm_SID_can_be_suspended(at_msg_t sid);
+void atcm_suspend_SID_context(atcustom_modem_context_t *p_modem_ctxt);
+void atcm_resume_SID_context(atcustom_modem_context_t *p_modem_ctxt);
 at_status_t atcm_modem_build_cmd(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
                                  uint32_t *p_ATcmdTimeout);
 at_status_t atcm_modem_get_rsp(atcustom_modem_context_t *p_modem_ctxt, const atparser_context_t *p_atp_ctxt,
@@ -400,6 +513,10 @@ CS_PDN_conf_id_t atcm_get_configID_for_modem_cid(const atcustom_persistent_conte
                                                  uint8_t modem_cid);
 
 CS_PDN_conf_id_t atcm_get_cid_current_SID(atcustom_modem_context_t *p_modem_ctxt);
+at_bool_t atcm_cfg_cache_modem_id_is_known(const atcustom_modem_context_t *p_modem_ctxt);
+at_bool_t atcm_cfg_cache_PDN_is_committed(const atcustom_modem_context_t *p_modem_ctxt);
+void atcm_cfg_cache_PDN_commit(const atcustom_modem_context_t *p_modem_ctxt);
+void atcm_cfg_cache_invalidate(void);
 void atcm_put_IP_address_infos(atcustom_persistent_context_t *p_persistent_ctxt, uint8_t modem_cid,
                                csint_ip_addr_info_t  *ip_addr_info);
 void atcm_get_IP_address_infos(atcustom_persistent_context_t *p_persistent_ctxt, CS_PDN_conf_id_t conf_id,
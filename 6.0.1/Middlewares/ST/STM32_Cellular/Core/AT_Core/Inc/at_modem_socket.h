@@ -65,6 +65,7 @@ at_bool_t       atcm_socket_remaining_urc_data_pending(const atcustom_modem_cont
 at_bool_t       atcm_socket_remaining_urc_closed_by_remote(const atcustom_modem_context_t *p_modem_ctxt);
 at_bool_t       atcm_socket_is_connected(const atcustom_modem_context_t *p_modem_ctxt, socket_handle_t sockHandle);
 at_status_t     atcm_socket_set_connected(atcustom_modem_context_t *p_modem_ctxt, socket_handle_t sockHandle);
+uint32_t        atcm_socket_copy_send_data(const csint_socket_data_buffer_t *p_send_data, uint8_t *p_dest);
 
 #ifdef __cplusplus
 }
@@ -100,7 +100,8 @@ typedef struct
 
 /* Exported functions ------------------------------------------------------- */
 at_status_t ATParser_initParsers(sysctrl_device_type_t device_type);
-void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback);
+void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback,
+                   IPC_CheckEndOfMsgBlockCallbackTypeDef *p_checkEndOfMsgBlockCallback);
 void ATParser_process_request(at_context_t *p_at_ctxt,
                               at_msg_t msg_id, at_buf_t *p_cmd_buf);
 at_action_send_t ATParser_get_ATcmd(at_context_t *p_at_ctxt,
@@ -111,6 +112,8 @@ at_status_t ATParser_get_rsp(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATParser_get_urc(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 at_status_t ATParser_get_error(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf);
 void        ATParser_abort_request(at_context_t *p_at_ctxt);
+at_status_t ATParser_suspend_request(at_context_t *p_at_ctxt);
+void        ATParser_resume_request(at_context_t *p_at_ctxt);
 
 #ifdef __cplusplus
 }
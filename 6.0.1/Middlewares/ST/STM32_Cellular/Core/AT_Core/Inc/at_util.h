@@ -26,6 +26,7 @@ extern "C" {
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
 #include "plf_config.h"
 
 /* Exported constants --------------------------------------------------------*/
@@ -50,6 +51,8 @@ uint32_t ATutil_extract_hex_value_from_quotes(const uint8_t *p_str, uint16_t str
 uint32_t ATutil_extract_bin_value_from_quotes(const uint8_t *p_str, uint16_t str_size, uint8_t param_size);
 uint32_t ATutil_convert_T3412_to_seconds(uint32_t encoded_value);
 uint32_t ATutil_convert_T3324_to_seconds(uint32_t encoded_value);
+void     ATutil_convertBinToHexaString(const uint8_t *p_src, uint32_t size, uint8_t *p_dst);
+bool     ATutil_convertHexaStringToBin(const uint8_t *p_src, uint32_t size, uint8_t *p_dst);
 
 #ifdef __cplusplus
 }
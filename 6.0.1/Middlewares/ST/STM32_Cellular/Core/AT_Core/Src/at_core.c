@@ -30,6 +30,31 @@
 #include "cellular_service_int.h"
 
 /* Private typedef -----------------------------------------------------------*/
+/* state of an AT request context */
+typedef enum
+{
+  ATREQ_FREE = 0,   /* context not allocated */
+  ATREQ_PENDING,    /* request queued, waiting for ATCore task */
+  ATREQ_RUNNING,    /* transaction processed by ATCore task */
+  ATREQ_SUSPENDED,  /* transaction suspended at a step boundary, client thread decides when to resume it */
+  ATREQ_DONE,       /* transaction finished, status available for the client thread */
+} atcore_req_state_t;
+
+/* context of an AT request (AT_sendcmd or AT_sendcmd_async) */
+typedef struct atcore_req_s
+{
+  atcore_req_state_t  state;
+  at_msg_t            msg_id;        /* SID of the request */
+  at_buf_t            *p_cmd_in_buf; /* client buffer with the request parameters */
+  at_buf_t            *p_rsp_buf;    /* client buffer receiving the response */
+  at_req_callback_t   req_callback;  /* completion callback (NULL for AT_sendcmd: the client thread waits) */
+  void                *p_cb_ctx;     /* client context for completion callback */
+  at_status_t         status;        /* status of the transaction */
+  uint8_t             resume;        /* 1 if the request resumes a transaction suspended at a step boundary */
+  at_action_rsp_t     action_flags;  /* action flags of the suspended transaction */
+  osSemaphoreId       done_sem;      /* released by ATCore task when the transaction is finished or suspended */
+  struct atcore_req_s *p_next;       /* next request in the queue */
+} atcore_req_t;
 
 /* Private macros ------------------------------------------------------------*/
 #if (USE_TRACE_ATCORE == 1U)
@@ -63,6 +88,7 @@
 #define MSG_IPC_RECEIVED_SIZE (uint32_t) ((uint16_t) 128U)
 #define SIG_IPC_MSG                      (1U) /* signals definition for IPC message queue */
 #define SIG_INTERNAL_EVENT_MODEM         (2U) /* signals definition for internal event from the cellular modem */
+#define SIG_AT_REQ                       (3U) /* signals definition for AT request queued */
 
 /* Global variables ----------------------------------------------------------*/
 
@@ -81,14 +107,34 @@ static void ATCoreTaskBody(void *argument);
 static osMutexId ATCore_ParsingMutexHandle;
 #endif /* USE_PARSING_MUTEX == 1 */
 
+/* AT requests: contexts and queue of the pending requests, executed in order by ATCore task
+ * (queue updated with IT masked, the contexts are allocated by the clients and executed by ATCore task) */
+static atcore_req_t    atcore_req_tab[ATCORE_REQ_NB];
+static atcore_req_t    *p_atcore_req_head = NULL; /* next request to execute */
+static atcore_req_t    *p_atcore_req_tail = NULL; /* last request queued */
+/* this semaphore counts the free request contexts */
+static osSemaphoreId   s_ReqFree_SemaphoreId = NULL;
+
 /* Private variables ---------------------------------------------------------*/
 static uint8_t         AT_Core_initialized = 0U;
+static osThreadId      atcoreTaskId = NULL;  /* ATCore task handler */
 static IPC_Handle_t    ipcHandleTab;
 static at_context_t    at_context;
 static urc_callback_t  register_URC_callback;
-static IPC_RxMessage_t msgFromIPC;       /* IPC msg */
+static IPC_RxMessage_t msgFromIPC;       /* IPC msg (points to the message in IPC RX queue) */
 static __IO uint8_t    MsgReceived = 0U; /* received IPC msg counter */
+#if (USE_AT_CORE_RX_BATCH == 1)
+static __IO uint8_t    MsgSignaled = 0U; /* 1 if SIG_IPC_MSG is pending: ATCore task will parse all unread msg */
+#endif /* USE_AT_CORE_RX_BATCH == 1 */
+static at_rx_stats_t   at_rx_stats;      /* statistics of IPC msg parsing */
+static at_tx_stats_t   at_tx_stats;      /* statistics of IPC msg sending */
 static IPC_CheckEndOfMsgCallbackTypeDef custom_checkEndOfMsgCallback = NULL;
+static IPC_CheckEndOfMsgBlockCallbackTypeDef custom_checkEndOfMsgBlockCallback = NULL;
+static at_step_callback_t atcore_step_callback = NULL; /* client called at the step boundaries of the transactions */
+/* 1 if a transaction is suspended at a step boundary: no other transaction is suspended meanwhile,
+   the parser and the modem save the contexts of one suspended transaction only */
+static uint8_t         atcore_step_suspended = 0U;
+static at_buf_t        atcore_urc_buf[ATCMD_MAX_BUF_SIZE]; /* buffer size not optimized yet */
 
 /* Global variables ----------------------------------------------------------*/
 
@@ -96,12 +142,22 @@ static IPC_CheckEndOfMsgCallbackTypeDef custom_checkEndOfMsgCallback = NULL;
 static void msgReceivedCallback(IPC_Handle_t *ipcHandle);
 static void msgSentCallback(IPC_Handle_t *ipcHandle);
 
-static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_buf);
+static atcore_req_t *atcore_req_alloc(at_msg_t msg_in_id, at_buf_t *p_cmd_in_buf, at_buf_t *p_rsp_buf,
+                                      at_req_callback_t req_callback, void *p_cb_ctx);
+static void atcore_req_free(atcore_req_t *p_req);
+static void atcore_req_queue(atcore_req_t *p_req);
+static atcore_req_t *atcore_req_get(void);
+static void process_AT_requests(void);
+static void process_AT_request(atcore_req_t *p_req);
+static at_status_t process_AT_transaction(atcore_req_t *p_req);
+static bool step_boundary(atcore_req_t *p_req);
+static void process_signal(uint32_t msg);
 static at_status_t waitOnMsgUntilTimeout(uint32_t Tickstart, uint32_t Timeout);
 static at_status_t sendToIPC(uint8_t *cmdBuf, uint16_t cmdSize);
 static at_status_t waitFromIPC(uint32_t tickstart, uint32_t cmdTimeout, IPC_RxMessage_t *p_msg);
 static at_action_rsp_t process_answer(at_action_send_t action_send, uint32_t at_cmd_timeout);
 static at_action_rsp_t analyze_action_result(at_action_rsp_t val);
+static bool process_IPC_msg(at_buf_t *p_urc_buf);
 
 static void IRQ_DISABLE(void);
 static void IRQ_ENABLE(void);
@@ -126,6 +182,11 @@ at_status_t  AT_init(void)
   else
   {
     MsgReceived = 0U;
+#if (USE_AT_CORE_RX_BATCH == 1)
+    MsgSignaled = 0U;
+#endif /* USE_AT_CORE_RX_BATCH == 1 */
+    (void) memset((void *)&at_rx_stats, 0, sizeof(at_rx_stats_t));
+    (void) memset((void *)&at_tx_stats, 0, sizeof(at_tx_stats_t));
     register_URC_callback = NULL;
 
     at_context.device_type = DEVTYPE_INVALID;
@@ -147,6 +208,32 @@ at_status_t  AT_init(void)
     }
 #endif /* ENABLE_BG96_LOW_POWER_MODE == 1U */
 
+    /* AT requests contexts */
+    p_atcore_req_head = NULL;
+    p_atcore_req_tail = NULL;
+    s_ReqFree_SemaphoreId = rtosalSemaphoreNew((const rtosal_char_t *)"ATCORE_SEM_REQ_FREE", (uint32_t)ATCORE_REQ_NB);
+    if (s_ReqFree_SemaphoreId == NULL)
+    {
+      /* Platform is reset */
+      ERROR_Handler(DBG_CHAN_ATCMD, 22, ERROR_FATAL);
+    }
+    for (uint8_t i = 0U; i < ATCORE_REQ_NB; i++)
+    {
+      (void) memset((void *)&atcore_req_tab[i], 0, sizeof(atcore_req_t));
+      atcore_req_tab[i].state = ATREQ_FREE;
+      atcore_req_tab[i].done_sem = rtosalSemaphoreNew((const rtosal_char_t *)"ATCORE_SEM_REQ_DONE", 1U);
+      if (atcore_req_tab[i].done_sem == NULL)
+      {
+        /* Platform is reset */
+        ERROR_Handler(DBG_CHAN_ATCMD, 22, ERROR_FATAL);
+      }
+      else
+      {
+        /* init semaphore */
+        (void) rtosalSemaphoreAcquire(atcore_req_tab[i].done_sem, 0U);
+      }
+    }
+
     AT_Core_initialized = 1U;
     retval = ATSTATUS_OK;
   }
@@ -207,7 +294,7 @@ at_handle_t  AT_open(sysctrl_info_t *p_device_infos, urc_callback_t urc_callback
         register_URC_callback = urc_callback;
 
         /* init the ATParser */
-        ATParser_init(&at_context, &custom_checkEndOfMsgCallback);
+        ATParser_init(&at_context, &custom_checkEndOfMsgCallback, &custom_checkEndOfMsgBlockCallback);
       }
       else
       {
@@ -249,6 +336,8 @@ at_status_t  AT_open_channel(at_handle_t athandle)
                  NULL,
                  custom_checkEndOfMsgCallback) == IPC_OK)
     {
+      /* register block end of message callback (optional, used if characters are received by blocks) */
+      (void) IPC_setCheckEndOfMsgBlockCallback(at_context.ipc_handle, custom_checkEndOfMsgBlockCallback);
 
       /* Select the IPC opened channel as current channel */
       if (IPC_select(at_context.ipc_handle) == IPC_OK)
@@ -344,6 +433,8 @@ at_status_t AT_reset_context(at_handle_t athandle)
 /**
   * @brief  Request to send an AT command
   * @note   The command will be sent to the current active channel.
+  * @note   Blocking for the calling thread, see AT_sendcmd_async for the asynchronous requests.
+  * @note   Must not be called by ATCore task (ie from the URC callback or from a completion callback).
   * @param  athandle Handle of the AT context.
   * @param  msg_in_id Message ID.
   * @param  p_cmd_in_buf Pointer to the buffer with the command to send.
@@ -354,85 +445,92 @@ at_status_t AT_sendcmd(at_handle_t athandle, at_msg_t msg_in_id, at_buf_t *p_cmd
 {
   /* Sends a service request message to the ATCore.
   *  This is a blocking function.
+  *  The request is queued and its AT transaction is processed by ATCore task, after the requests queued before.
   *  It returns when the command is fully processed or a timeout expires.
   */
   at_status_t retval;
+  atcore_req_t *p_req;
 
   if (athandle == AT_HANDLE_INVALID)
   {
     retval = ATSTATUS_ERROR;
     LOG_ERROR(21, ERROR_WARNING);
   }
+  else if ((atcoreTaskId == NULL) || (rtosalThreadGetId() == atcoreTaskId))
+  {
+    /* ATCore task not started or waiting for its own request */
+    TRACE_ERR("AT_sendcmd can not be processed by ATCore task")
+    retval = ATSTATUS_ERROR;
+    LOG_ERROR(23, ERROR_WARNING);
+  }
   else
   {
-    /* Check if a command is already ongoing */
-    if (at_context.processing_cmd == 1U)
+    /* wait for a free request context */
+    (void) rtosalSemaphoreAcquire(s_ReqFree_SemaphoreId, RTOSAL_WAIT_FOREVER);
+    p_req = atcore_req_alloc(msg_in_id, p_cmd_in_buf, p_rsp_buf, NULL, NULL);
+    atcore_req_queue(p_req);
+
+    /* wait for the end of the transaction (or its suspension at a step boundary) */
+    (void) rtosalSemaphoreAcquire(p_req->done_sem, RTOSAL_WAIT_FOREVER);
+    while (p_req->state == ATREQ_SUSPENDED)
     {
-      TRACE_ERR("!!!!!!!!!!!!!!!!!! WARNING COMMAND IS UNDER PROCESS !!!!!!!!!!!!!!!!!!")
-      retval = ATSTATUS_ERROR;
-      LOG_ERROR(2, ERROR_WARNING);
-      goto exit_func;
-    }
-
-    /* initialize response buffer */
-    (void) memset((void *)p_rsp_buf, 0, ATCMD_MAX_BUF_SIZE);
+      /* the other requests are processed meanwhile: the client decides when the transaction is resumed */
+      (void)(*atcore_step_callback)(msg_in_id, ATSTEP_YIELD);
 
-    /* start to process this command */
-    at_context.processing_cmd = 1U;
-
-    /* save ptr on response buffer */
-    at_context.p_rsp_buf = p_rsp_buf;
-
-    /* Check if current mode is DATA mode */
-    if (at_context.in_data_mode == AT_TRUE)
-    {
-      /* Check if user command is DATA suspend */
-      if (msg_in_id == (at_msg_t) SID_CS_DATA_SUSPEND)
-      {
-        /* restore IPC Command channel to send ESCAPE COMMAND */
-        TRACE_DBG("<<< restore IPC COMMAND channel >>>")
-        (void) IPC_select(at_context.ipc_handle);
-      }
-    }
-    /* check if trying to suspend DATA while in command mode */
-    else if (msg_in_id == (at_msg_t) SID_CS_DATA_SUSPEND)
-    {
-      retval = ATSTATUS_ERROR;
-      LOG_ERROR(3, ERROR_WARNING);
-      TRACE_ERR("DATA not active")
-      goto exit_func;
-    }
-    else
-    {
-      /* nothing to do */
+      /* resume the transaction */
+      p_req->resume = 1U;
+      atcore_req_queue(p_req);
+      (void) rtosalSemaphoreAcquire(p_req->done_sem, RTOSAL_WAIT_FOREVER);
     }
 
-    /* Process the user request */
-    ATParser_process_request(&at_context, msg_in_id, p_cmd_in_buf);
+    retval = p_req->status;
+    atcore_req_free(p_req);
+  }
 
-    /* Start an AT command transaction */
-    retval = process_AT_transaction(msg_in_id, p_rsp_buf);
-    if (retval != ATSTATUS_OK)
-    {
-      TRACE_DBG("AT_sendcmd error: process AT transaction")
-      /* retrieve and send error report if exist */
-      (void) ATParser_get_error(&at_context, p_rsp_buf);
-      ATParser_abort_request(&at_context);
-      if (msg_in_id == (at_msg_t) SID_CS_DATA_SUSPEND)
-      {
-        /* force to return to command mode */
-        TRACE_ERR("force to return to COMMAND mode")
-        at_context.in_data_mode = AT_FALSE ;
-      }
-      goto exit_func;
-    }
+  return (retval);
+}
 
-    /* get command response buffer */
-    (void) ATParser_get_rsp(&at_context, p_rsp_buf);
+/**
+  * @brief  Request to send an AT command without waiting for its completion
+  * @note   The request is queued and its AT transaction is processed by ATCore task, after the requests queued
+  *         before. The buffers have to remain valid until the completion callback is called.
+  * @note   The transaction is never suspended at a step boundary (see AT_set_step_callback).
+  * @param  athandle Handle of the AT context.
+  * @param  msg_in_id Message ID.
+  * @param  p_cmd_in_buf Pointer to the buffer with the command to send.
+  * @param  p_rsp_buf Pointer to the buffer to return the response.
+  * @param  req_callback Client callback called by ATCore task when the request is completed (can be NULL).
+  * @param  p_cb_ctx Client context passed to the completion callback.
+  * @retval at_status_t ATSTATUS_OK if the request is queued, ATSTATUS_ERROR otherwise (no free request context).
+  */
+at_status_t AT_sendcmd_async(at_handle_t athandle, at_msg_t msg_in_id, at_buf_t *p_cmd_in_buf, at_buf_t *p_rsp_buf,
+                             at_req_callback_t req_callback, void *p_cb_ctx)
+{
+  at_status_t retval;
+  atcore_req_t *p_req;
 
-exit_func:
-    /* finished to process this command */
-    at_context.processing_cmd = 0U;
+  if (athandle == AT_HANDLE_INVALID)
+  {
+    retval = ATSTATUS_ERROR;
+    LOG_ERROR(21, ERROR_WARNING);
+  }
+  else if (atcoreTaskId == NULL)
+  {
+    TRACE_ERR("error, ATCore task not started")
+    retval = ATSTATUS_ERROR;
+    LOG_ERROR(23, ERROR_WARNING);
+  }
+  else if (rtosalSemaphoreAcquire(s_ReqFree_SemaphoreId, 0U) != ((rtosalStatus)osOK))
+  {
+    TRACE_ERR("no more request context available")
+    retval = ATSTATUS_ERROR;
+    LOG_ERROR(24, ERROR_WARNING);
+  }
+  else
+  {
+    p_req = atcore_req_alloc(msg_in_id, p_cmd_in_buf, p_rsp_buf, req_callback, p_cb_ctx);
+    atcore_req_queue(p_req);
+    retval = ATSTATUS_OK;
   }
 
   return (retval);
@@ -454,18 +552,85 @@ void AT_internalEvent(sysctrl_device_type_t deviceType)
   }
 }
 
+/**
+  * @brief  Get the statistics of AT messages reception.
+  * @param  p_stats Pointer to the structure to fill.
+  * @retval none.
+  */
+void AT_get_rx_stats(at_rx_stats_t *p_stats)
+{
+  if (p_stats != NULL)
+  {
+    (void) memcpy((void *)p_stats, (const void *)&at_rx_stats, sizeof(at_rx_stats_t));
+  }
+}
+
+/**
+  * @brief  Get the statistics of AT messages transmission.
+  * @param  p_stats Pointer to the structure to fill.
+  * @retval none.
+  */
+void AT_get_tx_stats(at_tx_stats_t *p_stats)
+{
+  if (p_stats != NULL)
+  {
+    (void) memcpy((void *)p_stats, (const void *)&at_tx_stats, sizeof(at_tx_stats_t));
+  }
+}
+
+/**
+  * @brief  Set the client callback called at the step boundaries of the AT transactions.
+  * @note   At a step boundary of a transaction requested by AT_sendcmd, ATCore task calls the callback with
+  *         ATSTEP_CHECK_YIELD: if it returns true, the transaction is suspended (its SID context is saved) and
+  *         the client thread waiting in AT_sendcmd calls the callback with ATSTEP_YIELD: meanwhile, ATCore task
+  *         processes the other queued requests. The transaction is queued again when the callback returns.
+  *         Only one transaction is suspended at a time: the transactions run during ATSTEP_YIELD are not
+  *         suspended. The response buffer of the suspended transaction is cleared when it is resumed.
+  * @param  step_callback Client callback (NULL: transactions are never suspended).
+  * @retval none.
+  */
+void AT_set_step_callback(at_step_callback_t step_callback)
+{
+  atcore_step_callback = step_callback;
+}
+
 /* Private function Definition -----------------------------------------------*/
 static void msgReceivedCallback(IPC_Handle_t *ipcHandle)
 {
+#if (USE_AT_CORE_RX_BATCH == 1)
+  bool signal_msg;
+#endif /* USE_AT_CORE_RX_BATCH == 1 */
   UNUSED(ipcHandle);
-  /* Warning ! this function is called under IT
-   * disable irq not required, we are under IT */
+  /* Warning ! this function is called under IT,
+   * or by ATCore task with IT unmasked when IPC_release() resumes the DMA reception (IPC_USE_UART_DMA_RX):
+   * counters are updated with IT masked */
+  IRQ_DISABLE();
   MsgReceived++;
+#if (USE_AT_CORE_RX_BATCH == 1)
+  /* signal only the first msg: ATCore task parses all unread msg before to wait for a new signal */
+  signal_msg = (MsgSignaled == 0U);
+  MsgSignaled = 1U;
+#endif /* USE_AT_CORE_RX_BATCH == 1 */
+  IRQ_ENABLE();
+
+#if (USE_AT_CORE_RX_BATCH == 1)
+  if (signal_msg == true)
+  {
+    if (rtosalMessageQueuePut(q_msg_IPC_received_Id,
+                              (uint32_t)SIG_IPC_MSG, (uint32_t)0U) != osOK)
+    {
+      /* next msg will try again */
+      MsgSignaled = 0U;
+      TRACE_ERR("q_msg_IPC_received_Id error for SIG_IPC_MSG")
+    }
+  }
+#else
   if (rtosalMessageQueuePut(q_msg_IPC_received_Id,
                             (uint32_t)SIG_IPC_MSG, (uint32_t)0U) != osOK)
   {
     TRACE_ERR("q_msg_IPC_received_Id error for SIG_IPC_MSG")
   }
+#endif /* USE_AT_CORE_RX_BATCH == 1 */
 }
 
 static void msgSentCallback(IPC_Handle_t *ipcHandle)
@@ -473,32 +638,55 @@ static void msgSentCallback(IPC_Handle_t *ipcHandle)
   UNUSED(ipcHandle);
   /* Warning ! this function is called under IT */
   at_context.dataSent = AT_TRUE;
+#if (IPC_USE_TX_QUEUE == 0U)
+  /* sendToIPC() waits for the end of the transmission (with IPC TX queue, it does not wait) */
   (void) rtosalSemaphoreRelease(at_context.s_SendConfirm_SemaphoreId);
+#endif /* IPC_USE_TX_QUEUE == 0U */
 }
 
 static at_status_t waitOnMsgUntilTimeout(uint32_t Tickstart, uint32_t Timeout)
 {
-  at_status_t retval = ATSTATUS_OK;
+  /* called by ATCore task during a transaction: the signals are processed until the answer is received
+   * (the queued AT requests are processed after this transaction) */
+  at_status_t retval = ATSTATUS_TIMEOUT;
+  uint32_t wait_start = HAL_GetTick();
+  uint32_t elapsed;
+  uint32_t remaining = Timeout; /* Timeout = 0: simulate a timeout */
+  uint32_t msg = 0U;
+  rtosalStatus status;
 
   UNUSED(Tickstart);
 
   TRACE_DBG("**** Waiting Sema (to=%lu) *****", Timeout)
-  if (Timeout != 0U)
+  while (remaining != 0U)
   {
-    rtosalStatus sem_status;
-    sem_status = rtosalSemaphoreAcquire(s_WaitAnswer_SemaphoreId, Timeout);
     /* check if sema released because IPC msg received */
-    if (sem_status != ((rtosalStatus)osOK))
+    if (rtosalSemaphoreAcquire(s_WaitAnswer_SemaphoreId, 0U) == ((rtosalStatus)osOK))
     {
-      TRACE_DBG("**** Sema Timeout (=%ld) !!! *****", Timeout)
-      retval = ATSTATUS_TIMEOUT;
+      TRACE_DBG("**** Sema Freed *****")
+      retval = ATSTATUS_OK;
+      remaining = 0U;
+    }
+    else
+    {
+      if (Timeout != RTOSAL_WAIT_FOREVER)
+      {
+        elapsed = HAL_GetTick() - wait_start;
+        remaining = (elapsed < Timeout) ? (Timeout - elapsed) : 0U;
+      }
+      if (remaining != 0U)
+      {
+        status = rtosalMessageQueueGet(q_msg_IPC_received_Id, &msg, remaining);
+        if ((status == osEventMessage) || (status == osOK))
+        {
+          process_signal(msg);
+        }
+      }
+      else
+      {
+        TRACE_DBG("**** Sema Timeout (=%ld) !!! *****", Timeout)
+      }
     }
-    TRACE_DBG("**** Sema Freed *****")
-  }
-  else
-  {
-    /* simulate a timeout */
-    retval = ATSTATUS_TIMEOUT;
   }
 
   return (retval);
@@ -591,15 +779,250 @@ static at_action_rsp_t process_answer(at_action_send_t action_send, uint32_t at_
   return (action_rsp);
 }
 
-static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_buf)
+static atcore_req_t *atcore_req_alloc(at_msg_t msg_in_id, at_buf_t *p_cmd_in_buf, at_buf_t *p_rsp_buf,
+                                      at_req_callback_t req_callback, void *p_cb_ctx)
+{
+  /* called with a free context reserved (s_ReqFree_SemaphoreId acquired) */
+  atcore_req_t *p_req = NULL;
+
+  IRQ_DISABLE();
+  for (uint8_t i = 0U; (i < ATCORE_REQ_NB) && (p_req == NULL); i++)
+  {
+    if (atcore_req_tab[i].state == ATREQ_FREE)
+    {
+      p_req = &atcore_req_tab[i];
+      p_req->state = ATREQ_PENDING;
+    }
+  }
+  IRQ_ENABLE();
+
+  if (p_req == NULL)
+  {
+    /* Platform is reset: more contexts allocated than counted by the semaphore */
+    ERROR_Handler(DBG_CHAN_ATCMD, 25, ERROR_FATAL);
+  }
+  else
+  {
+    p_req->msg_id = msg_in_id;
+    p_req->p_cmd_in_buf = p_cmd_in_buf;
+    p_req->p_rsp_buf = p_rsp_buf;
+    p_req->req_callback = req_callback;
+    p_req->p_cb_ctx = p_cb_ctx;
+    p_req->status = ATSTATUS_ERROR;
+    p_req->resume = 0U;
+    p_req->action_flags = ATACTION_RSP_NO_ACTION;
+  }
+
+  return (p_req);
+}
+
+static void atcore_req_free(atcore_req_t *p_req)
+{
+  p_req->state = ATREQ_FREE;
+  (void) rtosalSemaphoreRelease(s_ReqFree_SemaphoreId);
+}
+
+static void atcore_req_queue(atcore_req_t *p_req)
+{
+  IRQ_DISABLE();
+  p_req->state = ATREQ_PENDING;
+  p_req->p_next = NULL;
+  if (p_atcore_req_tail == NULL)
+  {
+    p_atcore_req_head = p_req;
+  }
+  else
+  {
+    p_atcore_req_tail->p_next = p_req;
+  }
+  p_atcore_req_tail = p_req;
+  IRQ_ENABLE();
+
+  /* wake up ATCore task (if the signal is lost, the request is processed after the next signal) */
+  if (rtosalMessageQueuePut(q_msg_IPC_received_Id, (uint32_t)SIG_AT_REQ, (uint32_t)0U) != osOK)
+  {
+    TRACE_ERR("q_msg_IPC_received_Id error for SIG_AT_REQ")
+  }
+}
+
+static atcore_req_t *atcore_req_get(void)
+{
+  atcore_req_t *p_req;
+
+  IRQ_DISABLE();
+  p_req = p_atcore_req_head;
+  if (p_req != NULL)
+  {
+    p_atcore_req_head = p_req->p_next;
+    if (p_atcore_req_head == NULL)
+    {
+      p_atcore_req_tail = NULL;
+    }
+    p_req->p_next = NULL;
+    p_req->state = ATREQ_RUNNING;
+  }
+  IRQ_ENABLE();
+
+  return (p_req);
+}
+
+/**
+  * @brief  Process the queued AT requests, in order (called by ATCore task).
+  * @note   The next transaction starts as soon as the previous one is finished, without waking up its client.
+  * @param  none
+  * @retval none
+  */
+static void process_AT_requests(void)
+{
+  atcore_req_t *p_req;
+  at_req_callback_t req_callback;
+  at_msg_t msg_id;
+  at_status_t status;
+  at_buf_t *p_rsp_buf;
+  void *p_cb_ctx;
+
+  p_req = atcore_req_get();
+  while (p_req != NULL)
+  {
+    process_AT_request(p_req);
+
+    if (p_req->req_callback == NULL)
+    {
+      /* AT_sendcmd: wake up the client thread (request finished or suspended) */
+      if (p_req->state == ATREQ_RUNNING)
+      {
+        p_req->state = ATREQ_DONE;
+      }
+      (void) rtosalSemaphoreRelease(p_req->done_sem);
+    }
+    else
+    {
+      /* AT_sendcmd_async: free the request context before to call the client, callback can queue a new request */
+      req_callback = p_req->req_callback;
+      msg_id = p_req->msg_id;
+      status = p_req->status;
+      p_rsp_buf = p_req->p_rsp_buf;
+      p_cb_ctx = p_req->p_cb_ctx;
+      atcore_req_free(p_req);
+      (* req_callback)(msg_id, status, p_rsp_buf, p_cb_ctx);
+    }
+
+    p_req = atcore_req_get();
+  }
+}
+
+/**
+  * @brief  Process the AT transaction of a request (called by ATCore task).
+  * @param  p_req Request to process: new request or transaction suspended at a step boundary to resume.
+  * @retval none (status of the transaction set in the request)
+  */
+static void process_AT_request(atcore_req_t *p_req)
 {
-  UNUSED(p_rsp_buf);
+  at_status_t retval;
+  at_msg_t msg_in_id = p_req->msg_id;
+  at_buf_t *p_rsp_buf = p_req->p_rsp_buf;
 
+  if (p_req->resume == 1U)
+  {
+    /* resume the transaction */
+    p_req->resume = 0U;
+    at_context.processing_cmd = 1U;
+    atcore_step_suspended = 0U;
+    (void) memset((void *)p_rsp_buf, 0, ATCMD_MAX_BUF_SIZE);
+    at_context.p_rsp_buf = p_rsp_buf;
+    ATParser_resume_request(&at_context);
+    at_context.action_flags = p_req->action_flags;
+    TRACE_DBG("SID %d resumed", msg_in_id)
+  }
+  else
+  {
+    /* Check if a command is already ongoing */
+    if (at_context.processing_cmd == 1U)
+    {
+      TRACE_ERR("!!!!!!!!!!!!!!!!!! WARNING COMMAND IS UNDER PROCESS !!!!!!!!!!!!!!!!!!")
+      retval = ATSTATUS_ERROR;
+      LOG_ERROR(2, ERROR_WARNING);
+      goto exit_func;
+    }
+
+    /* initialize response buffer */
+    (void) memset((void *)p_rsp_buf, 0, ATCMD_MAX_BUF_SIZE);
+
+    /* start to process this command */
+    at_context.processing_cmd = 1U;
+
+    /* save ptr on response buffer */
+    at_context.p_rsp_buf = p_rsp_buf;
+
+    /* Check if current mode is DATA mode */
+    if (at_context.in_data_mode == AT_TRUE)
+    {
+      /* Check if user command is DATA suspend */
+      if (msg_in_id == (at_msg_t) SID_CS_DATA_SUSPEND)
+      {
+        /* restore IPC Command channel to send ESCAPE COMMAND */
+        TRACE_DBG("<<< restore IPC COMMAND channel >>>")
+        (void) IPC_select(at_context.ipc_handle);
+      }
+    }
+    /* check if trying to suspend DATA while in command mode */
+    else if (msg_in_id == (at_msg_t) SID_CS_DATA_SUSPEND)
+    {
+      retval = ATSTATUS_ERROR;
+      LOG_ERROR(3, ERROR_WARNING);
+      TRACE_ERR("DATA not active")
+      goto exit_func;
+    }
+    else
+    {
+      /* nothing to do */
+    }
+
+    /* Process the user request */
+    ATParser_process_request(&at_context, msg_in_id, p_req->p_cmd_in_buf);
+
+    /* clear all flags*/
+    at_context.action_flags = ATACTION_RSP_NO_ACTION;
+  }
+
+  /* Start (or continue) an AT command transaction */
+  retval = process_AT_transaction(p_req);
+  if (p_req->state != ATREQ_SUSPENDED)
+  {
+    if (retval != ATSTATUS_OK)
+    {
+      TRACE_DBG("AT_sendcmd error: process AT transaction")
+      /* retrieve and send error report if exist */
+      (void) ATParser_get_error(&at_context, p_rsp_buf);
+      ATParser_abort_request(&at_context);
+      if (msg_in_id == (at_msg_t) SID_CS_DATA_SUSPEND)
+      {
+        /* force to return to command mode */
+        TRACE_ERR("force to return to COMMAND mode")
+        at_context.in_data_mode = AT_FALSE ;
+      }
+    }
+    else
+    {
+      /* get command response buffer */
+      (void) ATParser_get_rsp(&at_context, p_rsp_buf);
+    }
+  }
+
+exit_func:
+  /* finished to process this command (or transaction suspended) */
+  at_context.processing_cmd = 0U;
+  p_req->status = retval;
+}
+
+static at_status_t process_AT_transaction(atcore_req_t *p_req)
+{
   /* static variables (do not use stack) */
   static AT_CHAR_t build_atcmd[ATCMD_MAX_CMD_SIZE] = {0};
 
   /* local variables */
   at_status_t retval = ATSTATUS_OK;
+  at_msg_t msg_in_id = p_req->msg_id;
   uint32_t at_cmd_timeout = 0U;
   at_action_send_t action_send;
   uint16_t build_atcmd_size;
@@ -609,9 +1032,6 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_bu
   /* reset at cmd buffer */
   (void) memset((void *) build_atcmd, 0, ATCMD_MAX_CMD_SIZE);
 
-  /* clear all flags*/
-  at_context.action_flags = ATACTION_RSP_NO_ACTION;
-
   do
   {
     another_cmd_to_send = 0U; /* default value: this is the last command (will be changed if this is not the case) */
@@ -691,6 +1111,19 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_bu
     {
       another_cmd_to_send = 0U;
     }
+    else if (another_cmd_to_send == 1U)
+    {
+      /* answer of this command received, next command of the SID not prepared yet */
+      if (step_boundary(p_req) == true)
+      {
+        /* transaction suspended: next command will be sent when the request is resumed */
+        another_cmd_to_send = 0U;
+      }
+    }
+    else
+    {
+      /* nothing to do */
+    }
 
   } while (another_cmd_to_send == 1U);
 
@@ -708,6 +1141,31 @@ static at_status_t process_AT_transaction(at_msg_t msg_in_id, at_buf_t *p_rsp_bu
   return (retval);
 }
 
+static bool step_boundary(atcore_req_t *p_req)
+{
+  /* called by ATCore task: only a transaction with its client thread waiting for it (AT_sendcmd) is suspended,
+   * the client thread calls the step callback with ATSTEP_YIELD then queues the request again */
+  bool suspended = false;
+
+  if ((atcore_step_callback != NULL) && (p_req->req_callback == NULL) && (atcore_step_suspended == 0U) &&
+      (at_context.in_data_mode == AT_FALSE) &&
+      ((*atcore_step_callback)(p_req->msg_id, ATSTEP_CHECK_YIELD) == true))
+  {
+    p_req->action_flags = at_context.action_flags;
+    if (ATParser_suspend_request(&at_context) == ATSTATUS_OK)
+    {
+      /* transaction suspended: let ATCore task process the other requests */
+      TRACE_DBG("SID %d suspended", p_req->msg_id)
+      atcore_step_suspended = 1U;
+      at_context.processing_cmd = 0U;
+      p_req->state = ATREQ_SUSPENDED;
+      suspended = true;
+    }
+  }
+
+  return (suspended);
+}
+
 static at_status_t sendToIPC(uint8_t *cmdBuf, uint16_t cmdSize)
 {
   at_status_t retval;
@@ -721,6 +1179,11 @@ static at_status_t sendToIPC(uint8_t *cmdBuf, uint16_t cmdSize)
   }
   else
   {
+    at_tx_stats.cmd_nb++;
+#if (IPC_USE_TX_QUEUE == 1U)
+    /* command copied in IPC TX queue: it is sent while waiting for the answer */
+    retval = ATSTATUS_OK;
+#else
     (void) rtosalSemaphoreAcquire(at_context.s_SendConfirm_SemaphoreId, 5000U);
     if (at_context.dataSent == AT_TRUE)
     {
@@ -730,6 +1193,7 @@ static at_status_t sendToIPC(uint8_t *cmdBuf, uint16_t cmdSize)
     {
       retval = ATSTATUS_ERROR;
     }
+#endif /* IPC_USE_TX_QUEUE */
   }
 
   return (retval);
@@ -801,6 +1265,100 @@ static at_action_rsp_t analyze_action_result(at_action_rsp_t val)
   return (action);
 }
 
+/**
+  * @brief  Read, parse and release the first unread message of IPC RX queue.
+  * @param  p_urc_buf Buffer used to forward the URC to the client.
+  * @retval bool true if a message has been read, false if no unread message.
+  */
+static bool process_IPC_msg(at_buf_t *p_urc_buf)
+{
+  bool msg_read;
+  at_status_t retUrc;
+  at_action_rsp_t action;
+
+  /* retrieve message from IPC (message is analyzed in place in IPC RX queue) */
+  if (IPC_peek(&ipcHandleTab, &msgFromIPC) == IPC_ERROR)
+  {
+    TRACE_DBG("IPC receive error")
+    ATParser_abort_request(&at_context);
+    TRACE_DBG("**** Sema Released on error 1 *****")
+    (void) rtosalSemaphoreRelease(s_WaitAnswer_SemaphoreId);
+    msg_read = false;
+  }
+  else
+  {
+    msg_read = true;
+
+    /* one message has been read */
+    IRQ_DISABLE();
+    MsgReceived--;
+    IRQ_ENABLE();
+
+    /* Parse the response */
+#if (USE_PARSING_MUTEX == 1)
+    (void)rtosalMutexAcquire(ATCore_ParsingMutexHandle, RTOSAL_WAIT_FOREVER);
+#endif /* USE_PARSING_MUTEX == 1 */
+    action = ATParser_parse_rsp(&at_context, &msgFromIPC);
+#if (USE_PARSING_MUTEX == 1)
+    (void)rtosalMutexRelease(ATCore_ParsingMutexHandle);
+#endif /* USE_PARSING_MUTEX == 1 */
+
+    /* message has been analyzed: free it in IPC RX queue */
+    (void) IPC_release(&ipcHandleTab);
+
+    /* analyze the response (check data mode flag) */
+    action = analyze_action_result(action);
+
+    /* add this action to action flags only if this kind of action will be treated later */
+    if ((action == ATACTION_RSP_FRC_END)
+        || (action == ATACTION_RSP_FRC_CONTINUE)
+        || (action == ATACTION_RSP_ERROR))
+    {
+      at_context.action_flags |= action;
+      TRACE_DBG("add action 0x%x (flags=0x%x)", action, at_context.action_flags)
+    }
+
+    if (action == ATACTION_RSP_ERROR)
+    {
+      TRACE_ERR("AT_sendcmd error")
+      ATParser_abort_request(&at_context);
+      TRACE_DBG("**** Sema Released on error 2 *****")
+      (void) rtosalSemaphoreRelease(s_WaitAnswer_SemaphoreId);
+    }
+    /* check if this is an URC to forward */
+    else if (action == ATACTION_RSP_URC_FORWARDED)
+    {
+      /* notify user with callback */
+      if (register_URC_callback != NULL)
+      {
+        /* get URC response buffer */
+        do
+        {
+          (void) memset((void *) p_urc_buf, 0, ATCMD_MAX_BUF_SIZE);
+          retUrc = ATParser_get_urc(&at_context, p_urc_buf);
+          if ((retUrc == ATSTATUS_OK) || (retUrc == ATSTATUS_OK_PENDING_URC))
+          {
+            /* call the URC callback */
+            (* register_URC_callback)(p_urc_buf);
+          }
+        } while (retUrc == ATSTATUS_OK_PENDING_URC);
+      }
+    }
+    else if ((action == ATACTION_RSP_FRC_CONTINUE) ||
+             (action == ATACTION_RSP_FRC_END))
+    {
+      TRACE_DBG("**** Sema released *****")
+      (void) rtosalSemaphoreRelease(s_WaitAnswer_SemaphoreId);
+    }
+    else
+    {
+      /* nothing to do */
+    }
+  }
+
+  return (msg_read);
+}
+
 static void IRQ_DISABLE(void)
 {
   __disable_irq();
@@ -815,9 +1373,6 @@ at_status_t atcore_task_start(osPriority taskPrio, uint16_t stackSize)
 {
   at_status_t retval;
 
-  /* ATCore task handler */
-  static osThreadId atcoreTaskId = NULL;
-
   /* check if AT_init has been called before */
   if (AT_Core_initialized != 1U)
   {
@@ -867,130 +1422,114 @@ at_status_t atcore_task_start(osPriority taskPrio, uint16_t stackSize)
   return (retval);
 }
 
+/**
+  * @brief  Process a signal received by ATCore task.
+  * @note   Called by ATCore task while waiting for a signal, or while waiting for the answer of a transaction.
+  * @param  msg Signal received.
+  * @retval none
+  */
+static void process_signal(uint32_t msg)
+{
+  at_status_t retUrc;
+  uint32_t msg_nb;
+#if (USE_AT_CORE_RX_BATCH == 1)
+  bool msg_read;
+  bool leave_loop;
+#endif /* USE_AT_CORE_RX_BATCH == 1 */
+
+  if (msg == (SIG_IPC_MSG))
+  {
+#if (USE_AT_CORE_RX_BATCH == 1)
+    /* parse all unread messages, including the ones received meanwhile */
+    msg_nb = 0U;
+    leave_loop = false;
+    do
+    {
+      msg_read = process_IPC_msg(atcore_urc_buf);
+      if (msg_read == true)
+      {
+        msg_nb++;
+      }
+
+      IRQ_DISABLE();
+      if ((msg_read == false) || (MsgReceived == 0U))
+      {
+        if (msg_read == false)
+        {
+          /* no unread message in IPC (RX queue has been reset): resynchronize the counter */
+          MsgReceived = 0U;
+        }
+        /* next message received will signal the task again */
+        MsgSignaled = 0U;
+        leave_loop = true;
+      }
+      IRQ_ENABLE();
+    } while (leave_loop == false);
+#else
+    msg_nb = (process_IPC_msg(atcore_urc_buf) == true) ? 1U : 0U;
+#endif /* USE_AT_CORE_RX_BATCH == 1 */
+
+    /* update reception statistics */
+    at_rx_stats.wakeup_nb++;
+    at_rx_stats.msg_nb += msg_nb;
+    if (msg_nb > at_rx_stats.max_msg_per_wakeup)
+    {
+      at_rx_stats.max_msg_per_wakeup = msg_nb;
+    }
+  }
+  else if (msg == (SIG_INTERNAL_EVENT_MODEM))
+  {
+    /* An internal event has been received (ie not coming from IPC: could be an interrupt from modem,...)
+     * Do not call IPC_peek in this case
+     */
+    TRACE_DBG("!!! an internal event has been received !!!")
+    if (register_URC_callback != NULL)
+    {
+      do
+      {
+        (void) memset((void *) atcore_urc_buf, 0, ATCMD_MAX_BUF_SIZE);
+        retUrc = ATParser_get_urc(&at_context, atcore_urc_buf);
+        if ((retUrc == ATSTATUS_OK) || (retUrc == ATSTATUS_OK_PENDING_URC))
+        {
+          /* call the URC callback */
+          (* register_URC_callback)(atcore_urc_buf);
+        }
+      } while (retUrc == ATSTATUS_OK_PENDING_URC);
+    }
+  }
+  else if (msg == (SIG_AT_REQ))
+  {
+    /* nothing to do: the queued requests are processed by ATCoreTaskBody */
+    __NOP();
+  }
+  else
+  {
+    /* should not happen */
+    __NOP();
+  }
+}
+
 static void ATCoreTaskBody(void *argument)
 {
   UNUSED(argument);
 
-  at_status_t retUrc;
-  at_action_rsp_t action;
   rtosalStatus status;
   uint32_t msg = 0;
 
-  static at_buf_t urc_buf[ATCMD_MAX_BUF_SIZE]; /* buffer size not optimized yet */
-
   TRACE_DBG("<start ATCore TASK>")
 
   /* Infinite loop */
   for (;;)
   {
-    /* waiting IPC message received event (message) */
+    /* waiting IPC message received event (message) or AT request */
     status = rtosalMessageQueueGet(q_msg_IPC_received_Id,
                                    (uint32_t *)&msg, (uint32_t) RTOSAL_WAIT_FOREVER);
     if ((status == osEventMessage) || (status == osOK))
     {
-      if (msg == (SIG_IPC_MSG))
-      {
-        /* retrieve message from IPC */
-        if (IPC_receive(&ipcHandleTab, &msgFromIPC) == IPC_ERROR)
-        {
-          TRACE_DBG("IPC receive error")
-          ATParser_abort_request(&at_context);
-          TRACE_DBG("**** Sema Released on error 1 *****")
-          (void) rtosalSemaphoreRelease(s_WaitAnswer_SemaphoreId);
-          /* skip this loop iteration */
-          continue;
-        }
-
-        /* one message has been read */
-        IRQ_DISABLE();
-        MsgReceived--;
-        IRQ_ENABLE();
+      process_signal(msg);
 
-        /* Parse the response */
-#if (USE_PARSING_MUTEX == 1)
-        (void)rtosalMutexAcquire(ATCore_ParsingMutexHandle, RTOSAL_WAIT_FOREVER);
-#endif /* USE_PARSING_MUTEX == 1 */
-        action = ATParser_parse_rsp(&at_context, &msgFromIPC);
-#if (USE_PARSING_MUTEX == 1)
-        (void)rtosalMutexRelease(ATCore_ParsingMutexHandle);
-#endif /* USE_PARSING_MUTEX == 1 */
-
-        /* analyze the response (check data mode flag) */
-        action = analyze_action_result(action);
-
-        /* add this action to action flags only if this kind of action will be treated later */
-        if ((action == ATACTION_RSP_FRC_END)
-            || (action == ATACTION_RSP_FRC_CONTINUE)
-            || (action == ATACTION_RSP_ERROR))
-        {
-          at_context.action_flags |= action;
-          TRACE_DBG("add action 0x%x (flags=0x%x)", action, at_context.action_flags)
-        }
-        if (action == ATACTION_RSP_ERROR)
-        {
-          TRACE_ERR("AT_sendcmd error")
-          ATParser_abort_request(&at_context);
-          TRACE_DBG("**** Sema Released on error 2 *****")
-          (void) rtosalSemaphoreRelease(s_WaitAnswer_SemaphoreId);
-          continue;
-        }
-
-        /* check if this is an URC to forward */
-        if (action == ATACTION_RSP_URC_FORWARDED)
-        {
-          /* notify user with callback */
-          if (register_URC_callback != NULL)
-          {
-            /* get URC response buffer */
-            do
-            {
-              (void) memset((void *) urc_buf, 0, ATCMD_MAX_BUF_SIZE);
-              retUrc = ATParser_get_urc(&at_context, urc_buf);
-              if ((retUrc == ATSTATUS_OK) || (retUrc == ATSTATUS_OK_PENDING_URC))
-              {
-                /* call the URC callback */
-                (* register_URC_callback)(urc_buf);
-              }
-            } while (retUrc == ATSTATUS_OK_PENDING_URC);
-          }
-        }
-        else if ((action == ATACTION_RSP_FRC_CONTINUE) ||
-                 (action == ATACTION_RSP_FRC_END) ||
-                 (action == ATACTION_RSP_ERROR))
-        {
-          TRACE_DBG("**** Sema released *****")
-          (void) rtosalSemaphoreRelease(s_WaitAnswer_SemaphoreId);
-        }
-        else
-        {
-          /* nothing to do */
-        }
-      }
-      else if (msg == (SIG_INTERNAL_EVENT_MODEM))
-      {
-        /* An internal event has been received (ie not coming from IPC: could be an interrupt from modem,...)
-         * Do not call IPC_receive in this case
-         */
-        TRACE_DBG("!!! an internal event has been received !!!")
-        if (register_URC_callback != NULL)
-        {
-          do
-          {
-            (void) memset((void *) urc_buf, 0, ATCMD_MAX_BUF_SIZE);
-            retUrc = ATParser_get_urc(&at_context, urc_buf);
-            if ((retUrc == ATSTATUS_OK) || (retUrc == ATSTATUS_OK_PENDING_URC))
-            {
-              /* call the URC callback */
-              (* register_URC_callback)(urc_buf);
-            }
-          } while (retUrc == ATSTATUS_OK_PENDING_URC);
-        }
-      }
-      else
-      {
-        /* should not happen */
-        __NOP();
-      }
+      /* process the queued AT requests */
+      process_AT_requests();
     }
   }
 }
@@ -107,6 +107,19 @@ ATC_checkEndOfMsgCallbackTypeDef atcc_checkEndOfMsgCallback(const at_context_t *
   return (at_custom_func[p_at_ctxt->device_type].f_checkEndOfMsgCallback);
 }
 
+/**
+  * @brief  Callback modem function to check end of message in a block of characters.
+  * @note  This function is called by the IPC to determine if a complete message has been received
+  *        when characters are received by blocks.
+  * @param  p_at_ctxt Pointer to the modem context.
+  * @retval none
+  */
+ATC_checkEndOfMsgBlockCallbackTypeDef atcc_checkEndOfMsgBlockCallback(const at_context_t *p_at_ctxt)
+{
+  /* called under interruption, do not put trace here */
+  return (at_custom_func[p_at_ctxt->device_type].f_checkEndOfMsgBlockCallback);
+}
+
 /**
   * @brief  Call modem function to retrieve next AT command to send for the requested service.
   * @note   This functions can be called many times for a service if required.
@@ -248,6 +261,35 @@ at_status_t atcc_get_error(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf)
   return (retval);
 }
 
+/**
+  * @brief  Call modem function to save the SID context of a SID suspended at a step boundary.
+  * @note   The SID context of the modem is ready for another SID until atcc_resume_SID is called.
+  * @param  p_at_ctxt Pointer to the modem context.
+  * @retval at_status_t ATSTATUS_ERROR if the modem can not suspend the current SID.
+  */
+at_status_t atcc_suspend_SID(at_context_t *p_at_ctxt)
+{
+  at_status_t retval = ATSTATUS_ERROR;
+
+  if (at_custom_func[p_at_ctxt->device_type].f_suspend_SID != NULL)
+  {
+    retval = (*at_custom_func[p_at_ctxt->device_type].f_suspend_SID)(&p_at_ctxt->parser);
+  }
+
+  PRINT_DBG("atcc_suspend_SID returned status = %d", retval)
+  return (retval);
+}
+
+/**
+  * @brief  Call modem function to restore the SID context saved by atcc_suspend_SID.
+  * @param  p_at_ctxt Pointer to the modem context.
+  * @retval none
+  */
+void atcc_resume_SID(at_context_t *p_at_ctxt)
+{
+  (*at_custom_func[p_at_ctxt->device_type].f_resume_SID)(&p_at_ctxt->parser);
+}
+
 /**
   * @brief  Report an Hw event
   * @note   this function is usually called from GPIO interrupt handler
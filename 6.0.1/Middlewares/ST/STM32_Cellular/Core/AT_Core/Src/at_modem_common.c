@@ -18,6 +18,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include <string.h>
 #include "at_core.h"
 #include "at_modem_common.h"
@@ -32,8 +33,25 @@
 #include "plf_config.h"
 
 /* Private typedef -----------------------------------------------------------*/
+/* modem configuration cache: fingerprints of the settings already committed to the modem non-volatile memory */
+typedef struct
+{
+  uint32_t magic;                                   /* ATCM_CFG_CACHE_MAGIC when the cache has been initialized */
+  uint32_t committed;                               /* bitmask of the items committed to the modem */
+  uint32_t fingerprint[MODEM_CFG_CACHE_NB_ITEMS];   /* fingerprint of the settings of each committed item */
+  uint32_t checksum;                                /* checksum of the fields above */
+} atcm_cfg_cache_t;
 
 /* Private defines -----------------------------------------------------------*/
+/* max size of the commands concatenated to the main command of a line */
+#define ATCM_CONCAT_MAX_SIZE ((uint16_t) 64U)
+/* modem configuration cache */
+#define ATCM_CFG_CACHE_MAGIC ((uint32_t) 0x4D434647U)
+#define FNV1A_HASH_INIT      ((uint32_t) 2166136261U)
+#if defined(MODEM_CFG_CACHE_RTC_BKP_FIRST)
+/* number of RTC backup registers used by the cache (one per 32-bit field) */
+#define ATCM_CFG_CACHE_RTC_BKP_NB ((uint32_t)(sizeof(atcm_cfg_cache_t) / sizeof(uint32_t)))
+#endif /* MODEM_CFG_CACHE_RTC_BKP_FIRST */
 
 /* Private macros ------------------------------------------------------------*/
 #if (USE_TRACE_ATCUSTOM_MODEM == 1U)
@@ -57,6 +75,15 @@
 #endif /* USE_TRACE_ATCUSTOM_MODEM */
 
 /* Private variables ---------------------------------------------------------*/
+/* not initialized at startup when MODEM_CFG_CACHE_SECTION is a no-init section: kept over MCU reset */
+static atcm_cfg_cache_t modem_cfg_cache MODEM_CFG_CACHE_SECTION;
+
+/* SID and concatenated commands contexts of the SID suspended at a step boundary (see atcm_suspend_SID_context)
+ * only one transaction can be suspended: AT Core does not suspend a transaction while another one is suspended
+ * (atcore_step_suspended in at_core.c), the transactions run during the suspension run to completion
+ */
+static atcustom_SID_context_t    suspended_SID_ctxt;
+static atcustom_concat_context_t suspended_concat_ctxt;
 
 /* Global variables ----------------------------------------------------------*/
 
@@ -66,6 +93,19 @@ static void reserve_user_modem_cid(atcustom_persistent_context_t *p_persistent_c
                                    uint8_t reserved_modem_cid);
 static void affect_modem_cid(atcustom_persistent_context_t *p_persistent_ctxt,
                              CS_PDN_conf_id_t conf_id);
+static uint32_t fnv1a_hash(uint32_t hash, const uint8_t *p_data, uint32_t size);
+static uint16_t LUT_hash(const AT_CHAR_t *p_str, uint16_t size);
+static uint16_t LUT_get_entry(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id);
+static bool is_extended_cmd_name(const AT_CHAR_t *p_cmd_name);
+static at_status_t build_concat_cmd(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
+                                    AT_CHAR_t *p_concat_str, uint16_t concat_str_size);
+static uint32_t cfg_cache_checksum(void);
+static void cfg_cache_check(void);
+static uint32_t cfg_cache_PDN_fingerprint(const atcustom_modem_context_t *p_modem_ctxt, uint8_t *p_item);
+#if defined(MODEM_CFG_CACHE_RTC_BKP_FIRST)
+static void cfg_cache_RTC_restore(void);
+static void cfg_cache_RTC_save(void);
+#endif /* MODEM_CFG_CACHE_RTC_BKP_FIRST */
 
 /* Private function Definition -----------------------------------------------*/
 /*
@@ -371,7 +411,361 @@ CS_PDN_conf_id_t atcm_get_cid_current_SID(atcustom_modem_context_t *p_modem_ctxt
   return (current_conf_id);
 }
 
+/*
+*  FNV-1a hash of a data buffer, continuing from hash (FNV1A_HASH_INIT for a new hash)
+*/
+static uint32_t fnv1a_hash(uint32_t hash, const uint8_t *p_data, uint32_t size)
+{
+  uint32_t new_hash = hash;
+  uint32_t i;
+
+  for (i = 0U; i < size; i++)
+  {
+    new_hash ^= (uint32_t)p_data[i];
+    new_hash *= 16777619U;
+  }
+
+  return (new_hash);
+}
+
+/*
+*  Hash of a command string (FNV-1a), reduced to the size of the LUT hash table
+*/
+static uint16_t LUT_hash(const AT_CHAR_t *p_str, uint16_t size)
+{
+  uint32_t hash = fnv1a_hash(FNV1A_HASH_INIT, p_str, (uint32_t)size);
+
+  return ((uint16_t)(hash & ((uint32_t)MODEM_LUT_HASH_SIZE - 1U)));
+}
+
+/*
+*  Get the LUT entry of a command Id (MODEM_LUT_ENTRY_NONE if not found)
+*/
+static uint16_t LUT_get_entry(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
+{
+  uint16_t retval = MODEM_LUT_ENTRY_NONE;
+  uint32_t i;
+
+  if (cmd_id != CMD_AT_INVALID)
+  {
+    if ((p_modem_ctxt->LUT_index.indexed == 1U) && (cmd_id < MODEM_LUT_MAX_CMD_ID))
+    {
+      /* direct access */
+      if (p_modem_ctxt->LUT_index.idx_by_cmd_id[cmd_id] != MODEM_LUT_INDEX_NONE)
+      {
+        retval = p_modem_ctxt->LUT_index.idx_by_cmd_id[cmd_id];
+      }
+    }
+    else
+    {
+      /* search in LUT the cmd ID */
+      for (i = 0U; (i < p_modem_ctxt->modem_LUT_size) && (i < (uint32_t)MODEM_LUT_ENTRY_NONE); i++)
+      {
+        if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
+        {
+          retval = (uint16_t)i;
+          break;
+        }
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*
+*  Check if a command name uses the extended syntax (exple: "+CREG") rather than the basic syntax (exple: "E", "&D")
+*/
+static bool is_extended_cmd_name(const AT_CHAR_t *p_cmd_name)
+{
+  bool retval = false;
+  AT_CHAR_t first_char = p_cmd_name[0];
+
+  if ((first_char != 0U) &&
+      (first_char != (AT_CHAR_t)'&') &&
+      ((first_char < (AT_CHAR_t)'A') || (first_char > (AT_CHAR_t)'Z')) &&
+      ((first_char < (AT_CHAR_t)'a') || (first_char > (AT_CHAR_t)'z')))
+  {
+    retval = true;
+  }
+
+  return (retval);
+}
+
+/*
+*  Build the commands concatenated to the main command of the line: <;><name><sep><params> for each command.
+*  A ';' is only needed after an extended syntax command (ITU-T V.250).
+*  The main command parameters have to be built after this function (its build buffer is used for each command).
+*/
+static at_status_t build_concat_cmd(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
+                                    AT_CHAR_t *p_concat_str, uint16_t concat_str_size)
+{
+  at_status_t retval = ATSTATUS_OK;
+  const AT_CHAR_t *p_prev_name = p_atp_ctxt->current_atcmd.name;
+  const AT_CHAR_t *p_name;
+  const AT_CHAR_t *p_sep;
+  size_t concat_len = 0U;
+  size_t part_len;
+  uint8_t i;
+
+  p_concat_str[0] = 0U;
+
+  for (i = 1U; (i < p_atp_ctxt->current_atcmd.concat_nb) && (retval == ATSTATUS_OK); i++)
+  {
+    /* build the command parameters as if this command was sent alone */
+    p_atp_ctxt->current_atcmd.type = p_atp_ctxt->current_atcmd.concat_type[i];
+    p_atp_ctxt->current_atcmd.id = p_atp_ctxt->current_atcmd.concat_id[i];
+    (void) memset((void *)&p_atp_ctxt->current_atcmd.params[0], 0, sizeof(uint8_t) * (ATCMD_MAX_CMD_SIZE));
+    if ((p_atp_ctxt->current_atcmd.type == ATTYPE_WRITE_CMD) ||
+        (p_atp_ctxt->current_atcmd.type == ATTYPE_EXECUTION_CMD))
+    {
+      retval = (atcm_get_CmdBuildFunc(p_modem_ctxt, p_atp_ctxt->current_atcmd.id))(p_atp_ctxt, p_modem_ctxt);
+    }
+
+    switch (p_atp_ctxt->current_atcmd.type)
+    {
+      case ATTYPE_TEST_CMD:
+        p_sep = (const AT_CHAR_t *)"=?";
+        break;
+      case ATTYPE_READ_CMD:
+        p_sep = (const AT_CHAR_t *)"?";
+        break;
+      case ATTYPE_WRITE_CMD:
+        p_sep = (const AT_CHAR_t *)"=";
+        break;
+      default:
+        p_sep = (const AT_CHAR_t *)"";
+        break;
+    }
+
+    /* append <;><name><sep><params> */
+    p_name = atcm_get_CmdStr(p_modem_ctxt, p_atp_ctxt->current_atcmd.id);
+    part_len = strlen((const CRC_CHAR_t *)p_name) + strlen((const CRC_CHAR_t *)p_sep) +
+               strlen((const CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params) + 1U;
+    if ((retval == ATSTATUS_OK) && ((concat_len + part_len) < (size_t)concat_str_size))
+    {
+      (void) sprintf((CRC_CHAR_t *)&p_concat_str[concat_len], "%s%s%s%s",
+                     is_extended_cmd_name(p_prev_name) ? ";" : "",
+                     (const CRC_CHAR_t *)p_name,
+                     (const CRC_CHAR_t *)p_sep,
+                     (const CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params);
+      concat_len = strlen((const CRC_CHAR_t *)p_concat_str);
+      p_prev_name = p_name;
+    }
+    else
+    {
+      PRINT_ERR("concatenated command (id=%ld) can not be built", p_atp_ctxt->current_atcmd.id)
+      retval = ATSTATUS_ERROR;
+    }
+  }
+
+  /* restore the main command */
+  p_atp_ctxt->current_atcmd.type = p_atp_ctxt->current_atcmd.concat_type[0];
+  p_atp_ctxt->current_atcmd.id = p_atp_ctxt->current_atcmd.concat_id[0];
+  (void) memset((void *)&p_atp_ctxt->current_atcmd.params[0], 0, sizeof(uint8_t) * (ATCMD_MAX_CMD_SIZE));
+
+  return (retval);
+}
+
+/*
+*  Checksum of the modem configuration cache content
+*/
+static uint32_t cfg_cache_checksum(void)
+{
+  return (fnv1a_hash(FNV1A_HASH_INIT, (const uint8_t *)&modem_cfg_cache,
+                     (uint32_t)offsetof(atcm_cfg_cache_t, checksum)));
+}
+
+#if defined(MODEM_CFG_CACHE_RTC_BKP_FIRST)
+/*
+*  Restore the modem configuration cache from the RTC backup registers (content checked by the caller)
+*/
+static void cfg_cache_RTC_restore(void)
+{
+  uint32_t reg = MODEM_CFG_CACHE_RTC_BKP_FIRST;
+  uint8_t i;
+
+  modem_cfg_cache.magic = HAL_RTCEx_BKUPRead(&MODEM_CFG_CACHE_RTC_HANDLE, reg);
+  reg++;
+  modem_cfg_cache.committed = HAL_RTCEx_BKUPRead(&MODEM_CFG_CACHE_RTC_HANDLE, reg);
+  reg++;
+  for (i = 0U; i < MODEM_CFG_CACHE_NB_ITEMS; i++)
+  {
+    modem_cfg_cache.fingerprint[i] = HAL_RTCEx_BKUPRead(&MODEM_CFG_CACHE_RTC_HANDLE, reg);
+    reg++;
+  }
+  modem_cfg_cache.checksum = HAL_RTCEx_BKUPRead(&MODEM_CFG_CACHE_RTC_HANDLE, reg);
+}
+
+/*
+*  Save the modem configuration cache in the RTC backup registers
+*  checksum written last: a cache partially written (reset during the save) is invalid at next restore
+*/
+static void cfg_cache_RTC_save(void)
+{
+  uint32_t reg = MODEM_CFG_CACHE_RTC_BKP_FIRST;
+  uint8_t i;
+
+  HAL_RTCEx_BKUPWrite(&MODEM_CFG_CACHE_RTC_HANDLE, reg, modem_cfg_cache.magic);
+  reg++;
+  HAL_RTCEx_BKUPWrite(&MODEM_CFG_CACHE_RTC_HANDLE, reg, modem_cfg_cache.committed);
+  reg++;
+  for (i = 0U; i < MODEM_CFG_CACHE_NB_ITEMS; i++)
+  {
+    HAL_RTCEx_BKUPWrite(&MODEM_CFG_CACHE_RTC_HANDLE, reg, modem_cfg_cache.fingerprint[i]);
+    reg++;
+  }
+  HAL_RTCEx_BKUPWrite(&MODEM_CFG_CACHE_RTC_HANDLE, reg, modem_cfg_cache.checksum);
+}
+#endif /* MODEM_CFG_CACHE_RTC_BKP_FIRST */
+
+/*
+*  Check the modem configuration cache: cache is cleared if it has never been initialized or is corrupted
+*  (RAM content random at power up when the cache is in a no-init section)
+*  With MODEM_CFG_CACHE_RTC_BKP_FIRST, a cache not valid in RAM (MCU reset) is restored from the RTC backup registers
+*/
+static void cfg_cache_check(void)
+{
+#if defined(MODEM_CFG_CACHE_RTC_BKP_FIRST)
+  if (((modem_cfg_cache.magic != ATCM_CFG_CACHE_MAGIC) || (modem_cfg_cache.checksum != cfg_cache_checksum()))
+      && ((MODEM_CFG_CACHE_RTC_BKP_FIRST + ATCM_CFG_CACHE_RTC_BKP_NB) <= RTC_BKP_NUMBER))
+  {
+    cfg_cache_RTC_restore();
+  }
+#endif /* MODEM_CFG_CACHE_RTC_BKP_FIRST */
+
+  if ((modem_cfg_cache.magic != ATCM_CFG_CACHE_MAGIC) || (modem_cfg_cache.checksum != cfg_cache_checksum()))
+  {
+    (void) memset((void *)&modem_cfg_cache, 0, sizeof(atcm_cfg_cache_t));
+    modem_cfg_cache.magic = ATCM_CFG_CACHE_MAGIC;
+    modem_cfg_cache.checksum = cfg_cache_checksum();
+  }
+}
+
+/*
+*  Fingerprint of the PDN configuration of the current SID and corresponding cache item
+*/
+static uint32_t cfg_cache_PDN_fingerprint(const atcustom_modem_context_t *p_modem_ctxt, uint8_t *p_item)
+{
+  const csint_pdn_infos_t *p_pdn_infos;
+  CS_PDN_conf_id_t conf_id = p_modem_ctxt->SID_ctxt.pdn_conf_id;
+  uint8_t modem_cid = 0U;
+  uint32_t hash;
+  uint8_t i;
+
+  if (conf_id == CS_PDN_CONFIG_DEFAULT)
+  {
+    conf_id = p_modem_ctxt->persist.pdn_default_conf_id;
+  }
+  *p_item = (uint8_t)conf_id;
+
+  if (*p_item >= MODEM_CFG_CACHE_NB_ITEMS)
+  {
+    /* not a valid PDN configuration, no fingerprint */
+    hash = 0U;
+  }
+  else
+  {
+    for (i = 0U; i < MODEM_MAX_NB_PDP_CTXT; i++)
+    {
+      if (p_modem_ctxt->persist.modem_cid_table[i].affected_config == conf_id)
+      {
+        modem_cid = p_modem_ctxt->persist.modem_cid_table[i].mdm_cid_value;
+      }
+    }
+
+    /* modem identity: settings stored in another modem are not in this one
+     * then all the parameters sent to the modem for this PDN (strings with their terminating null character)
+     */
+    p_pdn_infos = &p_modem_ctxt->persist.pdp_ctxt_infos[conf_id];
+    hash = fnv1a_hash(FNV1A_HASH_INIT, (const uint8_t *)p_modem_ctxt->persist.imei,
+                      (uint32_t)strlen((const CRC_CHAR_t *)p_modem_ctxt->persist.imei) + 1U);
+    hash = fnv1a_hash(hash, &modem_cid, 1U);
+    hash = fnv1a_hash(hash, (const uint8_t *)&p_pdn_infos->apn_present, (uint32_t)sizeof(CS_Bool_t));
+    hash = fnv1a_hash(hash, (const uint8_t *)&p_pdn_infos->pdn_conf.pdp_type, (uint32_t)sizeof(CS_PDPtype_t));
+    hash = fnv1a_hash(hash, (const uint8_t *)p_pdn_infos->apn,
+                      (uint32_t)strlen((const CRC_CHAR_t *)p_pdn_infos->apn) + 1U);
+    hash = fnv1a_hash(hash, (const uint8_t *)p_pdn_infos->pdn_conf.username,
+                      (uint32_t)strlen((const CRC_CHAR_t *)p_pdn_infos->pdn_conf.username) + 1U);
+    hash = fnv1a_hash(hash, (const uint8_t *)p_pdn_infos->pdn_conf.password,
+                      (uint32_t)strlen((const CRC_CHAR_t *)p_pdn_infos->pdn_conf.password) + 1U);
+  }
+
+  return (hash);
+}
+
 /* functions ------------------------------------------------------------------ */
+/**
+  * @brief  Register the modem LUT and build its indexes.
+  * @note   Commands are then found by direct access on the command Id and by hash on the command string,
+  *         instead of a linear search in the LUT. If several entries have the same command Id or the same
+  *         command string, the first one in the LUT is used (as for a linear search).
+  * @param  p_modem_ctxt modem context
+  * @param  p_modem_LUT modem LUT
+  * @param  modem_LUT_size number of entries in the modem LUT
+  * @retval none
+  */
+void atcm_set_modem_LUT(atcustom_modem_context_t *p_modem_ctxt,
+                        const atcustom_LUT_t *p_modem_LUT, uint32_t modem_LUT_size)
+{
+  atcustom_LUT_index_t *p_index = &p_modem_ctxt->LUT_index;
+  uint16_t i;
+  uint16_t pos;
+  uint16_t str_len;
+  uint8_t entry;
+
+  p_modem_ctxt->modem_LUT_size = modem_LUT_size;
+  p_modem_ctxt->p_modem_LUT = p_modem_LUT;
+
+  (void) memset((void *)p_index->idx_by_cmd_id, (int32_t)MODEM_LUT_INDEX_NONE, sizeof(p_index->idx_by_cmd_id));
+  (void) memset((void *)p_index->idx_by_str_hash, (int32_t)MODEM_LUT_INDEX_NONE, sizeof(p_index->idx_by_str_hash));
+
+  if (modem_LUT_size <= MODEM_LUT_MAX_SIZE)
+  {
+    /* reverse order: first entry of the LUT overrides next ones with same command Id */
+    for (i = (uint16_t)modem_LUT_size; i > 0U; i--)
+    {
+      if (p_modem_LUT[i - 1U].cmd_id < MODEM_LUT_MAX_CMD_ID)
+      {
+        p_index->idx_by_cmd_id[p_modem_LUT[i - 1U].cmd_id] = (uint8_t)(i - 1U);
+      }
+    }
+
+    for (i = 0U; i < (uint16_t)modem_LUT_size; i++)
+    {
+      str_len = (uint16_t) strlen((const CRC_CHAR_t *)p_modem_LUT[i].cmd_str);
+      p_index->str_len[i] = (uint8_t)str_len;
+
+      /* empty strings are never searched */
+      if (str_len > 0U)
+      {
+        /* linear probing until a free slot or an entry with the same string (keep first one) */
+        pos = LUT_hash(p_modem_LUT[i].cmd_str, str_len);
+        entry = p_index->idx_by_str_hash[pos];
+        while ((entry != MODEM_LUT_INDEX_NONE) &&
+               ((p_index->str_len[entry] != str_len) ||
+                (0 != memcmp((const void *)p_modem_LUT[entry].cmd_str,
+                             (const void *)p_modem_LUT[i].cmd_str, (size_t)str_len))))
+        {
+          pos = (pos + 1U) & (MODEM_LUT_HASH_SIZE - 1U);
+          entry = p_index->idx_by_str_hash[pos];
+        }
+        if (entry == MODEM_LUT_INDEX_NONE)
+        {
+          p_index->idx_by_str_hash[pos] = (uint8_t)i;
+        }
+      }
+    }
+    p_index->indexed = 1U;
+  }
+  else
+  {
+    /* LUT too big to be indexed: linear search */
+    PRINT_ERR("modem LUT not indexed (size=%ld)", modem_LUT_size)
+    p_index->indexed = 0U;
+  }
+}
+
 /**
   * @brief  Search command string corresponding to a command Id
   *
@@ -382,22 +776,11 @@ CS_PDN_conf_id_t atcm_get_cid_current_SID(atcustom_modem_context_t *p_modem_ctxt
 const AT_CHAR_t *atcm_get_CmdStr(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
 {
   const AT_CHAR_t *retval = ((uint8_t *)"");
-  uint16_t i = 0U;
-  bool leave_loop = false;
+  uint16_t entry = LUT_get_entry(p_modem_ctxt, cmd_id);
 
-  /* check if this is the invalid cmd id*/
-  if (cmd_id != CMD_AT_INVALID)
+  if (entry != MODEM_LUT_ENTRY_NONE)
   {
-    /* search in LUT the cmd ID */
-    do
-    {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = (const AT_CHAR_t *)(&p_modem_ctxt->p_modem_LUT[i].cmd_str);
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    retval = (const AT_CHAR_t *)(&p_modem_ctxt->p_modem_LUT[entry].cmd_str);
   }
 
   return (retval);
@@ -413,22 +796,11 @@ const AT_CHAR_t *atcm_get_CmdStr(const atcustom_modem_context_t *p_modem_ctxt, u
 uint32_t atcm_get_CmdTimeout(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
 {
   uint32_t retval = MODEM_DEFAULT_TIMEOUT;
+  uint16_t entry = LUT_get_entry(p_modem_ctxt, cmd_id);
 
-  /* check if this is the invalid cmd id */
-  if (cmd_id != CMD_AT_INVALID)
+  if (entry != MODEM_LUT_ENTRY_NONE)
   {
-    /* search in LUT the cmd ID */
-    bool leave_loop = false;
-    uint16_t i = 0U;
-    do
-    {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = p_modem_ctxt->p_modem_LUT[i].cmd_timeout;
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    retval = p_modem_ctxt->p_modem_LUT[entry].cmd_timeout;
   }
 
   return (retval);
@@ -444,21 +816,11 @@ uint32_t atcm_get_CmdTimeout(const atcustom_modem_context_t *p_modem_ctxt, uint3
 CmdBuildFuncTypeDef atcm_get_CmdBuildFunc(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
 {
   CmdBuildFuncTypeDef retval = fCmdBuild_NoParams; /* return default value */
+  uint16_t entry = LUT_get_entry(p_modem_ctxt, cmd_id);
 
-  if (cmd_id != CMD_AT_INVALID)
+  if (entry != MODEM_LUT_ENTRY_NONE)
   {
-    uint16_t i = 0U;
-    bool leave_loop = false;
-    /* search in LUT the cmd ID */
-    do
-    {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = p_modem_ctxt->p_modem_LUT[i].cmd_BuildFunc;
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    retval = p_modem_ctxt->p_modem_LUT[entry].cmd_BuildFunc;
   }
 
   return (retval);
@@ -474,21 +836,11 @@ CmdBuildFuncTypeDef atcm_get_CmdBuildFunc(const atcustom_modem_context_t *p_mode
 CmdAnalyzeFuncTypeDef atcm_get_CmdAnalyzeFunc(const atcustom_modem_context_t *p_modem_ctxt, uint32_t cmd_id)
 {
   CmdAnalyzeFuncTypeDef retval = fRspAnalyze_None;
+  uint16_t entry = LUT_get_entry(p_modem_ctxt, cmd_id);
 
-  if (cmd_id != CMD_AT_INVALID)
+  if (entry != MODEM_LUT_ENTRY_NONE)
   {
-    /* search in LUT the cmd ID */
-    uint16_t i = 0U;
-    bool leave_loop = false;
-    do
-    {
-      if (p_modem_ctxt->p_modem_LUT[i].cmd_id == cmd_id)
-      {
-        retval = p_modem_ctxt->p_modem_LUT[i].rsp_AnalyzeFunc;
-        leave_loop = true;
-      }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    retval = p_modem_ctxt->p_modem_LUT[entry].rsp_AnalyzeFunc;
   }
 
   return (retval);
@@ -544,6 +896,9 @@ void atcm_program_AT_CMD(atcustom_modem_context_t *p_modem_ctxt,
                          uint32_t cmd_id,
                          atcustom_FinalCmd_t final)
 {
+  /* new command line: not made of concatenated commands until atcm_concat_line_programmed */
+  p_modem_ctxt->concat_ctxt.line.sid = SID_INVALID;
+
   /* command type */
   p_atp_ctxt->current_atcmd.type = cmd_type;
   /* command id */
@@ -571,6 +926,9 @@ void atcm_program_AT_CMD_ANSWER_OPTIONAL(atcustom_modem_context_t *p_modem_ctxt,
                                          uint32_t cmd_id,
                                          atcustom_FinalCmd_t final)
 {
+  /* new command line: not made of concatenated commands until atcm_concat_line_programmed */
+  p_modem_ctxt->concat_ctxt.line.sid = SID_INVALID;
+
   /* command type */
   p_atp_ctxt->current_atcmd.type = cmd_type;
   /* command id */
@@ -584,6 +942,155 @@ void atcm_program_AT_CMD_ANSWER_OPTIONAL(atcustom_modem_context_t *p_modem_ctxt,
   p_atp_ctxt->cmd_timeout =  atcm_get_CmdTimeout(p_modem_ctxt, p_atp_ctxt->current_atcmd.id);
 }
 
+/**
+  * @brief  Concatenate an AT command to the command programmed for this step: both are sent on the same line
+  *         (exple: "AT+CEREG?;+CREG?") and share a single final answer, saving a modem round-trip.
+  * @note   To call after atcm_program_AT_CMD: the timeout of the line is the sum of the commands timeouts.
+  * @note   The answers of a concatenated command are analyzed once atcm_select_concat_cmd has switched the
+  *         current command to it. Use only for commands whose answer is empty or starts with the command prefix.
+  * @param  p_modem_ctxt
+  * @param  p_atp_ctxt
+  * @param  cmd_type
+  * @param  cmd_id
+  * @retval at_status_t
+  */
+at_status_t atcm_program_AT_CMD_CONCAT(atcustom_modem_context_t *p_modem_ctxt,
+                                       atparser_context_t *p_atp_ctxt,
+                                       at_type_t cmd_type,
+                                       uint32_t cmd_id)
+{
+  at_status_t retval = ATSTATUS_OK;
+  atcmd_desc_t *p_atcmd = &p_atp_ctxt->current_atcmd;
+
+  if ((p_atcmd->type != ATTYPE_TEST_CMD) && (p_atcmd->type != ATTYPE_READ_CMD) &&
+      (p_atcmd->type != ATTYPE_WRITE_CMD) && (p_atcmd->type != ATTYPE_EXECUTION_CMD))
+  {
+    PRINT_ERR("no AT command to concatenate with")
+    retval = ATSTATUS_ERROR;
+  }
+  else if (p_atcmd->concat_nb >= ATCMD_MAX_CONCAT_NB)
+  {
+    PRINT_ERR("too many concatenated commands")
+    retval = ATSTATUS_ERROR;
+  }
+  else
+  {
+    if (p_atcmd->concat_nb == 0U)
+    {
+      /* first entry of the line is the main command */
+      p_atcmd->concat_type[0] = p_atcmd->type;
+      p_atcmd->concat_id[0] = p_atcmd->id;
+      p_atcmd->concat_nb = 1U;
+    }
+    p_atcmd->concat_type[p_atcmd->concat_nb] = cmd_type;
+    p_atcmd->concat_id[p_atcmd->concat_nb] = cmd_id;
+    p_atcmd->concat_nb++;
+
+    /* the line answer is received when all commands have been executed */
+    p_atp_ctxt->cmd_timeout += atcm_get_CmdTimeout(p_modem_ctxt, cmd_id);
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Select the command of the current line which corresponds to the answer received.
+  * @note   Called by the modem analyzeCmd once the command prefix has been identified (atcm_searchCmdInLUT):
+  *         the following analysis of the answer sees the concatenated command as the current command.
+  * @param  p_atp_ctxt
+  * @param  cmd_id_received
+  * @retval none
+  */
+void atcm_select_concat_cmd(atparser_context_t *p_atp_ctxt, uint32_t cmd_id_received)
+{
+  atcmd_desc_t *p_atcmd = &p_atp_ctxt->current_atcmd;
+  uint8_t i;
+
+  for (i = 0U; i < p_atcmd->concat_nb; i++)
+  {
+    if (p_atcmd->concat_id[i] == cmd_id_received)
+    {
+      p_atcmd->type = p_atcmd->concat_type[i];
+      p_atcmd->id = p_atcmd->concat_id[i];
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  Check if commands can be concatenated to the command programmed for this step.
+  * @note   Concatenation is not allowed for the steps of a line which answered an error: they are sent again
+  *         one command per line until the end of the SID (see atcm_concat_line_error).
+  * @param  p_modem_ctxt
+  * @param  p_atp_ctxt
+  * @retval at_bool_t
+  */
+at_bool_t atcm_concat_allowed(const atcustom_modem_context_t *p_modem_ctxt, const atparser_context_t *p_atp_ctxt)
+{
+  at_bool_t retval = AT_TRUE;
+  const atcustom_concat_steps_t *p_replay = &p_modem_ctxt->concat_ctxt.replay;
+
+  if ((p_replay->sid == p_atp_ctxt->current_SID) &&
+      (p_atp_ctxt->step >= p_replay->first_step) &&
+      (p_atp_ctxt->step <= p_replay->last_step))
+  {
+    retval = AT_FALSE;
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Record the steps of the command line programmed for this step (main command and concatenated commands).
+  * @note   To call after atcm_program_AT_CMD_CONCAT: the line consumes the steps of its concatenated commands,
+  *         each of these steps has to program its command alone when the line is replayed.
+  * @param  p_modem_ctxt
+  * @param  p_atp_ctxt
+  * @param  steps_nb number of steps consumed by the concatenated commands
+  * @retval none
+  */
+void atcm_concat_line_programmed(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt,
+                                 uint8_t steps_nb)
+{
+  atcustom_concat_steps_t *p_line = &p_modem_ctxt->concat_ctxt.line;
+
+  p_line->sid = p_atp_ctxt->current_SID;
+  p_line->first_step = p_atp_ctxt->step;
+  p_atp_ctxt->step += steps_nb;
+  p_line->last_step = p_atp_ctxt->step;
+}
+
+/**
+  * @brief  Process an error answered to a line of concatenated commands.
+  * @note   Called by the modem analysis of ERROR and +CME ERROR before its per command treatments.
+  *         The modem stops the line at the first command in error: the error can not be assigned to a command
+  *         and the following commands have not been executed. The steps of the line are replayed with one
+  *         command per line, so the error treatment of each command applies as if it was never concatenated.
+  * @param  p_modem_ctxt
+  * @param  p_atp_ctxt
+  * @retval at_bool_t AT_TRUE if the line is replayed (the error is ignored), AT_FALSE otherwise
+  */
+at_bool_t atcm_concat_line_error(atcustom_modem_context_t *p_modem_ctxt, atparser_context_t *p_atp_ctxt)
+{
+  at_bool_t retval = AT_FALSE;
+  atcustom_concat_context_t *p_concat = &p_modem_ctxt->concat_ctxt;
+
+  /* the step has been incremented when the line has been built */
+  if ((p_atp_ctxt->current_atcmd.concat_nb > 1U) &&
+      (p_concat->line.sid == p_atp_ctxt->current_SID) &&
+      (p_atp_ctxt->step == (p_concat->line.last_step + 1U)))
+  {
+    PRINT_INFO("error on concatenated commands line, send them one per line")
+    p_concat->replay = p_concat->line;
+    p_concat->line.sid = SID_INVALID;
+    p_atp_ctxt->step = p_concat->replay.first_step;
+    p_atp_ctxt->is_final_cmd = 0U;
+    retval = AT_TRUE;
+  }
+
+  return (retval);
+}
+
 /**
   * @brief  Allow to specify a command timeout different from the default one.
   * @param  p_modem_ctxt
@@ -667,6 +1174,228 @@ void atcm_program_SKIP_CMD(atparser_context_t *p_atp_ctxt)
   p_atp_ctxt->cmd_timeout = 0U;
 }
 
+/**
+  * @brief  Search the sequence description of a SID
+  * @param  p_seq_LUT sequences table of the modem
+  * @param  seq_LUT_size number of sequences in the table
+  * @param  sid SID to find
+  * @retval sequence of the SID, NULL if the SID is not described by a sequence
+  */
+const atcm_SID_seq_t *atcm_get_SID_sequence(const atcm_SID_seq_t *p_seq_LUT, uint32_t seq_LUT_size, at_msg_t sid)
+{
+  const atcm_SID_seq_t *retval = NULL;
+  uint32_t i = 0U;
+
+  while ((retval == NULL) && (i < seq_LUT_size))
+  {
+    if (p_seq_LUT[i].sid == sid)
+    {
+      retval = &p_seq_LUT[i];
+    }
+    i++;
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Program the command of a SID sequence step
+  * @note   A skipped or empty step is programmed as SKIP_CMD, or as NO_MORE_CMD if it is the last step.
+  * @param  p_modem_ctxt
+  * @param  p_atp_ctxt
+  * @param  p_seq sequence of the current SID
+  * @param  seq_step step in the sequence (first step is 0)
+  * @retval at_status_t ATSTATUS_ERROR if the step is not part of the sequence
+  */
+at_status_t atcm_program_SID_sequence(atcustom_modem_context_t *p_modem_ctxt,
+                                      atparser_context_t *p_atp_ctxt,
+                                      const atcm_SID_seq_t *p_seq,
+                                      uint8_t seq_step)
+{
+  at_status_t retval = ATSTATUS_OK;
+  const atcm_SID_seq_step_t *p_step;
+  atcustom_FinalCmd_t final;
+  uint8_t last_step;
+
+  if (seq_step >= p_seq->steps_nb)
+  {
+    /* error, invalid step */
+    retval = ATSTATUS_ERROR;
+  }
+  else
+  {
+    p_step = &p_seq->p_steps[seq_step];
+    final = ((seq_step + 1U) == p_seq->steps_nb) ? FINAL_CMD : INTERMEDIATE_CMD;
+
+    if ((p_step->cmd_type == ATTYPE_NO_CMD) ||
+        ((p_step->skip_Func != NULL) && ((p_step->skip_Func)(p_modem_ctxt) == AT_TRUE)))
+    {
+      /* nothing to send for this step */
+      if (final == FINAL_CMD)
+      {
+        atcm_program_NO_MORE_CMD(p_atp_ctxt);
+      }
+      else
+      {
+        atcm_program_SKIP_CMD(p_atp_ctxt);
+      }
+    }
+    else
+    {
+      if (p_step->prepare_Func != NULL)
+      {
+        (p_step->prepare_Func)(p_modem_ctxt);
+      }
+
+      if ((p_step->options & ATCM_SEQ_ANSWER_OPT) != 0U)
+      {
+        atcm_program_AT_CMD_ANSWER_OPTIONAL(p_modem_ctxt, p_atp_ctxt, p_step->cmd_type, p_step->cmd_id, final);
+      }
+      else
+      {
+        atcm_program_AT_CMD(p_modem_ctxt, p_atp_ctxt, p_step->cmd_type, p_step->cmd_id, final);
+      }
+
+      /* append the following steps to send on the same line, they are consumed now
+       * (not when the steps of this line are replayed after an error)
+       */
+      last_step = seq_step;
+      while ((retval == ATSTATUS_OK) &&
+             (atcm_concat_allowed(p_modem_ctxt, p_atp_ctxt) == AT_TRUE) &&
+             ((last_step + 1U) < p_seq->steps_nb) &&
+             ((p_seq->p_steps[last_step + 1U].options & ATCM_SEQ_CONCAT) != 0U))
+      {
+        last_step++;
+        p_step = &p_seq->p_steps[last_step];
+        if ((p_step->cmd_type != ATTYPE_NO_CMD) &&
+            ((p_step->skip_Func == NULL) || ((p_step->skip_Func)(p_modem_ctxt) == AT_FALSE)))
+        {
+          if (p_step->prepare_Func != NULL)
+          {
+            (p_step->prepare_Func)(p_modem_ctxt);
+          }
+          retval = atcm_program_AT_CMD_CONCAT(p_modem_ctxt, p_atp_ctxt, p_step->cmd_type, p_step->cmd_id);
+        }
+      }
+      if (last_step != seq_step)
+      {
+        atcm_concat_line_programmed(p_modem_ctxt, p_atp_ctxt, (uint8_t)(last_step - seq_step));
+      }
+      if ((last_step + 1U) == p_seq->steps_nb)
+      {
+        p_atp_ctxt->is_final_cmd = 1U;
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  SID sequence prepare function: AT+CGATT write command requests attachment
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+void atcm_seq_prepare_CGATT_attach(atcustom_modem_context_t *p_modem_ctxt)
+{
+  p_modem_ctxt->CMD_ctxt.cgatt_write_cmd_param = CGATT_ATTACHED;
+}
+
+/**
+  * @brief  SID sequence prepare function: AT+CGATT write command requests detachment
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+void atcm_seq_prepare_CGATT_detach(atcustom_modem_context_t *p_modem_ctxt)
+{
+  p_modem_ctxt->CMD_ctxt.cgatt_write_cmd_param = CGATT_DETACHED;
+}
+
+/**
+  * @brief  SID sequence prepare function: PDN activation command requests activation
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+void atcm_seq_prepare_PDN_activate(atcustom_modem_context_t *p_modem_ctxt)
+{
+  p_modem_ctxt->CMD_ctxt.pdn_state = PDN_STATE_ACTIVATE;
+}
+
+/* --------------------------------------------------------------------------------------------------------- */
+/**
+  * @brief  Analyze a block of received characters with the modem syntax automaton.
+  * @note   Called under interruption, do not put trace here.
+  *         Characters which can not change the automaton state are skipped in one step:
+  *         - characters before <CR> when waiting for <CR> (searched with memchr)
+  *         - socket data payload when its expected size is known
+  *         Other characters are analyzed one by one with the modem callback, so messages framing is the same
+  *         than when the modem callback is applied to each character.
+  * @param  p_modem_ctxt Pointer to the modem context.
+  * @param  checkEndOfMsgCallback Modem callback analyzing one character.
+  * @param  p_data Pointer to the received characters.
+  * @param  size Number of received characters.
+  * @param  p_endOfMsg Set to 1 if last character analyzed is an end of message, 0 otherwise.
+  * @retval number of characters analyzed
+  */
+uint16_t atcm_checkEndOfMsgBlock(atcustom_modem_context_t *p_modem_ctxt,
+                                 ATC_checkEndOfMsgCallbackTypeDef checkEndOfMsgCallback,
+                                 const uint8_t *p_data, uint16_t size, uint8_t *p_endOfMsg)
+{
+  uint16_t count = 0U;
+  uint16_t skip_size;
+  uint32_t remaining_data;
+  const uint8_t *p_cr;
+  atcustom_SOCKET_context_t *p_socket_ctxt = &p_modem_ctxt->socket_ctxt;
+
+  *p_endOfMsg = 0U;
+
+  while ((count < size) && (*p_endOfMsg == 0U))
+  {
+    skip_size = 0U;
+
+    /* when waiting for the socket send prompt, each character has to be analyzed */
+    if (p_socket_ctxt->socket_send_state == SocketSendState_No_Activity)
+    {
+      if ((p_modem_ctxt->state_SyntaxAutomaton == WAITING_FOR_INIT_CR) ||
+          (p_modem_ctxt->state_SyntaxAutomaton == WAITING_FOR_CR) ||
+          ((p_modem_ctxt->state_SyntaxAutomaton == WAITING_FOR_FIRST_CHAR) &&
+           (p_socket_ctxt->socket_RxData_state != SocketRxDataState_waiting_header) &&
+           (p_socket_ctxt->socket_RxData_state != SocketRxDataState_receiving_header) &&
+           (p_socket_ctxt->socket_RxData_state != SocketRxDataState_receiving_data)))
+      {
+        /* only <CR> can change the automaton state: skip all characters before it */
+        p_cr = (const uint8_t *) memchr((const void *) &p_data[count], (int32_t)'\r', (size_t)(size - count));
+        skip_size = (p_cr == NULL) ? (size - count) : (uint16_t)(p_cr - &p_data[count]);
+      }
+      else if ((p_modem_ctxt->state_SyntaxAutomaton == WAITING_FOR_SOCKET_DATA) &&
+               (p_socket_ctxt->socket_rx_expected_buf_size > (p_socket_ctxt->socket_rx_count_bytes_received + 1U)))
+      {
+        /* socket data: count all characters except the last one of the payload (analyzed by the modem callback) */
+        remaining_data = p_socket_ctxt->socket_rx_expected_buf_size -
+                         p_socket_ctxt->socket_rx_count_bytes_received - 1U;
+        skip_size = ((uint32_t)size - (uint32_t)count > remaining_data) ? (uint16_t)remaining_data : (size - count);
+        p_socket_ctxt->socket_rx_count_bytes_received += skip_size;
+      }
+      else
+      {
+        /* character has to be analyzed by the modem callback */
+      }
+    }
+
+    if (skip_size != 0U)
+    {
+      count += skip_size;
+    }
+    else
+    {
+      *p_endOfMsg = (*checkEndOfMsgCallback)(p_data[count]);
+      count++;
+    }
+  }
+
+  return (count);
+}
+
 /* --------------------------------------------------------------------------------------------------------- */
 /**
   * @brief  atcm_modem_init
@@ -682,6 +1411,8 @@ void atcm_modem_init(atcustom_modem_context_t *p_modem_ctxt)
   atcm_reset_SID_context(&p_modem_ctxt->SID_ctxt);
   atcm_reset_CMD_context(&p_modem_ctxt->CMD_ctxt);
   atcm_reset_SOCKET_context(p_modem_ctxt);
+  p_modem_ctxt->concat_ctxt.line.sid = SID_INVALID;
+  p_modem_ctxt->concat_ctxt.replay.sid = SID_INVALID;
   p_modem_ctxt->state_SyntaxAutomaton = WAITING_FOR_INIT_CR;
 }
 
@@ -698,9 +1429,72 @@ void atcm_modem_reset(atcustom_modem_context_t *p_modem_ctxt)
   atcm_reset_persistent_context(&p_modem_ctxt->persist);
   atcm_reset_CMD_context(&p_modem_ctxt->CMD_ctxt);
   atcm_reset_SOCKET_context(p_modem_ctxt);
+  p_modem_ctxt->concat_ctxt.line.sid = SID_INVALID;
+  p_modem_ctxt->concat_ctxt.replay.sid = SID_INVALID;
   p_modem_ctxt->state_SyntaxAutomaton = WAITING_FOR_INIT_CR;
 }
 
+/**
+  * @brief  Check if a SID can be suspended at a step boundary
+  * @note   The remaining steps of these SIDs do not wait for an URC and only use the SID context.
+  *         The modems use it in the customization part of their suspend_SID function.
+  * @param  sid
+  * @retval at_bool_t
+  */
+at_bool_t atcm_SID_can_be_suspended(at_msg_t sid)
+{
+  at_bool_t retval;
+
+  switch (sid)
+  {
+    case SID_CS_GET_DEVICE_INFO:
+    case SID_CS_REGISTER_NET:
+    case SID_CS_GET_NETSTATUS:
+    case SID_CS_GET_ATTACHSTATUS:
+    case SID_CS_GET_SIGNAL_QUALITY:
+      retval = AT_TRUE;
+      break;
+    default:
+      retval = AT_FALSE;
+      break;
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Save the contexts of the SID suspended at a step boundary, contexts are ready for another SID
+  * @note   The persistent and socket contexts are shared with the SIDs run during the suspension.
+  *         The command context is set again by each command.
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+void atcm_suspend_SID_context(atcustom_modem_context_t *p_modem_ctxt)
+{
+  PRINT_API("enter atcm_suspend_SID_context")
+
+  (void) memcpy((void *)&suspended_SID_ctxt, (const void *)&p_modem_ctxt->SID_ctxt, sizeof(atcustom_SID_context_t));
+  (void) memcpy((void *)&suspended_concat_ctxt, (const void *)&p_modem_ctxt->concat_ctxt,
+                sizeof(atcustom_concat_context_t));
+  atcm_reset_SID_context(&p_modem_ctxt->SID_ctxt);
+  p_modem_ctxt->concat_ctxt.line.sid = SID_INVALID;
+  p_modem_ctxt->concat_ctxt.replay.sid = SID_INVALID;
+}
+
+/**
+  * @brief  Restore the contexts saved by atcm_suspend_SID_context
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+void atcm_resume_SID_context(atcustom_modem_context_t *p_modem_ctxt)
+{
+  PRINT_API("enter atcm_resume_SID_context")
+
+  (void) memcpy((void *)&p_modem_ctxt->SID_ctxt, (const void *)&suspended_SID_ctxt, sizeof(atcustom_SID_context_t));
+  (void) memcpy((void *)&p_modem_ctxt->concat_ctxt, (const void *)&suspended_concat_ctxt,
+                sizeof(atcustom_concat_context_t));
+}
+
 /**
   * @brief  atcm_modem_build_cmd
   * @param  p_modem_ctxt
@@ -713,6 +1507,7 @@ at_status_t atcm_modem_build_cmd(atcustom_modem_context_t *p_modem_ctxt,
                                  uint32_t *p_ATcmdTimeout)
 {
   at_status_t retval = ATSTATUS_OK;
+  AT_CHAR_t concat_str[ATCM_CONCAT_MAX_SIZE];
 
   /* 1- set the commande name (get it from LUT) */
   const AT_CHAR_t *p_cmd_name_string = atcm_get_CmdStr(p_modem_ctxt, p_atp_ctxt->current_atcmd.id);
@@ -726,15 +1521,38 @@ at_status_t atcm_modem_build_cmd(atcustom_modem_context_t *p_modem_ctxt,
             p_atp_ctxt->current_atcmd.type,
             string_length)
 
-  /* 2- set the command parameters (only for write or execution commands or for data) */
-  if ((p_atp_ctxt->current_atcmd.type == ATTYPE_WRITE_CMD) ||
-      (p_atp_ctxt->current_atcmd.type == ATTYPE_EXECUTION_CMD) ||
-      (p_atp_ctxt->current_atcmd.type == ATTYPE_RAW_CMD))
+  /* 2- build the commands concatenated on the same line (if any) */
+  concat_str[0] = 0U;
+  if (p_atp_ctxt->current_atcmd.concat_nb > 1U)
+  {
+    retval = build_concat_cmd(p_modem_ctxt, p_atp_ctxt, concat_str, ATCM_CONCAT_MAX_SIZE);
+  }
+
+  /* 3- set the command parameters (only for write or execution commands or for data) */
+  if ((retval == ATSTATUS_OK) &&
+      ((p_atp_ctxt->current_atcmd.type == ATTYPE_WRITE_CMD) ||
+       (p_atp_ctxt->current_atcmd.type == ATTYPE_EXECUTION_CMD) ||
+       (p_atp_ctxt->current_atcmd.type == ATTYPE_RAW_CMD)))
   {
     retval = (atcm_get_CmdBuildFunc(p_modem_ctxt, p_atp_ctxt->current_atcmd.id))(p_atp_ctxt, p_modem_ctxt);
   }
 
-  /* 3- set command timeout (has been set in command programmation) */
+  /* 4- append the concatenated commands after the command parameters */
+  if ((retval == ATSTATUS_OK) && (concat_str[0] != 0U))
+  {
+    if ((strlen((CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params) + strlen((CRC_CHAR_t *)concat_str))
+        < (size_t)ATCMD_MAX_CMD_SIZE)
+    {
+      (void) strcat((CRC_CHAR_t *)p_atp_ctxt->current_atcmd.params, (CRC_CHAR_t *)concat_str);
+    }
+    else
+    {
+      PRINT_ERR("concatenated command line too long")
+      retval = ATSTATUS_ERROR;
+    }
+  }
+
+  /* 5- set command timeout (has been set in command programmation) */
   *p_ATcmdTimeout = p_atp_ctxt->cmd_timeout;
   PRINT_DBG("==== CMD TIMEOUT = %ld ====", *p_ATcmdTimeout)
 
@@ -760,6 +1578,9 @@ at_status_t atcm_modem_get_rsp(atcustom_modem_context_t *p_modem_ctxt,
 {
   at_status_t retval = ATSTATUS_OK;
 
+  /* end of the SID: commands can be concatenated again */
+  p_modem_ctxt->concat_ctxt.replay.sid = SID_INVALID;
+
   /* prepare response for a SID
   *  all common behaviors for SID which are returning data in rsp_buf have to be implemented here
   */
@@ -1318,6 +2139,9 @@ at_status_t atcm_modem_get_error(atcustom_modem_context_t *p_modem_ctxt,
   UNUSED(p_atp_ctxt);
   at_status_t retval = ATSTATUS_OK;
 
+  /* end of the SID: commands can be concatenated again */
+  p_modem_ctxt->concat_ctxt.replay.sid = SID_INVALID;
+
   /* prepare error report */
   if (DATAPACK_writeStruct(p_rsp_buf,
                            (uint16_t) CSMT_ERROR_REPORT,
@@ -1693,6 +2517,7 @@ void atcm_reset_persistent_context(atcustom_persistent_context_t *p_persistent_c
   p_persistent_ctxt->sim_selected = CS_MODEM_SIM_SOCKET_0; /* default SIM slot selected */
   p_persistent_ctxt->flowCtrl_RTS = 0xFF;       /* not initialized (from AT+IFC) */
   p_persistent_ctxt->flowCtrl_CTS = 0xFF;       /* not initialized (from AT+IFC) */
+  p_persistent_ctxt->imei[0] = 0U;              /* not read yet: the modem may have been changed */
 
   /* ping infos */
   (void) memset((void *)&p_persistent_ctxt->ping_infos, 0, sizeof(csint_ping_params_t));
@@ -1837,33 +2662,60 @@ at_status_t atcm_searchCmdInLUT(atcustom_modem_context_t *p_modem_ctxt,
   }
   else
   {
-    /* search in LUT the ID corresponding to command received */
-    bool leave_loop = false;
-    uint16_t i = 0U;
-    do
+    const atcustom_LUT_index_t *p_index = &p_modem_ctxt->LUT_index;
+    const AT_CHAR_t *p_str = &p_msg_in->buffer[element_infos->str_start_idx];
+    uint32_t i;
+    uint16_t pos;
+    uint8_t hash_entry;
+    uint16_t entry = MODEM_LUT_ENTRY_NONE;
+
+    if (p_index->indexed == 1U)
+    {
+      /* search in hash table the ID corresponding to command received */
+      pos = LUT_hash(p_str, element_infos->str_size);
+      do
+      {
+        hash_entry = p_index->idx_by_str_hash[pos];
+        if ((hash_entry != MODEM_LUT_INDEX_NONE) &&
+            (p_index->str_len[hash_entry] == element_infos->str_size) &&
+            (0 == memcmp((const void *)p_str,
+                         (const void *)p_modem_ctxt->p_modem_LUT[hash_entry].cmd_str,
+                         (size_t) element_infos->str_size)))
+        {
+          /* found */
+          entry = hash_entry;
+          break;
+        }
+        pos = (pos + 1U) & (MODEM_LUT_HASH_SIZE - 1U);
+      } while (hash_entry != MODEM_LUT_INDEX_NONE);
+    }
+    else
     {
-      /* if string length > 0 */
-      if (strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str) > 0U)
+      /* search in LUT the ID corresponding to command received */
+      for (i = 0U; (i < p_modem_ctxt->modem_LUT_size) && (i < (uint32_t)MODEM_LUT_ENTRY_NONE) &&
+           (entry == MODEM_LUT_ENTRY_NONE); i++)
       {
-        /* compare strings size first */
-        if ((strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str) == element_infos->str_size))
+        /* if string length > 0, compare strings size first, then strings content */
+        size_t lut_str_len = strlen((const CRC_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str);
+        if ((lut_str_len > 0U) &&
+            (lut_str_len == (size_t) element_infos->str_size) &&
+            (0 == memcmp((const void *)p_str,
+                         (const void *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str,
+                         (size_t) element_infos->str_size)))
         {
-          /* compare strings content */
-          if (0 == memcmp((const void *) & (p_msg_in->buffer[element_infos->str_start_idx]),
-                          (const AT_CHAR_t *)(p_modem_ctxt->p_modem_LUT)[i].cmd_str,
-                          (size_t) element_infos->str_size))
-          {
-            PRINT_DBG("we received LUT#%ld : %s \r\n", (p_modem_ctxt->p_modem_LUT)[i].cmd_id,
-                      (p_modem_ctxt->p_modem_LUT)[i].cmd_str)
-
-            element_infos->cmd_id_received = (p_modem_ctxt->p_modem_LUT)[i].cmd_id;
-            retval = ATSTATUS_OK;
-            leave_loop = true;
-          }
+          entry = (uint16_t)i;
         }
       }
-      i++;
-    } while ((leave_loop == false) && (i < p_modem_ctxt->modem_LUT_size));
+    }
+
+    if (entry != MODEM_LUT_ENTRY_NONE)
+    {
+      PRINT_DBG("we received LUT#%ld : %s \r\n", (p_modem_ctxt->p_modem_LUT)[entry].cmd_id,
+                (p_modem_ctxt->p_modem_LUT)[entry].cmd_str)
+
+      element_infos->cmd_id_received = (p_modem_ctxt->p_modem_LUT)[entry].cmd_id;
+      retval = ATSTATUS_OK;
+    }
   }
   return (retval);
 }
@@ -2408,6 +3260,97 @@ CS_PDN_conf_id_t atcm_get_configID_for_modem_cid(const atcustom_persistent_conte
   return (retval);
 }
 
+/**
+  * @brief  Check if the identity (IMEI) of the modem is known since the modem power on.
+  * @note   Can be used as SID sequence skip function for the command reading the IMEI before the commands
+  *         checked by atcm_cfg_cache_PDN_is_committed (PDN settings committed to this modem only).
+  * @param  p_modem_ctxt
+  * @retval at_bool_t AT_TRUE if the IMEI does not need to be read
+  */
+at_bool_t atcm_cfg_cache_modem_id_is_known(const atcustom_modem_context_t *p_modem_ctxt)
+{
+  return ((p_modem_ctxt->persist.imei[0] != 0U) ? AT_TRUE : AT_FALSE);
+}
+
+/**
+  * @brief  Check if the PDN configuration of the current SID is already committed to the modem
+  *         non-volatile memory (same settings sent and acknowledged before, in this run or before a MCU reset
+  *         if the cache is kept in a no-init section or in the RTC backup registers).
+  * @note   Can be used as SID sequence skip function for the commands defining the PDN in the modem.
+  * @param  p_modem_ctxt
+  * @retval at_bool_t AT_TRUE if the PDN configuration does not need to be sent again
+  */
+at_bool_t atcm_cfg_cache_PDN_is_committed(const atcustom_modem_context_t *p_modem_ctxt)
+{
+  at_bool_t retval = AT_FALSE;
+  uint8_t item;
+  uint32_t fingerprint = cfg_cache_PDN_fingerprint(p_modem_ctxt, &item);
+
+  cfg_cache_check();
+  /* without the modem identity, the modem may not be the one where the settings have been committed */
+  if ((p_modem_ctxt->persist.imei[0] != 0U) &&
+      (item < MODEM_CFG_CACHE_NB_ITEMS) &&
+      ((modem_cfg_cache.committed & ((uint32_t)1U << item)) != 0U) &&
+      (modem_cfg_cache.fingerprint[item] == fingerprint))
+  {
+    PRINT_INFO("PDN config (conf_id=%d) unchanged: already stored in modem", item)
+    retval = AT_TRUE;
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Record that the PDN configuration of the current SID has been committed to the modem
+  *         non-volatile memory.
+  * @note   To call when the SID defining the PDN in the modem returns OK.
+  * @param  p_modem_ctxt
+  * @retval none
+  */
+void atcm_cfg_cache_PDN_commit(const atcustom_modem_context_t *p_modem_ctxt)
+{
+  uint8_t item;
+  uint32_t fingerprint = cfg_cache_PDN_fingerprint(p_modem_ctxt, &item);
+
+  cfg_cache_check();
+  if ((p_modem_ctxt->persist.imei[0] != 0U) && (item < MODEM_CFG_CACHE_NB_ITEMS))
+  {
+    modem_cfg_cache.fingerprint[item] = fingerprint;
+    modem_cfg_cache.committed |= ((uint32_t)1U << item);
+    modem_cfg_cache.checksum = cfg_cache_checksum();
+#if defined(MODEM_CFG_CACHE_RTC_BKP_FIRST)
+    if ((MODEM_CFG_CACHE_RTC_BKP_FIRST + ATCM_CFG_CACHE_RTC_BKP_NB) <= RTC_BKP_NUMBER)
+    {
+      cfg_cache_RTC_save();
+    }
+#endif /* MODEM_CFG_CACHE_RTC_BKP_FIRST */
+  }
+}
+
+/**
+  * @brief  Invalidate the modem configuration cache: all the settings are sent again to the modem.
+  * @note   To call when the settings stored in the modem may differ from the cache: activation of a PDN
+  *         rejected (modem non-volatile memory lost), settings changed by a direct command.
+  * @param  none
+  * @retval none
+  */
+void atcm_cfg_cache_invalidate(void)
+{
+  cfg_cache_check();
+  if (modem_cfg_cache.committed != 0U)
+  {
+    PRINT_INFO("modem config cache invalidated")
+    modem_cfg_cache.committed = 0U;
+    modem_cfg_cache.checksum = cfg_cache_checksum();
+#if defined(MODEM_CFG_CACHE_RTC_BKP_FIRST)
+    if ((MODEM_CFG_CACHE_RTC_BKP_FIRST + ATCM_CFG_CACHE_RTC_BKP_NB) <= RTC_BKP_NUMBER)
+    {
+      cfg_cache_RTC_save();
+    }
+#endif /* MODEM_CFG_CACHE_RTC_BKP_FIRST */
+  }
+}
+
 /**
   * @brief  atcm_convert_index_to_PDN_conf
   * @param  index
@@ -1574,8 +1574,11 @@ at_action_rsp_t fRspAnalyze_CGMR(at_context_t *p_at_ctxt, atcustom_modem_context
   PRINT_API("enter fRspAnalyze_CGMR()")
 
   /* analyze parameters for +CGMR */
-  /* only for execution command, set parameters */
-  if (p_atp_ctxt->current_atcmd.type == ATTYPE_EXECUTION_CMD)
+  /* only for execution command, set parameters
+   * (device_info is only available for SID_CS_GET_DEVICE_INFO, +CGMR can also be sent during power on)
+   */
+  if ((p_atp_ctxt->current_atcmd.type == ATTYPE_EXECUTION_CMD) &&
+      (p_modem_ctxt->SID_ctxt.device_info != NULL))
   {
     PRINT_DBG("Revision:")
     PRINT_BUF((const uint8_t *)&p_msg_in->buffer[element_infos->str_start_idx], element_infos->str_size)
@@ -3157,6 +3160,7 @@ at_action_rsp_t fRspAnalyze_GSN(at_context_t *p_at_ctxt, atcustom_modem_context_
 {
   atparser_context_t *p_atp_ctxt = &(p_at_ctxt->parser);
   at_action_rsp_t retval = ATACTION_RSP_IGNORED;
+  uint16_t imei_size;
   PRINT_API("enter fRspAnalyze_GSN()")
 
   /* analyze parameters for +GSN */
@@ -3166,9 +3170,20 @@ at_action_rsp_t fRspAnalyze_GSN(at_context_t *p_at_ctxt, atcustom_modem_context_
     PRINT_DBG("IMEI:")
     PRINT_BUF((const uint8_t *)&p_msg_in->buffer[element_infos->str_start_idx], element_infos->str_size)
 
-    (void) memcpy((void *) & (p_modem_ctxt->SID_ctxt.device_info->u.imei),
+    /* modem identity, kept until the modem is reset (see atcm_cfg_cache_modem_id_is_known) */
+    imei_size = ((element_infos->str_size < MAX_SIZE_IMEI) ? element_infos->str_size : (MAX_SIZE_IMEI - 1U));
+    (void) memcpy((void *) & (p_modem_ctxt->persist.imei[0]),
                   (const void *)&p_msg_in->buffer[element_infos->str_start_idx],
-                  (size_t) element_infos->str_size);
+                  (size_t) imei_size);
+    p_modem_ctxt->persist.imei[imei_size] = 0U;
+
+    /* AT+GSN is also sent by SIDs which do not request the device info */
+    if (p_atp_ctxt->current_SID == (at_msg_t) SID_CS_GET_DEVICE_INFO)
+    {
+      (void) memcpy((void *) & (p_modem_ctxt->SID_ctxt.device_info->u.imei),
+                    (const void *)&p_msg_in->buffer[element_infos->str_start_idx],
+                    (size_t) element_infos->str_size);
+    }
   }
 
   return (retval);
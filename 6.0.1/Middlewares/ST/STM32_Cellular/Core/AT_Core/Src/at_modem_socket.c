@@ -372,4 +372,36 @@ at_status_t atcm_socket_set_connected(atcustom_modem_context_t *p_modem_ctxt, so
   return (retval);
 }
 
+uint32_t atcm_socket_copy_send_data(const csint_socket_data_buffer_t *p_send_data, uint8_t *p_dest)
+{
+  uint32_t size = 0U;
+
+  PRINT_API("enter atcm_socket_copy_send_data")
+
+  if (p_send_data->p_buffer_addr_send != NULL)
+  {
+    (void) memcpy((void *)p_dest,
+                  (const void *)p_send_data->p_buffer_addr_send,
+                  (size_t) p_send_data->buffer_size);
+    size = p_send_data->buffer_size;
+  }
+  else if (p_send_data->p_iov_send != NULL)
+  {
+    /* vectored send: segments are copied one after the other */
+    for (uint8_t i = 0U; i < p_send_data->iov_count; i++)
+    {
+      (void) memcpy((void *)&p_dest[size],
+                    (const void *)p_send_data->p_iov_send[i].p_buf,
+                    (size_t) p_send_data->p_iov_send[i].length);
+      size += p_send_data->p_iov_send[i].length;
+    }
+  }
+  else
+  {
+    /* no data to copy */
+  }
+
+  return (size);
+}
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
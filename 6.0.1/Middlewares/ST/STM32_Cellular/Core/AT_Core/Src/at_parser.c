@@ -73,6 +73,19 @@ typedef struct
   uint16_t     cmd_separator_size;
 } cmd_format_LUT_t;
 
+/* parser context of the SID suspended at a step boundary (the command context is empty at a step boundary)
+ * only one transaction can be suspended (see atcore_step_suspended in at_core.c)
+ */
+typedef struct
+{
+  at_msg_t  current_SID;
+  uint8_t   step;
+  uint8_t   is_final_cmd;
+  at_buf_t  *p_cmd_input;
+} atparser_suspended_t;
+
+static atparser_suspended_t atparser_suspended;
+
 /* Global variables ----------------------------------------------------------*/
 
 /* Private function prototypes -----------------------------------------------*/
@@ -89,13 +102,15 @@ at_status_t ATParser_initParsers(sysctrl_device_type_t device_type)
   return (atcc_initParsers(device_type));
 }
 
-void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback)
+void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback,
+                   IPC_CheckEndOfMsgBlockCallbackTypeDef *p_checkEndOfMsgBlockCallback)
 {
   /* reset request context */
   reset_parser_context(&p_at_ctxt->parser);
 
-  /* get callback pointer */
+  /* get callback pointers */
   *p_checkEndOfMsgCallback = atcc_checkEndOfMsgCallback(p_at_ctxt);
+  *p_checkEndOfMsgBlockCallback = atcc_checkEndOfMsgBlockCallback(p_at_ctxt);
 
   /* default termination string for AT command: <CR>
    * this value can be changed in ATCustom init if needed
@@ -176,6 +191,9 @@ static uint16_t build_command(at_context_t *p_at_ctxt, uint8_t *p_ATcmdBuf, uint
     *  <cmd_params> are the command parameters (exple: "1,0")
     *  <cmd_endstr> is the command termination string (exple: carriage return)
     *  For the example above, the command generated is "AT+CFUN=1,0<CR>"
+    *
+    * When several commands are concatenated on the same line (see atcm_program_AT_CMD_CONCAT), the modem
+    * layer appends them to <cmd_params> of the first one (exple: "AT+CEREG?;+CREG?<CR>").
   */
 
   static const cmd_format_LUT_t CMD_FORMAT[ATTYPE_MAX_VAL] =
@@ -439,6 +457,34 @@ void ATParser_abort_request(at_context_t *p_at_ctxt)
   reset_parser_context(&p_at_ctxt->parser);
 }
 
+at_status_t ATParser_suspend_request(at_context_t *p_at_ctxt)
+{
+  at_status_t retval;
+
+  /* save the SID context of the modem first: not possible with all modems */
+  retval = atcc_suspend_SID(p_at_ctxt);
+  if (retval == ATSTATUS_OK)
+  {
+    atparser_suspended.current_SID = p_at_ctxt->parser.current_SID;
+    atparser_suspended.step = p_at_ctxt->parser.step;
+    atparser_suspended.is_final_cmd = p_at_ctxt->parser.is_final_cmd;
+    atparser_suspended.p_cmd_input = p_at_ctxt->parser.p_cmd_input;
+    reset_parser_context(&p_at_ctxt->parser);
+  }
+
+  return (retval);
+}
+
+void ATParser_resume_request(at_context_t *p_at_ctxt)
+{
+  reset_parser_context(&p_at_ctxt->parser);
+  p_at_ctxt->parser.current_SID = atparser_suspended.current_SID;
+  p_at_ctxt->parser.step = atparser_suspended.step;
+  p_at_ctxt->parser.is_final_cmd = atparser_suspended.is_final_cmd;
+  p_at_ctxt->parser.p_cmd_input = atparser_suspended.p_cmd_input;
+  atcc_resume_SID(p_at_ctxt);
+}
+
 /* Private function Definition -----------------------------------------------*/
 static void reset_parser_context(atparser_context_t *p_atp_ctxt)
 {
@@ -461,6 +507,7 @@ static void reset_current_command(atparser_context_t *p_atp_ctxt)
   (void) memset((void *)&p_atp_ctxt->current_atcmd.name[0], 0, sizeof(uint8_t) * (ATCMD_MAX_NAME_SIZE));
   (void) memset((void *)&p_atp_ctxt->current_atcmd.params[0], 0, sizeof(uint8_t) * (ATCMD_MAX_CMD_SIZE));
   p_atp_ctxt->current_atcmd.raw_cmd_size = 0U;
+  p_atp_ctxt->current_atcmd.concat_nb = 0U;
 }
 
 static void display_buffer(const at_context_t *p_at_ctxt, const uint8_t *p_buf, uint16_t buf_size, uint8_t is_TX_buf)
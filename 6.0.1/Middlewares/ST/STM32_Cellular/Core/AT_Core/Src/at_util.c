@@ -29,10 +29,19 @@
 #define MAX_64BITS_STRING_SIZE (16U) /* = max string size for a 64bits value (FFFF.FFFF.FFFF.FFFF) */
 
 #define MAX_PARAM_SIZE ((uint16_t)32U) /* max size of string */
+
+/* hexadecimal string conversions process 32-bit words (4 bytes or 4 digits at once):
+ * byte order of the words loaded/stored in memory is little endian (Cortex-M)
+ */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error hexadecimal string conversions require a little endian target
+#endif /* defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__) */
 /* Private macros ------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Global variables ----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t hexa_encode_word(uint32_t value);
+static uint32_t hexa_decode_word(uint32_t digits, uint32_t *p_invalid);
 
 /* Functions Definition ------------------------------------------------------*/
 uint32_t ATutil_ipow(uint32_t base, uint16_t exp)
@@ -520,4 +529,129 @@ uint32_t ATutil_convert_T3324_to_seconds(uint32_t encoded_value)
   return (decode_value);
 }
 
+/**
+  * @brief  Convert a binary buffer to its hexadecimal string (2 lowercase digits per byte)
+  *         for example "AB" is converted to "4142"
+  * @note   No null character is added at the end of the string
+  * @param  p_src Buffer to convert
+  * @param  size Number of bytes to convert
+  * @param  p_dst Destination string (2 * size characters)
+  * @retval none
+  */
+void ATutil_convertBinToHexaString(const uint8_t *p_src, uint32_t size, uint8_t *p_dst)
+{
+  uint32_t idx = 0U;
+  uint32_t bytes;
+  uint32_t digits[2];
+
+  /* 4 bytes at a time */
+  while ((size - idx) >= 4U)
+  {
+    (void) memcpy((void *)&bytes, (const void *)&p_src[idx], 4U);
+    digits[0] = hexa_encode_word(bytes & 0x0000FFFFU);
+    digits[1] = hexa_encode_word(bytes >> 16);
+    (void) memcpy((void *)&p_dst[2U * idx], (const void *)&digits[0], 8U);
+    idx += 4U;
+  }
+
+  /* remaining bytes */
+  while (idx < size)
+  {
+    digits[0] = hexa_encode_word((uint32_t)p_src[idx]);
+    p_dst[2U * idx] = (uint8_t)(digits[0] & 0xFFU);
+    p_dst[(2U * idx) + 1U] = (uint8_t)((digits[0] >> 8) & 0xFFU);
+    idx++;
+  }
+}
+
+/**
+  * @brief  Convert an hexadecimal string to binary
+  *         for example "4142" is converted to "AB"
+  * @param  p_src String to convert (digits '0' to '9', 'a' to 'f' and 'A' to 'F')
+  * @param  size Number of bytes to produce (p_src contains 2 * size digits)
+  * @param  p_dst Destination buffer (size bytes)
+  * @retval bool true if conversion is ok, false if p_src contains a non hexadecimal digit
+  *         (p_dst content is then undefined)
+  */
+bool ATutil_convertHexaStringToBin(const uint8_t *p_src, uint32_t size, uint8_t *p_dst)
+{
+  uint32_t idx = 0U;
+  uint32_t invalid = 0U;
+  uint32_t digits[2];
+  uint32_t values[2];
+  uint32_t bytes;
+
+  /* 8 digits at a time */
+  while ((size - idx) >= 4U)
+  {
+    (void) memcpy((void *)&digits[0], (const void *)&p_src[2U * idx], 8U);
+    values[0] = hexa_decode_word(digits[0], &invalid);
+    values[1] = hexa_decode_word(digits[1], &invalid);
+    bytes = (values[0] & 0x000000FFU) | ((values[0] >> 8) & 0x0000FF00U)
+            | ((values[1] << 16) & 0x00FF0000U) | ((values[1] << 8) & 0xFF000000U);
+    (void) memcpy((void *)&p_dst[idx], (const void *)&bytes, 4U);
+    idx += 4U;
+  }
+
+  /* remaining bytes: 2 digits completed with "00" */
+  while (idx < size)
+  {
+    digits[0] = (uint32_t)p_src[2U * idx] | ((uint32_t)p_src[(2U * idx) + 1U] << 8) | 0x30300000U;
+    values[0] = hexa_decode_word(digits[0], &invalid);
+    p_dst[idx] = (uint8_t)(values[0] & 0xFFU);
+    idx++;
+  }
+
+  return (invalid == 0U);
+}
+
+/* Private function Definition -----------------------------------------------*/
+/**
+  * @brief  Convert 2 bytes to their 4 hexadecimal digits
+  * @param  value 2 bytes to convert (first byte in bits 0-7)
+  * @retval 4 digits (first digit in bits 0-7)
+  */
+static uint32_t hexa_encode_word(uint32_t value)
+{
+  uint32_t nibbles;
+  uint32_t letters;
+
+  /* one nibble per byte, most significant nibble of each input byte first */
+  nibbles = ((value >> 4) & 0x0000000FU) | ((value << 8) & 0x00000F00U)
+            | ((value << 4) & 0x000F0000U) | ((value << 16) & 0x0F000000U);
+
+  /* 1 in each byte where nibble > 9 (nibble + 6 >= 16) */
+  letters = ((nibbles + 0x06060606U) >> 4) & 0x01010101U;
+
+  /* '0' + nibble for 0-9, 'a' + nibble - 10 = '0' + nibble + 39 for 10-15 */
+  return (nibbles + 0x30303030U + (letters * 39U));
+}
+
+/**
+  * @brief  Convert 4 hexadecimal digits to their 2 bytes
+  * @param  digits 4 digits to convert (first digit in bits 0-7)
+  * @param  p_invalid Updated with a non-null value if one of the digits is not an hexadecimal digit
+  * @retval 2 bytes (first byte in bits 0-7, second byte in bits 16-23)
+  */
+static uint32_t hexa_decode_word(uint32_t digits, uint32_t *p_invalid)
+{
+  uint32_t lower;
+  uint32_t is_digit;
+  uint32_t is_letter;
+  uint32_t nibbles;
+
+  /* bit 7 of each byte set if byte is in range: byte + (0x80 - min) >= 0x80 and byte + (0x80 - (max + 1)) < 0x80
+   * no carry between bytes as long as bytes are < 0x80 (other bytes are invalid)
+   */
+  lower = digits | 0x20202020U; /* 'A'-'F' to 'a'-'f' */
+  is_digit = (digits + 0x50505050U) & ~(digits + 0x46464646U) & 0x80808080U;  /* '0' - '9' */
+  is_letter = (lower + 0x1F1F1F1FU) & ~(lower + 0x19191919U) & 0x80808080U;  /* 'a' - 'f' */
+  *p_invalid |= (digits & 0x80808080U) | ((is_digit | is_letter) ^ 0x80808080U);
+
+  /* '0'-'9' low nibble is the value, 'a'-'f' low nibble is value - 9 */
+  nibbles = (digits & 0x0F0F0F0FU) + ((is_letter >> 7) * 9U);
+
+  return (((nibbles << 4) & 0x00F000F0U) | ((nibbles >> 8) & 0x000F000FU));
+}
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
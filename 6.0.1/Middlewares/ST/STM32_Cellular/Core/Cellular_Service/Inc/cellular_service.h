@@ -369,6 +369,13 @@ typedef struct
   uint8_t  pingnum;
 } CS_Ping_params_t;
 
+/* Data segment of a vectored socket send */
+typedef struct
+{
+  const CS_CHAR_t  *p_buf;  /* segment data */
+  uint32_t         length;  /* segment length (in bytes) */
+} CS_Iovec_t;
+
 typedef struct
 {
   uint8_t      index;
@@ -481,6 +488,9 @@ CS_Status_t CDS_socket_connect(socket_handle_t sockHandle,
 CS_Status_t CDS_socket_send(socket_handle_t sockHandle,
                             const CS_CHAR_t *p_buf,
                             uint32_t length);
+CS_Status_t CDS_socket_sendv(socket_handle_t sockHandle,
+                             const CS_Iovec_t *p_iov,
+                             uint8_t iov_count);
 CS_Status_t CDS_socket_sendto(socket_handle_t sockHandle,
                               const CS_CHAR_t *p_buf,
                               uint32_t length,
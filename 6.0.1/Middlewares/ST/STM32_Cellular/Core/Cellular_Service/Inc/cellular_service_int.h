@@ -230,6 +230,8 @@ typedef struct
 {
   socket_handle_t  socket_handle;
   const CS_CHAR_t  *p_buffer_addr_send; /* send buffer (const) */
+  const CS_Iovec_t *p_iov_send;         /* send segments (vectored send) - used if p_buffer_addr_send is NULL */
+  uint8_t          iov_count;           /* number of send segments */
   CS_CHAR_t        *p_buffer_addr_rcv;  /* receive buffer */
   uint32_t         buffer_size;         /* real buffer size */
   uint32_t         max_buffer_size;     /* maximum buffer size allowed by client - used on for RX data */
@@ -31,6 +31,31 @@ extern "C" {
 
 /* Exported constants --------------------------------------------------------*/
 /* Exported types ------------------------------------------------------------*/
+/* lock statistics of a Cellular Service plane (wait times in ms) */
+typedef struct
+{
+  uint32_t lock_nb;        /* number of requests */
+  uint32_t wait_total_ms;  /* cumulated time waiting for the lock */
+  uint32_t wait_max_ms;    /* maximum time waiting for the lock */
+} osCS_lock_plane_stats_t;
+
+/* lock statistics of the Cellular Service
+ * ctrl: control plane requests (registration, PDN, DNS, ping, power, ...)
+ * data: data plane requests (socket operations)
+ */
+typedef struct
+{
+  osCS_lock_plane_stats_t ctrl;
+  osCS_lock_plane_stats_t data;
+  uint32_t                ctrl_yield_nb; /* number of step boundaries where a control plane request let data plane
+                                            requests run (only if USE_CELLULAR_SERVICE_CTRL_YIELD == 1) */
+} osCS_lock_stats_t;
+
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+/* completion callback of an asynchronous request (called from the Cellular Service request thread) */
+typedef void (* osCDS_async_callback_t)(CS_Status_t status, void *p_cb_ctx);
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
+
 /* External variables --------------------------------------------------------*/
 /* Exported macros -----------------------------------------------------------*/
 
@@ -41,6 +66,8 @@ CS_Bool_t osCDS_cellular_service_init(void);
 /**
   * @brief  Read the actual signal quality seen by Modem .
   * @note   Call CS_get_signal_quality with mutex access protection
+  * @note   Processed by the calling thread: not ordered with the queued asynchronous requests (see the
+  *         asynchronous services)
   * @param  same parameters as the CS_get_signal_quality function
   * @retval CS_Status_t
   */
@@ -117,6 +144,8 @@ CS_Status_t osCDS_socket_bind(socket_handle_t sockHandle,
   * @note   This function is blocking until the connection is setup or when the timeout to wait
   *         for socket connection expires.
   * @note   Call CDS_socket_connect with mutex access protection
+  * @note   Processed by the calling thread: not ordered with the queued asynchronous requests (see the
+  *         asynchronous services)
   * @param  same parameters as the CDS_socket_connect function
   * @retval CS_Status_t
   */
@@ -139,6 +168,8 @@ CS_Status_t osCDS_socket_listen(socket_handle_t sockHandle);
   * @note   This function is blocking until the data is transferred or when the
   *         timeout to wait for transmission expires.
   * @note   Call CDS_socket_send with mutex access protection
+  * @note   Processed by the calling thread: not ordered with the queued asynchronous requests (see the
+  *         asynchronous services)
   * @param  same parameters as the CDS_socket_send function
   * @retval CS_Status_t
   */
@@ -146,10 +177,24 @@ CS_Status_t osCDS_socket_send(socket_handle_t sockHandle,
                               const CS_CHAR_t *p_buf,
                               uint32_t length);
 
+/**
+  * @brief  Send data segments over a socket to a remote server.
+  * @note   This function is blocking until the data is transferred or when the
+  *         timeout to wait for transmission expires.
+  * @note   Call CDS_socket_sendv with mutex access protection
+  * @param  same parameters as the CDS_socket_sendv function
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_sendv(socket_handle_t sockHandle,
+                               const CS_Iovec_t *p_iov,
+                               uint8_t iov_count);
+
 /**
   * @brief  Receive data from the connected remote server.
   * @note   This function is blocking until expected data length is received or a receive timeout has expired.
   * @note   Call CDS_socket_receive with mutex access protection
+  * @note   Processed by the calling thread: not ordered with the queued asynchronous requests (see the
+  *         asynchronous services)
   * @param  same parameters as the CDS_socket_receive function
   * @retval Size of received data (in bytes).
   */
@@ -193,6 +238,8 @@ CS_Status_t osCDS_socket_cnx_status(socket_handle_t sockHandle,
   * @brief  Get connection status for a given socket.
   * @note   If a PDN is activated at socket creation, the socket will not be deactivated at socket closure.
   * @note   Call CDS_socket_cnx_status with mutex access protection
+  * @note   Processed by the calling thread: not ordered with the queued asynchronous requests (see the
+  *         asynchronous services)
   * @param  same parameters as the CDS_socket_cnx_status function
   * @retval CS_Status_t
   */
@@ -361,6 +408,8 @@ CS_Status_t osCDS_resume_data(void);
   * @brief  DNS request
   * @note   Get IP address of the specified hostname
   * @note   Call CS_dns_request with mutex access protection
+  * @note   Processed by the calling thread: not ordered with the queued asynchronous requests (see the
+  *         asynchronous services)
   * @param  same parameters as the CS_dns_request function
   * @retval CS_Status_t
   */
@@ -435,6 +484,13 @@ void osCCS_get_wait_cs_resource(void);
   */
 void osCCS_get_release_cs_resource(void);
 
+/**
+  * @brief  Get the Cellular Service lock statistics.
+  * @param  p_stats Pointer to the structure to return the statistics
+  * @retval none
+  */
+void osCS_get_lock_stats(osCS_lock_stats_t *p_stats);
+
 
 /* =========================================================
    ===========   Low Power Functions             ===========
@@ -492,6 +548,95 @@ CS_Status_t osCS_PowerWakeup(CS_wakeup_origin_t wakeup_origin);
 CS_Status_t osCS_SetPowerConfig(CS_set_power_config_t *p_power_config);
 #endif  /* (USE_LOW_POWER == 1) */
 
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+/* =========================================================
+   ===========      Asynchronous services        ===========
+   ========================================================= */
+/* Asynchronous services return CELLULAR_OK when the request is queued.
+ * The request is then processed by the Cellular Service request thread and the result is returned to the client
+ * by the completion callback (callback can be NULL). At most CS_ASYNC_REQ_QUEUE_SIZE (plf_sw_config.h) requests
+ * are pending: when all the contexts are used, the asynchronous services return CELLULAR_ERROR.
+ * The synchronous variants of these services are processed by the calling thread, they are not blocking wrappers
+ * over the request queue: they do not wait for the queued requests and are not ordered with them (a client mixing both variants on a socket waits for the completion of
+ * its asynchronous requests when the order matters, e.g. before to close the socket).
+ * The remote address and the DNS request are copied; the other buffers given as parameters (data, results)
+ * have to remain valid until the completion callback is called.
+ */
+
+/**
+  * @brief  Read the actual signal quality seen by Modem (asynchronous request).
+  * @param  p_sig_qual Pointer to the structure to return the signal quality
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCS_get_signal_quality_async(CS_SignalQuality_t *p_sig_qual,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx);
+
+/**
+  * @brief  Connect to a remote server (asynchronous request).
+  * @param  same parameters as the osCDS_socket_connect function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_connect_async(socket_handle_t sockHandle,
+                                       CS_IPaddrType_t addr_type,
+                                       CS_CHAR_t *p_ip_addr_value,
+                                       uint16_t remote_port,
+                                       osCDS_async_callback_t async_cb, void *p_cb_ctx);
+
+/**
+  * @brief  Send data over a socket to a remote server (asynchronous request).
+  * @param  same parameters as the osCDS_socket_send function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_send_async(socket_handle_t sockHandle,
+                                    const CS_CHAR_t *p_buf,
+                                    uint32_t length,
+                                    osCDS_async_callback_t async_cb, void *p_cb_ctx);
+
+/**
+  * @brief  Receive data from the connected remote server (asynchronous request).
+  * @note   Completion status is CELLULAR_OK if the read has been done (even if no data was available).
+  * @param  same parameters as the osCDS_socket_receive function
+  * @param  p_rcv_length Pointer to return the size of received data (in bytes)
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_receive_async(socket_handle_t sockHandle,
+                                       CS_CHAR_t *p_buf,
+                                       uint32_t max_buf_length,
+                                       int32_t *p_rcv_length,
+                                       osCDS_async_callback_t async_cb, void *p_cb_ctx);
+
+/**
+  * @brief  Free a socket handle (asynchronous request).
+  * @param  same parameters as the osCDS_socket_close function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_close_async(socket_handle_t sockHandle,
+                                     uint8_t force,
+                                     osCDS_async_callback_t async_cb, void *p_cb_ctx);
+
+/**
+  * @brief  DNS request (asynchronous request).
+  * @param  same parameters as the osCDS_dns_request function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_dns_request_async(CS_PDN_conf_id_t cid,
+                                    CS_DnsReq_t  *dns_req,
+                                    CS_DnsResp_t *dns_resp,
+                                    osCDS_async_callback_t async_cb, void *p_cb_ctx);
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
+
 
 #ifdef __cplusplus
 }
@@ -1561,6 +1561,76 @@ CS_Status_t CDS_socket_send(socket_handle_t sockHandle,
   return (retval);
 }
 
+/**
+  * @brief  Send data segments over a socket to a remote server.
+  * @note   Segments are sent in a single modem data write (same behavior as CDS_socket_send).
+  * @param  sockHandle Handle of the socket
+  * @param  p_iov Pointer to the data segments to transfer (used until the function returns).
+  * @param  iov_count Number of data segments.
+  * @retval CS_Status_t
+  */
+CS_Status_t CDS_socket_sendv(socket_handle_t sockHandle,
+                             const CS_Iovec_t *p_iov,
+                             uint8_t iov_count)
+{
+  CS_Status_t retval = CELLULAR_ERROR;
+  uint32_t length = 0U;
+  PRINT_API("CDS_socket_sendv (iov@=%p - iovcount = %d)", p_iov, iov_count)
+
+  if (p_iov != NULL)
+  {
+    for (uint8_t i = 0U; i < iov_count; i++)
+    {
+      length += p_iov[i].length;
+    }
+  }
+
+  /* check that size does not exceed maximum buffers size */
+  if ((length == 0U) || (length > DEFAULT_IP_MAX_PACKET_SIZE))
+  {
+    PRINT_ERR("<Cellular_Service> buffer size %ld invalid (maximum value %d)",
+              length,
+              DEFAULT_IP_MAX_PACKET_SIZE)
+  }
+  /* check that socket has been allocated */
+  else if (cs_ctxt_sockets_info[sockHandle].state != SOCKETSTATE_CONNECTED)
+  {
+    PRINT_ERR("<Cellular_Service> socket not connected (state=%d) for handle %ld (sendv)",
+              cs_ctxt_sockets_info[sockHandle].state,
+              sockHandle)
+  }
+  else
+  {
+    csint_socket_data_buffer_t send_data_struct;
+    (void) memset((void *)&send_data_struct, 0, sizeof(csint_socket_data_buffer_t));
+    send_data_struct.socket_handle = sockHandle;
+    /* p_buffer_addr_send already reset: data are provided by the segments */
+    send_data_struct.p_iov_send = p_iov;
+    send_data_struct.iov_count = iov_count;
+    send_data_struct.buffer_size = length;
+    send_data_struct.max_buffer_size = length;
+    if (DATAPACK_writeStruct(&cmd_buf[0],
+                             (uint16_t) CSMT_SOCKET_DATA_BUFFER,
+                             (uint16_t) sizeof(csint_socket_data_buffer_t),
+                             (void *)&send_data_struct) == DATAPACK_OK)
+    {
+      at_status_t err;
+      err = AT_sendcmd(_Adapter_Handle, (at_msg_t) SID_CS_SEND_DATA, &cmd_buf[0], &rsp_buf[0]);
+      if (err == ATSTATUS_OK)
+      {
+        PRINT_DBG("<Cellular_Service> socket data segments sent")
+        retval = CELLULAR_OK;
+      }
+    }
+  }
+
+  if (retval == CELLULAR_ERROR)
+  {
+    PRINT_ERR("<Cellular_Service> error when sending data segments to socket")
+  }
+  return (retval);
+}
+
 /**
   * @brief  Send data over a socket to a remote server.
   * @note   This function is blocking until the data is transferred or when the
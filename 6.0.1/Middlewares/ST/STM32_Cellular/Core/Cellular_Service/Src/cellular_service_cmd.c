@@ -25,6 +25,7 @@
 
 #if (USE_CMD_CONSOLE == 1)
 #include "dc_common.h"
+#include "at_core.h"
 
 #include "cellular_control_api.h"
 
@@ -330,6 +331,9 @@ static void CST_HelpCmd(void)
   PRINT_FORCE("%s state   (Displays the cellular and SIM state)", CST_cmd_label)
   PRINT_FORCE("%s config  (Displays the cellular configuration used)", CST_cmd_label)
   PRINT_FORCE("%s info    (Displays modem information)", CST_cmd_label)
+  PRINT_FORCE("%s dcstats (Displays Data Cache notification statistics)", CST_cmd_label)
+  PRINT_FORCE("%s atstats (Displays AT messages transmission and reception statistics)", CST_cmd_label)
+  PRINT_FORCE("%s lockstats (Displays Cellular Service control/data plane lock statistics)", CST_cmd_label)
   PRINT_FORCE("%s targetstate [off|sim|full|modem] (set modem state)", CST_cmd_label)
   PRINT_FORCE("%s polling [on|off]  (enable/disable periodical modem polling)", CST_cmd_label)
   PRINT_FORCE("%s cmd  (switch to command mode)", CST_cmd_label)
@@ -420,6 +424,12 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
   static dc_cellular_params_t    cst_cmd_cellular_params;
   static dc_nfmc_info_t          cst_cmd_nfmc_info;
   static dc_cellular_target_state_t target_state;
+  dc_com_stats_t cst_cmd_dc_stats;
+  uint32_t  dc_cb_per_write;
+  at_rx_stats_t cst_cmd_at_rx_stats;
+  at_tx_stats_t cst_cmd_at_tx_stats;
+  uint32_t  at_msg_per_wakeup;
+  osCS_lock_stats_t cst_cmd_lock_stats;
   uint8_t   *argv_p[CST_CMS_PARAM_MAX];
   uint32_t  argc;
   uint8_t   *cmd_p;
@@ -442,9 +452,9 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
   /* verify that it is a cst command */
   if (cmd_p != NULL)
   {
-    if (memcmp((CRC_CHAR_t *)cmd_p,
-               (CRC_CHAR_t *)CST_cmd_label,
-               crs_strlen(cmd_p))
+    if (strncmp((CRC_CHAR_t *)cmd_p,
+                (CRC_CHAR_t *)CST_cmd_label,
+                crs_strlen(cmd_p))
         == 0)
     {
       /* parameters parsing                     */
@@ -464,18 +474,18 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         CST_HelpCmd();
       }
       /* -- help ---------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],  "help",  crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],  "help",  crs_strlen(argv_p[0])) == 0)
       {
         /* help command: displays help */
         CST_HelpCmd();
       }
       /* -- pooling ------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "polling", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "polling", crs_strlen(argv_p[0])) == 0)
       {
         /* 'cst polling ...' command */
         if (argc == 2U)
         {
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
           {
             /* disables cst polling */
             CST_polling_active = false;
@@ -498,20 +508,20 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         }
       }
       /* -- targetstate --------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "targetstate", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "targetstate", crs_strlen(argv_p[0])) == 0)
       {
         /* 'cst targetstate ...' command */
         if (argc == 2U)
         {
           /* new mode mtarget state requested */
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
           {
             /* API call to stop the modem. cmd acts as an application, so, use the API */
             (void)cellular_modem_stop();
             /* update target_state value that may have been modified in cellular_modem_stop */
             (void)dc_com_read(&dc_com_db, DC_CELLULAR_TARGET_STATE_CMD, (void *)&target_state, sizeof(target_state));
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "sim", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "sim", crs_strlen(argv_p[1])) == 0)
           {
             /* 'cst targetstate sim' command: new modem state requested: modem manages sim but not data transfer */
             target_state.rt_state     = DC_SERVICE_ON;
@@ -519,7 +529,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
             target_state.callback = true;
             (void)dc_com_write(&dc_com_db, DC_CELLULAR_TARGET_STATE_CMD, (void *)&target_state, sizeof(target_state));
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "full", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "full", crs_strlen(argv_p[1])) == 0)
           {
             /* API call to start and attach the modem. cmd acts as an application, so, use the API */
             (void)cellular_connect();
@@ -527,7 +537,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
             (void)dc_com_read(&dc_com_db, DC_CELLULAR_TARGET_STATE_CMD, (void *)&target_state, sizeof(target_state));
 
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "modem", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "modem", crs_strlen(argv_p[1])) == 0)
           {
             /* 'cst targetstate modem only' command:  new modem state requested: modem manages full data transfer */
             target_state.rt_state     = DC_SERVICE_ON;
@@ -544,11 +554,11 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
       }
       /* -- apn ----------------------------------------------------------------------------------------------------- */
       /* command apn [on|off] */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "apn", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "apn", crs_strlen(argv_p[0])) == 0)
       {
         if (argc == 2U)
         {
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
           {
             /* disable use of APN */
             (void)dc_com_read(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cellular_params,
@@ -559,7 +569,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
             (void)dc_com_write(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cellular_params,
                                sizeof(cst_cellular_params));
           }
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0)
           {
             /* enables use of APN */
             (void)dc_com_read(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cellular_params,
@@ -584,7 +594,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         }
       }
       /* -- apnconf ------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "apnconf", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "apnconf", crs_strlen(argv_p[0])) == 0)
       {
         /* cst apnconf ...:  sets new apn configuration */
 
@@ -671,11 +681,11 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
       /* -- apnuser ------------------------------------------------------------------------------------------------- */
       /* command apnuser
        [on|off] */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "apnuser", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "apnuser", crs_strlen(argv_p[0])) == 0)
       {
         if (argc == 2U)
         {
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
           {
             /* disable use of APN */
             (void)dc_com_read(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cellular_params,
@@ -685,7 +695,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
             (void)dc_com_write(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cellular_params,
                                sizeof(cst_cellular_params));
           }
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0)
           {
             /* enables use of APN */
             (void)dc_com_read(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cellular_params,
@@ -708,7 +718,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         }
       }
       /* -- apnempty ------------------------------------------------------------------------------------------------ */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "apnempty", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "apnempty", crs_strlen(argv_p[0])) == 0)
       {
         /* Set APN to empty string */
         (void)dc_com_read(&dc_com_db, DC_CELLULAR_CONFIG, (void *)&cst_cmd_cellular_params,
@@ -730,9 +740,9 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
                            sizeof(cst_cmd_cellular_params));
       }
       /* -- state --------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                      "state",
-                      crs_strlen(argv_p[0]))
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "state",
+                       crs_strlen(argv_p[0]))
                == 0)
       {
         /* 'cst state' command: displays cellular service state */
@@ -763,9 +773,9 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
       }
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
       /* -- data ---------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                      "data",
-                      crs_strlen(argv_p[0]))
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "data",
+                       crs_strlen(argv_p[0]))
                == 0)
       {
         /* 'cst data' command: switch to data state */
@@ -781,9 +791,9 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         }
       }
       /* -- cmd ----------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                      "cmd",
-                      crs_strlen(argv_p[0]))
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "cmd",
+                       crs_strlen(argv_p[0]))
                == 0)
       {
         /* 'cst cmd' command: switch to cmd state */
@@ -800,14 +810,14 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
       }
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
       /* -- valid --------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                      "valid",
-                      crs_strlen(argv_p[0]))
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "valid",
+                       crs_strlen(argv_p[0]))
                == 0)
       {
-        if (memcmp((CRC_CHAR_t *)argv_p[1],
-                   "netstate",
-                   crs_strlen(argv_p[1]))
+        if (strncmp((CRC_CHAR_t *)argv_p[1],
+                    "netstate",
+                    crs_strlen(argv_p[1]))
             == 0)
         {
           /* 'cst valid netstate'  automatic tests */
@@ -818,9 +828,9 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
 
       }
       /* -- info ---------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                      "info",
-                      crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "info",
+                       crs_strlen(argv_p[0])) == 0)
       {
         /* 'cst state' command: displays cellular service info supplied by modem */
 
@@ -851,10 +861,68 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
                     CST_accessTechnoToString_p[p_my_signal_info.access_techno]);
 
       }
+      /* -- dcstats ------------------------------------------------------------------------------------------------- */
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "dcstats",
+                       crs_strlen(argv_p[0])) == 0)
+      {
+        /* 'cst dcstats' command: displays Data Cache notification statistics */
+        if (dc_com_get_stats(&dc_com_db, &cst_cmd_dc_stats) == DC_COM_OK)
+        {
+          PRINT_FORCE("Data Cache writes    : %ld", cst_cmd_dc_stats.write_nb)
+          PRINT_FORCE("Changed writes       : %ld", cst_cmd_dc_stats.write_change_nb)
+          PRINT_FORCE("Callbacks called     : %ld", cst_cmd_dc_stats.cb_call_nb)
+          PRINT_FORCE("Callbacks skipped    : %ld", cst_cmd_dc_stats.cb_skip_nb)
+          PRINT_FORCE("Read retries         : %ld", cst_cmd_dc_stats.read_retry_nb)
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+          PRINT_FORCE("Coalesced writes     : %ld", cst_cmd_dc_stats.notif_coalesced_nb)
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
+          if (cst_cmd_dc_stats.write_change_nb != 0U)
+          {
+            /* average number of consumers woken up by a changed write, 2 decimals */
+            dc_cb_per_write = (cst_cmd_dc_stats.cb_call_nb * 100U) / cst_cmd_dc_stats.write_change_nb;
+            PRINT_FORCE("Callbacks per write  : %ld.%02ld", dc_cb_per_write / 100U, dc_cb_per_write % 100U)
+          }
+        }
+      }
+      /* -- atstats ------------------------------------------------------------------------------------------------- */
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "atstats",
+                       crs_strlen(argv_p[0])) == 0)
+      {
+        /* 'cst atstats' command: displays AT messages transmission and reception statistics */
+        AT_get_rx_stats(&cst_cmd_at_rx_stats);
+        AT_get_tx_stats(&cst_cmd_at_tx_stats);
+        PRINT_FORCE("AT commands sent     : %ld", cst_cmd_at_tx_stats.cmd_nb)
+        PRINT_FORCE("AT task wake-ups     : %ld", cst_cmd_at_rx_stats.wakeup_nb)
+        PRINT_FORCE("AT messages parsed   : %ld", cst_cmd_at_rx_stats.msg_nb)
+        PRINT_FORCE("Max msg per wake-up  : %ld", cst_cmd_at_rx_stats.max_msg_per_wakeup)
+        if (cst_cmd_at_rx_stats.wakeup_nb != 0U)
+        {
+          /* average number of messages parsed per wake-up, 2 decimals */
+          at_msg_per_wakeup = (cst_cmd_at_rx_stats.msg_nb * 100U) / cst_cmd_at_rx_stats.wakeup_nb;
+          PRINT_FORCE("Msg per wake-up      : %ld.%02ld", at_msg_per_wakeup / 100U, at_msg_per_wakeup % 100U)
+        }
+      }
+      /* -- lockstats ----------------------------------------------------------------------------------------------- */
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "lockstats",
+                       crs_strlen(argv_p[0])) == 0)
+      {
+        /* 'cst lockstats' command: displays Cellular Service lock statistics */
+        osCS_get_lock_stats(&cst_cmd_lock_stats);
+        PRINT_FORCE("Control plane requests : %ld", cst_cmd_lock_stats.ctrl.lock_nb)
+        PRINT_FORCE("Control plane wait ms  : total %ld max %ld",
+                    cst_cmd_lock_stats.ctrl.wait_total_ms, cst_cmd_lock_stats.ctrl.wait_max_ms)
+        PRINT_FORCE("Control plane yields   : %ld", cst_cmd_lock_stats.ctrl_yield_nb)
+        PRINT_FORCE("Data plane requests    : %ld", cst_cmd_lock_stats.data.lock_nb)
+        PRINT_FORCE("Data plane wait ms     : total %ld max %ld",
+                    cst_cmd_lock_stats.data.wait_total_ms, cst_cmd_lock_stats.data.wait_max_ms)
+      }
       /* -- config -------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                      "config",
-                      crs_strlen(argv_p[0]))
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                       "config",
+                       crs_strlen(argv_p[0]))
                == 0)
       {
         /* 'cst config' command: displays cellular configuration */
@@ -909,12 +977,12 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         }
       }
       /* -- power --------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "power", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "power", crs_strlen(argv_p[0])) == 0)
       {
         /* 'cst power ...' command */
         if (argc == 2U)
         {
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0)
           {
             /* power on the modem */
             PRINT_FORCE("modem power ON")
@@ -925,7 +993,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
               cmd_status = CMD_PROCESS_ERROR;
             }
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
           {
             /* power off the modem */
             PRINT_FORCE("modem power OFF")
@@ -943,7 +1011,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         }
       }
       /* -- techno -------------------------------------------------------------------------------------------------- */
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "techno", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "techno", crs_strlen(argv_p[0])) == 0)
       {
         /* 'cst techno ...' command */
         if (argc == 3U)
@@ -954,7 +1022,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
 
           tmpConversion = (uint8_t)crs_atoi(argv_p[2]);
           /* tmpConversion is unsigned, no need to test its value is greater or equal than zero */
-          if ((memcmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0) && (tmpConversion <= 9U))
+          if ((strncmp((CRC_CHAR_t *)argv_p[1], "on", crs_strlen(argv_p[1])) == 0) && (tmpConversion <= 9U))
           {
             /* Set access techno is present */
             cst_cmd_cellular_params.operator_selector.access_techno_present = CA_ACT_PRESENT;
@@ -975,7 +1043,7 @@ static cmd_status_t CST_cmd(uint8_t *cmd_line_p)
         }
         else if (argc == 2U)
         {
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
           {
             /* Set access techno is not present : automatic mode use*/
             cst_cmd_cellular_params.operator_selector.access_techno_present = CA_ACT_NOT_PRESENT;
@@ -1052,9 +1120,9 @@ static uint32_t CST_CMD_get_band(const CST_band_descr_t *band_descr,
     for (i = 0U ; band_descr[i].name != NULL ; i++)
     {
       /* find matching band in band_descr table */
-      if (memcmp((const CRC_CHAR_t *)argv_p[current_arg],
-                 (CRC_CHAR_t *)(band_descr[i].name),
-                 crs_strlen((const uint8_t *)argv_p[current_arg]))
+      if (strncmp((const CRC_CHAR_t *)argv_p[current_arg],
+                  (CRC_CHAR_t *)(band_descr[i].name),
+                  crs_strlen((const uint8_t *)argv_p[current_arg]))
           == 0)
       {
         /* matching band found */
@@ -1348,9 +1416,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
 
   if (cmd_p != NULL)
   {
-    if (memcmp((CRC_CHAR_t *)cmd_p,
-               (CRC_CHAR_t *)CST_cmd_modem_label,
-               crs_strlen(cmd_p)) == 0)
+    if (strncmp((CRC_CHAR_t *)cmd_p,
+                (CRC_CHAR_t *)CST_cmd_modem_label,
+                crs_strlen(cmd_p)) == 0)
     {
       /* parameters parsing                     */
 
@@ -1369,14 +1437,14 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
         /* no argument: displays help */
         CST_ModemHelpCmd();
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[0], "help", crs_strlen((uint8_t *)argv_p[0])) == 0)
+      else if (strncmp((const CRC_CHAR_t *)argv_p[0], "help", crs_strlen((uint8_t *)argv_p[0])) == 0)
       {
         /* help command: displays help */
         CST_ModemHelpCmd();
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[0],
-                      "config",
-                      crs_strlen((uint8_t *)argv_p[0]))
+      else if (strncmp((const CRC_CHAR_t *)argv_p[0],
+                       "config",
+                       crs_strlen((uint8_t *)argv_p[0]))
                == 0)
       {
         /* 'modem config ...' command */
@@ -1397,35 +1465,35 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           PRINT_FORCE("Scan seq : (mask=0x%06lx)", cst_cmd_scanseq_default)
           CST_CMD_display_seq_name(cst_cmd_scanseq_default, CST_Scanseq);
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                        "nwscanmode",
-                        crs_strlen((uint8_t *)argv_p[1])) == 0)
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                         "nwscanmode",
+                         crs_strlen((uint8_t *)argv_p[1])) == 0)
         {
           /* 'modem config nwscanmode ...' command */
           if (argc == 3U)
           {
             /* 'modem config nwscanmode ...' command */
-            if (memcmp((const CRC_CHAR_t *)argv_p[2],
-                       "AUTO",
-                       crs_strlen((uint8_t *)argv_p[2]))
+            if (strncmp((const CRC_CHAR_t *)argv_p[2],
+                        "AUTO",
+                        crs_strlen((uint8_t *)argv_p[2]))
                 == 0)
             {
               /* 'modem config nwscanmode AUTO' command: set AUTO in nwscanmode config */
               cst_cmd_nwscanmode_default = (uint8_t)QCFGSCANMODE_AUTO;
               cst_display_nwscanmode_default = CST_DISP_SCANMODE_AUTO;
             }
-            else if (memcmp((const CRC_CHAR_t *)argv_p[2],
-                            "GSM",
-                            crs_strlen((uint8_t *)argv_p[2]))
+            else if (strncmp((const CRC_CHAR_t *)argv_p[2],
+                             "GSM",
+                             crs_strlen((uint8_t *)argv_p[2]))
                      == 0)
             {
               /* 'modem config nwscanmode GSM' command */
               cst_cmd_nwscanmode_default = (uint8_t)QCFGSCANMODE_GSMONLY;
               cst_display_nwscanmode_default = CST_DISP_SCANMODE_GSM;
             }
-            else if (memcmp((const CRC_CHAR_t *)argv_p[2],
-                            "LTE",
-                            crs_strlen((uint8_t *)argv_p[2])) == 0)
+            else if (strncmp((const CRC_CHAR_t *)argv_p[2],
+                             "LTE",
+                             crs_strlen((uint8_t *)argv_p[2])) == 0)
             {
               /* 'modem config nwscanmode LTE' command */
               cst_cmd_nwscanmode_default = (uint8_t)QCFGSCANMODE_LTEONLY;
@@ -1443,32 +1511,32 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           /* display current nwscanmode */
           PRINT_FORCE("scanmode: %s\n\r", CST_ScanmodeName_p[cst_display_nwscanmode_default])
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                        "iotopmode",
-                        crs_strlen((uint8_t *)argv_p[1])) == 0)
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                         "iotopmode",
+                         crs_strlen((uint8_t *)argv_p[1])) == 0)
         {
           /* 'modem config iotopmode ...' command */
           if (argc == 3U)
           {
-            if (memcmp((const CRC_CHAR_t *)argv_p[2],
-                       "M1",
-                       crs_strlen((uint8_t *)argv_p[2]))
+            if (strncmp((const CRC_CHAR_t *)argv_p[2],
+                        "M1",
+                        crs_strlen((uint8_t *)argv_p[2]))
                 == 0)
             {
               /* 'modem config iotopmode M1' command */
               cst_cmd_iotopmode_default = QCFGIOTOPMODE_CATM1;
             }
-            else if (memcmp((const CRC_CHAR_t *)argv_p[2],
-                            "NB1",
-                            crs_strlen((uint8_t *)argv_p[2]))
+            else if (strncmp((const CRC_CHAR_t *)argv_p[2],
+                             "NB1",
+                             crs_strlen((uint8_t *)argv_p[2]))
                      == 0)
             {
               /* 'modem config iotopmode NB1' command */
               cst_cmd_iotopmode_default = QCFGIOTOPMODE_CATNB1;
             }
-            else if (memcmp((const CRC_CHAR_t *)argv_p[2],
-                            "ALL",
-                            crs_strlen((uint8_t *)argv_p[2]))
+            else if (strncmp((const CRC_CHAR_t *)argv_p[2],
+                             "ALL",
+                             crs_strlen((uint8_t *)argv_p[2]))
                      == 0)
             {
               /* 'modem config iotopmode ALL' command */
@@ -1486,9 +1554,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           /* display current iotopmode */
           PRINT_FORCE("iotopmode: %s\n\r", CST_IotopmodeName_p[cst_cmd_iotopmode_default])
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                        "gsmband",
-                        crs_strlen((uint8_t *)argv_p[1]))
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                         "gsmband",
+                         crs_strlen((uint8_t *)argv_p[1]))
                  == 0)
         {
           /* 'modem config gsmband ...' command */
@@ -1518,9 +1586,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           PRINT_FORCE("Gsm Bands: (mask=0x%lx%08lx)\n\r", cst_cmd_gsmband_MSB_default, cst_cmd_gsmband_LSB_default)
           CST_CMD_display_bitmap_name(cst_cmd_gsmband_MSB_default, cst_cmd_gsmband_LSB_default, CST_GSMband);
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                        "m1band",
-                        crs_strlen((uint8_t *)argv_p[1]))
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                         "m1band",
+                         crs_strlen((uint8_t *)argv_p[1]))
                  == 0)
         {
           /* 'modem config m1band ...' command */
@@ -1551,9 +1619,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           PRINT_FORCE("M1 Bands: (mask=0x%lx%08lx)\n\r", cst_cmd_m1band_MSB_default, cst_cmd_m1band_LSB_default)
           CST_CMD_display_bitmap_name(cst_cmd_m1band_MSB_default, cst_cmd_m1band_LSB_default, CST_M1band);
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                        "nb1band",
-                        crs_strlen((uint8_t *)argv_p[1]))
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                         "nb1band",
+                         crs_strlen((uint8_t *)argv_p[1]))
                  == 0)
         {
           /* 'modem config nb1band ...' command */
@@ -1584,9 +1652,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           PRINT_FORCE("NB1 bands: (mask=0x%lx%08lx)", cst_cmd_nb1band_MSB_default, cst_cmd_nb1band_LSB_default)
           CST_CMD_display_bitmap_name(cst_cmd_nb1band_MSB_default, cst_cmd_nb1band_LSB_default, CST_Nb1band);
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                        "scanseq",
-                        crs_strlen((uint8_t *)argv_p[1]))
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                         "scanseq",
+                         crs_strlen((uint8_t *)argv_p[1]))
                  == 0)
         {
           /* 'modem config scanseq ...' command */
@@ -1602,9 +1670,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
             for (i = 0U ; i < CST_CMD_SCANSEQ_NUMBER ; i++)
             {
               /* find matching scanseq mask */
-              if (memcmp((const CRC_CHAR_t *)argv_p[2],
-                         (const CRC_CHAR_t *)CST_ScanseqName_p[i],
-                         crs_strlen(CST_ScanseqName_p[i]))
+              if (strncmp((const CRC_CHAR_t *)argv_p[2],
+                          (const CRC_CHAR_t *)CST_ScanseqName_p[i],
+                          crs_strlen(CST_ScanseqName_p[i]))
                   == 0)
               {
                 /* matching scanseq mask found: sets it in the current config */
@@ -1633,7 +1701,7 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
             PRINT_FORCE("Too many parameters command: %s %s \n\r", cmd_p, argv_p[1])
           }
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1], "send", crs_strlen((uint8_t *)argv_p[1])) == 0)
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1], "send", crs_strlen((uint8_t *)argv_p[1])) == 0)
         {
           /* 'modem config send' command: send condif to the modem */
           /* send scanseg set AT command  */
@@ -1661,7 +1729,7 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
             cmd_status = CMD_PROCESS_ERROR;
           }
         }
-        else if (memcmp((const CRC_CHAR_t *)argv_p[1], "get", crs_strlen((uint8_t *)argv_p[1])) == 0)
+        else if (strncmp((const CRC_CHAR_t *)argv_p[1], "get", crs_strlen((uint8_t *)argv_p[1])) == 0)
         {
           /* 'modem config get' command: get condif from the modem */
           /* send scanseg get AT command  */
@@ -1863,9 +1931,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
 
   cmd_p = (uint8_t *)strtok((CRC_CHAR_t *)cmd_line_p, " \t");
 
-  if (memcmp((CRC_CHAR_t *)cmd_p,
-             (CRC_CHAR_t *)CST_cmd_modem_label,
-             crs_strlen(cmd_p)) == 0)
+  if (strncmp((CRC_CHAR_t *)cmd_p,
+              (CRC_CHAR_t *)CST_cmd_modem_label,
+              crs_strlen(cmd_p)) == 0)
   {
     /* parameters parsing                     */
 
@@ -1884,14 +1952,14 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
       /* help command or no argument: displays help */
       CST_ModemHelpCmd();
     }
-    else if (memcmp((const CRC_CHAR_t *)argv_p[0], "help", crs_strlen(argv_p[0])) == 0)
+    else if (strncmp((const CRC_CHAR_t *)argv_p[0], "help", crs_strlen(argv_p[0])) == 0)
     {
       /* help command or no argument: displays help */
       CST_ModemHelpCmd();
     }
-    else if (memcmp((const CRC_CHAR_t *)argv_p[0],
-                    "config",
-                    crs_strlen(argv_p[0]))
+    else if (strncmp((const CRC_CHAR_t *)argv_p[0],
+                     "config",
+                     crs_strlen(argv_p[0]))
              == 0)
     {
       /* 'modem config ...' command */
@@ -1900,9 +1968,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
         PRINT_FORCE("bands : ")
         CST_CMD_display_bitmap_name_altair();
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                      "bands",
-                      crs_strlen(argv_p[1]))
+      else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                       "bands",
+                       crs_strlen(argv_p[1]))
                == 0)
       {
         /* 'modem config bands ...' command */
@@ -1922,7 +1990,7 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
         /* display current band list */
         CST_CMD_display_bitmap_name_altair();
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[1], "send", crs_strlen(argv_p[1])) == 0)
+      else if (strncmp((const CRC_CHAR_t *)argv_p[1], "send", crs_strlen(argv_p[1])) == 0)
       {
         /* 'modem config send' command: send config to the modem */
         /* 1st create the AT command */
@@ -1942,7 +2010,7 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           cmd_status = CMD_PROCESS_ERROR;
         }
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[1], "lowpower", crs_strlen(argv_p[1])) == 0)
+      else if (strncmp((const CRC_CHAR_t *)argv_p[1], "lowpower", crs_strlen(argv_p[1])) == 0)
       {
         /* set low power capabilities command  */
         (void)sprintf((CRC_CHAR_t *)CST_CMD_Command, "AT%%SETACFG=\"pm.hifc.mode,A\"");
@@ -1967,7 +2035,7 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           PRINT_FORCE("Low power capabilities enabled\n\r")
         }
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[1], "get", crs_strlen(argv_p[1])) == 0)
+      else if (strncmp((const CRC_CHAR_t *)argv_p[1], "get", crs_strlen(argv_p[1])) == 0)
       {
         /* 'modem config get' command: get condif from the modem */
         PRINT_FORCE("GSM Bands:")
@@ -2119,9 +2187,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
   PRINT_FORCE("\n\r")
 
   cmd_p = (uint8_t *)strtok((CRC_CHAR_t *)cmd_line_p, " \t");
-  if (memcmp((CRC_CHAR_t *)cmd_p,
-             (CRC_CHAR_t *)CST_cmd_modem_label,
-             crs_strlen(cmd_p)) == 0)
+  if (strncmp((CRC_CHAR_t *)cmd_p,
+              (CRC_CHAR_t *)CST_cmd_modem_label,
+              crs_strlen(cmd_p)) == 0)
   {
     /* parameters parsing                     */
     for (argc = 0U ; argc < CST_CMS_PARAM_MAX ; argc++)
@@ -2139,14 +2207,14 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
       /* no argument: displays help */
       CST_ModemHelpCmd();
     }
-    else if (memcmp((const CRC_CHAR_t *)argv_p[0], "help", crs_strlen(argv_p[0])) == 0)
+    else if (strncmp((const CRC_CHAR_t *)argv_p[0], "help", crs_strlen(argv_p[0])) == 0)
     {
       /* help command: displays help */
       CST_ModemHelpCmd();
     }
-    else if (memcmp((const CRC_CHAR_t *)argv_p[0],
-                    "config",
-                    crs_strlen(argv_p[0]))
+    else if (strncmp((const CRC_CHAR_t *)argv_p[0],
+                     "config",
+                     crs_strlen(argv_p[0]))
              == 0)
     {
       /* 'modem config ...' command */
@@ -2156,9 +2224,9 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
         PRINT_FORCE("bands : ")
         CST_CMD_display_bitmap_name_sequans();
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[1],
-                      "bands",
-                      crs_strlen(argv_p[1]))
+      else if (strncmp((const CRC_CHAR_t *)argv_p[1],
+                       "bands",
+                       crs_strlen(argv_p[1]))
                == 0)
       {
         /* 'modem config band ...' command*/
@@ -2178,7 +2246,7 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
         /* display selected bands*/
         CST_CMD_display_bitmap_name_sequans();
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[1], "send", crs_strlen(argv_p[1])) == 0)
+      else if (strncmp((const CRC_CHAR_t *)argv_p[1], "send", crs_strlen(argv_p[1])) == 0)
       {
         /* send condif to the modem */
         /* Firstly: clear current modem configuration */
@@ -2206,7 +2274,7 @@ static cmd_status_t CST_ModemCmd(uint8_t *cmd_line_p)
           }
         }
       }
-      else if (memcmp((const CRC_CHAR_t *)argv_p[1], "get", crs_strlen(argv_p[1])) == 0)
+      else if (strncmp((const CRC_CHAR_t *)argv_p[1], "get", crs_strlen(argv_p[1])) == 0)
       {
         /* get the current list of band from the modem */
         PRINT_FORCE("GSM Bands:")
@@ -2350,23 +2418,23 @@ static cmd_status_t CST_AtCmd(uint8_t *cmd_line_p)
       cmd_p = (uint8_t *)strtok((CRC_CHAR_t *)cmd_line_p, " \t");
       if (cmd_p != NULL)
       {
-        if (memcmp((const CRC_CHAR_t *)cmd_p,
-                   (const CRC_CHAR_t *)CST_cmd_at_label,
-                   crs_strlen(cmd_p))
+        if (strncmp((const CRC_CHAR_t *)cmd_p,
+                    (const CRC_CHAR_t *)CST_cmd_at_label,
+                    crs_strlen(cmd_p))
             == 0)
         {
           /* parameters parsing                     */
           argv_p[0] = (uint8_t *)strtok(NULL, " \t");
           if (argv_p[0] != NULL)
           {
-            if (memcmp((CRC_CHAR_t *)argv_p[0], "help", crs_strlen(argv_p[0])) == 0)
+            if (strncmp((CRC_CHAR_t *)argv_p[0], "help", crs_strlen(argv_p[0])) == 0)
             {
               /* help command */
               cst_at_cmd_help();
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                            "timeout",
-                            crs_strlen(argv_p[0]))
+            else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                             "timeout",
+                             crs_strlen(argv_p[0]))
                      == 0)
             {
               /* timeout command */
@@ -2379,9 +2447,9 @@ static cmd_status_t CST_AtCmd(uint8_t *cmd_line_p)
               PRINT_FORCE("at timeout : %ld\n\r", cst_at_timeout)
             }
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
-            else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                            "suspenddata",
-                            crs_strlen(argv_p[0]))
+            else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                             "suspenddata",
+                             crs_strlen(argv_p[0]))
                      == 0)
             {
               /* suspenddata command: allows to switch modem to command mode */
@@ -2397,9 +2465,9 @@ static cmd_status_t CST_AtCmd(uint8_t *cmd_line_p)
                 PRINT_FORCE("\n\rsuspend data OK")
               }
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[0],
-                            "resumedata",
-                            crs_strlen(argv_p[0]))
+            else if (strncmp((CRC_CHAR_t *)argv_p[0],
+                             "resumedata",
+                             crs_strlen(argv_p[0]))
                      == 0)
             {
               /* resumedata command: allows to switch modem data mode */
@@ -18,25 +18,130 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
 #include "rtosal.h"
+#include "at_core.h"
 #include "error_handler.h"
 #include "cellular_service_task.h"
 #include "cellular_service_os.h"
 
 
 /* Private typedef -----------------------------------------------------------*/
+/* Cellular Service scheduling: control plane (registration, PDN, DNS, ping, power...: long AT sequences)
+   and data plane (socket operations: short AT sequences) */
+typedef enum
+{
+  CS_OS_CTRL_PLANE = 0,
+  CS_OS_DATA_PLANE,
+} cs_os_plane_t;
+
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+/* type of asynchronous request */
+typedef enum
+{
+  CS_ASYNC_REQ_SIGNAL_QUALITY = 0,
+  CS_ASYNC_REQ_SOCKET_CONNECT,
+  CS_ASYNC_REQ_SOCKET_SEND,
+  CS_ASYNC_REQ_SOCKET_RECEIVE,
+  CS_ASYNC_REQ_SOCKET_CLOSE,
+  CS_ASYNC_REQ_DNS,
+} cs_async_req_type_t;
+
+/* context of an asynchronous request (parameters are the ones of the service,
+   the remote address and the DNS request are copied) */
+typedef struct
+{
+  uint8_t                in_use;          /* 1 if this context is allocated */
+  cs_async_req_type_t    type;            /* request type */
+  socket_handle_t        sockHandle;      /* socket requests */
+  CS_IPaddrType_t        addr_type;       /* connect */
+  CS_CHAR_t              ip_addr_value[MAX_SIZE_IPADDR]; /* connect */
+  uint16_t               remote_port;     /* connect */
+  const CS_CHAR_t        *p_buf;          /* send */
+  uint32_t               length;          /* send, receive */
+  CS_CHAR_t              *p_rcv_buf;      /* receive */
+  int32_t                *p_rcv_length;   /* receive */
+  uint8_t                force;           /* close */
+  CS_PDN_conf_id_t       cid;             /* dns */
+  CS_DnsReq_t            dns_req;         /* dns */
+  CS_DnsResp_t           *p_dns_resp;     /* dns */
+  CS_SignalQuality_t     *p_sig_qual;     /* signal quality */
+  CS_Status_t            result;          /* result of the request */
+  osCDS_async_callback_t async_cb;        /* client completion callback */
+  void                   *p_cb_ctx;       /* client context for completion callback */
+} cs_async_req_t;
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
 
 /* Private defines -----------------------------------------------------------*/
 
 /* Private macros ------------------------------------------------------------*/
 
 /* Private variables ---------------------------------------------------------*/
+/* CellularServiceMutexHandle: one Cellular Service request (SID) at a time,
+   CellularServiceCtrlMutexHandle: one control plane request at a time, so that waiting control plane requests
+   do not queue in front of data plane ones,
+   CellularServiceYieldSemHandle: released when the data plane requests a control plane request yielded to are done,
+   CellularServiceStatsMutexHandle: protects cs_os_lock_stats */
 static osMutexId CellularServiceMutexHandle;
+static osMutexId CellularServiceCtrlMutexHandle;
+static osSemaphoreId CellularServiceYieldSemHandle;
+static osMutexId CellularServiceStatsMutexHandle;
 static osMutexId CellularServiceGeneralMutexHandle;
+static __IO uint32_t cs_os_data_waiting; /* number of data plane requests waiting for CellularServiceMutexHandle */
+static uint32_t cs_os_data_ticket;       /* ticket of the next data plane request waiting for the lock */
+static uint32_t cs_os_data_owner_ticket; /* ticket of the data plane request which has CellularServiceMutexHandle */
+static bool cs_os_ctrl_running;          /* a control plane request has CellularServiceMutexHandle */
+static uint32_t cs_os_yield_data_nb;     /* number of data plane requests to run before the control plane resumes */
+static uint32_t cs_os_yield_ticket;      /* first ticket of the data plane requests arrived after the yield */
+static osCS_lock_stats_t cs_os_lock_stats;
+
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+/* asynchronous requests: contexts, queue of pending requests (contains the context index),
+   mutex protecting contexts allocation, count of free contexts */
+static cs_async_req_t cs_async_req_tab[CS_ASYNC_REQ_QUEUE_SIZE];
+static osMessageQId   q_cs_async_req_Id = NULL;
+static osMutexId      CellularServiceAsyncMutexHandle;
+static osSemaphoreId  cs_async_req_free_sem;
+static osThreadId     cs_async_req_thread_id = NULL;
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
 
 /* Global variables ----------------------------------------------------------*/
 
 /* Private function prototypes -----------------------------------------------*/
+static void cs_os_lock(cs_os_plane_t plane);
+static void cs_os_unlock(cs_os_plane_t plane);
+#if (USE_CELLULAR_SERVICE_CTRL_YIELD == 1)
+static bool cs_os_step_callback(at_msg_t msg_id, at_step_event_t event);
+#endif /* USE_CELLULAR_SERVICE_CTRL_YIELD == 1 */
+static CS_Status_t cs_os_get_signal_quality(CS_SignalQuality_t *p_sig_qual);
+static CS_Status_t cs_os_socket_connect(socket_handle_t sockHandle, CS_IPaddrType_t addr_type,
+                                        CS_CHAR_t *p_ip_addr_value, uint16_t remote_port);
+static CS_Status_t cs_os_socket_send(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length);
+static int32_t cs_os_socket_receive(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length);
+static CS_Status_t cs_os_socket_close(socket_handle_t sockHandle, uint8_t force);
+static CS_Status_t cs_os_dns_request(CS_PDN_conf_id_t cid, CS_DnsReq_t *dns_req, CS_DnsResp_t *dns_resp);
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+static cs_async_req_t *cs_async_req_alloc(cs_async_req_type_t type,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx);
+static void cs_async_req_free(cs_async_req_t *p_req);
+static CS_Status_t cs_async_req_queue(cs_async_req_t *p_req);
+static void cs_async_req_process(cs_async_req_t *p_req);
+static cs_async_req_t *cs_req_get_signal_quality(CS_SignalQuality_t *p_sig_qual,
+                                                 osCDS_async_callback_t async_cb, void *p_cb_ctx);
+static cs_async_req_t *cs_req_socket_connect(socket_handle_t sockHandle, CS_IPaddrType_t addr_type,
+                                             const CS_CHAR_t *p_ip_addr_value, uint16_t remote_port,
+                                             osCDS_async_callback_t async_cb, void *p_cb_ctx);
+static cs_async_req_t *cs_req_socket_send(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx);
+static cs_async_req_t *cs_req_socket_receive(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length,
+                                             int32_t *p_rcv_length,
+                                             osCDS_async_callback_t async_cb, void *p_cb_ctx);
+static cs_async_req_t *cs_req_socket_close(socket_handle_t sockHandle, uint8_t force,
+                                           osCDS_async_callback_t async_cb, void *p_cb_ctx);
+static cs_async_req_t *cs_req_dns_request(CS_PDN_conf_id_t cid, const CS_DnsReq_t *dns_req, CS_DnsResp_t *dns_resp,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx);
+static void CellularServiceReqTaskBody(void *argument);
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
 
 /* Functions Definition ------------------------------------------------------*/
 /**
@@ -49,11 +154,7 @@ CS_Status_t osCS_get_signal_quality(CS_SignalQuality_t *p_sig_qual)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
-
-  result = CS_get_signal_quality(p_sig_qual);
-
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  result = cs_os_get_signal_quality(p_sig_qual);
 
   return (result);
 }
@@ -70,12 +171,12 @@ socket_handle_t osCDS_socket_create(CS_IPaddrType_t addr_type,
 {
   socket_handle_t socket_handle;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_DATA_PLANE);
 
   socket_handle = CDS_socket_create(addr_type,
                                     protocol,
                                     cid);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_DATA_PLANE);
 
   return (socket_handle);
 }
@@ -94,14 +195,14 @@ CS_Status_t osCDS_socket_set_callbacks(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_DATA_PLANE);
 
   result = CDS_socket_set_callbacks(sockHandle,
                                     data_ready_cb,
                                     data_sent_cb,
                                     remote_close_cb);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_DATA_PLANE);
 
   return (result);
 }
@@ -122,14 +223,14 @@ CS_Status_t osCDS_socket_set_option(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_DATA_PLANE);
 
   result = CDS_socket_set_option(sockHandle,
                                  opt_level,
                                  opt_name,
                                  p_opt_val);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_DATA_PLANE);
 
   return (result);
 }
@@ -149,11 +250,11 @@ CS_Status_t osCDS_socket_get_option(void)
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_DATA_PLANE);
 
     result = CDS_socket_get_option();
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_DATA_PLANE);
   }
 
   return (result);
@@ -173,12 +274,12 @@ CS_Status_t osCDS_socket_bind(socket_handle_t sockHandle,
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_DATA_PLANE);
 
     result = CDS_socket_bind(sockHandle,
                              local_port);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_DATA_PLANE);
   }
 
   return (result);
@@ -197,19 +298,9 @@ CS_Status_t osCDS_socket_connect(socket_handle_t sockHandle,
                                  CS_CHAR_t *p_ip_addr_value,
                                  uint16_t remote_port)
 {
-  CS_Status_t result = CELLULAR_ERROR;
-
-  if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
-  {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
-
-    result = CDS_socket_connect(sockHandle,
-                                addr_type,
-                                p_ip_addr_value,
-                                remote_port);
+  CS_Status_t result;
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
-  }
+  result = cs_os_socket_connect(sockHandle, addr_type, p_ip_addr_value, remote_port);
 
   return (result);
 }
@@ -227,11 +318,11 @@ CS_Status_t osCDS_socket_listen(socket_handle_t sockHandle)
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_DATA_PLANE);
 
     result = CDS_socket_listen(sockHandle);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_DATA_PLANE);
   }
 
   return (result);
@@ -248,18 +339,37 @@ CS_Status_t osCDS_socket_listen(socket_handle_t sockHandle)
 CS_Status_t osCDS_socket_send(socket_handle_t sockHandle,
                               const CS_CHAR_t *p_buf,
                               uint32_t length)
+{
+  CS_Status_t result;
+
+  result = cs_os_socket_send(sockHandle, p_buf, length);
+
+  return (result);
+}
+
+/**
+  * @brief  Send data segments over a socket to a remote server.
+  * @note   This function is blocking until the data is transferred or when the
+  *         timeout to wait for transmission expires.
+  * @note   Call CDS_socket_sendv with mutex access protection
+  * @param  same parameters as the CDS_socket_sendv function
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_sendv(socket_handle_t sockHandle,
+                               const CS_Iovec_t *p_iov,
+                               uint8_t iov_count)
 {
   CS_Status_t result = CELLULAR_ERROR;
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_DATA_PLANE);
 
-    result = CDS_socket_send(sockHandle,
-                             p_buf,
-                             length);
+    result = CDS_socket_sendv(sockHandle,
+                              p_iov,
+                              iov_count);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_DATA_PLANE);
   }
 
   return (result);
@@ -278,17 +388,7 @@ int32_t osCDS_socket_receive(socket_handle_t sockHandle,
 {
   int32_t result;
 
-  result = 0;
-  if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
-  {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
-
-    result = CDS_socket_receive(sockHandle,
-                                p_buf,
-                                max_buf_length);
-
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
-  }
+  result = cs_os_socket_receive(sockHandle, p_buf, max_buf_length);
 
   return (result);
 }
@@ -313,7 +413,7 @@ CS_Status_t osCDS_socket_sendto(socket_handle_t sockHandle,
 
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_DATA_PLANE);
 
     result = CDS_socket_sendto(sockHandle,
                                p_buf,
@@ -322,7 +422,7 @@ CS_Status_t osCDS_socket_sendto(socket_handle_t sockHandle,
                                p_ip_addr_value,
                                remote_port);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_DATA_PLANE);
   }
 
   return (result);
@@ -347,7 +447,7 @@ int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle,
   result = 0;
   if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_DATA_PLANE);
 
     result = CDS_socket_receivefrom(sockHandle,
                                     p_buf,
@@ -356,7 +456,7 @@ int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle,
                                     p_ip_addr_value,
                                     p_remote_port);
 
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_DATA_PLANE);
   }
 
   return (result);
@@ -374,12 +474,7 @@ CS_Status_t osCDS_socket_close(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
-
-  result = CDS_socket_close(sockHandle,
-                            force);
-
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  result = cs_os_socket_close(sockHandle, force);
 
   return (result);
 }
@@ -396,12 +491,12 @@ CS_Status_t osCDS_socket_cnx_status(socket_handle_t sockHandle,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_DATA_PLANE);
 
   result = CDS_socket_cnx_status(sockHandle,
                                  infos);
 
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_DATA_PLANE);
 
   return (result);
 }
@@ -426,6 +521,37 @@ CS_Bool_t osCDS_cellular_service_init(void)
       /* Platform is reset */
       ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 1, ERROR_FATAL);
     }
+    CellularServiceCtrlMutexHandle = rtosalMutexNew(NULL);
+    if (CellularServiceCtrlMutexHandle == NULL)
+    {
+      result = CELLULAR_FALSE;
+      /* Platform is reset */
+      ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 10, ERROR_FATAL);
+    }
+    CellularServiceYieldSemHandle = rtosalSemaphoreNew((const rtosal_char_t *)"CS_SEM_YIELD", 1U);
+    if (CellularServiceYieldSemHandle != NULL)
+    {
+      /* semaphore released by the data plane requests a control plane request yielded to */
+      (void)rtosalSemaphoreAcquire(CellularServiceYieldSemHandle, RTOSAL_WAIT_FOREVER);
+    }
+    CellularServiceStatsMutexHandle = rtosalMutexNew(NULL);
+    if ((CellularServiceYieldSemHandle == NULL) || (CellularServiceStatsMutexHandle == NULL))
+    {
+      result = CELLULAR_FALSE;
+      /* Platform is reset */
+      ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 11, ERROR_FATAL);
+    }
+    cs_os_data_waiting = 0U;
+    cs_os_data_ticket = 0U;
+    cs_os_data_owner_ticket = 0U;
+    cs_os_ctrl_running = false;
+    cs_os_yield_data_nb = 0U;
+    cs_os_yield_ticket = 0U;
+    (void) memset((void *)&cs_os_lock_stats, 0, sizeof(cs_os_lock_stats));
+#if (USE_CELLULAR_SERVICE_CTRL_YIELD == 1)
+    /* control plane requests yield to the data plane requests at the step boundaries of their AT transaction */
+    AT_set_step_callback(cs_os_step_callback);
+#endif /* USE_CELLULAR_SERVICE_CTRL_YIELD == 1 */
     CellularServiceGeneralMutexHandle = rtosalMutexNew(NULL);
     if (CellularServiceGeneralMutexHandle == NULL)
     {
@@ -434,6 +560,35 @@ CS_Bool_t osCDS_cellular_service_init(void)
       ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 2, ERROR_FATAL);
     }
 
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+    (void) memset((void *)cs_async_req_tab, 0, sizeof(cs_async_req_tab));
+    CellularServiceAsyncMutexHandle = rtosalMutexNew(NULL);
+    cs_async_req_free_sem = rtosalSemaphoreNew((const rtosal_char_t *)"CS_SEM_ASYNC_REQ_FREE",
+                                               (uint32_t)CS_ASYNC_REQ_QUEUE_SIZE);
+    q_cs_async_req_Id = rtosalMessageQueueNew((const rtosal_char_t *)"CS_ASYNC_REQ",
+                                              (uint32_t)CS_ASYNC_REQ_QUEUE_SIZE);
+    if ((CellularServiceAsyncMutexHandle == NULL) || (cs_async_req_free_sem == NULL) || (q_cs_async_req_Id == NULL))
+    {
+      result = CELLULAR_FALSE;
+      /* Platform is reset */
+      ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 8, ERROR_FATAL);
+    }
+    else
+    {
+      cs_async_req_thread_id = rtosalThreadNew((const rtosal_char_t *)"CellularSrvReq",
+                                               (os_pthread)CellularServiceReqTaskBody,
+                                               CELLULAR_SERVICE_REQ_THREAD_PRIO,
+                                               (uint32_t)CELLULAR_SERVICE_REQ_THREAD_STACK_SIZE,
+                                               NULL);
+      if (cs_async_req_thread_id == NULL)
+      {
+        result = CELLULAR_FALSE;
+        /* Platform is reset */
+        ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 9, ERROR_FATAL);
+      }
+    }
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
+
     /* To do next line of code not done under if result == CELLULAR_TRUE
        because if result == CELLULAR_FALSE platform is reset (avoid quality error)
      */
@@ -458,9 +613,9 @@ CS_Status_t osCDS_get_net_status(CS_RegistrationStatus_t *p_reg_status)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_get_net_status(p_reg_status);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -475,9 +630,9 @@ CS_Status_t osCDS_get_device_info(CS_DeviceInfo_t *p_devinfo)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_get_device_info(p_devinfo);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -494,9 +649,9 @@ CS_Status_t osCDS_subscribe_net_event(CS_UrcEvent_t event, cellular_urc_callback
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_subscribe_net_event(event,  urc_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -513,9 +668,9 @@ CS_Status_t osCDS_subscribe_modem_event(CS_ModemEvent_t events_mask, cellular_mo
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_subscribe_modem_event(events_mask, modem_evt_cb);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -532,9 +687,9 @@ CS_Status_t osCDS_power_on(void)
 
   if (cst_context.modem_on == false)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_CTRL_PLANE);
     result = CS_power_on();
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_CTRL_PLANE);
     if (result == CELLULAR_OK)
     {
       cst_context.modem_on = true;
@@ -555,9 +710,9 @@ CS_Status_t osCDS_power_off(void)
 
   if (cst_context.modem_on == true)
   {
-    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock(CS_OS_CTRL_PLANE);
     result = CS_power_off();
-    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    cs_os_unlock(CS_OS_CTRL_PLANE);
     if (result == CELLULAR_OK)
     {
       cst_context.modem_on = false;
@@ -576,9 +731,9 @@ CS_Status_t osCDS_reset(CS_Reset_t rst_type)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_reset(rst_type);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -596,9 +751,9 @@ CS_Status_t osCDS_init_modem(CS_ModemInit_t init,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_init_modem(init,  reset, pin_code);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -623,6 +778,22 @@ void osCCS_get_release_cs_resource(void)
   (void)rtosalMutexRelease(CellularServiceGeneralMutexHandle);
 }
 
+/**
+  * @brief  Get the Cellular Service lock statistics.
+  * @note   Statistics are copied under lock: the copy is consistent
+  * @param  p_stats Pointer to the structure to return the statistics
+  * @retval none
+  */
+void osCS_get_lock_stats(osCS_lock_stats_t *p_stats)
+{
+  if (p_stats != NULL)
+  {
+    (void)rtosalMutexAcquire(CellularServiceStatsMutexHandle, RTOSAL_WAIT_FOREVER);
+    (void) memcpy((void *)p_stats, (const void *)&cs_os_lock_stats, sizeof(osCS_lock_stats_t));
+    (void)rtosalMutexRelease(CellularServiceStatsMutexHandle);
+  }
+}
+
 /**
   * @brief  Request the Modem to register to the Cellular Network.
   * @note   This function is used to select the operator. It returns a detailed
@@ -636,9 +807,9 @@ CS_Status_t osCDS_register_net(CS_OperatorSelector_t *p_operator,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_register_net(p_operator, p_reg_status);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -652,9 +823,9 @@ CS_Status_t osCS_detach_PS_domain(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_detach_PS_domain();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -669,9 +840,9 @@ CS_Status_t osCDS_get_attach_status(CS_PSattach_t *p_attach)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_get_attach_status(p_attach);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -687,9 +858,9 @@ CS_Status_t osCDS_attach_PS_domain(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_attach_PS_domain();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -707,9 +878,9 @@ CS_Status_t osCDS_define_pdn(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_define_pdn(cid, apn, pdn_conf);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -728,9 +899,9 @@ CS_Status_t osCDS_register_pdn_event(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_register_pdn_event(cid,  pdn_event_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -746,9 +917,9 @@ CS_Status_t osCDS_set_default_pdn(CS_PDN_conf_id_t cid)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_set_default_pdn(cid);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -765,9 +936,9 @@ CS_Status_t osCDS_activate_pdn(CS_PDN_conf_id_t cid)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_activate_pdn(cid);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -783,9 +954,9 @@ CS_Status_t osCDS_suspend_data(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_suspend_data();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -800,9 +971,9 @@ CS_Status_t osCDS_resume_data(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_resume_data();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -821,9 +992,7 @@ CS_Status_t osCDS_dns_request(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
-  result = CS_dns_request(cid, dns_req, dns_resp);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  result = cs_os_dns_request(cid, dns_req, dns_resp);
 
   return (result);
 }
@@ -842,9 +1011,9 @@ CS_Status_t osCDS_ping(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CDS_ping(cid, ping_params, cs_ping_rsp_cb);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -862,9 +1031,9 @@ CS_Status_t osCDS_direct_cmd(CS_direct_cmd_tx_t *direct_cmd_tx,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result =  CS_direct_cmd(direct_cmd_tx, direct_cmd_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -881,9 +1050,9 @@ CS_Status_t osCDS_get_dev_IP_address(CS_PDN_conf_id_t cid,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_get_dev_IP_address(cid, ip_addr_type, p_ip_addr_value);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -900,9 +1069,9 @@ CS_Status_t osCS_sim_select(CS_SimSlot_t simSelected)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_sim_select(simSelected);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -919,9 +1088,9 @@ int32_t osCS_sim_generic_access(CS_sim_generic_access_t *sim_generic_access)
 {
   int32_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_sim_generic_access(sim_generic_access);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -942,9 +1111,9 @@ CS_Status_t osCS_InitPowerConfig(CS_init_power_config_t *p_power_config,
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_InitPowerConfig(p_power_config, power_status_callback);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -959,9 +1128,9 @@ CS_Status_t osCS_PowerWakeup(CS_wakeup_origin_t wakeup_origin)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_PowerWakeup(wakeup_origin);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -977,9 +1146,9 @@ CS_Status_t osCS_SleepCancel(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_SleepCancel();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -994,9 +1163,9 @@ CS_Status_t osCS_SleepRequest(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_SleepRequest();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -1011,9 +1180,9 @@ CS_Status_t osCS_SleepComplete(void)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_SleepComplete();
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -1028,9 +1197,9 @@ CS_Status_t osCS_SetPowerConfig(CS_set_power_config_t *p_power_config)
 {
   CS_Status_t result;
 
-  (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+  cs_os_lock(CS_OS_CTRL_PLANE);
   result = CS_SetPowerConfig(p_power_config);
-  (void)rtosalMutexRelease(CellularServiceMutexHandle);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
 
   return (result);
 }
@@ -1041,6 +1210,563 @@ CS_Status_t osCS_SetPowerConfig(CS_set_power_config_t *p_power_config)
 
 #endif  /* (USE_LOW_POWER == 1) */
 
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+/* =========================================================
+   ===========      Asynchronous services        ===========
+   ========================================================= */
+
+/**
+  * @brief  Read the actual signal quality seen by Modem (asynchronous request).
+  * @note   Request processed by the Cellular Service request thread as osCS_get_signal_quality
+  * @param  p_sig_qual Pointer to the structure to return the signal quality
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCS_get_signal_quality_async(CS_SignalQuality_t *p_sig_qual,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  return (cs_async_req_queue(cs_req_get_signal_quality(p_sig_qual, async_cb, p_cb_ctx)));
+}
+
+/**
+  * @brief  Connect to a remote server (asynchronous request).
+  * @note   Request processed by the Cellular Service request thread as osCDS_socket_connect
+  * @param  same parameters as the osCDS_socket_connect function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_connect_async(socket_handle_t sockHandle,
+                                       CS_IPaddrType_t addr_type,
+                                       CS_CHAR_t *p_ip_addr_value,
+                                       uint16_t remote_port,
+                                       osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  return (cs_async_req_queue(cs_req_socket_connect(sockHandle, addr_type, p_ip_addr_value, remote_port,
+                                                   async_cb, p_cb_ctx)));
+}
+
+/**
+  * @brief  Send data over a socket to a remote server (asynchronous request).
+  * @note   Request processed by the Cellular Service request thread as osCDS_socket_send
+  * @param  same parameters as the osCDS_socket_send function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_send_async(socket_handle_t sockHandle,
+                                    const CS_CHAR_t *p_buf,
+                                    uint32_t length,
+                                    osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  return (cs_async_req_queue(cs_req_socket_send(sockHandle, p_buf, length, async_cb, p_cb_ctx)));
+}
+
+/**
+  * @brief  Receive data from the connected remote server (asynchronous request).
+  * @note   Request processed by the Cellular Service request thread as osCDS_socket_receive
+  * @param  same parameters as the osCDS_socket_receive function
+  * @param  p_rcv_length Pointer to return the size of received data (in bytes)
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_receive_async(socket_handle_t sockHandle,
+                                       CS_CHAR_t *p_buf,
+                                       uint32_t max_buf_length,
+                                       int32_t *p_rcv_length,
+                                       osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  return (cs_async_req_queue(cs_req_socket_receive(sockHandle, p_buf, max_buf_length, p_rcv_length,
+                                                   async_cb, p_cb_ctx)));
+}
+
+/**
+  * @brief  Free a socket handle (asynchronous request).
+  * @note   Request processed by the Cellular Service request thread as osCDS_socket_close
+  * @param  same parameters as the osCDS_socket_close function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_socket_close_async(socket_handle_t sockHandle,
+                                     uint8_t force,
+                                     osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  return (cs_async_req_queue(cs_req_socket_close(sockHandle, force, async_cb, p_cb_ctx)));
+}
+
+/**
+  * @brief  DNS request (asynchronous request).
+  * @note   Request processed by the Cellular Service request thread as osCDS_dns_request
+  * @param  same parameters as the osCDS_dns_request function
+  * @param  async_cb Client completion callback
+  * @param  p_cb_ctx Client context passed to the completion callback
+  * @retval CS_Status_t
+  */
+CS_Status_t osCDS_dns_request_async(CS_PDN_conf_id_t cid,
+                                    CS_DnsReq_t  *dns_req,
+                                    CS_DnsResp_t *dns_resp,
+                                    osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  return (cs_async_req_queue(cs_req_dns_request(cid, dns_req, dns_resp, async_cb, p_cb_ctx)));
+}
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
+
+/* Private function Definition -----------------------------------------------*/
+/* osCS_get_signal_quality: call CS_get_signal_quality with mutex access protection */
+static CS_Status_t cs_os_get_signal_quality(CS_SignalQuality_t *p_sig_qual)
+{
+  CS_Status_t result;
+
+  cs_os_lock(CS_OS_CTRL_PLANE);
+
+  result = CS_get_signal_quality(p_sig_qual);
+
+  cs_os_unlock(CS_OS_CTRL_PLANE);
+
+  return (result);
+}
+
+/* osCDS_socket_connect: call CDS_socket_connect with mutex access protection */
+static CS_Status_t cs_os_socket_connect(socket_handle_t sockHandle,
+                                        CS_IPaddrType_t addr_type,
+                                        CS_CHAR_t *p_ip_addr_value,
+                                        uint16_t remote_port)
+{
+  CS_Status_t result = CELLULAR_ERROR;
+
+  if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
+  {
+    cs_os_lock(CS_OS_DATA_PLANE);
+
+    result = CDS_socket_connect(sockHandle,
+                                addr_type,
+                                p_ip_addr_value,
+                                remote_port);
+
+    cs_os_unlock(CS_OS_DATA_PLANE);
+  }
+
+  return (result);
+}
+
+/* osCDS_socket_send: call CDS_socket_send with mutex access protection */
+static CS_Status_t cs_os_socket_send(socket_handle_t sockHandle,
+                                     const CS_CHAR_t *p_buf,
+                                     uint32_t length)
+{
+  CS_Status_t result = CELLULAR_ERROR;
+
+  if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
+  {
+    cs_os_lock(CS_OS_DATA_PLANE);
+
+    result = CDS_socket_send(sockHandle,
+                             p_buf,
+                             length);
+
+    cs_os_unlock(CS_OS_DATA_PLANE);
+  }
+
+  return (result);
+}
+
+/* osCDS_socket_receive: call CDS_socket_receive with mutex access protection */
+static int32_t cs_os_socket_receive(socket_handle_t sockHandle,
+                                    CS_CHAR_t *p_buf,
+                                    uint32_t  max_buf_length)
+{
+  int32_t result;
+
+  result = 0;
+  if (CST_get_state() == CST_MODEM_DATA_READY_STATE)
+  {
+    cs_os_lock(CS_OS_DATA_PLANE);
+
+    result = CDS_socket_receive(sockHandle,
+                                p_buf,
+                                max_buf_length);
+
+    cs_os_unlock(CS_OS_DATA_PLANE);
+  }
+
+  return (result);
+}
+
+/* osCDS_socket_close: call CDS_socket_close with mutex access protection */
+static CS_Status_t cs_os_socket_close(socket_handle_t sockHandle,
+                                      uint8_t force)
+{
+  CS_Status_t result;
+
+  cs_os_lock(CS_OS_DATA_PLANE);
+
+  result = CDS_socket_close(sockHandle,
+                            force);
+
+  cs_os_unlock(CS_OS_DATA_PLANE);
+
+  return (result);
+}
+
+/* osCDS_dns_request: call CS_dns_request with mutex access protection */
+static CS_Status_t cs_os_dns_request(CS_PDN_conf_id_t cid,
+                                     CS_DnsReq_t *dns_req,
+                                     CS_DnsResp_t *dns_resp)
+{
+  CS_Status_t result;
+
+  cs_os_lock(CS_OS_CTRL_PLANE);
+  result = CS_dns_request(cid, dns_req, dns_resp);
+  cs_os_unlock(CS_OS_CTRL_PLANE);
+
+  return (result);
+}
+
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+/* allocate a free request context (NULL if none available) */
+static cs_async_req_t *cs_async_req_alloc(cs_async_req_type_t type,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  cs_async_req_t *p_req = NULL;
+  uint8_t idx;
+
+  if ((q_cs_async_req_Id != NULL) &&
+      (rtosalSemaphoreAcquire(cs_async_req_free_sem, 0U) == osOK))
+  {
+    (void)rtosalMutexAcquire(CellularServiceAsyncMutexHandle, RTOSAL_WAIT_FOREVER);
+    for (idx = 0U; idx < (uint8_t)CS_ASYNC_REQ_QUEUE_SIZE; idx++)
+    {
+      if (cs_async_req_tab[idx].in_use == 0U)
+      {
+        p_req = &cs_async_req_tab[idx];
+        (void) memset((void *)p_req, 0, sizeof(cs_async_req_t));
+        p_req->in_use = 1U;
+        p_req->type = type;
+        p_req->result = CELLULAR_ERROR;
+        p_req->async_cb = async_cb;
+        p_req->p_cb_ctx = p_cb_ctx;
+        break;
+      }
+    }
+    (void)rtosalMutexRelease(CellularServiceAsyncMutexHandle);
+  }
+
+  return (p_req);
+}
+
+/* free a request context */
+static void cs_async_req_free(cs_async_req_t *p_req)
+{
+  (void)rtosalMutexAcquire(CellularServiceAsyncMutexHandle, RTOSAL_WAIT_FOREVER);
+  p_req->in_use = 0U;
+  (void)rtosalMutexRelease(CellularServiceAsyncMutexHandle);
+  (void)rtosalSemaphoreRelease(cs_async_req_free_sem);
+}
+
+/* post an allocated request context to the request thread (context is freed on error) */
+static CS_Status_t cs_async_req_queue(cs_async_req_t *p_req)
+{
+  CS_Status_t result = CELLULAR_ERROR;
+
+  if (p_req != NULL)
+  {
+    /* one queue entry per context: no wait */
+    if (rtosalMessageQueuePut(q_cs_async_req_Id, (uint32_t)(p_req - &cs_async_req_tab[0]), 0U) == osOK)
+    {
+      result = CELLULAR_OK;
+    }
+    else
+    {
+      cs_async_req_free(p_req);
+    }
+  }
+
+  return (result);
+}
+
+/* process a request with mutex access protection (request thread) */
+static void cs_async_req_process(cs_async_req_t *p_req)
+{
+  switch (p_req->type)
+  {
+    case CS_ASYNC_REQ_SIGNAL_QUALITY:
+      p_req->result = cs_os_get_signal_quality(p_req->p_sig_qual);
+      break;
+    case CS_ASYNC_REQ_SOCKET_CONNECT:
+      p_req->result = cs_os_socket_connect(p_req->sockHandle, p_req->addr_type,
+                                           p_req->ip_addr_value, p_req->remote_port);
+      break;
+    case CS_ASYNC_REQ_SOCKET_SEND:
+      p_req->result = cs_os_socket_send(p_req->sockHandle, p_req->p_buf, p_req->length);
+      break;
+    case CS_ASYNC_REQ_SOCKET_RECEIVE:
+      *(p_req->p_rcv_length) = cs_os_socket_receive(p_req->sockHandle, p_req->p_rcv_buf, p_req->length);
+      p_req->result = (*(p_req->p_rcv_length) < 0) ? CELLULAR_ERROR : CELLULAR_OK;
+      break;
+    case CS_ASYNC_REQ_SOCKET_CLOSE:
+      p_req->result = cs_os_socket_close(p_req->sockHandle, p_req->force);
+      break;
+    case CS_ASYNC_REQ_DNS:
+      p_req->result = cs_os_dns_request(p_req->cid, &p_req->dns_req, p_req->p_dns_resp);
+      break;
+    default:
+      p_req->result = CELLULAR_ERROR;
+      break;
+  }
+}
+
+/* asynchronous requests: allocate a context and copy the parameters */
+static cs_async_req_t *cs_req_get_signal_quality(CS_SignalQuality_t *p_sig_qual,
+                                                 osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  cs_async_req_t *p_req = cs_async_req_alloc(CS_ASYNC_REQ_SIGNAL_QUALITY, async_cb, p_cb_ctx);
+
+  if (p_req != NULL)
+  {
+    p_req->p_sig_qual = p_sig_qual;
+  }
+
+  return (p_req);
+}
+
+static cs_async_req_t *cs_req_socket_connect(socket_handle_t sockHandle, CS_IPaddrType_t addr_type,
+                                             const CS_CHAR_t *p_ip_addr_value, uint16_t remote_port,
+                                             osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  cs_async_req_t *p_req = NULL;
+
+  /* remote address is copied */
+  if ((p_ip_addr_value != NULL) && (strlen((const CRC_CHAR_t *)p_ip_addr_value) < MAX_SIZE_IPADDR))
+  {
+    p_req = cs_async_req_alloc(CS_ASYNC_REQ_SOCKET_CONNECT, async_cb, p_cb_ctx);
+    if (p_req != NULL)
+    {
+      p_req->sockHandle = sockHandle;
+      p_req->addr_type = addr_type;
+      (void) strcpy((CRC_CHAR_t *)p_req->ip_addr_value, (const CRC_CHAR_t *)p_ip_addr_value);
+      p_req->remote_port = remote_port;
+    }
+  }
+
+  return (p_req);
+}
+
+static cs_async_req_t *cs_req_socket_send(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  cs_async_req_t *p_req = cs_async_req_alloc(CS_ASYNC_REQ_SOCKET_SEND, async_cb, p_cb_ctx);
+
+  if (p_req != NULL)
+  {
+    p_req->sockHandle = sockHandle;
+    p_req->p_buf = p_buf;
+    p_req->length = length;
+  }
+
+  return (p_req);
+}
+
+static cs_async_req_t *cs_req_socket_receive(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length,
+                                             int32_t *p_rcv_length,
+                                             osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  cs_async_req_t *p_req = NULL;
+
+  if (p_rcv_length != NULL)
+  {
+    p_req = cs_async_req_alloc(CS_ASYNC_REQ_SOCKET_RECEIVE, async_cb, p_cb_ctx);
+    if (p_req != NULL)
+    {
+      p_req->sockHandle = sockHandle;
+      p_req->p_rcv_buf = p_buf;
+      p_req->length = max_buf_length;
+      p_req->p_rcv_length = p_rcv_length;
+    }
+  }
+
+  return (p_req);
+}
+
+static cs_async_req_t *cs_req_socket_close(socket_handle_t sockHandle, uint8_t force,
+                                           osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  cs_async_req_t *p_req = cs_async_req_alloc(CS_ASYNC_REQ_SOCKET_CLOSE, async_cb, p_cb_ctx);
+
+  if (p_req != NULL)
+  {
+    p_req->sockHandle = sockHandle;
+    p_req->force = force;
+  }
+
+  return (p_req);
+}
+
+static cs_async_req_t *cs_req_dns_request(CS_PDN_conf_id_t cid, const CS_DnsReq_t *dns_req, CS_DnsResp_t *dns_resp,
+                                          osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  cs_async_req_t *p_req = NULL;
+
+  /* DNS request is copied */
+  if (dns_req != NULL)
+  {
+    p_req = cs_async_req_alloc(CS_ASYNC_REQ_DNS, async_cb, p_cb_ctx);
+    if (p_req != NULL)
+    {
+      p_req->cid = cid;
+      p_req->dns_req = *dns_req;
+      p_req->p_dns_resp = dns_resp;
+    }
+  }
+
+  return (p_req);
+}
+
+/* Cellular Service request thread: process queued requests in submission order */
+static void CellularServiceReqTaskBody(void *argument)
+{
+  UNUSED(argument);
+
+  rtosalStatus status;
+  uint32_t idx = 0U;
+  CS_Status_t result;
+  osCDS_async_callback_t async_cb;
+  void *p_cb_ctx;
+
+  for (;;)
+  {
+    status = rtosalMessageQueueGet(q_cs_async_req_Id, &idx, RTOSAL_WAIT_FOREVER);
+    if (((status == osEventMessage) || (status == osOK)) && (idx < (uint32_t)CS_ASYNC_REQ_QUEUE_SIZE))
+    {
+      cs_async_req_t *p_req = &cs_async_req_tab[idx];
+
+      cs_async_req_process(p_req);
+
+      /* free the request context before to call the client: callback can submit a new request */
+      result = p_req->result;
+      async_cb = p_req->async_cb;
+      p_cb_ctx = p_req->p_cb_ctx;
+      cs_async_req_free(p_req);
+
+      if (async_cb != NULL)
+      {
+        (* async_cb)(result, p_cb_ctx);
+      }
+    }
+  }
+}
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
+
+/* get the Cellular Service lock for one request of the plane
+   a data plane request waits only for the current request or step,
+   a control plane request waits for the other control plane requests, then lets the waiting data plane requests
+   run at its step boundaries if USE_CELLULAR_SERVICE_CTRL_YIELD == 1 (see cs_os_step_callback) */
+static void cs_os_lock(cs_os_plane_t plane)
+{
+  uint32_t start_time = rtosalGetSysTimerCount();
+  uint32_t wait_time;
+  uint32_t ticket;
+  osCS_lock_plane_stats_t *p_plane_stats;
+
+  if (plane == CS_OS_DATA_PLANE)
+  {
+    __disable_irq();
+    ticket = cs_os_data_ticket;
+    cs_os_data_ticket++;
+    cs_os_data_waiting++;
+    __enable_irq();
+    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_data_owner_ticket = ticket;
+    __disable_irq();
+    cs_os_data_waiting--;
+    __enable_irq();
+    p_plane_stats = &cs_os_lock_stats.data;
+  }
+  else
+  {
+    (void)rtosalMutexAcquire(CellularServiceCtrlMutexHandle, RTOSAL_WAIT_FOREVER);
+    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_ctrl_running = true;
+    p_plane_stats = &cs_os_lock_stats.ctrl;
+  }
+
+  wait_time = rtosalGetSysTimerCount() - start_time;
+  (void)rtosalMutexAcquire(CellularServiceStatsMutexHandle, RTOSAL_WAIT_FOREVER);
+  p_plane_stats->lock_nb++;
+  p_plane_stats->wait_total_ms += wait_time;
+  if (wait_time > p_plane_stats->wait_max_ms)
+  {
+    p_plane_stats->wait_max_ms = wait_time;
+  }
+  (void)rtosalMutexRelease(CellularServiceStatsMutexHandle);
+}
+
+/* release the Cellular Service lock got by cs_os_lock() */
+static void cs_os_unlock(cs_os_plane_t plane)
+{
+  bool resume_ctrl = false;
+
+  if (plane == CS_OS_CTRL_PLANE)
+  {
+    cs_os_ctrl_running = false;
+    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    (void)rtosalMutexRelease(CellularServiceCtrlMutexHandle);
+  }
+  else
+  {
+    /* tickets are compared by difference: they can loop back to 0 */
+    if ((cs_os_yield_data_nb != 0U) && ((int32_t)(cs_os_data_owner_ticket - cs_os_yield_ticket) < 0))
+    {
+      /* one of the data plane requests the control plane request yielded to is done
+         (not a data plane request arrived after the yield, even if it got the lock first) */
+      cs_os_yield_data_nb--;
+      resume_ctrl = (cs_os_yield_data_nb == 0U);
+    }
+    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    if (resume_ctrl == true)
+    {
+      (void)rtosalSemaphoreRelease(CellularServiceYieldSemHandle);
+    }
+  }
+}
+
+#if (USE_CELLULAR_SERVICE_CTRL_YIELD == 1)
+/* step callback of the AT transactions (see AT_set_step_callback)
+   called by the thread of the request at a step boundary of its SID, with CellularServiceMutexHandle taken:
+   a control plane request yields to the data plane requests waiting for the lock,
+   the modem decides which SIDs can be suspended (see atcm_SID_can_be_suspended) */
+static bool cs_os_step_callback(at_msg_t msg_id, at_step_event_t event)
+{
+  bool retval = false;
+  UNUSED(msg_id);
+
+  if (event == ATSTEP_CHECK_YIELD)
+  {
+    retval = ((cs_os_ctrl_running == true) && (cs_os_data_waiting != 0U));
+  }
+  else
+  {
+    /* data plane requests waiting at the time of the yield run before the control plane request resumes */
+    cs_os_ctrl_running = false;
+    __disable_irq();
+    cs_os_yield_data_nb = cs_os_data_waiting;
+    cs_os_yield_ticket = cs_os_data_ticket;
+    __enable_irq();
+    (void)rtosalMutexAcquire(CellularServiceStatsMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_lock_stats.ctrl_yield_nb++;
+    (void)rtosalMutexRelease(CellularServiceStatsMutexHandle);
+
+    (void)rtosalMutexRelease(CellularServiceMutexHandle);
+    (void)rtosalSemaphoreAcquire(CellularServiceYieldSemHandle, RTOSAL_WAIT_FOREVER);
+    (void)rtosalMutexAcquire(CellularServiceMutexHandle, RTOSAL_WAIT_FOREVER);
+    cs_os_ctrl_running = true;
+  }
+
+  return (retval);
+}
+#endif /* USE_CELLULAR_SERVICE_CTRL_YIELD == 1 */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
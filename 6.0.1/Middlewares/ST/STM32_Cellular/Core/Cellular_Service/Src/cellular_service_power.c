@@ -248,9 +248,9 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
   /* verify that it is a cst command */
   if (cmd_p != NULL)
   {
-    if (memcmp((CRC_CHAR_t *)cmd_p,
-               (CRC_CHAR_t *)CSP_cmd_label,
-               crs_strlen(cmd_p))
+    if (strncmp((CRC_CHAR_t *)cmd_p,
+                (CRC_CHAR_t *)CSP_cmd_label,
+                crs_strlen(cmd_p))
         == 0)
     {
       /* parameters parsing                     */
@@ -269,71 +269,71 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
         /* no argument: displays help */
         CSP_HelpCmd();
       }
-      else if (memcmp((CRC_CHAR_t *)argv_p[0],  "help",  crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0],  "help",  crs_strlen(argv_p[0])) == 0)
       {
         /* help command: displays help */
         CSP_HelpCmd();
       }
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "config", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "config", crs_strlen(argv_p[0])) == 0)
       {
         /* 'csp config' command */
         if (argc == 1U)
         {
           CSP_get_config();
         }
-        else if (memcmp((CRC_CHAR_t *)argv_p[1], "set", crs_strlen(argv_p[1])) == 0)
+        else if (strncmp((CRC_CHAR_t *)argv_p[1], "set", crs_strlen(argv_p[1])) == 0)
         {
           /* 'csp config set ...' command */
           if (argc == 4U)
           {
-            if (memcmp((CRC_CHAR_t *)argv_p[2], "psmrau", crs_strlen(argv_p[2])) == 0)
+            if (strncmp((CRC_CHAR_t *)argv_p[2], "psmrau", crs_strlen(argv_p[2])) == 0)
             {
               /* 'csp config set psmrau ...' command */
               (void)CMD_GetValue(argv_p[3], &value);
               csp_cmd_power_config.psm.req_periodic_RAU = (uint8_t)value & 0xffU;
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[2], "psmgprstimer", crs_strlen(argv_p[2])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[2], "psmgprstimer", crs_strlen(argv_p[2])) == 0)
             {
               /* 'csp config set psmgprstimer ...' command */
               (void)CMD_GetValue(argv_p[3], &value);
               csp_cmd_power_config.psm.req_GPRS_READY_timer = (uint8_t)value & 0xffU;
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[2], "psmtau", crs_strlen(argv_p[2])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[2], "psmtau", crs_strlen(argv_p[2])) == 0)
             {
               /* 'csp config set psmtau ...' command */
               (void)CMD_GetValue(argv_p[3], &value);
               csp_cmd_power_config.psm.req_periodic_TAU = (uint8_t)value & 0xffU;
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[2], "psmactivetimer", crs_strlen(argv_p[2])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[2], "psmactivetimer", crs_strlen(argv_p[2])) == 0)
             {
               /* 'csp config set psmactivetimer ...' command */
               (void)CMD_GetValue(argv_p[3], &value);
               csp_cmd_power_config.psm.req_active_time = (uint8_t)value & 0xffU;
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[2], "edrxacttype", crs_strlen(argv_p[2])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[2], "edrxacttype", crs_strlen(argv_p[2])) == 0)
             {
               /* 'csp config set edrxacttype ...' command */
-              if (memcmp((CRC_CHAR_t *)argv_p[3], "NOT_USED", crs_strlen(argv_p[3])) == 0)
+              if (strncmp((CRC_CHAR_t *)argv_p[3], "NOT_USED", crs_strlen(argv_p[3])) == 0)
               {
                 csp_cmd_power_config.edrx.act_type = CA_EIDRX_ACT_NOT_USED;
               }
-              else if (memcmp((CRC_CHAR_t *)argv_p[3], "EC_GSM_IOT", crs_strlen(argv_p[3])) == 0)
+              else if (strncmp((CRC_CHAR_t *)argv_p[3], "EC_GSM_IOT", crs_strlen(argv_p[3])) == 0)
               {
                 csp_cmd_power_config.edrx.act_type = CA_EIDRX_ACT_EC_GSM_IOT;
               }
-              else if (memcmp((CRC_CHAR_t *)argv_p[3], "GSM", crs_strlen(argv_p[3])) == 0)
+              else if (strncmp((CRC_CHAR_t *)argv_p[3], "GSM", crs_strlen(argv_p[3])) == 0)
               {
                 csp_cmd_power_config.edrx.act_type = CA_EIDRX_ACT_GSM;
               }
-              else if (memcmp((CRC_CHAR_t *)argv_p[3], "UTRAN_WB_S1", crs_strlen(argv_p[3])) == 0)
+              else if (strncmp((CRC_CHAR_t *)argv_p[3], "UTRAN_WB_S1", crs_strlen(argv_p[3])) == 0)
               {
                 csp_cmd_power_config.edrx.act_type = CA_EIDRX_ACT_E_UTRAN_WBS1;
               }
-              else if (memcmp((CRC_CHAR_t *)argv_p[3], "UTRAN_NB_S1", crs_strlen(argv_p[3])) == 0)
+              else if (strncmp((CRC_CHAR_t *)argv_p[3], "UTRAN_NB_S1", crs_strlen(argv_p[3])) == 0)
               {
                 csp_cmd_power_config.edrx.act_type = CA_EDRX_ACT_E_UTRAN_NBS1;
               }
-              else if (memcmp((CRC_CHAR_t *)argv_p[3], "UTRAN", crs_strlen(argv_p[3])) == 0)
+              else if (strncmp((CRC_CHAR_t *)argv_p[3], "UTRAN", crs_strlen(argv_p[3])) == 0)
               {
                 csp_cmd_power_config.edrx.act_type = CA_EIDRX_ACT_UTRAN;
               }
@@ -346,7 +346,7 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
                 cmd_status = CMD_SYNTAX_ERROR;
               }
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[2], "edrxvalue", crs_strlen(argv_p[2])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[2], "edrxvalue", crs_strlen(argv_p[2])) == 0)
             {
               /* 'csp config set edrxvalue ...' command */
               (void)CMD_GetValue(argv_p[3], &value);
@@ -368,12 +368,12 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
             cmd_status = CMD_SYNTAX_ERROR;
           }
         }
-        else if (memcmp((CRC_CHAR_t *)argv_p[1], "get", crs_strlen(argv_p[1])) == 0)
+        else if (strncmp((CRC_CHAR_t *)argv_p[1], "get", crs_strlen(argv_p[1])) == 0)
         {
           /* 'csp config get' command */
           CSP_get_config();
         }
-        else if (memcmp((CRC_CHAR_t *)argv_p[1], "send", crs_strlen(argv_p[1])) == 0)
+        else if (strncmp((CRC_CHAR_t *)argv_p[1], "send", crs_strlen(argv_p[1])) == 0)
         {
           /* 'csp config send' command */
           (void)dc_com_read(&dc_com_db, DC_CELLULAR_POWER_CONFIG, (void *)&csp_cmd_dc_power_config,
@@ -402,7 +402,7 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
           cmd_status = CMD_SYNTAX_ERROR;
         }
       }
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "state", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "state", crs_strlen(argv_p[0])) == 0)
       {
         /* 'csp state' command */
         (void)dc_com_read(&dc_com_db, DC_CELLULAR_POWER_CONFIG, (void *)&csp_cmd_dc_power_config,
@@ -439,7 +439,7 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
           PRINT_FORCE("eDRX config not present\n\r")
         }
       }
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "wakeup", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "wakeup", crs_strlen(argv_p[0])) == 0)
       {
         /* 'csp wakeup' command */
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
@@ -456,69 +456,69 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
         }
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
       }
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "setmode", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "setmode", crs_strlen(argv_p[0])) == 0)
       {
         /* 'csp setmode ...' command */
         if (argc == 2U)
         {
           (void)dc_com_read(&dc_com_db, DC_CELLULAR_POWER_CONFIG, (void *)&csp_cmd_dc_power_config,
                             sizeof(dc_cellular_power_config_t));
-          if (memcmp((CRC_CHAR_t *)argv_p[1], "runrealtime", crs_strlen(argv_p[1])) == 0)
+          if (strncmp((CRC_CHAR_t *)argv_p[1], "runrealtime", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode runrealtime ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_RUN_REAL_TIME;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "runinteractive0", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "runinteractive0", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode runinteractive0 ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_RUN_INTERACTIVE_0;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "runinteractive1", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "runinteractive1", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode runinteractive1 ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_RUN_INTERACTIVE_1;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "runinteractive2", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "runinteractive2", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode runinteractive2 ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_RUN_INTERACTIVE_2;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "runinteractive3", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "runinteractive3", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode runinteractive3 ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_RUN_INTERACTIVE_3;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "idle", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "idle", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode idle ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_IDLE;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "ildllp", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "ildllp", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode ildllp ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_IDLE_LP;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "lp", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "lp", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode lp ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_LP;
           }
-          else if (memcmp((CRC_CHAR_t *)argv_p[1], "ulp", crs_strlen(argv_p[1])) == 0)
+          else if (strncmp((CRC_CHAR_t *)argv_p[1], "ulp", crs_strlen(argv_p[1])) == 0)
           {
             /* 'csp setmode ulp ...' command */
             csp_cmd_dc_power_config.power_mode = CA_POWER_ULP;
           }
           /*
             Futur power management mode
-            else if (memcmp((CRC_CHAR_t *)argv_p[1], "stby1", crs_strlen(argv_p[1])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[1], "stby1", crs_strlen(argv_p[1])) == 0)
             {
               csp_cmd_dc_power_config.power_mode = CA_POWER_STBY1;
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[1], "stby1", crs_strlen(argv_p[1])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[1], "stby1", crs_strlen(argv_p[1])) == 0)
             {
               csp_cmd_dc_power_config.power_mode = CA_POWER_STBY2;
             }
-            else if (memcmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
+            else if (strncmp((CRC_CHAR_t *)argv_p[1], "off", crs_strlen(argv_p[1])) == 0)
             {
               csp_cmd_dc_power_config.power_mode = CA_POWER_OFF;
             }
@@ -538,7 +538,7 @@ static cmd_status_t CSP_cmd(uint8_t *cmd_line_p)
         PRINT_FORCE("Current power mode: %s\n\r", CSP_power_mode_name[csp_cmd_dc_power_config.power_mode])
 
       }
-      else if (memcmp((CRC_CHAR_t *)argv_p[0], "idle", crs_strlen(argv_p[0])) == 0)
+      else if (strncmp((CRC_CHAR_t *)argv_p[0], "idle", crs_strlen(argv_p[0])) == 0)
       {
         /* 'csp idle' command */
         status = CSP_DataIdle();
@@ -2752,6 +2752,7 @@ CS_Status_t CST_cellular_service_start(void)
   static osThreadId cst_cellular_service_thread_id = NULL;
   dc_nfmc_info_t  nfmc_info;
   uint32_t        cst_polling_period;
+  dc_com_res_mask_t cst_dc_res_mask;
   dc_com_status_t dc_ret;
   uint32_t        cs_ret;
   CS_Status_t     cst_ret;
@@ -2811,8 +2812,18 @@ CS_Status_t CST_cellular_service_start(void)
     ERROR_Handler(DBG_CHAN_CELLULAR_SERVICE, 6, ERROR_WARNING);
   }
 
-  /* register component to Data Cache  */
-  if (dc_com_core_register_gen_event_cb(&dc_com_db, CST_notif_callback, (const void *)NULL) == DC_COM_INVALID_ENTRY)
+  /* register component to Data Cache: only the entries managed by CST_notif_callback */
+  cst_dc_res_mask = DC_COM_RES_MASK(DC_CELLULAR_DATA_INFO)
+                    | DC_COM_RES_MASK(DC_CELLULAR_TARGET_STATE_CMD)
+                    | DC_COM_RES_MASK(DC_CELLULAR_CONFIG);
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
+  cst_dc_res_mask |= DC_COM_RES_MASK(DC_CELLULAR_INFO);
+#endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP) */
+#if (USE_LOW_POWER == 1)
+  cst_dc_res_mask |= DC_COM_RES_MASK(DC_CELLULAR_POWER_CONFIG);
+#endif /* (USE_LOW_POWER == 1) */
+  if (dc_com_core_register_entry_cb(&dc_com_db, cst_dc_res_mask, CST_notif_callback, (const void *)NULL)
+      == DC_COM_INVALID_ENTRY)
   {
     dc_ret = DC_COM_ERROR;
   }
@@ -50,7 +50,15 @@ extern "C" {
   A component can subscribe a callback in order to be informed
   when a Data Cache data entry has been updated.
   Subscription is done through dc_com_register_gen_event_cb() service
+  or, to be notified only for some entries, through dc_com_register_entry_cb() service
+  (a write of an entry only calls the callbacks subscribed to this entry).
+  The callbacks are called in the writing thread context, except when USE_DC_COM_DEFERRED_NOTIF == 1:
+  then the application consumers callbacks are called by a dedicated Data Cache thread, and several writes
+  of an entry done before its notification produce only one notification. The events sent by
+  dc_com_write_event are notified by this thread too, after the entries written before them.
   Read of data entry value is done by calling dc_com_read() service.
+  A read does not take the Data Cache mutex: the entry is copied and the copy is retried
+  if the entry has been updated meanwhile, so a reader does not wait for the notification callbacks.
 
   The Data Cache structure includes the rt_state field.
   This field contains the state of service and the validity of entry data.
@@ -134,6 +142,10 @@ extern "C" {
       * Data Cache entry structure registration
       * registration allows consumer to be notified when an entry is produced in Data Cache
       (void)dc_com_register_gen_event_cb(&dc_com_db, dc_consumer_example_notif_callback, (void *) NULL);
+      * or, to be notified only when DC_PRODUCER_EXAMPLE_ENTRY is written
+      * (the entry must be registered by its producer before this call)
+      (void)dc_com_register_entry_cb(&dc_com_db, DC_COM_RES_MASK(DC_PRODUCER_EXAMPLE_ENTRY),
+                                     dc_consumer_example_notif_callback, (void *) NULL);
     }
 
     ---------------------------------------------------------------------------------------
@@ -225,6 +237,14 @@ extern "C" {
 /** @brief Invalid entry: at creation, the Data Cache entries must be initialized with this value  */
 #define DC_COM_INVALID_ENTRY  0xFFU
 
+/* Entry subscription of a consumer is a bitmap of entry identifiers */
+#if (DC_COM_ENTRY_MAX_NB > 32U)
+#error "DC_COM_ENTRY_MAX_NB must not exceed the number of bits of dc_com_res_mask_t"
+#endif /* (DC_COM_ENTRY_MAX_NB > 32U) */
+
+/** @brief All entries: subscription mask used by dc_com_register_gen_event_cb() */
+#define DC_COM_RES_MASK_ALL   0xFFFFFFFFUL
+
 /**
   * @}
   */
@@ -240,6 +260,8 @@ typedef uint16_t dc_com_res_id_t;   /*!< type of identifier of the registered Da
 
 typedef uint16_t dc_com_event_id_t; /*!< type of Data Cache event */
 
+typedef uint32_t dc_com_res_mask_t; /*!< type of Data Cache entry subscription mask (one bit per res_id) */
+
 typedef bool  dc_com_status_t;   /*!< type of Data Cache return code  */
 #define   DC_COM_OK     (dc_com_status_t)true   /*!< Ok  */
 #define   DC_COM_ERROR  (dc_com_status_t)false  /*!< Error  */
@@ -304,8 +326,20 @@ typedef struct
   dc_com_reg_id_t consumer_reg_id;
   dc_com_gen_event_callback_t notif_cb;    /* Call back not registered by API                                         */
   const void *private_consumer_data;       /* Private data associated with call back                                  */
+  dc_com_res_mask_t res_mask;              /* Entries for which the call back is called on dc_com_write               */
 } dc_com_consumer_info_t;
 
+/** @brief type of Data Cache notification statistics */
+typedef struct
+{
+  uint32_t write_nb;            /*!< number of dc_com_write calls                                       */
+  uint32_t write_change_nb;     /*!< number of dc_com_write calls with a data change (notification)     */
+  uint32_t cb_call_nb;          /*!< number of consumer callbacks called on entry notification        */
+  uint32_t cb_skip_nb;          /*!< number of consumer callbacks skipped (entry not subscribed)        */
+  uint32_t read_retry_nb;       /*!< number of dc_com_read copies retried (entry updated during copy)   */
+  uint32_t notif_coalesced_nb;  /*!< number of changed writes merged in a pending deferred notification */
+} dc_com_stats_t;
+
 /** @brief type of Data Cache global structure (Data Cache internal use) */
 typedef struct
 {
@@ -315,6 +349,8 @@ typedef struct
   dc_com_consumer_info_t consumer_info[DC_COM_MAX_NB_SUBSCRIBER];
   void *p_dc_db[DC_COM_ENTRY_MAX_NB];
   uint16_t dc_db_len[DC_COM_ENTRY_MAX_NB];
+  volatile uint32_t dc_db_seq[DC_COM_ENTRY_MAX_NB]; /* entry sequence: odd while dc_com_write updates the entry */
+  dc_com_stats_t stats;
 } dc_com_db_t;
 
 /**
@@ -338,6 +374,10 @@ extern dc_com_db_t dc_com_db; /*!< Data Cache Database Identifier */
   * @{
   */
 
+/** @brief Subscription mask of one Data Cache entry (to be combined with '|' for several entries) */
+#define DC_COM_RES_MASK(res_id)  (((dc_com_res_id_t)(res_id) < 32U) ? \
+                                  ((dc_com_res_mask_t)1U << (dc_com_res_id_t)(res_id)) : (dc_com_res_mask_t)0U)
+
 /**
   * @}
   */
@@ -389,6 +429,42 @@ dc_com_reg_id_t dc_com_core_register_gen_event_cb(dc_com_db_t *p_dc_db,
 dc_com_reg_id_t dc_com_register_gen_event_cb(dc_com_db_t *p_dc_db, dc_com_gen_event_callback_t notif_cb,
                                              const void *p_private_data);
 
+/**
+  * @brief  Allow a core consumer to register to the notifications of some Data Cache entries.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  res_mask        - entries subscribed (DC_COM_RES_MASK() of each entry, combined with '|')
+  * @note                     The entries must be registered before this call.
+  * @param  notif_cb        - address of callback.
+  * @note                     This callback is called by dc_com_write only for the subscribed entries
+  *                           and for each event sent by a call to dc_com_write_event.
+  *                           The callback is executed in the writing thread context.
+  * @param  p_private_data  - address of consumer private context (optional).
+  * @note                     This address is passed as a parameter of the callback
+  * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
+  *                           DC_COM_INVALID_ENTRY in case of error
+  */
+dc_com_reg_id_t dc_com_core_register_entry_cb(dc_com_db_t *p_dc_db, dc_com_res_mask_t res_mask,
+                                              dc_com_gen_event_callback_t notif_cb,
+                                              const void *p_private_data);
+
+/**
+  * @brief  Allow a application consumer to register to the notifications of some Data Cache entries.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  res_mask        - entries subscribed (DC_COM_RES_MASK() of each entry, combined with '|')
+  * @note                     The entries must be registered before this call.
+  * @param  notif_cb        - address of callback.
+  * @note                     This callback is called by dc_com_write only for the subscribed entries
+  *                           and for each event sent by a call to dc_com_write_event.
+  *                           The callback is executed in the writing thread context.
+  * @param  p_private_data  - address of consumer private context (optional).
+  * @note                     This address is passed as a parameter of the callback
+  * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
+  *                           DC_COM_INVALID_ENTRY in case of error
+  */
+dc_com_reg_id_t dc_com_register_entry_cb(dc_com_db_t *p_dc_db, dc_com_res_mask_t res_mask,
+                                         dc_com_gen_event_callback_t notif_cb,
+                                         const void *p_private_data);
+
 /**
   * @brief  Allow a Data Cache producer to update data associated to a Data Cache entry.
   * @param  p_dc            - data base reference (Must be set to &dc_com_db)
@@ -409,6 +485,14 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
   */
 dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_data, uint32_t len);
 
+/**
+  * @brief  Get the Data Cache notification statistics.
+  * @note   write_nb and read_retry_nb are updated without mutex: approximate on concurrent calls.
+  * @param  p_dc            - data base reference (Must be set to &dc_com_db)
+  * @param  p_stats         - statistics copy
+  * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+  */
+dc_com_status_t dc_com_get_stats(dc_com_db_t *p_dc, dc_com_stats_t *p_stats);
 
 /**
   * @}
@@ -431,13 +515,15 @@ void dc_com_init(dc_com_db_t *p_dc);
 
 /**
   * @brief  Start Data Cache module.
-  * @param  p_dc - data base reference (Unused)
+  * @param  p_dc - data base reference (Must be set to &dc_com_db)
   * @retval -
   */
 void dc_com_start(dc_com_db_t *p_dc);
 
 /**
   * @brief  Send an event to DC.
+  * @note   When USE_DC_COM_DEFERRED_NOTIF == 1, DC_COM_ERROR is returned if too many events
+  *         are not yet notified to the application consumers.
   * @param  p_dc            - data base reference (Must be set to &dc_com_db)
   * @param  event_id        - event id
   * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
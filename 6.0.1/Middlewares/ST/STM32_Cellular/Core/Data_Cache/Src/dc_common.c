@@ -34,7 +34,26 @@ typedef struct
   dc_service_rt_state_t rt_state;
 } dc_base_rt_info_t;
 
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+/** @brief Deferred notifications: entries written, then the event sent after these writes (if any) */
+typedef struct
+{
+  dc_com_res_mask_t res_mask;   /* entries written and not yet notified                 */
+  dc_com_event_id_t event_id;   /* event sent after the writes of res_mask              */
+  bool              event;      /* true: event_id is notified after the entries         */
+} dc_com_notif_t;
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
+
 /* Private defines -----------------------------------------------------------*/
+/* Number of copies tried by dc_com_read before sleeping one tick between the copies.
+ * A reader with a higher priority than the preempted writer would otherwise spin forever. */
+#define DC_COM_READ_RETRY_MAX  (3U)
+
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+/* Number of events sent by dc_com_write_event and not yet notified to the application consumers */
+#define DC_COM_NOTIF_EVENT_MAX  (4U)
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
+
 /* Private macros ------------------------------------------------------------*/
 
 #if (USE_TRACE_CELLULAR_SERVICE == 1U)
@@ -74,19 +93,37 @@ dc_com_db_t dc_com_db;
   *                           The callback is executed in the writing thread context.
   * @param  p_private_data  - address of consumer private context (optional).
   * @note                     This address is passed as a parameter of the callback
+  * @param  res_mask        - entries for which the callback is called by dc_com_write
   * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
   *                           DC_COM_INVALID_ENTRY in case of error
   */
 void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db,
                                          uint8_t id,
                                          dc_com_gen_event_callback_t notif_cb,
-                                         const void *p_private_data);
+                                         const void *p_private_data,
+                                         dc_com_res_mask_t res_mask);
+
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+/* Wake up dc_com_notif_thread if no notification is pending */
+static void dc_com_notif_wakeup(void);
+/* Thread notifying the application consumers of the written entries and of the events */
+static void dc_com_notif_thread(void *p_argument);
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
 
 /* Private variables ---------------------------------------------------------*/
 
 /* Mutex to avoid  Data Cache concurrent access */
 static osMutexId dc_common_mutex;
 
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+/* Notifications not yet done to the application consumers, in write order (protected by mutex):
+   dc_com_notif_pending[0..dc_com_notif_event_nb - 1] end with an event, the last one collects the next writes */
+static dc_com_notif_t dc_com_notif_pending[DC_COM_NOTIF_EVENT_MAX + 1U];
+static uint8_t dc_com_notif_event_nb;
+/* Semaphore to wake up dc_com_notif_thread when an entry becomes pending */
+static osSemaphoreId dc_com_notif_semaphore;
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
+
 /* Functions Definition ------------------------------------------------------*/
 
 /**
@@ -143,6 +180,27 @@ dc_com_res_id_t dc_com_register_serv(dc_com_db_t *p_dc_db, void *p_data, uint16_
 dc_com_reg_id_t dc_com_core_register_gen_event_cb(dc_com_db_t *p_dc_db,
                                                   dc_com_gen_event_callback_t notif_cb,
                                                   const void *p_private_data)
+{
+  /* notified for all entries */
+  return (dc_com_core_register_entry_cb(p_dc_db, DC_COM_RES_MASK_ALL, notif_cb, p_private_data));
+}
+
+/**
+  * @brief  Allow a core consumer to register to the notifications of some Data Cache entries.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  res_mask        - entries subscribed (DC_COM_RES_MASK() of each entry, combined with '|')
+  * @param  notif_cb        - address of callback.
+  * @note                     This callback is called by dc_com_write only for the subscribed entries
+  *                           and for each event sent by a call to dc_com_write_event.
+  *                           The callback is executed in the writing thread context.
+  * @param  p_private_data  - address of consumer private context (optional).
+  * @note                     This address is passed as a parameter of the callback
+  * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
+  *                           DC_COM_INVALID_ENTRY in case of error
+  */
+dc_com_reg_id_t dc_com_core_register_entry_cb(dc_com_db_t *p_dc_db, dc_com_res_mask_t res_mask,
+                                              dc_com_gen_event_callback_t notif_cb,
+                                              const void *p_private_data)
 {
   dc_com_reg_id_t consumer_id;
 
@@ -150,14 +208,14 @@ dc_com_reg_id_t dc_com_core_register_gen_event_cb(dc_com_db_t *p_dc_db,
   {
     consumer_id = p_dc_db->consumer_core_number;
     (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
-    dc_com_register_gen_event_cb_common(p_dc_db, consumer_id, notif_cb, p_private_data);
+    dc_com_register_gen_event_cb_common(p_dc_db, consumer_id, notif_cb, p_private_data, res_mask);
     p_dc_db->consumer_core_number++;
     (void)rtosalMutexRelease(dc_common_mutex);
   }
   else
   {
     consumer_id = DC_COM_INVALID_ENTRY;
-    PRINT_ERR("dc_com_core_register_gen_event_cb : Impossible to register to events")
+    PRINT_ERR("dc_com_core_register_entry_cb : Impossible to register to events")
   }
 
   return consumer_id;
@@ -178,6 +236,27 @@ dc_com_reg_id_t dc_com_core_register_gen_event_cb(dc_com_db_t *p_dc_db,
 dc_com_reg_id_t dc_com_register_gen_event_cb(dc_com_db_t *p_dc_db,
                                              dc_com_gen_event_callback_t notif_cb,
                                              const void *p_private_data)
+{
+  /* notified for all entries */
+  return (dc_com_register_entry_cb(p_dc_db, DC_COM_RES_MASK_ALL, notif_cb, p_private_data));
+}
+
+/**
+  * @brief  Allow a application consumer to register to the notifications of some Data Cache entries.
+  * @param  p_dc_db         - data base reference (Must be set to &dc_com_db)
+  * @param  res_mask        - entries subscribed (DC_COM_RES_MASK() of each entry, combined with '|')
+  * @param  notif_cb        - address of callback.
+  * @note                     This callback is called by dc_com_write only for the subscribed entries
+  *                           and for each event sent by a call to dc_com_write_event.
+  *                           The callback is executed in the writing thread context.
+  * @param  p_private_data  - address of consumer private context (optional).
+  * @note                     This address is passed as a parameter of the callback
+  * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
+  *                           DC_COM_INVALID_ENTRY in case of error
+  */
+dc_com_reg_id_t dc_com_register_entry_cb(dc_com_db_t *p_dc_db, dc_com_res_mask_t res_mask,
+                                         dc_com_gen_event_callback_t notif_cb,
+                                         const void *p_private_data)
 {
   dc_com_reg_id_t consumer_id;
 
@@ -185,14 +264,14 @@ dc_com_reg_id_t dc_com_register_gen_event_cb(dc_com_db_t *p_dc_db,
   {
     consumer_id = p_dc_db->consumer_appli_number;
     (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
-    dc_com_register_gen_event_cb_common(p_dc_db, consumer_id, notif_cb, p_private_data);
+    dc_com_register_gen_event_cb_common(p_dc_db, consumer_id, notif_cb, p_private_data, res_mask);
     p_dc_db->consumer_appli_number++;
     (void)rtosalMutexRelease(dc_common_mutex);
   }
   else
   {
     consumer_id = DC_COM_INVALID_ENTRY;
-    PRINT_ERR("dc_com_register_gen_event_cb : Impossible to register to events")
+    PRINT_ERR("dc_com_register_entry_cb : Impossible to register to events")
   }
 
   return consumer_id;
@@ -208,17 +287,20 @@ dc_com_reg_id_t dc_com_register_gen_event_cb(dc_com_db_t *p_dc_db,
   *                           The callback is executed in the writing thread context.
   * @param  p_private_data  - address of consumer private context (optional).
   * @note                     This address is passed as a parameter of the callback
+  * @param  res_mask        - entries for which the callback is called by dc_com_write
   * @retval dc_com_reg_id_t - return the identifier of the registered consumer or
   *                           DC_COM_INVALID_ENTRY in case of error
   */
 void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db,
                                          uint8_t id,
                                          dc_com_gen_event_callback_t notif_cb,
-                                         const void *p_private_data)
+                                         const void *p_private_data,
+                                         dc_com_res_mask_t res_mask)
 {
   p_dc_db->consumer_info[id].consumer_reg_id       = id;
   p_dc_db->consumer_info[id].notif_cb              = notif_cb;
   p_dc_db->consumer_info[id].private_consumer_data = p_private_data;
+  p_dc_db->consumer_info[id].res_mask              = res_mask;
 }
 
 
@@ -233,6 +315,7 @@ void dc_com_register_gen_event_cb_common(dc_com_db_t *p_dc_db,
 dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const void *p_data, uint32_t len)
 {
   dc_com_reg_id_t reg_id;
+  dc_com_res_mask_t res_mask;
   dc_base_rt_info_t *dc_base_rt_info;
   dc_com_status_t res;
   dc_com_db_t *com_db = (dc_com_db_t *)p_dc;
@@ -240,6 +323,8 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
   if ((p_dc != NULL) && (res_id != DC_COM_INVALID_ENTRY) && (res_id < com_db->serv_number) &&
       (com_db->dc_db_len[res_id] >= len) && (p_data != NULL))
   {
+    /* updated without mutex: an unchanged write must stay lock free (approximate count on concurrent writes) */
+    com_db->stats.write_nb++;
     /* check that something has changed in data to write */
     /* if nothing changed, just do nothing */
     if (memcmp(com_db->p_dc_db[res_id], p_data, len) != 0)
@@ -248,22 +333,54 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
       /* Avoid to be interrupted by another event before the end of first event processing */
       (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
 
+      /* odd sequence: entry update ongoing, concurrent dc_com_read will retry */
+      com_db->dc_db_seq[res_id]++;
+      __DMB();
       (void)memcpy((void *)(com_db->p_dc_db[res_id]), p_data, (uint32_t)len);
       dc_base_rt_info = (dc_base_rt_info_t *)(com_db->p_dc_db[res_id]);
       dc_base_rt_info->header.res_id = res_id;
       dc_base_rt_info->header.size   = len;
+      __DMB();
+      /* even sequence: entry update done */
+      com_db->dc_db_seq[res_id]++;
+      com_db->stats.write_change_nb++;
 
       /* In consumer_info array, core consumers are place at the beginning, and application after */
       /* So for loops from the beginning to the last application registered */
+      res_mask = DC_COM_RES_MASK(res_id);
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+      /* application consumers are notified by dc_com_notif_thread: only core consumers are called here */
+      if ((dc_com_notif_pending[dc_com_notif_event_nb].res_mask & res_mask) != 0U)
+      {
+        /* entry notification still pending, and no event sent since: this write is notified with it */
+        com_db->stats.notif_coalesced_nb++;
+      }
+      else
+      {
+        dc_com_notif_wakeup();
+        dc_com_notif_pending[dc_com_notif_event_nb].res_mask |= res_mask;
+      }
+      for (reg_id = 0U; reg_id < p_dc->consumer_core_number; reg_id++)
+#else
       for (reg_id = 0U; reg_id < p_dc->consumer_appli_number; reg_id++)
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
       {
         dc_com_consumer_info_t *consumer_info;
         consumer_info = &(com_db->consumer_info[reg_id]);
 
         if (consumer_info->notif_cb != NULL)
         {
-          /* let's call now the call back                                                  */
-          consumer_info->notif_cb((dc_com_event_id_t)res_id, consumer_info->private_consumer_data);
+          /* only consumers subscribed to this entry are woken up */
+          if ((consumer_info->res_mask & res_mask) != 0U)
+          {
+            /* let's call now the call back                                                  */
+            com_db->stats.cb_call_nb++;
+            consumer_info->notif_cb((dc_com_event_id_t)res_id, consumer_info->private_consumer_data);
+          }
+          else
+          {
+            com_db->stats.cb_skip_nb++;
+          }
         }
       }
       (void)rtosalMutexRelease(dc_common_mutex);
@@ -289,11 +406,45 @@ dc_com_status_t dc_com_write(dc_com_db_t *p_dc, dc_com_res_id_t res_id, const vo
 dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_data, uint32_t len)
 {
   dc_com_status_t res;
+  uint32_t seq;
+  uint8_t  retry;
+  bool     copy_ok;
 
   if ((p_dc != NULL) && (res_id != DC_COM_INVALID_ENTRY) && (res_id < p_dc->serv_number) &&
       (p_dc->dc_db_len[res_id] >= len))
   {
-    (void)memcpy(p_data, (void *)p_dc->p_dc_db[res_id], (uint32_t)len);
+    /* Lock free read: copy the entry and check that no dc_com_write updated it during the copy */
+    copy_ok = false;
+    retry = 0U;
+    while (copy_ok == false)
+    {
+      if (retry >= DC_COM_READ_RETRY_MAX)
+      {
+        /* writer preempted during the update: let it run, the mutex is not taken because the writer
+           keeps it while calling the consumer callbacks */
+        (void)rtosalDelay(1U);
+      }
+      seq = p_dc->dc_db_seq[res_id];
+      if ((seq & 1U) == 0U)
+      {
+        __DMB();
+        (void)memcpy(p_data, (void *)p_dc->p_dc_db[res_id], (uint32_t)len);
+        __DMB();
+        if (seq == p_dc->dc_db_seq[res_id])
+        {
+          copy_ok = true;
+        }
+      }
+      if (copy_ok == false)
+      {
+        /* torn read: updated without mutex, approximate count on concurrent reads */
+        p_dc->stats.read_retry_nb++;
+        if (retry < DC_COM_READ_RETRY_MAX)
+        {
+          retry++;
+        }
+      }
+    }
     res = DC_COM_OK;
   }
   else
@@ -305,8 +456,36 @@ dc_com_status_t dc_com_read(dc_com_db_t *p_dc, dc_com_res_id_t res_id, void *p_d
   return res;
 }
 
+/**
+  * @brief  Get the Data Cache notification statistics.
+  * @param  p_dc            - data base reference (Must be set to &dc_com_db)
+  * @param  p_stats         - statistics copy
+  * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
+  */
+dc_com_status_t dc_com_get_stats(dc_com_db_t *p_dc, dc_com_stats_t *p_stats)
+{
+  dc_com_status_t res;
+
+  if ((p_dc != NULL) && (p_stats != NULL))
+  {
+    /* consistent copy of the statistics updated under mutex,
+       write_nb and read_retry_nb are updated without mutex (approximate counts) */
+    (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+    *p_stats = p_dc->stats;
+    (void)rtosalMutexRelease(dc_common_mutex);
+    res = DC_COM_OK;
+  }
+  else
+  {
+    res = DC_COM_ERROR;
+  }
+  return res;
+}
+
 /**
   * @brief  Send an event to DC.
+  * @note   When USE_DC_COM_DEFERRED_NOTIF == 1, DC_COM_ERROR is returned if too many events
+  *         are not yet notified to the application consumers.
   * @param  p_dc            - data base reference (Must be set to &dc_com_db)
   * @param  event_id        - event id
   * @retval dc_com_status_t - return status with DC_COM_OK or DC_COM_ERROR
@@ -325,8 +504,28 @@ dc_com_status_t dc_com_write_event(dc_com_db_t *p_dc, dc_com_event_id_t event_id
     /* Calls all registered callback notification */
     /* In consumer_info array, core consumers are place at the beginning, and application after */
     /* So for loops from the beginning to the last application registered */
-
-    for (reg_id = 0U; reg_id <  p_dc->consumer_appli_number; reg_id++)
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+    /* application consumers are notified by dc_com_notif_thread, after the entries written before the event */
+    if (dc_com_notif_event_nb < DC_COM_NOTIF_EVENT_MAX)
+    {
+      res = DC_COM_OK;
+      dc_com_notif_wakeup();
+      dc_com_notif_pending[dc_com_notif_event_nb].event_id = event_id;
+      dc_com_notif_pending[dc_com_notif_event_nb].event    = true;
+      dc_com_notif_event_nb++;
+      dc_com_notif_pending[dc_com_notif_event_nb].res_mask = 0U;
+      dc_com_notif_pending[dc_com_notif_event_nb].event    = false;
+    }
+    else
+    {
+      res = DC_COM_ERROR;
+      PRINT_ERR("dc_com_write_event : too many events not yet notified.")
+    }
+    for (reg_id = 0U; (res == DC_COM_OK) && (reg_id < p_dc->consumer_core_number); reg_id++)
+#else
+    res = DC_COM_OK;
+    for (reg_id = 0U; reg_id < p_dc->consumer_appli_number; reg_id++)
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
     {
       const dc_com_consumer_info_t *consumer_info;
       consumer_info = &(com_db->consumer_info[reg_id]);
@@ -336,7 +535,6 @@ dc_com_status_t dc_com_write_event(dc_com_db_t *p_dc, dc_com_event_id_t event_id
       }
     }
     (void)rtosalMutexRelease(dc_common_mutex);
-    res = DC_COM_OK;
   }
   else
   {
@@ -345,6 +543,109 @@ dc_com_status_t dc_com_write_event(dc_com_db_t *p_dc, dc_com_event_id_t event_id
   return res;
 }
 
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+/**
+  * @brief  Wake up dc_com_notif_thread if no notification is pending (called under mutex).
+  * @note   The thread takes all the pending notifications each time it is woken up.
+  * @param  -
+  * @retval -
+  */
+static void dc_com_notif_wakeup(void)
+{
+  if ((dc_com_notif_event_nb == 0U) && (dc_com_notif_pending[0].res_mask == 0U))
+  {
+    (void)rtosalSemaphoreRelease(dc_com_notif_semaphore);
+  }
+}
+
+/**
+  * @brief  Thread notifying the application consumers of the entries written by dc_com_write
+  *         and of the events sent by dc_com_write_event.
+  * @note   Writes of an entry done before its notification, and with no event sent between them,
+  *         are notified once: the consumer reads the last value of the entry.
+  *         An event is notified after the entries written before it.
+  * @param  p_argument - data base reference (&dc_com_db)
+  * @retval -
+  */
+static void dc_com_notif_thread(void *p_argument)
+{
+  dc_com_db_t *p_dc = (dc_com_db_t *)p_argument;
+  dc_com_notif_t pending[DC_COM_NOTIF_EVENT_MAX + 1U];
+  uint8_t pending_nb;
+  uint8_t i;
+  dc_com_res_mask_t res_mask;
+  dc_com_res_id_t res_id;
+  dc_com_reg_id_t reg_id;
+  uint32_t cb_call_nb;
+  uint32_t cb_skip_nb;
+
+  for (;;)
+  {
+    (void)rtosalSemaphoreAcquire(dc_com_notif_semaphore, RTOSAL_WAIT_FOREVER);
+
+    /* get and reset the pending notifications: entries written from now on trigger a new notification */
+    (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+    pending_nb = dc_com_notif_event_nb + 1U;
+    (void)memcpy(pending, dc_com_notif_pending, (uint32_t)pending_nb * sizeof(dc_com_notif_t));
+    dc_com_notif_event_nb = 0U;
+    dc_com_notif_pending[0].res_mask = 0U;
+    dc_com_notif_pending[0].event    = false;
+    (void)rtosalMutexRelease(dc_common_mutex);
+
+    /* callbacks called without mutex: a producer is never blocked by an application consumer */
+    cb_call_nb = 0U;
+    cb_skip_nb = 0U;
+    for (i = 0U; i < pending_nb; i++)
+    {
+      for (res_id = 0U; res_id < p_dc->serv_number; res_id++)
+      {
+        res_mask = DC_COM_RES_MASK(res_id);
+        if ((pending[i].res_mask & res_mask) != 0U)
+        {
+          for (reg_id = DC_COM_MAX_NB_CORE_SUBSCRIBER; reg_id < p_dc->consumer_appli_number; reg_id++)
+          {
+            const dc_com_consumer_info_t *consumer_info;
+            consumer_info = &(p_dc->consumer_info[reg_id]);
+
+            if (consumer_info->notif_cb != NULL)
+            {
+              if ((consumer_info->res_mask & res_mask) != 0U)
+              {
+                cb_call_nb++;
+                consumer_info->notif_cb((dc_com_event_id_t)res_id, consumer_info->private_consumer_data);
+              }
+              else
+              {
+                cb_skip_nb++;
+              }
+            }
+          }
+        }
+      }
+      if (pending[i].event == true)
+      {
+        /* events are notified to all the application consumers */
+        for (reg_id = DC_COM_MAX_NB_CORE_SUBSCRIBER; reg_id < p_dc->consumer_appli_number; reg_id++)
+        {
+          const dc_com_consumer_info_t *consumer_info;
+          consumer_info = &(p_dc->consumer_info[reg_id]);
+
+          if (consumer_info->notif_cb != NULL)
+          {
+            consumer_info->notif_cb(pending[i].event_id, consumer_info->private_consumer_data);
+          }
+        }
+      }
+    }
+
+    (void)rtosalMutexAcquire(dc_common_mutex, RTOSAL_WAIT_FOREVER);
+    p_dc->stats.cb_call_nb += cb_call_nb;
+    p_dc->stats.cb_skip_nb += cb_skip_nb;
+    (void)rtosalMutexRelease(dc_common_mutex);
+  }
+}
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
+
 /**
   * @brief  Initialize the Data Cache module.
   * @param  p_dc - data base reference (Must be set to &dc_com_db)
@@ -361,18 +662,45 @@ void dc_com_init(dc_com_db_t *p_dc)
   {
     ERROR_Handler(DBG_CHAN_UTILITIES, 1, ERROR_FATAL);
   }
+
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+  dc_com_notif_event_nb = 0U;
+  dc_com_notif_pending[0].res_mask = 0U;
+  dc_com_notif_pending[0].event    = false;
+  dc_com_notif_semaphore = rtosalSemaphoreNew((const rtosal_char_t *)"DC_NOTIF_SEM", 1U);
+  if (dc_com_notif_semaphore == NULL)
+  {
+    ERROR_Handler(DBG_CHAN_UTILITIES, 2, ERROR_FATAL);
+  }
+  else
+  {
+    /* semaphore created available: take it, it is released when an entry notification is pending */
+    (void)rtosalSemaphoreAcquire(dc_com_notif_semaphore, RTOSAL_WAIT_FOREVER);
+  }
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
 }
 
 /**
   * @brief  Start Data Cache module.
-  * @param  p_dc - data base reference (Unused)
+  * @param  p_dc - data base reference (Must be set to &dc_com_db)
   * @retval -
   */
 void dc_com_start(dc_com_db_t *p_dc)
 {
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+  if (rtosalThreadNew((const rtosal_char_t *)"DataCacheNotif",
+                      (os_pthread)dc_com_notif_thread,
+                      DC_COM_NOTIF_THREAD_PRIO,
+                      (uint32_t)DC_COM_NOTIF_THREAD_STACK_SIZE,
+                      (void *)p_dc) == NULL)
+  {
+    ERROR_Handler(DBG_CHAN_UTILITIES, 3, ERROR_FATAL);
+  }
+#else
   UNUSED(p_dc);
   /* Nothing to do */
   __NOP();
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -28,6 +28,9 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "plf_config.h"
 #include "plf_ipc_config.h"
+#if (IPC_USE_TX_QUEUE == 1U)
+#include "rtosal.h"
+#endif /* IPC_USE_TX_QUEUE */
 /* ipc_config.h must define following flags:
 * - IPC_USE_STREAM_MODE: set to 0 if IPC stream mode not supported (ie using modem IP stack, with sockets)
 *   set to 1 if IPC stream mode needed (ie using MCU IP stack like Lwip)
@@ -37,6 +40,17 @@ extern "C" {
 * - IPC_RXBUF_THRESHOLD: if free space in RX queue is < to this value, the interface (UART,..) will be paused
 *   until enough free space (ie previous msg have been read)
 * - IPC_USE_UART: set to 1 is IPC uses UART (ONLY UART IS SUPPORTED ACTUALLY)
+* - IPC_USE_UART_DMA_RX: set to 1 to receive UART characters with a circular DMA and idle line detection
+*   (characters are written by blocks to the RX queue), set to 0 to receive one character per interrupt
+* - IPC_UART_DMA_RXBUF_SIZE: size of the circular DMA buffer
+*   NOTE: need to define only if (IPC_USE_UART_DMA_RX == 1U)
+* - IPC_USE_TX_QUEUE: set to 1 to copy data to send in a queue of TX buffers (IPC_send returns once data are queued,
+*   tasks sending on the same device are serialized), set to 0 to send the caller buffer directly (caller has to
+*   wait for the TX complete callback)
+* - IPC_TXQUEUE_NB, IPC_TXQUEUE_BUF_SIZE: number and size of the TX buffers
+*   NOTE: need to define only if (IPC_USE_TX_QUEUE == 1U)
+* - IPC_USE_UART_DMA_TX: set to 1 to send the TX buffers by DMA, set to 0 to send them under interrupt
+*   NOTE: need to define only if (IPC_USE_TX_QUEUE == 1U)
 * - IPC_USE_SPI: 0
 * - IPC_USE_I2C: 0
 * - DBG_IPC_RX_FIFO: set to 1 for additional debug information
@@ -61,10 +75,14 @@ extern "C" {
 *    S: message size (15 bits, maximum size = 32767)
 *  - Payload
 *    message received
+*  A message never loops back to index 0 of the circular buffer: when the end of the buffer is reached, the
+*  message being received is moved to index 0 and the first byte of its previous header is set to
+*  IPC_RXMSG_HEADER_WRAP (the end of the buffer is skipped by the reader).
 */
 #define  IPC_RXMSG_HEADER_SIZE            ((uint16_t) 2U)
 #define  IPC_RXMSG_HEADER_COMPLETE_MASK   ((uint8_t) 0x80U)
 #define  IPC_RXMSG_HEADER_SIZE_MASK       ((uint8_t) 0x7FU)
+#define  IPC_RXMSG_HEADER_WRAP            ((uint8_t) 0xFFU) /* size above IPC_RXBUF_MAXSIZE: not a message */
 #define  IPC_DEVICE_NOT_FOUND             ((uint8_t) 0xFFU)
 
 /* Exported types ------------------------------------------------------------*/
@@ -148,8 +166,8 @@ typedef struct
 
 typedef struct
 {
-  uint8_t     buffer[IPC_RXBUF_MAXSIZE];
-  uint16_t    size;
+  const uint8_t *buffer; /* points to the message in the RX queue, valid until IPC_release() */
+  uint16_t       size;
 } IPC_RxMessage_t;
 
 typedef struct
@@ -163,13 +181,17 @@ typedef struct
 } IPC_RxQueue_t;
 
 #if (IPC_USE_STREAM_MODE == 1U)
+/* stream mode RX buffer: single-producer/single-consumer ring
+ * index_write is only updated by the reception interrupt, index_read is only updated by the reader task,
+ * so no interrupt masking is needed (one byte is kept free to distinguish a full ring from an empty one)
+ */
 typedef struct
 {
   uint8_t      data[IPC_RXBUF_STREAM_MAXSIZE];
-  uint16_t     index_read;
-  uint16_t     index_write;
-  uint16_t     available_char;
+  __IO uint16_t index_read;
+  __IO uint16_t index_write;
   uint16_t     total_rcv_count;
+  uint16_t     overflow_count;  /* characters dropped because the ring was full */
 } IPC_RxBuffer_t;
 #endif  /* IPC_USE_STREAM_MODE */
 
@@ -179,7 +201,15 @@ typedef void (*IPC_RxCallbackTypeDef)(struct IPC_Handle_Typedef_struct *hipc);
 typedef void (*IPC_TxCallbackTypeDef)(struct IPC_Handle_Typedef_struct *hipc);
 typedef void (*IPC_ErrCallbackTypeDef)(struct IPC_Handle_Typedef_struct *hipc);
 typedef void (*IPC_RXFIFO_writeTypeDef)(struct IPC_Handle_Typedef_struct *hipc, uint8_t rxChar);
+typedef uint16_t (*IPC_RXFIFO_writeBlockTypeDef)(struct IPC_Handle_Typedef_struct *hipc,
+                                                 const uint8_t *p_data, uint16_t size);
 typedef uint8_t (*IPC_CheckEndOfMsgCallbackTypeDef)(uint8_t rxChar);
+/* block version of IPC_CheckEndOfMsgCallbackTypeDef: analyze characters of p_data until the end of the block
+ * or until an end of message is detected (in this case, *p_endOfMsg is set to 1).
+ * Return the number of characters analyzed.
+ */
+typedef uint16_t (*IPC_CheckEndOfMsgBlockCallbackTypeDef)(const uint8_t *p_data, uint16_t size,
+                                                          uint8_t *p_endOfMsg);
 
 typedef struct IPC_Handle_Typedef_struct
 {
@@ -195,18 +225,48 @@ typedef struct IPC_Handle_Typedef_struct
   IPC_TxCallbackTypeDef             TxClientCallback;
   IPC_ErrCallbackTypeDef            ErrorCallback;
   IPC_CheckEndOfMsgCallbackTypeDef  CheckEndOfMsgCallback;
+  IPC_CheckEndOfMsgBlockCallbackTypeDef CheckEndOfMsgBlockCallback; /* optional (can be NULL) */
   IPC_RXFIFO_writeTypeDef           RxFifoWrite;
+#if (IPC_USE_UART_DMA_RX == 1U)
+  IPC_RXFIFO_writeBlockTypeDef      RxFifoWriteBlock;
+  uint8_t                           RxCallbackDeferred;   /* 1: messages closed are not notified to the client */
+  uint16_t                          RxCallbackPendingNb;  /* number of messages closed and not notified */
+#endif /* IPC_USE_UART_DMA_RX */
 
 #if (DBG_IPC_RX_FIFO == 1U)
   dbg_rx_queue_info_t         dbgRxQueue;
 #endif /* DBG_IPC_RX_FIFO */
 } IPC_Handle_t;
 
+#if (IPC_USE_TX_QUEUE == 1U)
+typedef struct
+{
+  IPC_CHAR_t      data[IPC_TXQUEUE_BUF_SIZE];
+  uint16_t        size;
+  IPC_Handle_t    *hipc;    /* channel which sent the data: its TX complete callback is called */
+} IPC_TxBuffer_t;
+#endif /* IPC_USE_TX_QUEUE */
+
 typedef struct
 {
   IPC_State_t              state;
   IPC_PhysicalInterface_t  phy_int;
+#if (IPC_USE_UART_DMA_RX == 1U)
+  IPC_CHAR_t               RxDmaBuf[IPC_UART_DMA_RXBUF_SIZE]; /* RX circular DMA buffer - common buffer for one
+                                                               * physical interface */
+  uint16_t                 RxDmaReadPos;  /* position of the next character to push in the RX queue */
+  uint16_t                 RxDmaWritePos; /* DMA position saved when the reception has been paused */
+#else
   IPC_CHAR_t               RxChar[1];    /* RX DMA buffer (1 char) - common buffer for one physical interface  */
+#endif /* IPC_USE_UART_DMA_RX */
+#if (IPC_USE_TX_QUEUE == 1U)
+  IPC_TxBuffer_t           TxQueue[IPC_TXQUEUE_NB]; /* TX buffers - common buffers for one physical interface */
+  uint8_t                  TxQueueWrite;     /* index of the next buffer to fill */
+  __IO uint8_t             TxQueueRead;      /* index of the buffer being sent */
+  __IO uint8_t             TxQueueCount;     /* number of buffers filled and not yet sent */
+  osSemaphoreId            TxQueueSemaphore; /* one token per free buffer */
+  osMutexId                TxQueueMutex;     /* serializes the tasks sending on this interface */
+#endif /* IPC_USE_TX_QUEUE */
   IPC_Handle_t             *h_current_channel;   /* current active IPC channel */
   IPC_Handle_t             *h_inactive_channel;  /* other IPC channel (exists if not NULL), currently not active */
 } IPC_ClientDescription_t;
@@ -226,14 +286,19 @@ IPC_Status_t IPC_open(IPC_Handle_t      *const hipc,
                       IPC_TxCallbackTypeDef pTxClientCallback,
                       IPC_ErrCallbackTypeDef pErrorClientCallback,
                       IPC_CheckEndOfMsgCallbackTypeDef pCheckEndOfMsg);
+IPC_Status_t IPC_setCheckEndOfMsgBlockCallback(IPC_Handle_t *const hipc,
+                                               IPC_CheckEndOfMsgBlockCallbackTypeDef pCheckEndOfMsgBlock);
 IPC_Status_t IPC_close(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_select(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_reset(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_abort(IPC_Handle_t *const hipc);
 IPC_Handle_t *IPC_get_other_channel(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bufsize);
-IPC_Status_t IPC_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg);
+IPC_Status_t IPC_peek(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg);
+IPC_Status_t IPC_release(IPC_Handle_t *const hipc);
 IPC_Status_t IPC_streamReceive(IPC_Handle_t *const hipc, uint8_t *const p_buffer, int16_t *const p_len);
+IPC_Status_t IPC_streamPeek(IPC_Handle_t *const hipc, const uint8_t **pp_data, uint16_t *const p_len);
+IPC_Status_t IPC_streamRelease(IPC_Handle_t *const hipc, uint16_t len);
 void IPC_DumpRXQueue(IPC_Handle_t *const hipc, uint8_t readable);
 
 #ifdef __cplusplus
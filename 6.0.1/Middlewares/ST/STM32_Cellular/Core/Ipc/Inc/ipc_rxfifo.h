@@ -39,10 +39,17 @@ extern "C" {
 /* Exported functions ------------------------------------------------------- */
 void IPC_RXFIFO_init(IPC_Handle_t *const hipc);
 void IPC_RXFIFO_writeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar);
-int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg);
+#if (IPC_USE_UART_DMA_RX == 1U)
+uint16_t IPC_RXFIFO_writeCharacterBlock(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size);
+#endif /* IPC_USE_UART_DMA_RX */
+int16_t IPC_RXFIFO_peek(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg);
+int16_t IPC_RXFIFO_release(IPC_Handle_t *const hipc);
 #if (IPC_USE_STREAM_MODE == 1U)
 void IPC_RXFIFO_stream_init(IPC_Handle_t *const hipc);
 void IPC_RXFIFO_writeStream(IPC_Handle_t *const hipc, uint8_t rxChar);
+#if (IPC_USE_UART_DMA_RX == 1U)
+uint16_t IPC_RXFIFO_writeStreamBlock(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size);
+#endif /* IPC_USE_UART_DMA_RX */
 #endif /* IPC_USE_STREAM_MODE */
 uint16_t IPC_RXFIFO_getFreeBytes(IPC_Handle_t *const hipc);
 void IPC_RXFIFO_readMsgHeader_at_pos(const IPC_Handle_t *const hipc, IPC_RxHeader_t *pHeader, uint16_t pos);
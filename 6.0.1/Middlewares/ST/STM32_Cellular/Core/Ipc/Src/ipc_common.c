@@ -163,6 +163,34 @@ IPC_Status_t IPC_open(IPC_Handle_t *const hipc,
   return (status);
 }
 
+/**
+  * @brief  Register the block version of the end of message callback for a channel.
+  * @note   Optional: when registered, it is used instead of the end of message callback (provided to IPC_open)
+  *         when characters are received by blocks. It must give the same result than the end of message
+  *         callback applied to each character of the block.
+  * @param  hipc IPC handle (channel already opened).
+  * @param  pCheckEndOfMsgBlock Callback ptr to the function used to search a termination char in a block of
+  *         received chars (NULL to unregister).
+  * @retval status
+  */
+IPC_Status_t IPC_setCheckEndOfMsgBlockCallback(IPC_Handle_t *const hipc,
+                                               IPC_CheckEndOfMsgBlockCallbackTypeDef pCheckEndOfMsgBlock)
+{
+  IPC_Status_t status;
+
+  if (hipc != NULL)
+  {
+    hipc->CheckEndOfMsgBlockCallback = pCheckEndOfMsgBlock;
+    status = IPC_OK;
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+}
+
 /**
   * @brief  Close a specific channel.
   * @param  hipc IPC handle to close.
@@ -262,6 +290,8 @@ IPC_Handle_t *IPC_get_other_channel(IPC_Handle_t *const hipc)
   * @param  hipc IPC handle.
   * @param  p_TxBuffer Pointer to the data buffer to transfer.
   * @param  bufsize Length of the data buffer.
+  * @note   If IPC_USE_TX_QUEUE == 1U, the function returns once data are copied in the TX queue:
+  *         the TX complete callback is called later, for each TX buffer sent.
   * @retval status
   */
 IPC_Status_t IPC_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bufsize)
@@ -281,18 +311,42 @@ IPC_Status_t IPC_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bu
 }
 
 /**
-  * @brief  Receive a message from a channel.
+  * @brief  Get first unread message from a channel, without copy.
+  * @note   The message stays in the channel RX queue until IPC_release() is called:
+  *         p_msg->buffer points to the message in the RX queue and is valid until then.
+  *         A message is always contiguous in the RX queue (it never loops back to index 0).
   * @param  hipc IPC handle.
-  * @param  p_msg Pointer to the IPC message structure to fill with received message.
+  * @param  p_msg Pointer to the IPC message structure to fill with received message position and size.
   * @retval status
   */
-IPC_Status_t IPC_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
+IPC_Status_t IPC_peek(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
 {
   IPC_Status_t status;
 
   if (hipc != NULL)
   {
-    status = IPC_UART_receive(hipc, p_msg);
+    status = IPC_UART_peek(hipc, p_msg);
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+}
+
+/**
+  * @brief  Release message returned by IPC_peek() and free its place in the channel RX queue.
+  * @param  hipc IPC handle.
+  * @retval status
+  */
+IPC_Status_t IPC_release(IPC_Handle_t *const hipc)
+{
+  IPC_Status_t status;
+
+  if (hipc != NULL)
+  {
+    status = IPC_UART_release(hipc);
   }
   else
   {
@@ -334,6 +388,68 @@ IPC_Status_t IPC_streamReceive(IPC_Handle_t *const hipc, uint8_t *const p_buffer
 #endif  /* IPC_USE_STREAM_MODE == 1U */
 }
 
+/**
+  * @brief  Get the received data of a stream channel, without copy.
+  * @note   The data stay in the channel RX buffer until IPC_streamRelease() is called:
+  *         *pp_data points to the oldest received character and is valid until then.
+  *         Only the contiguous part of the data is returned: when the RX buffer loops back,
+  *         the remaining data are returned by the next call.
+  * @param  hipc IPC handle.
+  * @param  pp_data Pointer set to the first received character.
+  * @param  p_len Pointer set to the number of contiguous characters available (0 if none).
+  * @retval status
+  */
+IPC_Status_t IPC_streamPeek(IPC_Handle_t *const hipc, const uint8_t **pp_data, uint16_t *const p_len)
+{
+#if (IPC_USE_STREAM_MODE == 1U)
+  IPC_Status_t status;
+
+  if ((hipc != NULL) && (pp_data != NULL) && (p_len != NULL))
+  {
+    status = IPC_UART_streamPeek(hipc, pp_data, p_len);
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+#else
+  UNUSED(hipc);
+  UNUSED(pp_data);
+  UNUSED(p_len);
+  return (IPC_ERROR);
+#endif  /* IPC_USE_STREAM_MODE == 1U */
+}
+
+/**
+  * @brief  Free characters returned by IPC_streamPeek() in the RX buffer of a stream channel.
+  * @param  hipc IPC handle.
+  * @param  len Number of characters to free (at most the length returned by IPC_streamPeek()).
+  * @retval status
+  */
+IPC_Status_t IPC_streamRelease(IPC_Handle_t *const hipc, uint16_t len)
+{
+#if (IPC_USE_STREAM_MODE == 1U)
+  IPC_Status_t status;
+
+  if (hipc != NULL)
+  {
+    status = IPC_UART_streamRelease(hipc, len);
+  }
+  else
+  {
+    status = IPC_ERROR;
+  }
+
+  return (status);
+#else
+  UNUSED(hipc);
+  UNUSED(len);
+  return (IPC_ERROR);
+#endif  /* IPC_USE_STREAM_MODE == 1U */
+}
+
 /**
   * @brief  Dump content of IPC Rx queue (for debug purpose).
   * @param  hipc IPC handle.
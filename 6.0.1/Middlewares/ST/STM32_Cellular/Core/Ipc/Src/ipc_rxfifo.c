@@ -19,6 +19,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <string.h>
+#include <stdbool.h>
 #include "ipc_rxfifo.h"
 #include "ipc_common.h"
 #include "plf_config.h"
@@ -68,6 +69,15 @@ static void RXFIFO_incrementHead(IPC_Handle_t *const hipc);
 static void RXFIFO_updateMsgHeader(IPC_Handle_t *const hipc);
 static void RXFIFO_prepareNextMsgHeader(IPC_Handle_t *const hipc);
 static void RXFIFO_rearm_RX_IT(IPC_Handle_t *const hipc);
+static void RXFIFO_storeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar);
+static void RXFIFO_checkEndOfMsg(IPC_Handle_t *const hipc, uint8_t rxChar);
+static void RXFIFO_closeMsg(IPC_Handle_t *const hipc);
+static void RXFIFO_checkFreeBytes(IPC_Handle_t *const hipc);
+static bool RXFIFO_wrapMsg(IPC_Handle_t *const hipc);
+static bool RXFIFO_checkRoom(IPC_Handle_t *const hipc);
+#if (IPC_USE_UART_DMA_RX == 1U)
+static uint16_t RXFIFO_storeBlock(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size);
+#endif /* IPC_USE_UART_DMA_RX */
 
 /* Functions Definition ------------------------------------------------------*/
 /**
@@ -77,7 +87,7 @@ static void RXFIFO_rearm_RX_IT(IPC_Handle_t *const hipc);
   */
 void IPC_RXFIFO_init(IPC_Handle_t *const hipc)
 {
-  (void) memset(hipc->RxQueue.data, 0, sizeof(uint8_t) * IPC_RXBUF_MAXSIZE);
+  (void) memset(hipc->RxQueue.data, 0, sizeof(hipc->RxQueue.data));
   hipc->RxQueue.index_read = 0U;
   hipc->RxQueue.index_write = IPC_RXMSG_HEADER_SIZE;
   hipc->RxQueue.current_msg_index = 0U;
@@ -106,55 +116,78 @@ void IPC_RXFIFO_writeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar)
 {
   if (hipc != NULL)
   {
-    hipc->RxQueue.data[hipc->RxQueue.index_write] = rxChar;
+    /* if the RX FIFO is full, the character is lost: reception is resumed when a message is released */
+    if (RXFIFO_checkRoom(hipc) == true)
+    {
+      RXFIFO_storeCharacter(hipc, rxChar);
 
-    hipc->RxQueue.current_msg_size++;
+      if (hipc->State != IPC_STATE_PAUSED)
+      {
+        /* rearm RX Interrupt */
+        RXFIFO_rearm_RX_IT(hipc);
+      }
 
-#if (DBG_IPC_RX_FIFO == 1U)
-    hipc->dbgRxQueue.msg_info_queue[hipc->dbgRxQueue.queue_pos].size = hipc->RxQueue.current_msg_size;
-#endif /* DBG_IPC_RX_FIFO */
+      /* check if the char received is an end of message */
+      RXFIFO_checkEndOfMsg(hipc, rxChar);
+    }
+  }
+}
 
-    RXFIFO_incrementHead(hipc);
+#if (IPC_USE_UART_DMA_RX == 1U)
+/**
+  * @brief  Write a block of chars in the IPC RX FIFO.
+  * @note   Characters are processed until the end of the block or until the RX FIFO is paused.
+  * @param  hipc IPC handle.
+  * @param  p_data ptr to the characters to write.
+  * @param  size number of characters to write.
+  * @retval number of characters written.
+  */
+uint16_t IPC_RXFIFO_writeCharacterBlock(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size)
+{
+  uint16_t count = 0U;
 
-    if (hipc->State != IPC_STATE_PAUSED)
+  if (hipc != NULL)
+  {
+    /* same treatment as IPC_RXFIFO_writeCharacter() but without RX Interrupt rearm:
+     * stop as soon as the queue is paused, remaining characters will be written when the queue is resumed
+     */
+    if (hipc->CheckEndOfMsgBlockCallback != NULL)
     {
-      /* rearm RX Interrupt */
-      RXFIFO_rearm_RX_IT(hipc);
+      while ((count < size) && (hipc->State != IPC_STATE_PAUSED))
+      {
+        count += RXFIFO_storeBlock(hipc, &p_data[count], size - count);
+      }
     }
-
-    /* check if the char received is an end of message */
-    if ((*hipc->CheckEndOfMsgCallback)(rxChar) == 1U)
+    else
     {
-      hipc->RxQueue.nb_unread_msg++;
-
-      /* update header for message received */
-      RXFIFO_updateMsgHeader(hipc);
-
-      /* save start position of next message */
-      hipc->RxQueue.current_msg_index = hipc->RxQueue.index_write;
-
-      /* reset current msg size */
-      hipc->RxQueue.current_msg_size = 0U;
-
-      /* reserve place for next msg header */
-      RXFIFO_prepareNextMsgHeader(hipc);
-
-      /* msg received: call client callback */
-      (* hipc->RxClientCallback)((IPC_Handle_t *)hipc);
+      while ((count < size) && (hipc->State != IPC_STATE_PAUSED))
+      {
+        if (RXFIFO_checkRoom(hipc) == true)
+        {
+          RXFIFO_storeCharacter(hipc, p_data[count]);
+          RXFIFO_checkEndOfMsg(hipc, p_data[count]);
+          count++;
+        }
+      }
     }
   }
+
+  return (count);
 }
+#endif /* IPC_USE_UART_DMA_RX */
 
 /**
-  * @brief  Read first unread message in the IPC RX FIFO.
+  * @brief  Get first unread message in the IPC RX FIFO, without removing it from the FIFO.
+  * @note   The message is not copied: pMsg->buffer points to the message in the IPC RX FIFO.
+  *         A message never loops back to index 0 of the FIFO, it is always contiguous.
   * @param  hipc IPC handle.
-  * @param  pMsg ptr to the message read from IPC RX FIFO.
-  * @retval message size (-1 if an error occurred).
+  * @param  pMsg ptr to the message description (position and size) to update.
+  * @retval number of unread messages, including this one (-1 if an error occurred).
   */
-int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
+int16_t IPC_RXFIFO_peek(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
 {
   int16_t retval;
-  uint16_t oversize;
+  uint16_t index_msg;
   IPC_RxHeader_t header;
 
   if (hipc != NULL)
@@ -163,8 +196,20 @@ int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
     PRINT_DBG(" *** start pos=%d ", hipc->RxQueue.index_read)
 #endif /* DBG_IPC_RX_FIFO */
 
-    /* read message header */
-    IPC_RXFIFO_readMsgHeader_at_pos(hipc, &header, hipc->RxQueue.index_read);
+    if (hipc->RxQueue.nb_unread_msg == 0U)
+    {
+      /* no unread message: the RX IT may move index_read with the message being received to index 0 */
+      header.complete = 0U;
+      header.size = 0U;
+    }
+    else
+    {
+      /* read message header */
+      IPC_RXFIFO_readMsgHeader_at_pos(hipc, &header, hipc->RxQueue.index_read);
+    }
+
+    /* jump header */
+    index_msg = hipc->RxQueue.index_read + IPC_RXMSG_HEADER_SIZE;
 
     if (header.complete != 1U)
     {
@@ -173,45 +218,51 @@ int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
     }
     else
     {
-      /* jump header */
-      RXFIFO_incrementTail(hipc, IPC_RXMSG_HEADER_SIZE);
-
 #if (DBG_IPC_RX_FIFO == 1U)
-      PRINT_DBG(" *** data pos=%d ", hipc->RxQueue.index_read)
+      PRINT_DBG(" *** data pos=%d ", index_msg)
       PRINT_DBG(" *** size=%d ", header.size)
-      PRINT_DBG(" *** free bytes before read=%d ", hipc->dbgRxQueue.free_bytes)
 #endif /* DBG_IPC_RX_FIFO */
 
-      /* update size in output structure */
+      pMsg->buffer = &hipc->RxQueue.data[index_msg];
       pMsg->size = header.size;
 
-      /* copy msg content to output structure */
-      if ((hipc->RxQueue.index_read + header.size) > IPC_RXBUF_MAXSIZE)
-      {
-        /* message is split in 2 parts in the circular buffer */
-        oversize = (hipc->RxQueue.index_read + header.size - IPC_RXBUF_MAXSIZE);
-        uint16_t remaining_size = header.size - oversize;
-        (void) memcpy((void *) & (pMsg->buffer[0]),
-                      (void *) & (hipc->RxQueue.data[hipc->RxQueue.index_read]),
-                      (size_t) remaining_size);
-        (void) memcpy((void *) & (pMsg->buffer[header.size - oversize]),
-                      (void *) & (hipc->RxQueue.data[0]),
-                      (size_t) oversize);
+      /* return number of unread messages */
+      retval = (int16_t)hipc->RxQueue.nb_unread_msg;
+    }
+  }
+  else
+  {
+    /* error: hipc is NULL */
+    retval = -1;
+  }
 
-#if (DBG_IPC_RX_FIFO == 1U)
-        PRINT_DBG("override end of buffer")
-#endif /* DBG_IPC_RX_FIFO */
-      }
-      else
-      {
-        /* message is contiguous in the circular buffer */
-        (void) memcpy((void *)pMsg->buffer,
-                      (void *) & (hipc->RxQueue.data[hipc->RxQueue.index_read]),
-                      (size_t) header.size);
-      }
+  return (retval);
+}
+
+/**
+  * @brief  Remove first unread message from the IPC RX FIFO (message returned by IPC_RXFIFO_peek).
+  * @param  hipc IPC handle.
+  * @retval number of remaining unread messages (-1 if an error occurred).
+  */
+int16_t IPC_RXFIFO_release(IPC_Handle_t *const hipc)
+{
+  int16_t retval;
+  IPC_RxHeader_t header;
+
+  if (hipc != NULL)
+  {
+    /* read message header */
+    IPC_RXFIFO_readMsgHeader_at_pos(hipc, &header, hipc->RxQueue.index_read);
 
+    if ((header.complete != 1U) || (hipc->RxQueue.nb_unread_msg == 0U))
+    {
+      /* error: trying to release an incomplete message */
+      retval = -1;
+    }
+    else
+    {
       /* increment tail index to the next message */
-      RXFIFO_incrementTail(hipc, header.size);
+      RXFIFO_incrementTail(hipc, IPC_RXMSG_HEADER_SIZE + header.size);
 
 #if (DBG_IPC_RX_FIFO == 1U)
       /* update free_bytes infos */
@@ -219,11 +270,18 @@ int16_t IPC_RXFIFO_read(IPC_Handle_t *const hipc, IPC_RxMessage_t *pMsg)
       PRINT_DBG(" *** free after read bytes=%d ", hipc->dbgRxQueue.free_bytes)
 #endif /* DBG_IPC_RX_FIFO */
 
-      /* msg has been read */
+      /* msg has been read: counter is also incremented by the RX IT */
+      __disable_irq();
+      /* next message moved to index 0 by the RX IT: skip the end of the FIFO.
+       * Checked with IT masked: once there is no unread message, the RX IT moves the read index itself
+       */
+      if (hipc->RxQueue.data[hipc->RxQueue.index_read] == IPC_RXMSG_HEADER_WRAP)
+      {
+        hipc->RxQueue.index_read = 0U;
+      }
       hipc->RxQueue.nb_unread_msg--;
-
-      /* return number of unread messages */
       retval = (int16_t)hipc->RxQueue.nb_unread_msg;
+      __enable_irq();
     }
   }
   else
@@ -248,38 +306,101 @@ void IPC_RXFIFO_stream_init(IPC_Handle_t *const hipc)
     (void) memset(hipc->RxBuffer.data, 0,  sizeof(uint8_t) * IPC_RXBUF_STREAM_MAXSIZE);
     hipc->RxBuffer.index_read = 0U;
     hipc->RxBuffer.index_write = 0U;
-    hipc->RxBuffer.available_char = 0U;
     hipc->RxBuffer.total_rcv_count = 0U;
+    hipc->RxBuffer.overflow_count = 0U;
   }
 }
 
 /**
   * @brief  Write a char in the IPC RX FIFO in stream mode.
+  * @note   Called under interrupt: only index_write is updated (single producer).
+  *         The character is dropped if the RX buffer is full.
   * @param  hipc IPC handle.
   * @param  rxChar character to write.
   * @retval none.
   */
 void IPC_RXFIFO_writeStream(IPC_Handle_t *const hipc, uint8_t rxChar)
 {
+  uint16_t next_write;
+
   if (hipc != NULL)
   {
-    hipc->RxBuffer.data[hipc->RxBuffer.index_write] = rxChar;
+    next_write = hipc->RxBuffer.index_write + 1U;
+    if (next_write >= IPC_RXBUF_STREAM_MAXSIZE)
+    {
+      next_write = 0U;
+    }
+
+    if (next_write != hipc->RxBuffer.index_read)
+    {
+      hipc->RxBuffer.data[hipc->RxBuffer.index_write] = rxChar;
+      /* character has to be stored before being published to the reader */
+      __DMB();
+      hipc->RxBuffer.index_write = next_write;
+      hipc->RxBuffer.total_rcv_count++;
+    }
+    else
+    {
+      hipc->RxBuffer.overflow_count++;
+    }
 
     /* rearm RX Interrupt */
     RXFIFO_rearm_RX_IT(hipc);
 
-    hipc->RxBuffer.index_write++;
-    hipc->RxBuffer.total_rcv_count++;
+    (* hipc->RxClientCallback)((void *)hipc);
+  }
+}
+
+#if (IPC_USE_UART_DMA_RX == 1U)
+/**
+  * @brief  Write a block of chars in the IPC RX FIFO in stream mode.
+  * @note   Called under interrupt: only index_write is updated (single producer).
+  *         Characters which do not fit in the RX buffer are dropped.
+  * @param  hipc IPC handle.
+  * @param  p_data ptr to the characters to write.
+  * @param  size number of characters to write.
+  * @retval number of characters consumed (stored or dropped), 0 if nothing is written.
+  */
+uint16_t IPC_RXFIFO_writeStreamBlock(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size)
+{
+  uint16_t first_part;
+  uint16_t free_bytes;
+  uint16_t store_size;
+  uint16_t index_write;
+  uint16_t consumed = 0U;
 
-    if (hipc->RxBuffer.index_write >= IPC_RXBUF_STREAM_MAXSIZE)
+  if ((hipc != NULL) && (size != 0U))
+  {
+    index_write = hipc->RxBuffer.index_write;
+    free_bytes = (uint16_t)(((uint32_t)hipc->RxBuffer.index_read + IPC_RXBUF_STREAM_MAXSIZE - index_write - 1U)
+                            % IPC_RXBUF_STREAM_MAXSIZE);
+    store_size = (size > free_bytes) ? free_bytes : size;
+    hipc->RxBuffer.overflow_count += (uint16_t)(size - store_size);
+
+    /* copy data in stream buffer (in 2 parts if the buffer loops back to index 0) */
+    first_part = IPC_RXBUF_STREAM_MAXSIZE - index_write;
+    if (first_part > store_size)
     {
-      hipc->RxBuffer.index_write = 0;
+      first_part = store_size;
     }
-    hipc->RxBuffer.available_char++;
+    (void) memcpy((void *) &hipc->RxBuffer.data[index_write],
+                  (const void *) p_data, (size_t) first_part);
+    (void) memcpy((void *) &hipc->RxBuffer.data[0],
+                  (const void *) &p_data[first_part], (size_t)(store_size - first_part));
 
+    /* characters have to be stored before being published to the reader */
+    __DMB();
+    hipc->RxBuffer.index_write = (uint16_t)((index_write + store_size) % IPC_RXBUF_STREAM_MAXSIZE);
+    hipc->RxBuffer.total_rcv_count += store_size;
+
+    /* one notification for the whole block */
     (* hipc->RxClientCallback)((void *)hipc);
+    consumed = size;
   }
+
+  return (consumed);
 }
+#endif /* IPC_USE_UART_DMA_RX */
 #endif /* IPC_USE_STREAM_MODE */
 
 /**
@@ -293,13 +414,30 @@ uint16_t IPC_RXFIFO_getFreeBytes(IPC_Handle_t *const hipc)
 
   if (hipc != NULL)
   {
-    if (hipc->RxQueue.index_write > hipc->RxQueue.index_read)
+    /* indexes are read once: index_read is updated by the client task while the RX IT is writing */
+    uint16_t index_read = hipc->RxQueue.index_read;
+    uint16_t index_write = hipc->RxQueue.index_write;
+    uint16_t msg_size = IPC_RXMSG_HEADER_SIZE + hipc->RxQueue.current_msg_size;
+
+    if ((index_write > index_read) && (hipc->RxQueue.nb_unread_msg == 0U))
+    {
+      /* no unread message: the message being received can be moved to index 0 with the read index */
+      free_bytes = (IPC_RXBUF_MAXSIZE - index_write +  index_read);
+    }
+    else if (index_write > index_read)
     {
-      free_bytes = (IPC_RXBUF_MAXSIZE - hipc->RxQueue.index_write +  hipc->RxQueue.index_read);
+      /* the message being received has to fit before the end of the FIFO or, moved to index 0,
+       * before the first unread message
+       */
+      free_bytes = IPC_RXBUF_MAXSIZE - index_write;
+      if (index_read > (free_bytes + msg_size))
+      {
+        free_bytes = index_read - msg_size;
+      }
     }
     else
     {
-      free_bytes =  hipc->RxQueue.index_read - hipc->RxQueue.index_write;
+      free_bytes =  index_read - index_write;
     }
   }
   else
@@ -446,10 +584,25 @@ static void RXFIFO_incrementTail(IPC_Handle_t *const hipc, uint16_t inc_size)
   * @retval none.
   */
 static void RXFIFO_incrementHead(IPC_Handle_t *const hipc)
+{
+  hipc->RxQueue.index_write++;
+  if (hipc->RxQueue.index_write == IPC_RXBUF_MAXSIZE)
+  {
+    /* end of the FIFO: the message being received continues at index 0 (later if the FIFO is full) */
+    (void) RXFIFO_wrapMsg(hipc);
+  }
+  RXFIFO_checkFreeBytes(hipc);
+}
+
+/**
+  * @brief  Pause IPC RX FIFO if free space is under the threshold.
+  * @param  hipc IPC handle.
+  * @retval none.
+  */
+static void RXFIFO_checkFreeBytes(IPC_Handle_t *const hipc)
 {
   uint16_t free_bytes;
 
-  hipc->RxQueue.index_write = (hipc->RxQueue.index_write + 1U) % IPC_RXBUF_MAXSIZE;
   free_bytes = IPC_RXFIFO_getFreeBytes(hipc);
 
 #if (DBG_IPC_RX_FIFO == 1U)
@@ -505,21 +658,249 @@ static void RXFIFO_updateMsgHeader(IPC_Handle_t *const hipc)
 static void RXFIFO_prepareNextMsgHeader(IPC_Handle_t *const hipc)
 {
   uint8_t idx;
-  for (idx = 0U; idx < IPC_RXMSG_HEADER_SIZE; idx++)
+
+  if ((hipc->RxQueue.index_write + IPC_RXMSG_HEADER_SIZE) > IPC_RXBUF_MAXSIZE)
+  {
+    /* header does not fit before the end of the FIFO: next msg starts at index 0 (later if the FIFO is full) */
+    hipc->RxQueue.index_write = IPC_RXBUF_MAXSIZE;
+    (void) RXFIFO_wrapMsg(hipc);
+    RXFIFO_checkFreeBytes(hipc);
+  }
+  else
+  {
+    for (idx = 0U; idx < IPC_RXMSG_HEADER_SIZE; idx++)
+    {
+      /* clean data and increment head */
+      hipc->RxQueue.data[hipc->RxQueue.index_write] = 0U;
+      RXFIFO_incrementHead(hipc);
+    }
+  }
+}
+
+/**
+  * @brief  Move the message being received to index 0 of the IPC RX FIFO (end of the FIFO reached).
+  * @note   Only the characters are moved, the header is written when the message is closed.
+  *         Not possible while the unread messages use the beginning of the FIFO: index_write stays equal to
+  *         IPC_RXBUF_MAXSIZE (FIFO full) until enough messages are released.
+  * @note   This copy is kept on purpose: IPC_peek() gives a single buffer because atcc_extractElement() and the
+  *         modem analyzers index the message as one array. It is done once per loop around the FIFO and only
+  *         for the characters of the message received before the end of the FIFO; the other messages are
+  *         analyzed in place without any copy.
+  * @param  hipc IPC handle.
+  * @retval true if the message has been moved.
+  */
+static bool RXFIFO_wrapMsg(IPC_Handle_t *const hipc)
+{
+  bool moved = true;
+  uint16_t msg_index = hipc->RxQueue.current_msg_index;
+  uint16_t msg_size = hipc->RxQueue.current_msg_size;
+
+  if ((hipc->RxQueue.nb_unread_msg == 0U) && (msg_index != 0U))
+  {
+    /* no unread message: the client waits at the start of this message, both restart at index 0 */
+    if (msg_size != 0U)
+    {
+      (void) memmove((void *) &hipc->RxQueue.data[IPC_RXMSG_HEADER_SIZE],
+                     (const void *) &hipc->RxQueue.data[msg_index + IPC_RXMSG_HEADER_SIZE], (size_t) msg_size);
+    }
+    hipc->RxQueue.index_read = 0U;
+  }
+  else if ((IPC_RXMSG_HEADER_SIZE + msg_size) < hipc->RxQueue.index_read)
+  {
+    /* beginning of the FIFO already read: the client skips the end of the FIFO when it reaches the wrap mark */
+    if (msg_size != 0U)
+    {
+      (void) memcpy((void *) &hipc->RxQueue.data[IPC_RXMSG_HEADER_SIZE],
+                    (const void *) &hipc->RxQueue.data[msg_index + IPC_RXMSG_HEADER_SIZE], (size_t) msg_size);
+    }
+    if (msg_index < IPC_RXBUF_MAXSIZE)
+    {
+      /* a message starting at IPC_RXBUF_MAXSIZE needs no mark: index_read loops back to 0 */
+      hipc->RxQueue.data[msg_index] = IPC_RXMSG_HEADER_WRAP;
+    }
+  }
+  else
+  {
+    /* RX FIFO full */
+    moved = false;
+  }
+
+  if (moved == true)
+  {
+    hipc->RxQueue.data[0] = 0U;
+    hipc->RxQueue.data[1] = 0U;
+    hipc->RxQueue.current_msg_index = 0U;
+    hipc->RxQueue.index_write = IPC_RXMSG_HEADER_SIZE + msg_size;
+
+#if (DBG_IPC_RX_FIFO == 1U)
+    hipc->dbgRxQueue.msg_info_queue[hipc->dbgRxQueue.queue_pos].start_pos = 0U;
+#endif /* DBG_IPC_RX_FIFO */
+  }
+
+  return (moved);
+}
+
+/**
+  * @brief  Check that a char can be stored in the IPC RX FIFO.
+  * @note   If the end of the FIFO has been reached, the message being received is moved to index 0 first.
+  *         If it is still not possible, the RX FIFO is paused.
+  * @param  hipc IPC handle.
+  * @retval true if a char can be stored.
+  */
+static bool RXFIFO_checkRoom(IPC_Handle_t *const hipc)
+{
+  bool room = true;
+
+  if ((hipc->RxQueue.index_write == IPC_RXBUF_MAXSIZE) && (RXFIFO_wrapMsg(hipc) == false))
+  {
+    hipc->State = IPC_STATE_PAUSED;
+    room = false;
+  }
+
+  return (room);
+}
+
+/**
+  * @brief  Store a char in the IPC RX FIFO and increment head.
+  * @param  hipc IPC handle.
+  * @param  rxChar character to write.
+  * @retval none.
+  */
+static void RXFIFO_storeCharacter(IPC_Handle_t *const hipc, uint8_t rxChar)
+{
+  hipc->RxQueue.data[hipc->RxQueue.index_write] = rxChar;
+
+  hipc->RxQueue.current_msg_size++;
+
+#if (DBG_IPC_RX_FIFO == 1U)
+  hipc->dbgRxQueue.msg_info_queue[hipc->dbgRxQueue.queue_pos].size = hipc->RxQueue.current_msg_size;
+#endif /* DBG_IPC_RX_FIFO */
+
+  RXFIFO_incrementHead(hipc);
+}
+
+/**
+  * @brief  Check if last char stored is an end of message and close the message if needed.
+  * @param  hipc IPC handle.
+  * @param  rxChar last character written.
+  * @retval none.
+  */
+static void RXFIFO_checkEndOfMsg(IPC_Handle_t *const hipc, uint8_t rxChar)
+{
+  if ((*hipc->CheckEndOfMsgCallback)(rxChar) == 1U)
+  {
+    RXFIFO_closeMsg(hipc);
+  }
+}
+
+/**
+  * @brief  Close current message (an end of message has been received) and notify the client.
+  * @param  hipc IPC handle.
+  * @retval none.
+  */
+static void RXFIFO_closeMsg(IPC_Handle_t *const hipc)
+{
+  hipc->RxQueue.nb_unread_msg++;
+
+  /* update header for message received */
+  RXFIFO_updateMsgHeader(hipc);
+
+  /* save start position of next message */
+  hipc->RxQueue.current_msg_index = hipc->RxQueue.index_write;
+
+  /* reset current msg size */
+  hipc->RxQueue.current_msg_size = 0U;
+
+  /* reserve place for next msg header */
+  RXFIFO_prepareNextMsgHeader(hipc);
+
+#if (IPC_USE_UART_DMA_RX == 1U)
+  if (hipc->RxCallbackDeferred == 1U)
+  {
+    /* characters pushed by the client task with IT masked: client is notified by IPC_UART_release() */
+    hipc->RxCallbackPendingNb++;
+  }
+  else
+#endif /* IPC_USE_UART_DMA_RX */
+  {
+    /* msg received: call client callback */
+    (* hipc->RxClientCallback)((IPC_Handle_t *)hipc);
+  }
+}
+
+#if (IPC_USE_UART_DMA_RX == 1U)
+/**
+  * @brief  Store a block of chars in the IPC RX FIFO until an end of message or the pause threshold.
+  * @note   The block is analyzed with the block end of message callback, the result (framing of messages and
+  *         pause of the RX FIFO) is the same than when chars are stored one by one.
+  * @param  hipc IPC handle.
+  * @param  p_data ptr to the characters to write.
+  * @param  size number of characters available.
+  * @retval number of characters written.
+  */
+static uint16_t RXFIFO_storeBlock(IPC_Handle_t *const hipc, const uint8_t *p_data, uint16_t size)
+{
+  uint16_t max_size;
+  uint16_t store_size = 0U;
+  uint16_t free_bytes;
+  uint8_t end_of_msg = 0U;
+
+  if (RXFIFO_checkRoom(hipc) == true)
   {
-    /* clean data and increment head */
-    hipc->RxQueue.data[hipc->RxQueue.index_write] = 0U;
-    RXFIFO_incrementHead(hipc);
+    /* do not store more chars than what would pause the RX FIFO if chars were stored one by one */
+    free_bytes = IPC_RXFIFO_getFreeBytes(hipc);
+    max_size = (free_bytes > IPC_RXBUF_THRESHOLD) ? (free_bytes - IPC_RXBUF_THRESHOLD) : 1U;
+    if (max_size > size)
+    {
+      max_size = size;
+    }
+
+    /* a message never loops back to index 0: if the block does not fit before the end of the FIFO,
+     * the message being received is moved to index 0 first (else only the chars which fit are stored)
+     */
+    if (((hipc->RxQueue.index_write + max_size) > IPC_RXBUF_MAXSIZE) && (RXFIFO_wrapMsg(hipc) == false))
+    {
+      max_size = IPC_RXBUF_MAXSIZE - hipc->RxQueue.index_write;
+    }
+
+    /* search end of message in the block */
+    store_size = (*hipc->CheckEndOfMsgBlockCallback)(p_data, max_size, &end_of_msg);
+
+    (void) memcpy((void *) &hipc->RxQueue.data[hipc->RxQueue.index_write],
+                  (const void *) p_data, (size_t) store_size);
+
+    hipc->RxQueue.current_msg_size += store_size;
+
+#if (DBG_IPC_RX_FIFO == 1U)
+    hipc->dbgRxQueue.msg_info_queue[hipc->dbgRxQueue.queue_pos].size = hipc->RxQueue.current_msg_size;
+#endif /* DBG_IPC_RX_FIFO */
+
+    hipc->RxQueue.index_write += store_size;
+    if (hipc->RxQueue.index_write == IPC_RXBUF_MAXSIZE)
+    {
+      /* end of the FIFO: the message being received continues at index 0 (later if the FIFO is full) */
+      (void) RXFIFO_wrapMsg(hipc);
+    }
+    RXFIFO_checkFreeBytes(hipc);
+
+    if (end_of_msg == 1U)
+    {
+      RXFIFO_closeMsg(hipc);
+    }
   }
+
+  return (store_size);
 }
+#endif /* IPC_USE_UART_DMA_RX */
 
 static void RXFIFO_rearm_RX_IT(IPC_Handle_t *const hipc)
 {
-#if (IPC_USE_UART == 1U)
+#if ((IPC_USE_UART == 1U) && (IPC_USE_UART_DMA_RX == 0U))
   IPC_UART_rearm_RX_IT(hipc);
 #else
-  __NOP();
-#endif /* IPC_USE_UART == 1U */
+  /* nothing to do: circular DMA reception does not need to be rearmed for each character */
+  UNUSED(hipc);
+#endif /* (IPC_USE_UART == 1U) && (IPC_USE_UART_DMA_RX == 0U) */
 }
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -28,6 +28,9 @@
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private defines -----------------------------------------------------------*/
+#if (IPC_USE_TX_QUEUE == 1U)
+#define IPC_TXQUEUE_TIMEOUT  (5000U) /* maximum time (in ms) to wait for a free TX buffer */
+#endif /* IPC_USE_TX_QUEUE */
 
 /* Private macros ------------------------------------------------------------*/
 
@@ -56,6 +59,16 @@
 /* Private function prototypes -----------------------------------------------*/
 static uint8_t find_Device_Id(const UART_HandleTypeDef *huart);
 static IPC_Status_t change_ipc_channel(IPC_Handle_t *const hipc);
+static HAL_StatusTypeDef UART_start_RX(uint8_t device_id);
+#if (IPC_USE_UART_DMA_RX == 1U)
+static void UART_DMA_stop_RX(uint8_t device_id);
+static void UART_DMA_process_RX(uint8_t device_id, uint16_t dma_pos);
+#endif /* IPC_USE_UART_DMA_RX */
+#if (IPC_USE_TX_QUEUE == 1U)
+static IPC_Status_t UART_queue_TX(IPC_Handle_t *const hipc, const uint8_t *p_TxBuffer, uint16_t bufsize);
+static HAL_StatusTypeDef UART_start_TX(uint8_t device_id);
+static void UART_flush_TX(uint8_t device_id);
+#endif /* IPC_USE_TX_QUEUE */
 
 /* Functions Definition ------------------------------------------------------*/
 /**
@@ -82,6 +95,27 @@ IPC_Status_t IPC_UART_init(IPC_Device_t device, UART_HandleTypeDef *const huart)
     IPC_DevicesList[device].h_current_channel = NULL;
     IPC_DevicesList[device].h_inactive_channel = NULL;
     retval = IPC_OK;
+
+#if (IPC_USE_TX_QUEUE == 1U)
+    IPC_DevicesList[device].TxQueueWrite = 0U;
+    IPC_DevicesList[device].TxQueueRead = 0U;
+    IPC_DevicesList[device].TxQueueCount = 0U;
+    /* semaphore and mutex are kept by IPC_UART_deinit(): create them only once */
+    if (IPC_DevicesList[device].TxQueueSemaphore == NULL)
+    {
+      IPC_DevicesList[device].TxQueueSemaphore = rtosalSemaphoreNew((const rtosal_char_t *)"IPC_SEM_TXQUEUE",
+                                                                    (uint32_t)IPC_TXQUEUE_NB);
+    }
+    if (IPC_DevicesList[device].TxQueueMutex == NULL)
+    {
+      IPC_DevicesList[device].TxQueueMutex = rtosalMutexNew((const rtosal_char_t *)"IPC_MUT_TXQUEUE");
+    }
+    if ((IPC_DevicesList[device].TxQueueSemaphore == NULL) || (IPC_DevicesList[device].TxQueueMutex == NULL))
+    {
+      IPC_DevicesList[device].state = IPC_STATE_NOT_INITIALIZED;
+      retval = IPC_ERROR;
+    }
+#endif /* IPC_USE_TX_QUEUE */
   }
 
   return (retval);
@@ -96,6 +130,11 @@ IPC_Status_t IPC_UART_deinit(IPC_Device_t device)
 {
   /* input parameters validity has been tested in calling function */
 
+#if (IPC_USE_TX_QUEUE == 1U)
+  /* buffers not yet sent are discarded */
+  UART_flush_TX(device);
+#endif /* IPC_USE_TX_QUEUE */
+
   IPC_DevicesList[device].state = IPC_STATE_NOT_INITIALIZED;
   IPC_DevicesList[device].phy_int.interface_type = IPC_INTERFACE_UNINITIALIZED;
   IPC_DevicesList[device].phy_int.h_uart = NULL;
@@ -160,8 +199,10 @@ IPC_Status_t IPC_UART_open(IPC_Handle_t *const hipc,
 
   if (retval != IPC_ERROR)
   {
+#if (IPC_USE_UART_DMA_RX == 0U)
     /* initialize common RX buffer */
     IPC_DevicesList[device].RxChar[0] = (IPC_CHAR_t)('\0');
+#endif /* IPC_USE_UART_DMA_RX */
 
     PRINT_DBG("IPC channel %p registered", IPC_DevicesList[device].h_current_channel)
     PRINT_DBG("state 0x%x", IPC_DevicesList[device].state)
@@ -172,11 +213,17 @@ IPC_Status_t IPC_UART_open(IPC_Handle_t *const hipc,
     if (mode == IPC_MODE_UART_CHARACTER)
     {
       hipc->RxFifoWrite = IPC_RXFIFO_writeCharacter;
+#if (IPC_USE_UART_DMA_RX == 1U)
+      hipc->RxFifoWriteBlock = IPC_RXFIFO_writeCharacterBlock;
+#endif /* IPC_USE_UART_DMA_RX */
     }
 #if (IPC_USE_STREAM_MODE == 1U)
     else
     {
       hipc->RxFifoWrite = IPC_RXFIFO_writeStream;
+#if (IPC_USE_UART_DMA_RX == 1U)
+      hipc->RxFifoWriteBlock = IPC_RXFIFO_writeStreamBlock;
+#endif /* IPC_USE_UART_DMA_RX */
     }
 #endif /* IPC_USE_STREAM_MODE */
 
@@ -191,7 +238,12 @@ IPC_Status_t IPC_UART_open(IPC_Handle_t *const hipc,
     hipc->TxClientCallback = pTxClientCallback;
     hipc->ErrorCallback = pErrorClientCallback;
     hipc->CheckEndOfMsgCallback = pCheckEndOfMsg;
+    hipc->CheckEndOfMsgBlockCallback = NULL;
     hipc->Mode = mode;
+#if (IPC_USE_UART_DMA_RX == 1U)
+    hipc->RxCallbackDeferred = 0U;
+    hipc->RxCallbackPendingNb = 0U;
+#endif /* IPC_USE_UART_DMA_RX */
 
     /* init RXFIFO */
     IPC_RXFIFO_init(hipc);
@@ -200,10 +252,10 @@ IPC_Status_t IPC_UART_open(IPC_Handle_t *const hipc,
 #endif /* IPC_USE_STREAM_MODE */
 
     /* start RX IT */
-    uart_status = HAL_UART_Receive_IT(hipc->Interface.h_uart, (uint8_t *)IPC_DevicesList[device].RxChar, 1U);
+    uart_status = UART_start_RX(device);
     if (uart_status != HAL_OK)
     {
-      PRINT_DBG("HAL_UART_Receive_IT error")
+      PRINT_DBG("UART start RX error")
       retval = IPC_ERROR;
     }
     else
@@ -233,6 +285,7 @@ IPC_Status_t IPC_UART_close(IPC_Handle_t *const hipc)
     hipc->State = IPC_STATE_NOT_INITIALIZED;
     hipc->RxClientCallback = NULL;
     hipc->CheckEndOfMsgCallback = NULL;
+    hipc->CheckEndOfMsgBlockCallback = NULL;
 
     /* init RXFIFO */
     IPC_RXFIFO_init(hipc);
@@ -270,6 +323,9 @@ IPC_Status_t IPC_UART_close(IPC_Handle_t *const hipc)
         {
           (void)HAL_UART_AbortTransmit_IT(hipc->Interface.h_uart);
         }
+#if (IPC_USE_TX_QUEUE == 1U)
+        UART_flush_TX(device_id);
+#endif /* IPC_USE_TX_QUEUE */
       }
 
       PRINT_DBG("IPC channel %p closed", hipc)
@@ -306,7 +362,12 @@ IPC_Status_t IPC_UART_reset(IPC_Handle_t *const hipc)
   uint8_t device_id = hipc->Device_ID;
   if (device_id != IPC_DEVICE_NOT_FOUND)
   {
+#if (IPC_USE_UART_DMA_RX == 1U)
+    /* stop current DMA reception: characters not yet pushed in RX queue are discarded */
+    (void) HAL_UART_AbortReceive(hipc->Interface.h_uart);
+#else
     IPC_DevicesList[device_id].RxChar[0] = (IPC_CHAR_t)('\0');
+#endif /* IPC_USE_UART_DMA_RX */
 
     /* init RXFIFO */
     IPC_RXFIFO_init(hipc);
@@ -315,7 +376,7 @@ IPC_Status_t IPC_UART_reset(IPC_Handle_t *const hipc)
 #endif /* IPC_USE_STREAM_MODE */
 
     /* rearm IT */
-    (void) HAL_UART_Receive_IT(hipc->Interface.h_uart, (uint8_t *)IPC_DevicesList[device_id].RxChar, 1U);
+    (void) UART_start_RX(device_id);
     hipc->State = IPC_STATE_ACTIVE;
     retval = IPC_OK;
   }
@@ -332,6 +393,13 @@ IPC_Status_t IPC_UART_abort(IPC_Handle_t *const hipc)
   PRINT_DBG("IPC abort %p", hipc)
   /* input parameters validity has been tested in calling function */
 
+#if (IPC_USE_TX_QUEUE == 1U)
+  /* transaction aborted when its answer is not received (AT core): the data queued are still sent, as without
+   * TX queue where IPC_send() caller waits for the end of the transmission before an abort.
+   * Queue is discarded only by IPC_close() and IPC_deinit().
+   */
+  UNUSED(hipc);
+#else
   if (hipc->Interface.h_uart != NULL)
   {
     if (hipc->Interface.h_uart->gState != HAL_UART_STATE_RESET)
@@ -339,6 +407,7 @@ IPC_Status_t IPC_UART_abort(IPC_Handle_t *const hipc)
       (void)HAL_UART_AbortTransmit_IT(hipc->Interface.h_uart);
     }
   }
+#endif /* IPC_USE_TX_QUEUE */
 
   return (IPC_OK);
 }
@@ -389,6 +458,7 @@ IPC_Handle_t *IPC_UART_get_other_channel(const IPC_Handle_t *const hipc)
   * @param  hipc IPC handle.
   * @param  p_TxBuffer Pointer to the data buffer to transfer.
   * @param  bufsize Length of the data buffer.
+  * @note   If IPC_USE_TX_QUEUE == 1U, data are copied in the TX queue and p_TxBuffer can be reused on return.
   * @retval status
   */
 IPC_Status_t IPC_UART_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bufsize)
@@ -402,23 +472,66 @@ IPC_Status_t IPC_UART_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16
   }
   else
   {
+#if (IPC_USE_TX_QUEUE == 1U)
+    retval = UART_queue_TX(hipc, p_TxBuffer, bufsize);
+#else
     /* send string in one block */
     (void)HAL_UART_Transmit_IT(hipc->Interface.h_uart, (uint8_t *)p_TxBuffer, bufsize);
     retval = IPC_OK;
+#endif /* IPC_USE_TX_QUEUE */
+  }
+  return (retval);
+}
+
+/**
+  * @brief  Get first unread message from an UART channel, without copy.
+  * @param  hipc IPC handle.
+  * @param  p_msg Pointer to the IPC message structure to fill with received message position and size.
+  * @retval status
+  */
+IPC_Status_t IPC_UART_peek(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
+{
+  IPC_Status_t retval;
+
+  /* check the handle */
+  if (hipc->Mode == IPC_MODE_UART_CHARACTER)
+  {
+    if (p_msg == NULL)
+    {
+      PRINT_ERR("IPC_peek err - p_msg NULL")
+      retval = IPC_ERROR;
+    }
+    else if (IPC_RXFIFO_peek(hipc, p_msg) == -1)
+    {
+      PRINT_DBG("IPC_peek err - no unread msg")
+      retval = IPC_ERROR;
+    }
+    else
+    {
+      retval = IPC_OK;
+    }
+  }
+  else
+  {
+    PRINT_ERR("IPC_peek err - IPC mode not matching")
+    retval = IPC_ERROR;
   }
+
   return (retval);
 }
 
 /**
-  * @brief  Receive a message from an UART channel.
+  * @brief  Release message returned by IPC_UART_peek() and resume reception if it was paused.
   * @param  hipc IPC handle.
-  * @param  p_msg Pointer to the IPC message structure to fill with received message.
   * @retval status
   */
-IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
+IPC_Status_t IPC_UART_release(IPC_Handle_t *const hipc)
 {
   IPC_Status_t retval;
   int16_t unread_msg;
+#if (IPC_USE_UART_DMA_RX == 1U)
+  uint16_t pending_nb;
+#endif /* IPC_USE_UART_DMA_RX */
 #if (DBG_IPC_RX_FIFO == 1U)
   int16_t free_bytes;
 #endif /* DBG_IPC_RX_FIFO */
@@ -426,57 +539,70 @@ IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p
   /* check the handle */
   if (hipc->Mode == IPC_MODE_UART_CHARACTER)
   {
-    if (p_msg == NULL)
+#if (DBG_IPC_RX_FIFO == 1U)
+    free_bytes = IPC_RXFIFO_getFreeBytes(hipc);
+    PRINT_DBG("free_bytes before msg release=%d", free_bytes)
+#endif /* DBG_IPC_RX_FIFO */
+
+    /* free the first unread message */
+    unread_msg = IPC_RXFIFO_release(hipc);
+    if (unread_msg == -1)
     {
-      PRINT_ERR("IPC_receive err - p_msg NULL")
+      PRINT_DBG("IPC_release err - no unread msg")
       retval = IPC_ERROR;
     }
     else
     {
 #if (DBG_IPC_RX_FIFO == 1U)
       free_bytes = IPC_RXFIFO_getFreeBytes(hipc);
-      PRINT_DBG("free_bytes before msg read=%d", free_bytes)
+      PRINT_DBG("free bytes after msg release=%d", free_bytes)
 #endif /* DBG_IPC_RX_FIFO */
 
-      /* read the first unread message */
-      unread_msg = IPC_RXFIFO_read(hipc, p_msg);
-      if (unread_msg == -1)
-      {
-        PRINT_DBG("IPC_receive err - no unread msg")
-        retval = IPC_ERROR;
-      }
-      else
+      if (hipc->State == IPC_STATE_PAUSED)
       {
 #if (DBG_IPC_RX_FIFO == 1U)
-        free_bytes = IPC_RXFIFO_getFreeBytes(hipc);
-        PRINT_DBG("free bytes after msg read=%d", free_bytes)
+        /* dump_RX_dbg_infos(hipc, 1, 1); */
+        PRINT_INFO("Resume IPC (paused %d times) %d unread msg", hipc->dbgRxQueue.cpt_RXPause, unread_msg)
 #endif /* DBG_IPC_RX_FIFO */
 
-        if (hipc->State == IPC_STATE_PAUSED)
+#if (IPC_USE_UART_DMA_RX == 1U)
+        /* RX event IT stops the DMA reception depending on the queue state: resume with IT masked.
+         * The characters kept in the DMA buffer are pushed in the RX queue, the client is notified of the
+         * messages they complete once IT are unmasked (the client callback may use the RTOS services)
+         */
+        __disable_irq();
+        hipc->RxCallbackDeferred = 1U;
+        hipc->State = IPC_STATE_ACTIVE;
+        IPC_UART_rearm_RX_IT(hipc);
+        hipc->RxCallbackDeferred = 0U;
+        pending_nb = hipc->RxCallbackPendingNb;
+        hipc->RxCallbackPendingNb = 0U;
+        __enable_irq();
+
+        while (pending_nb != 0U)
         {
-#if (DBG_IPC_RX_FIFO == 1U)
-          /* dump_RX_dbg_infos(hipc, 1, 1); */
-          PRINT_INFO("Resume IPC (paused %d times) %d unread msg", hipc->dbgRxQueue.cpt_RXPause, unread_msg)
-#endif /* DBG_IPC_RX_FIFO */
-
-          hipc->State = IPC_STATE_ACTIVE;
-          (void) HAL_UART_Receive_IT(hipc->Interface.h_uart, (uint8_t *)IPC_DevicesList[hipc->Device_ID].RxChar, 1U);
+          (* hipc->RxClientCallback)(hipc);
+          pending_nb--;
         }
+#else
+        hipc->State = IPC_STATE_ACTIVE;
+        IPC_UART_rearm_RX_IT(hipc);
+#endif /* IPC_USE_UART_DMA_RX */
+      }
 
-        if (unread_msg == 0)
-        {
-          retval = IPC_RXQUEUE_EMPTY;
-        }
-        else
-        {
-          retval = IPC_RXQUEUE_MSG_AVAIL;
-        }
+      if (unread_msg == 0)
+      {
+        retval = IPC_RXQUEUE_EMPTY;
+      }
+      else
+      {
+        retval = IPC_RXQUEUE_MSG_AVAIL;
       }
     }
   }
   else
   {
-    PRINT_ERR("IPC_receive err - IPC mode not matching")
+    PRINT_ERR("IPC_release err - IPC mode not matching")
     retval = IPC_ERROR;
   }
 
@@ -496,7 +622,10 @@ IPC_Status_t IPC_UART_receive(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p
 IPC_Status_t IPC_UART_streamReceive(IPC_Handle_t *const hipc,  uint8_t *const p_buffer, int16_t *const p_len)
 {
   IPC_Status_t retval;
-  uint16_t rx_size = 0;
+  const uint8_t *p_data;
+  uint16_t segment_size;
+  uint16_t rx_size = 0U;
+  uint8_t  segment;
 
   if (*p_len > 0)
   {
@@ -504,18 +633,17 @@ IPC_Status_t IPC_UART_streamReceive(IPC_Handle_t *const hipc,  uint8_t *const p_
 
     if (hipc->Mode == IPC_MODE_UART_STREAM)
     {
-      /* receive */
-      while ((hipc->RxBuffer.available_char != 0U) &&
-             (rx_size < maximum_buffer_size))
+      /* receive: at most 2 contiguous segments (if the RX buffer loops back to index 0) */
+      for (segment = 0U; segment < 2U; segment++)
       {
-        p_buffer[rx_size] = hipc->RxBuffer.data[hipc->RxBuffer.index_read];
-        hipc->RxBuffer.index_read++;
-        if (hipc->RxBuffer.index_read >= IPC_RXBUF_STREAM_MAXSIZE)
+        (void) IPC_UART_streamPeek(hipc, &p_data, &segment_size);
+        if (segment_size > (maximum_buffer_size - rx_size))
         {
-          hipc->RxBuffer.index_read = 0;
+          segment_size = maximum_buffer_size - rx_size;
         }
-        rx_size++;
-        hipc->RxBuffer.available_char--;
+        (void) memcpy((void *) &p_buffer[rx_size], (const void *) p_data, (size_t) segment_size);
+        (void) IPC_UART_streamRelease(hipc, segment_size);
+        rx_size += segment_size;
       }
 
       /* update buffer size */
@@ -536,6 +664,68 @@ IPC_Status_t IPC_UART_streamReceive(IPC_Handle_t *const hipc,  uint8_t *const p_
 
   return (retval);
 }
+
+/**
+  * @brief  Get the contiguous received data of an UART stream channel, without copy.
+  * @note   Called by the reader task only: index_write is read once, the RX interrupt keeps
+  *         writing after it without masking.
+  * @param  hipc IPC handle.
+  * @param  pp_data Pointer set to the first received character.
+  * @param  p_len Pointer set to the number of contiguous characters available.
+  * @retval status
+  */
+IPC_Status_t IPC_UART_streamPeek(IPC_Handle_t *const hipc, const uint8_t **pp_data, uint16_t *const p_len)
+{
+  IPC_Status_t retval;
+  uint16_t index_read;
+  uint16_t index_write;
+
+  if (hipc->Mode == IPC_MODE_UART_STREAM)
+  {
+    index_read = hipc->RxBuffer.index_read;
+    index_write = hipc->RxBuffer.index_write;
+    /* characters have to be read after index_write */
+    __DMB();
+
+    *pp_data = &hipc->RxBuffer.data[index_read];
+    *p_len = (index_write >= index_read) ? (index_write - index_read) : (IPC_RXBUF_STREAM_MAXSIZE - index_read);
+    retval = IPC_OK;
+  }
+  else
+  {
+    PRINT_ERR("IPC_streamPeek err - IPC mode not matching")
+    *p_len = 0U;
+    retval = IPC_ERROR;
+  }
+
+  return (retval);
+}
+
+/**
+  * @brief  Free characters returned by IPC_UART_streamPeek() in the RX buffer of an UART stream channel.
+  * @param  hipc IPC handle.
+  * @param  len Number of characters to free.
+  * @retval status
+  */
+IPC_Status_t IPC_UART_streamRelease(IPC_Handle_t *const hipc, uint16_t len)
+{
+  IPC_Status_t retval;
+
+  if (hipc->Mode == IPC_MODE_UART_STREAM)
+  {
+    /* characters have to be read before their place is given back to the RX interrupt */
+    __DMB();
+    hipc->RxBuffer.index_read = (uint16_t)((hipc->RxBuffer.index_read + len) % IPC_RXBUF_STREAM_MAXSIZE);
+    retval = IPC_OK;
+  }
+  else
+  {
+    PRINT_ERR("IPC_streamRelease err - IPC mode not matching")
+    retval = IPC_ERROR;
+  }
+
+  return (retval);
+}
 #endif  /* IPC_USE_STREAM_MODE */
 
 /**
@@ -551,7 +741,20 @@ void IPC_UART_rearm_RX_IT(IPC_Handle_t *const hipc)
     /* rearm uart TX interrupt */
     if (hipc->Interface.interface_type == IPC_INTERFACE_UART)
     {
+#if (IPC_USE_UART_DMA_RX == 1U)
+      /* DMA reception is circular: it has to be restarted only if it has been stopped (RX queue paused or error) */
+      if (hipc->Interface.h_uart->RxState == HAL_UART_STATE_READY)
+      {
+        /* first push characters received before the reception was stopped */
+        UART_DMA_process_RX(hipc->Device_ID, IPC_DevicesList[hipc->Device_ID].RxDmaWritePos);
+        if (hipc->State != IPC_STATE_PAUSED)
+        {
+          (void) UART_start_RX(hipc->Device_ID);
+        }
+      }
+#else
       (void)HAL_UART_Receive_IT(hipc->Interface.h_uart, (uint8_t *)IPC_DevicesList[hipc->Device_ID].RxChar, 1U);
+#endif /* IPC_USE_UART_DMA_RX */
     }
   }
 }
@@ -596,6 +799,11 @@ void IPC_UART_DumpRXQueue(const IPC_Handle_t *const hipc, uint8_t readable)
     IPC_RXFIFO_print_data(hipc, core_msg_index, header.size, readable);
     /* read next message header */
     dump_index = (dump_index + IPC_RXMSG_HEADER_SIZE + header.size) % IPC_RXBUF_MAXSIZE;
+    if (hipc->RxQueue.data[dump_index] == IPC_RXMSG_HEADER_WRAP)
+    {
+      /* next message has been moved to index 0 */
+      dump_index = 0U;
+    }
     IPC_RXFIFO_readMsgHeader_at_pos(hipc, &header, dump_index);
   }
 
@@ -629,6 +837,10 @@ void IPC_UART_DumpRXQueue(const IPC_Handle_t *const hipc, uint8_t readable)
 void IPC_UART_RxCpltCallback(UART_HandleTypeDef *UartHandle)
 {
   /* Warning ! this function is called under IT */
+#if (IPC_USE_UART_DMA_RX == 1U)
+  /* nothing to do: with circular DMA reception, characters are received in IPC_UART_RxEventCallback() */
+  UNUSED(UartHandle);
+#else
   uint8_t device_id = find_Device_Id(UartHandle);
   if (device_id < IPC_MAX_DEVICES)
   {
@@ -638,7 +850,35 @@ void IPC_UART_RxCpltCallback(UART_HandleTypeDef *UartHandle)
                                                                 IPC_DevicesList[device_id].RxChar[0]);
     }
   }
+#endif /* IPC_USE_UART_DMA_RX */
+}
+
+#if (IPC_USE_UART_DMA_RX == 1U)
+/**
+  * @brief  IPC uart RX event callback (called under IT !).
+  * @note   Called on DMA half transfer, DMA transfer complete and UART idle line events.
+  * @param  UartHandle Ptr to the HAL UART handle.
+  * @param  Pos Position in the DMA buffer of the last character received.
+  * @retval none
+  */
+void IPC_UART_RxEventCallback(UART_HandleTypeDef *UartHandle, uint16_t Pos)
+{
+  /* Warning ! this function is called under IT */
+  uint8_t device_id = find_Device_Id(UartHandle);
+  if (device_id < IPC_MAX_DEVICES)
+  {
+    /* push all characters received since last event */
+    UART_DMA_process_RX(device_id, Pos % IPC_UART_DMA_RXBUF_SIZE);
+
+    if ((IPC_DevicesList[device_id].h_current_channel != NULL) &&
+        (IPC_DevicesList[device_id].h_current_channel->State == IPC_STATE_PAUSED))
+    {
+      /* RX queue is full: stop reception until enough free space (ie previous msg have been read) */
+      UART_DMA_stop_RX(device_id);
+    }
+  }
 }
+#endif /* IPC_USE_UART_DMA_RX */
 
 /**
   * @brief  IPC uart TX callback (called under IT !).
@@ -652,6 +892,34 @@ void IPC_UART_TxCpltCallback(UART_HandleTypeDef *UartHandle)
 
   if (device_id < IPC_MAX_DEVICES)
   {
+#if (IPC_USE_TX_QUEUE == 1U)
+    IPC_Handle_t *hipc = NULL;
+
+    /* queue is empty if it has been flushed during the transmission */
+    if (IPC_DevicesList[device_id].TxQueueCount != 0U)
+    {
+      /* buffer sent: free it */
+      hipc = IPC_DevicesList[device_id].TxQueue[IPC_DevicesList[device_id].TxQueueRead].hipc;
+      IPC_DevicesList[device_id].TxQueueRead = (IPC_DevicesList[device_id].TxQueueRead + 1U) % IPC_TXQUEUE_NB;
+      IPC_DevicesList[device_id].TxQueueCount--;
+      (void)rtosalSemaphoreRelease(IPC_DevicesList[device_id].TxQueueSemaphore);
+
+      /* send next buffer before to call the client */
+      if (IPC_DevicesList[device_id].TxQueueCount != 0U)
+      {
+        if (UART_start_TX(device_id) != HAL_OK)
+        {
+          UART_flush_TX(device_id);
+        }
+      }
+    }
+
+    if (hipc != NULL)
+    {
+      /* Set transmission flag: transfer complete */
+      hipc->TxClientCallback(hipc);
+    }
+#else
     if (IPC_DevicesList[device_id].h_current_channel != NULL)
     {
       /* Set transmission flag: transfer complete */
@@ -659,6 +927,7 @@ void IPC_UART_TxCpltCallback(UART_HandleTypeDef *UartHandle)
         IPC_DevicesList[device_id].h_current_channel
       );
     }
+#endif /* IPC_USE_TX_QUEUE */
   }
 }
 
@@ -684,6 +953,15 @@ void IPC_UART_ErrorCallback(UART_HandleTypeDef *UartHandle)
           IPC_DevicesList[device_id].h_current_channel
         );
       }
+
+#if (IPC_USE_UART_DMA_RX == 1U)
+      /* blocking errors abort the DMA reception: restart it */
+      if (UartHandle->RxState == HAL_UART_STATE_READY)
+      {
+        UART_DMA_stop_RX(device_id);
+        IPC_UART_rearm_RX_IT(IPC_DevicesList[device_id].h_current_channel);
+      }
+#endif /* IPC_USE_UART_DMA_RX */
     }
   }
 }
@@ -738,5 +1016,211 @@ static IPC_Status_t change_ipc_channel(IPC_Handle_t *const hipc)
   return (IPC_OK);
 }
 
+/**
+  * brief  Start the reception on the UART of an IPC device.
+  * param  device_id IPC device identifier.
+  * retval HAL status
+  */
+static HAL_StatusTypeDef UART_start_RX(uint8_t device_id)
+{
+  HAL_StatusTypeDef uart_status;
+
+#if (IPC_USE_UART_DMA_RX == 1U)
+  if (IPC_DevicesList[device_id].phy_int.h_uart->RxState != HAL_UART_STATE_READY)
+  {
+    /* reception already running (other channel of the same device), keep current DMA position */
+    uart_status = HAL_OK;
+  }
+  else
+  {
+    IPC_DevicesList[device_id].RxDmaReadPos = 0U;
+    IPC_DevicesList[device_id].RxDmaWritePos = 0U;
+    uart_status = HAL_UARTEx_ReceiveToIdle_DMA(IPC_DevicesList[device_id].phy_int.h_uart,
+                                               (uint8_t *)IPC_DevicesList[device_id].RxDmaBuf,
+                                               IPC_UART_DMA_RXBUF_SIZE);
+  }
+#else
+  uart_status = HAL_UART_Receive_IT(IPC_DevicesList[device_id].phy_int.h_uart,
+                                    (uint8_t *)IPC_DevicesList[device_id].RxChar, 1U);
+#endif /* IPC_USE_UART_DMA_RX */
+
+  return (uart_status);
+}
+
+#if (IPC_USE_UART_DMA_RX == 1U)
+/**
+  * brief  Stop the DMA reception and save the current DMA position.
+  * param  device_id IPC device identifier.
+  * retval none
+  */
+static void UART_DMA_stop_RX(uint8_t device_id)
+{
+  UART_HandleTypeDef *huart = IPC_DevicesList[device_id].phy_int.h_uart;
+
+  /* abort first, then read DMA counter (value is kept when the DMA channel is disabled) */
+  (void) HAL_UART_AbortReceive(huart);
+  IPC_DevicesList[device_id].RxDmaWritePos =
+    (IPC_UART_DMA_RXBUF_SIZE - (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx)) % IPC_UART_DMA_RXBUF_SIZE;
+}
+
+/**
+  * brief  Push characters received in the DMA buffer to the RX queue of the current channel.
+  * param  device_id IPC device identifier.
+  * param  dma_pos Position of the DMA in the circular buffer.
+  * retval none
+  */
+static void UART_DMA_process_RX(uint8_t device_id, uint16_t dma_pos)
+{
+  IPC_Handle_t *hipc = IPC_DevicesList[device_id].h_current_channel;
+  uint16_t read_pos = IPC_DevicesList[device_id].RxDmaReadPos;
+  uint16_t block_size;
+  uint16_t written;
+  bool leave_loop = false;
+
+  if (hipc != NULL)
+  {
+    /* at most 2 blocks if DMA has looped back to index 0 */
+    while ((read_pos != dma_pos) && (leave_loop == false))
+    {
+      block_size = (dma_pos > read_pos) ? (dma_pos - read_pos) : (IPC_UART_DMA_RXBUF_SIZE - read_pos);
+      written = hipc->RxFifoWriteBlock(hipc, &IPC_DevicesList[device_id].RxDmaBuf[read_pos], block_size);
+      read_pos = (read_pos + written) % IPC_UART_DMA_RXBUF_SIZE;
+
+      /* RX queue paused: remaining characters are kept in the DMA buffer */
+      if (written != block_size)
+      {
+        leave_loop = true;
+      }
+    }
+    IPC_DevicesList[device_id].RxDmaReadPos = read_pos;
+  }
+}
+#endif /* IPC_USE_UART_DMA_RX */
+
+#if (IPC_USE_TX_QUEUE == 1U)
+/**
+  * brief  Copy data to send in the TX queue and start the transmission if the UART is idle.
+  * note   Several tasks can send on the same IPC device (AT channel and stream channel): the producers are
+  *        serialized by TxQueueMutex, the data of one call are queued in consecutive buffers.
+  *        Not to be called under interrupt.
+  * param  hipc IPC handle.
+  * param  p_TxBuffer Pointer to the data buffer to transfer.
+  * param  bufsize Length of the data buffer.
+  * retval status
+  */
+static IPC_Status_t UART_queue_TX(IPC_Handle_t *const hipc, const uint8_t *p_TxBuffer, uint16_t bufsize)
+{
+  IPC_Status_t retval = IPC_OK;
+  IPC_ClientDescription_t *p_device = &IPC_DevicesList[hipc->Device_ID];
+  IPC_TxBuffer_t *p_txbuf;
+  uint16_t offset = 0U;
+  uint16_t chunk_size;
+  bool start_tx;
+  bool queue_locked;
+
+  /* one producer at a time: TxQueueWrite is updated only by this function */
+  queue_locked = (rtosalMutexAcquire(p_device->TxQueueMutex, IPC_TXQUEUE_TIMEOUT) == osOK);
+  if (queue_locked == false)
+  {
+    PRINT_ERR("IPC_send err - TX queue busy")
+    retval = IPC_ERROR;
+  }
+
+  /* data bigger than a TX buffer are split on several buffers */
+  while ((offset < bufsize) && (retval == IPC_OK))
+  {
+    /* wait for a free buffer: meanwhile, previous buffers are sent under IT */
+    if (rtosalSemaphoreAcquire(p_device->TxQueueSemaphore, IPC_TXQUEUE_TIMEOUT) != osOK)
+    {
+      PRINT_ERR("IPC_send err - no free TX buffer")
+      retval = IPC_ERROR;
+    }
+    else
+    {
+      chunk_size = bufsize - offset;
+      if (chunk_size > IPC_TXQUEUE_BUF_SIZE)
+      {
+        chunk_size = IPC_TXQUEUE_BUF_SIZE;
+      }
+      p_txbuf = &p_device->TxQueue[p_device->TxQueueWrite];
+      (void)memcpy((void *)p_txbuf->data, (const void *)&p_TxBuffer[offset], chunk_size);
+      p_txbuf->size = chunk_size;
+      p_txbuf->hipc = hipc;
+      offset += chunk_size;
+
+      /* add the buffer to the queue: TX complete IT must not update the queue meanwhile */
+      __disable_irq();
+      p_device->TxQueueWrite = (p_device->TxQueueWrite + 1U) % IPC_TXQUEUE_NB;
+      p_device->TxQueueCount++;
+      start_tx = (p_device->TxQueueCount == 1U);
+      __enable_irq();
+
+      /* if a buffer is being sent, this one will be sent by the TX complete IT */
+      if (start_tx == true)
+      {
+        if (UART_start_TX(hipc->Device_ID) != HAL_OK)
+        {
+          PRINT_ERR("IPC_send err - UART TX start")
+          UART_flush_TX(hipc->Device_ID);
+          retval = IPC_ERROR;
+        }
+      }
+    }
+  }
+
+  if (queue_locked == true)
+  {
+    (void)rtosalMutexRelease(p_device->TxQueueMutex);
+  }
+
+  return (retval);
+}
+
+/**
+  * brief  Start the transmission of the first buffer of the TX queue.
+  * param  device_id IPC device identifier.
+  * retval HAL status
+  */
+static HAL_StatusTypeDef UART_start_TX(uint8_t device_id)
+{
+  HAL_StatusTypeDef uart_status;
+  IPC_TxBuffer_t *p_txbuf = &IPC_DevicesList[device_id].TxQueue[IPC_DevicesList[device_id].TxQueueRead];
+
+#if (IPC_USE_UART_DMA_TX == 1U)
+  uart_status = HAL_UART_Transmit_DMA(IPC_DevicesList[device_id].phy_int.h_uart,
+                                      (uint8_t *)p_txbuf->data, p_txbuf->size);
+#else
+  uart_status = HAL_UART_Transmit_IT(IPC_DevicesList[device_id].phy_int.h_uart,
+                                     (uint8_t *)p_txbuf->data, p_txbuf->size);
+#endif /* IPC_USE_UART_DMA_TX */
+
+  return (uart_status);
+}
+
+/**
+  * brief  Discard all the buffers of the TX queue.
+  * note   Transmission on going has to be aborted before.
+  * param  device_id IPC device identifier.
+  * retval none
+  */
+static void UART_flush_TX(uint8_t device_id)
+{
+  uint8_t nb_buffers;
+
+  __disable_irq();
+  nb_buffers = IPC_DevicesList[device_id].TxQueueCount;
+  IPC_DevicesList[device_id].TxQueueCount = 0U;
+  IPC_DevicesList[device_id].TxQueueRead = IPC_DevicesList[device_id].TxQueueWrite;
+  __enable_irq();
+
+  /* discarded buffers are free again */
+  while (nb_buffers != 0U)
+  {
+    (void)rtosalSemaphoreRelease(IPC_DevicesList[device_id].TxQueueSemaphore);
+    nb_buffers--;
+  }
+}
+#endif /* IPC_USE_TX_QUEUE */
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
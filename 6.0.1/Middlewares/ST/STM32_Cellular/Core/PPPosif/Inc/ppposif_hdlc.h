@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * @file    ppposif_hdlc.h
+  * @author  MCD Application Team
+  * @brief   Header for ppposif_hdlc.c module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef PPPOSIF_HDLC_H
+#define PPPOSIF_HDLC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* External variables --------------------------------------------------------*/
+/* Exported macros -----------------------------------------------------------*/
+
+/* Exported functions ------------------------------------------------------- */
+/* Block services of the LwIP PPPoS HDLC-like framing (RFC 1662), used by the local patch of pppos.c
+   when PPPOS_FAST_HDLC is set (see Middlewares/Third_Party/LwIP/st_readme.txt) */
+
+/**
+  * @brief  Update a PPP FCS (16-bit, RFC 1662) with a block of bytes, 4 bytes at a time
+  * @note   Same result as the per byte PPP_FCS() update of pppos.c
+  * @param  fcs: FCS before the block
+  * @param  p_buf: block
+  * @param  len: block size
+  * @retval FCS after the block
+  */
+uint16_t ppposif_hdlc_fcs(uint16_t fcs, const uint8_t *p_buf, uint32_t len);
+
+/**
+  * @brief  Number of leading bytes of a block which are not escaped with an ACCM
+  * @note   p_accm is the 32 bytes extended ACCM of pppos.c (bit c set: character c escaped).
+  *         pppos.c can only escape the 32 control characters, PPP_ESCAPE and PPP_FLAG:
+  *         the other characters are skipped a word at a time.
+  * @param  p_accm: ACCM
+  * @param  p_buf: block
+  * @param  len: block size
+  * @retval number of bytes before the first byte to escape (len if none)
+  */
+uint32_t ppposif_hdlc_unescaped_len(const uint8_t *p_accm, const uint8_t *p_buf, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PPPOSIF_HDLC_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
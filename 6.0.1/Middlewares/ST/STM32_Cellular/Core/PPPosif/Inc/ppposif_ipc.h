@@ -70,6 +70,22 @@ extern int16_t ppposif_ipc_write(IPC_Device_t pDevice, u8_t *data, int16_t len);
   */
 extern int16_t   ppposif_ipc_read(IPC_Device_t pDevice, u8_t *buff, int16_t size);
 
+/**
+  * @brief  Get received data without copy (waits for reception only if no data are available)
+  * @param  pDevice: serial device.
+  * @param  p_data: set to the first received byte.
+  * @retval number of contiguous bytes available at *p_data
+  */
+extern int16_t   ppposif_ipc_get_segment(IPC_Device_t pDevice, const u8_t **p_data);
+
+/**
+  * @brief  Free data returned by ppposif_ipc_get_segment()
+  * @param  pDevice: serial device.
+  * @param  size: number of bytes processed.
+  * @retval none
+  */
+extern void      ppposif_ipc_release_segment(IPC_Device_t pDevice, int16_t size);
+
 /**
   * @brief  component de init
   * @param  pDevice: device to de init.
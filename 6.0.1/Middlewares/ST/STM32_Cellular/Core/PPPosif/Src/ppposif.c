@@ -34,10 +34,10 @@
 #include "netif/ppp/pppos.h"
 #include "lwip/sys.h"
 #include "lwip/dns.h"
+#include "lwip/tcpip.h"
 /*cstat +MISRAC2012-* */
 
 /* Private defines -----------------------------------------------------------*/
-#define RCV_SIZE_MAX 100
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
@@ -207,15 +207,25 @@ void ppposif_status_cb(ppp_pcb *pcb, int32_t err_code, void *ctx)
 void ppposif_input(const struct netif *ppp_netif, ppp_pcb  *p_ppp_pcb, IPC_Device_t pDevice)
 {
   UNUSED(ppp_netif);
-  int32_t rcv_size;
-  uint8_t rcvChar[RCV_SIZE_MAX];
+  int16_t rcv_size;
+  const u8_t *p_rcv_data;
 
-  rcv_size = ppposif_ipc_read(pDevice, rcvChar, RCV_SIZE_MAX);
+  /* received data are decoded directly in the IPC buffer (one contiguous segment per call) */
+  rcv_size = ppposif_ipc_get_segment(pDevice, &p_rcv_data);
   if (rcv_size != 0)
   {
-    /* traceIF_hexPrint(DBG_CHAN_PPPOSIF, DBL_LVL_P0, rcvChar, rcv_size) */
+    /* traceIF_hexPrint(DBG_CHAN_PPPOSIF, DBL_LVL_P0, p_rcv_data, rcv_size) */
+#if (LWIP_TCPIP_CORE_LOCKING == 1)
+    /* Pass received data to PPPoS with lwIP core locked: no intermediate pbuf copy */
+    LOCK_TCPIP_CORE();
+    /* pppos_input() does not modify the data */
+    pppos_input(p_ppp_pcb, (u8_t *)p_rcv_data, (int)rcv_size);
+    UNLOCK_TCPIP_CORE();
+#else
     /* Pass received data to PPPoS to be decoded through lwIP TCPIP thread */
-    (void)pppos_input_tcpip(p_ppp_pcb, rcvChar, rcv_size);
+    (void)pppos_input_tcpip(p_ppp_pcb, (u8_t *)p_rcv_data, (int)rcv_size);
+#endif /* LWIP_TCPIP_CORE_LOCKING == 1 */
+    ppposif_ipc_release_segment(pDevice, rcv_size);
   }
 }
 
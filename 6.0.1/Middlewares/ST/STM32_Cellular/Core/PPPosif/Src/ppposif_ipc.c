@@ -70,7 +70,10 @@ static void IPC_MessageReceivedCallback(IPC_Handle_t *ipcHandle);
 static void IPC_MessageSentCallback(IPC_Handle_t *ipcHandle)
 {
   ppposif_ipc_ctx[ipcHandle->Device_ID].TransmitOnGoing = 0U;
+#if (IPC_USE_TX_QUEUE == 0U)
+  /* ppposif_ipc_write() waits for the end of the transmission (with IPC TX queue, it does not wait) */
   (void)rtosalSemaphoreRelease(ppposif_ipc_ctx[ipcHandle->Device_ID].sndSemaphore);
+#endif /* IPC_USE_TX_QUEUE == 0U */
 }
 
 /**
@@ -151,13 +154,47 @@ int16_t ppposif_ipc_read(IPC_Device_t pDevice, u8_t *buff, int16_t size)
   ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 2U;
   (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].rcvSemaphore, RTOSAL_WAIT_FOREVER);
   ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 0U;
-  __disable_irq();
+  /* IPC stream buffer is a single-producer/single-consumer ring: no need to mask interrupts */
   (void)IPC_streamReceive(ppposif_ipc_ctx[pDevice].ipcHandle, buff, &size);
-  __enable_irq();
 
   return size;
 }
 
+/**
+  * @brief  Get received data without copy
+  * @note   Waits for reception only if no data are available.
+  *         Data stay in the IPC buffer until ppposif_ipc_release_segment() is called.
+  * @param  pDevice: serial device.
+  * @param  p_data: set to the first received byte.
+  * @retval number of contiguous bytes available at *p_data
+  */
+int16_t ppposif_ipc_get_segment(IPC_Device_t pDevice, const u8_t **p_data)
+{
+  uint16_t size;
+
+  (void)IPC_streamPeek(ppposif_ipc_ctx[pDevice].ipcHandle, p_data, &size);
+  if (size == 0U)
+  {
+    ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 2U;
+    (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].rcvSemaphore, RTOSAL_WAIT_FOREVER);
+    ppposif_ipc_ctx[pDevice].rcvSemaphoreFlag = 0U;
+    (void)IPC_streamPeek(ppposif_ipc_ctx[pDevice].ipcHandle, p_data, &size);
+  }
+
+  return (int16_t)size;
+}
+
+/**
+  * @brief  Free data returned by ppposif_ipc_get_segment()
+  * @param  pDevice: serial device.
+  * @param  size: number of bytes processed.
+  * @retval none
+  */
+void ppposif_ipc_release_segment(IPC_Device_t pDevice, int16_t size)
+{
+  (void)IPC_streamRelease(ppposif_ipc_ctx[pDevice].ipcHandle, (uint16_t)size);
+}
+
 /**
   * @brief  Tx Send data
   * @param  pDevice: device .
@@ -181,8 +218,11 @@ int16_t ppposif_ipc_write(IPC_Device_t pDevice, u8_t *data, int16_t len)
   }
   else
   {
+    /* with IPC TX queue, data have been copied: next frame is prepared while this one is sent */
+#if (IPC_USE_TX_QUEUE == 0U)
     ppposif_ipc_ctx[pDevice].sndSemaphoreFlag = 1U;
     (void)rtosalSemaphoreAcquire(ppposif_ipc_ctx[pDevice].sndSemaphore, RTOSAL_WAIT_FOREVER);
+#endif /* IPC_USE_TX_QUEUE == 0U */
 
     ppposif_ipc_ctx[pDevice].TransmitChar += (uint16_t)temp_len;
     ppposif_ipc_ctx[pDevice].sndSemaphoreFlag = 0U;
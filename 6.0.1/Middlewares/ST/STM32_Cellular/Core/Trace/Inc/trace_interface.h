@@ -43,8 +43,37 @@ typedef uint8_t dbg_levels_t;
 /* following flags select debug interface(s) to use : to be defined in plf_sw_config.h
   #define TRACE_IF_TRACES_ITM     (1)
   #define TRACE_IF_TRACES_UART    (1)
+  #define TRACE_IF_TRACES_BIN     (1)
 */
 
+/* Binary deferred traces (TRACE_IF_TRACES_BIN == 1): TRACE_PRINT does not format the trace.
+ * It records in a RAM ring: channel, time (in ms), address of the format string and arguments (strings are copied).
+ * A low priority thread sends the records on UART, a host tool decodes them with the application ELF file
+ * (Middlewares/ST/STM32_Cellular/Core/Trace/Tools/trace_bin_decode.py).
+ * TRACE_PRINT_FORCE and TRACE_VALID traces are still sent as text.
+ * Limitations: at most TRACE_IF_BIN_ARG_MAX arguments per trace, 64-bit and floating point arguments are not supported.
+ */
+#if !defined TRACE_IF_TRACES_BIN
+#define TRACE_IF_TRACES_BIN       (0U)
+#endif /* !defined TRACE_IF_TRACES_BIN */
+
+#if (TRACE_IF_TRACES_BIN == 1U)
+/* Size of the binary traces ring in 32-bit words (must be a power of 2) */
+#if !defined TRACE_IF_BIN_RING_SIZE
+#define TRACE_IF_BIN_RING_SIZE    (1024U)
+#endif /* !defined TRACE_IF_BIN_RING_SIZE */
+/* Period of the binary traces ring draining (in ms) */
+#if !defined TRACE_IF_BIN_DRAIN_PERIOD
+#define TRACE_IF_BIN_DRAIN_PERIOD (20U)
+#endif /* !defined TRACE_IF_BIN_DRAIN_PERIOD */
+/* Maximum number of bytes recorded for a string argument */
+#if !defined TRACE_IF_BIN_STR_MAX
+#define TRACE_IF_BIN_STR_MAX      (64U)
+#endif /* !defined TRACE_IF_BIN_STR_MAX */
+/* Maximum number of arguments of a trace */
+#define TRACE_IF_BIN_ARG_MAX      (10U)
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 /* DEBUG MASK defines the allowed traces : to be defined in plf_sw_config.h */
 /* Full traces */
 /* #define TRACE_IF_MASK    (uint16_t)(DBL_LVL_P0 | DBL_LVL_P1 | DBL_LVL_P2 | DBL_LVL_WARN | DBL_LVL_ERR) */
@@ -137,6 +166,18 @@ void traceIF_itmPrintForce(uint8_t port, uint8_t *pptr, uint16_t len);
   */
 void traceIF_uartPrintForce(uint8_t port, uint8_t *pptr, uint16_t len);
 
+#if (TRACE_IF_TRACES_BIN == 1U)
+/**
+  * @brief  Record a binary trace (used by TRACE_PRINT)
+  * @param  chan     - component channel
+  * @param  lvl      - trace level
+  * @param  p_format - trace format string (must be a constant string)
+  * @param  p_args   - number of arguments followed by the arguments converted to uint32_t
+  * @retval -
+  */
+void traceIF_binPrint(uint8_t chan, uint8_t lvl, const CRC_CHAR_t *p_format, const uint32_t *p_args);
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 /**
   * @brief  Print a trace in hexadecimal format
   * @note   Available for ITM or UART trace And NOT for printf
@@ -171,7 +212,31 @@ void traceIF_BufCharPrint(dbg_channels_t chan, dbg_levels_t level, const CRC_CHA
   */
 void traceIF_BufHexPrint(dbg_channels_t chan, dbg_levels_t level, const CRC_CHAR_t *buf, uint16_t size);
 
-#if ((TRACE_IF_TRACES_ITM == 1U) && (TRACE_IF_TRACES_UART == 1U))
+#if (TRACE_IF_TRACES_BIN == 1U)
+/* Binary trace arguments: array of number of arguments followed by each argument converted to uint32_t */
+#define TRACE_IF_BIN_U32(a)  , (uint32_t)(uintptr_t)(a)
+#define TRACE_IF_BIN_ARG_0()
+#define TRACE_IF_BIN_ARG_1(a)       TRACE_IF_BIN_U32(a)
+#define TRACE_IF_BIN_ARG_2(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_1(b)
+#define TRACE_IF_BIN_ARG_3(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_2(b)
+#define TRACE_IF_BIN_ARG_4(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_3(b)
+#define TRACE_IF_BIN_ARG_5(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_4(b)
+#define TRACE_IF_BIN_ARG_6(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_5(b)
+#define TRACE_IF_BIN_ARG_7(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_6(b)
+#define TRACE_IF_BIN_ARG_8(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_7(b)
+#define TRACE_IF_BIN_ARG_9(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_8(b)
+#define TRACE_IF_BIN_ARG_10(a, b...) TRACE_IF_BIN_U32(a) TRACE_IF_BIN_ARG_9(b)
+#define TRACE_IF_BIN_NARG_(z, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, n, ...) n
+#define TRACE_IF_BIN_NARG(args...) TRACE_IF_BIN_NARG_(0, ## args, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define TRACE_IF_BIN_CAT_(a, b) a ## b
+#define TRACE_IF_BIN_CAT(a, b)  TRACE_IF_BIN_CAT_(a, b)
+#define TRACE_IF_BIN_ARGS(args...) \
+  (const uint32_t[]){ (uint32_t)TRACE_IF_BIN_NARG(args) \
+                      TRACE_IF_BIN_CAT(TRACE_IF_BIN_ARG_, TRACE_IF_BIN_NARG(args))(args) }
+
+#define TRACE_PRINT(chan, lvl, format, args...) \
+  traceIF_binPrint((uint8_t)(chan), (uint8_t)(lvl), format "", TRACE_IF_BIN_ARGS(args));
+#elif ((TRACE_IF_TRACES_ITM == 1U) && (TRACE_IF_TRACES_UART == 1U))
 #define TRACE_PRINT(chan, lvl, format, args...) \
   (void)sprintf((CRC_CHAR_t *)dbgIF_buf[(chan)], format "", ## args);\
   traceIF_itmPrint((uint8_t)(chan), (uint8_t)lvl, (uint8_t *)dbgIF_buf[(chan)],\
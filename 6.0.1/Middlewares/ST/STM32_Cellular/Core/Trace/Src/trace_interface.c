@@ -37,6 +37,24 @@
 /* Private defines -----------------------------------------------------------*/
 #define MAX_HEX_PRINT_SIZE     210U
 
+#if (TRACE_IF_TRACES_BIN == 1U)
+/* Binary trace record:
+ * - word 0: header, bytes 0x5A 0xA5 (sync, not ASCII) followed by channel and record size in words
+ * - word 1: time in ms
+ * - word 2: address of the format string
+ * - words 3..: for each argument, its value or for a string (%s) its length in bytes and its content
+ * A record of format address 0 reports the number of records lost (ring full) in its argument.
+ */
+#define TRACE_IF_BIN_SYNC          (0x0000A55AU)
+#define TRACE_IF_BIN_HEADER(chan, size) \
+  (TRACE_IF_BIN_SYNC | ((uint32_t)(chan) << 16) | ((uint32_t)(size) << 24))
+#define TRACE_IF_BIN_SIZE(header)  ((header) >> 24)
+#define TRACE_IF_BIN_HEADER_SIZE   (3U)
+#define TRACE_IF_BIN_RECORD_MAX    (255U) /* record size is coded on 8 bits */
+#define TRACE_IF_BIN_RING_MASK     (TRACE_IF_BIN_RING_SIZE - 1U)
+#define TRACE_IF_BIN_TX_SIZE       (64U)  /* size in words of the buffer sent on UART */
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 /* Private variables ---------------------------------------------------------*/
 static bool traceIF_traceEnable = true; /* Trace enable per default */
 static uint32_t traceIF_Level = TRACE_IF_MASK;
@@ -70,9 +88,28 @@ static uint8_t *trace_cmd_label = (uint8_t *)"trace";
 #endif /* SW_DEBUG_VERSION == 1 */
 #endif  /* (USE_CMD_CONSOLE == 1) */
 
+#if (TRACE_IF_TRACES_BIN == 1U)
+/* Binary traces ring: a word at 0 is free or not yet committed, a record is committed when its header is written.
+ * traceIF_binHead is the reservation index (updated by the producers with exclusive access instructions),
+ * traceIF_binTail is the read index (updated by the draining thread only). Both are free running. */
+static uint32_t traceIF_binRing[TRACE_IF_BIN_RING_SIZE];
+static volatile uint32_t traceIF_binHead = 0U;
+static volatile uint32_t traceIF_binTail = 0U;
+/* Number of records lost because the ring was full (updated with exclusive access instructions) */
+static volatile uint32_t traceIF_binLost = 0U;
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 /* Private function prototypes -----------------------------------------------*/
 static void ITM_Out(uint32_t port, uint32_t ch);
 
+#if (TRACE_IF_TRACES_BIN == 1U)
+static uint32_t traceIF_binStrArgs(const CRC_CHAR_t *p_format);
+static bool traceIF_binReserve(uint32_t size, uint32_t *p_pos);
+static uint32_t traceIF_binLostUpdate(bool reset);
+static void traceIF_binDrain(void);
+static void traceIF_binThread(void *p_argument);
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 #if (USE_CMD_CONSOLE == 1)
 #if (SW_DEBUG_VERSION == 1)
 static cmd_status_t traceIF_cmd(uint8_t *cmd_line_p);
@@ -351,6 +388,185 @@ static void traceIF_uartTransmit(uint8_t *ptr, uint16_t len)
   (void)rtosalMutexRelease(traceIF_uart_mutex);
 }
 
+#if (TRACE_IF_TRACES_BIN == 1U)
+/**
+  * @brief  Find the string arguments of a binary trace
+  * @note   Same format parsing as the host decoder
+  * @param  p_format - trace format string
+  * @retval uint32_t - bitmap of the string (%s) arguments
+  */
+static uint32_t traceIF_binStrArgs(const CRC_CHAR_t *p_format)
+{
+  const CRC_CHAR_t *p_char = p_format;
+  uint32_t arg_idx = 0U;
+  uint32_t str_mask = 0U;
+
+  while (*p_char != '\0')
+  {
+    if (*p_char == '%')
+    {
+      p_char++;
+      /* skip flags, width, precision and length modifiers: '*' width or precision consumes an argument */
+      while ((*p_char != '\0') && (strchr("-+ #0123456789.*hlLjzt", (int32_t)*p_char) != NULL))
+      {
+        if (*p_char == '*')
+        {
+          arg_idx++;
+        }
+        p_char++;
+      }
+      if ((*p_char == 's') && (arg_idx < TRACE_IF_BIN_ARG_MAX))
+      {
+        str_mask |= (1UL << arg_idx);
+      }
+      if ((*p_char != '%') && (*p_char != '\0'))
+      {
+        arg_idx++;
+      }
+    }
+    if (*p_char != '\0')
+    {
+      p_char++;
+    }
+  }
+
+  return (str_mask);
+}
+
+/**
+  * @brief  Reserve room for a record in binary traces ring
+  * @note   Lock free: can be called by any thread or interrupt
+  * @param  size  - record size in words
+  * @param  p_pos - record position in the ring (free running index)
+  * @retval bool  - true: room reserved, false: ring full
+  */
+static bool traceIF_binReserve(uint32_t size, uint32_t *p_pos)
+{
+  uint32_t head;
+  bool reserved = false;
+  bool done = false;
+
+  while (done == false)
+  {
+    head = __LDREXW(&traceIF_binHead);
+    if ((head - traceIF_binTail) > (TRACE_IF_BIN_RING_SIZE - size))
+    {
+      /* ring full */
+      __CLREX();
+      done = true;
+    }
+    else if (__STREXW(head + size, &traceIF_binHead) == 0U)
+    {
+      *p_pos = head;
+      reserved = true;
+      done = true;
+    }
+    else
+    {
+      /* preempted by another producer: retry */
+    }
+  }
+
+  return (reserved);
+}
+
+/**
+  * @brief  Count a lost record, or get and reset the number of lost records
+  * @note   Lock free: records are lost by any thread or interrupt while the draining thread resets the counter
+  * @param  reset - false: count one more lost record, true: reset the counter
+  * @retval uint32_t - number of lost records before the update
+  */
+static uint32_t traceIF_binLostUpdate(bool reset)
+{
+  uint32_t lost;
+
+  do
+  {
+    lost = __LDREXW(&traceIF_binLost);
+  } while (__STREXW((reset == true) ? 0U : (lost + 1U), &traceIF_binLost) != 0U);
+
+  return (lost);
+}
+
+/**
+  * @brief  Send the committed records of binary traces ring on UART
+  * @param  -
+  * @retval -
+  */
+static void traceIF_binDrain(void)
+{
+  static uint32_t tx_buf[TRACE_IF_BIN_TX_SIZE];
+
+  uint32_t tail = traceIF_binTail;
+  uint32_t tx_len = 0U;
+  uint32_t header;
+  uint32_t size;
+  uint32_t lost;
+  bool done = false;
+
+  /* records lost since last drain */
+  lost = (traceIF_binLost != 0U) ? traceIF_binLostUpdate(true) : 0U;
+  if (lost != 0U)
+  {
+    tx_buf[0] = TRACE_IF_BIN_HEADER(0U, TRACE_IF_BIN_HEADER_SIZE + 1U);
+    tx_buf[1] = rtosalGetSysTimerCount();
+    tx_buf[2] = 0U;
+    tx_buf[3] = lost;
+    tx_len = TRACE_IF_BIN_HEADER_SIZE + 1U;
+  }
+
+  while (done == false)
+  {
+    header = (tail != traceIF_binHead) ? traceIF_binRing[tail & TRACE_IF_BIN_RING_MASK] : 0U;
+    if (header == 0U)
+    {
+      /* ring empty or next record not yet committed */
+      done = true;
+    }
+    else
+    {
+      size = TRACE_IF_BIN_SIZE(header);
+      if ((tx_len + size) > TRACE_IF_BIN_TX_SIZE)
+      {
+        traceIF_uartTransmit((uint8_t *)tx_buf, (uint16_t)(tx_len * 4U));
+        tx_len = 0U;
+      }
+      /* copy the record and free its words */
+      for (uint32_t i = 0U; i < size; i++)
+      {
+        tx_buf[tx_len] = traceIF_binRing[(tail + i) & TRACE_IF_BIN_RING_MASK];
+        traceIF_binRing[(tail + i) & TRACE_IF_BIN_RING_MASK] = 0U;
+        tx_len++;
+      }
+      tail += size;
+      __DMB();
+      traceIF_binTail = tail;
+    }
+  }
+
+  if (tx_len != 0U)
+  {
+    traceIF_uartTransmit((uint8_t *)tx_buf, (uint16_t)(tx_len * 4U));
+  }
+}
+
+/**
+  * @brief  Thread draining binary traces ring
+  * @param  p_argument - unused
+  * @retval -
+  */
+static void traceIF_binThread(void *p_argument)
+{
+  UNUSED(p_argument);
+
+  for (;;)
+  {
+    (void)rtosalDelay(TRACE_IF_BIN_DRAIN_PERIOD);
+    traceIF_binDrain();
+  }
+}
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 /* Functions Definition ------------------------------------------------------*/
 /**
   * @brief  Trace off - Set trace to disable
@@ -473,6 +689,85 @@ void traceIF_uartPrintForce(uint8_t port, uint8_t *pptr, uint16_t len)
   traceIF_uartTransmit(ptr, len);
 }
 
+#if (TRACE_IF_TRACES_BIN == 1U)
+/**
+  * @brief  Record a binary trace (used by TRACE_PRINT)
+  * @param  chan     - component channel
+  * @param  lvl      - trace level
+  * @param  p_format - trace format string (must be a constant string)
+  * @param  p_args   - number of arguments followed by the arguments converted to uint32_t
+  * @retval -
+  */
+void traceIF_binPrint(uint8_t chan, uint8_t lvl, const CRC_CHAR_t *p_format, const uint32_t *p_args)
+{
+  uint32_t str_len[TRACE_IF_BIN_ARG_MAX];
+  uint32_t str_mask;
+  uint32_t nb_args;
+  uint32_t size;
+  uint32_t pos;
+  uint32_t i;
+
+  /* Is trace enable, this level of trace activated and the trace for this component activated ? */
+  if ((traceIF_traceEnable == true) && ((traceIF_Level & lvl) != 0U) && (traceIF_traceComponent[chan] != 0U))
+  {
+    nb_args = p_args[0];
+    str_mask = (traceIF_binStrArgs(p_format) & ((1UL << nb_args) - 1U));
+
+    /* record size */
+    size = TRACE_IF_BIN_HEADER_SIZE + nb_args;
+    for (i = 0U; i < nb_args; i++)
+    {
+      if ((str_mask & (1UL << i)) != 0U)
+      {
+        str_len[i] = (p_args[i + 1U] != 0U) ? crs_strlen((const uint8_t *)(uintptr_t)p_args[i + 1U]) : 0U;
+        str_len[i] = (str_len[i] > TRACE_IF_BIN_STR_MAX) ? TRACE_IF_BIN_STR_MAX : str_len[i];
+        size += (str_len[i] + 3U) / 4U;
+      }
+    }
+
+    if ((size <= TRACE_IF_BIN_RECORD_MAX) && (traceIF_binReserve(size, &pos) == true))
+    {
+      traceIF_binRing[(pos + 1U) & TRACE_IF_BIN_RING_MASK] = rtosalGetSysTimerCount();
+      traceIF_binRing[(pos + 2U) & TRACE_IF_BIN_RING_MASK] = (uint32_t)(uintptr_t)p_format;
+      pos += TRACE_IF_BIN_HEADER_SIZE;
+      for (i = 0U; i < nb_args; i++)
+      {
+        if ((str_mask & (1UL << i)) != 0U)
+        {
+          /* string argument: length then content (its buffer may be reused before the record is sent) */
+          uint32_t word = 0U;
+          const uint8_t *p_str = (const uint8_t *)(uintptr_t)p_args[i + 1U];
+          traceIF_binRing[pos & TRACE_IF_BIN_RING_MASK] = str_len[i];
+          pos++;
+          for (uint32_t j = 0U; j < str_len[i]; j++)
+          {
+            word |= ((uint32_t)p_str[j] << ((j & 3U) * 8U));
+            if (((j & 3U) == 3U) || ((j + 1U) == str_len[i]))
+            {
+              traceIF_binRing[pos & TRACE_IF_BIN_RING_MASK] = word;
+              pos++;
+              word = 0U;
+            }
+          }
+        }
+        else
+        {
+          traceIF_binRing[pos & TRACE_IF_BIN_RING_MASK] = p_args[i + 1U];
+          pos++;
+        }
+      }
+      /* commit the record: header written last */
+      __DMB();
+      traceIF_binRing[(pos - size) & TRACE_IF_BIN_RING_MASK] = TRACE_IF_BIN_HEADER(chan, size);
+    }
+    else
+    {
+      (void)traceIF_binLostUpdate(false);
+    }
+  }
+}
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 /**
   * @brief  Print a trace in hexadecimal format
   * @note   Available for ITM or UART trace And NOT for printf
@@ -647,6 +942,21 @@ void traceIF_init(void)
   */
 void traceIF_start(void)
 {
+#if (TRACE_IF_TRACES_BIN == 1U)
+  static osThreadId traceIF_binThreadId = NULL;
+
+  /* Multi call protection */
+  if (traceIF_binThreadId == NULL)
+  {
+    traceIF_binThreadId = rtosalThreadNew((const rtosal_char_t *)"TraceBin", (os_pthread)traceIF_binThread,
+                                          TRACE_IF_BIN_THREAD_PRIO, TRACE_IF_BIN_THREAD_STACK_SIZE, NULL);
+    if (traceIF_binThreadId == NULL)
+    {
+      PRINT_FORCE("TraceBin thread creation failed: binary traces not sent\n\r")
+    }
+  }
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 #if (USE_CMD_CONSOLE == 1)
 #if (SW_DEBUG_VERSION == 1)
   /* Registration to cmd module to support cmd 'trace' */
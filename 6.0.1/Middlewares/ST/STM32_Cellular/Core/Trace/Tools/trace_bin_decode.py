@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Decoder of the binary traces of trace_interface module (TRACE_IF_TRACES_BIN == 1)
+#
+# usage: trace_bin_decode.py <application.elf> <capture.bin> [-t]
+#   application.elf : ELF file of the application that produced the traces
+#   capture.bin     : raw bytes received on the trace UART
+#   -t              : add time (in ms) and channel at the beginning of each line
+#
+# The format strings are read in the ELF file at the address recorded by the target.
+# Text sent on the UART by TRACE_PRINT_FORCE (console) is output unchanged.
+#
+# Copyright (c) 2018 STMicroelectronics. All rights reserved.
+# This software component is licensed by ST under Ultimate Liberty license SLA0044,
+# the "License"; You may not use this file except in compliance with the License.
+# You may obtain a copy of the License at: www.st.com/SLA0044
+
+import struct
+import sys
+
+SYNC = b'\x5a\xa5'          # first bytes of a record header (see trace_interface.c)
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+# characters between '%' and the conversion: must match traceIF_binStrArgs()
+SPEC_CHARS = '-+ #0123456789.*hlLjzt'
+LENGTH_CHARS = 'hlLjzt'
+
+
+def load_elf(path):
+    """Return the list of (address, content) of the ELF32 sections loaded in target memory"""
+    with open(path, 'rb') as f:
+        elf = f.read()
+    if (elf[0:4] != b'\x7fELF') or (elf[4] != 1) or (elf[5] != 1):
+        sys.exit('%s: not a 32-bit little endian ELF file' % path)
+    shoff, = struct.unpack_from('<I', elf, 0x20)
+    shentsize, shnum = struct.unpack_from('<HH', elf, 0x2E)
+    sections = []
+    for i in range(shnum):
+        _, sh_type, flags, addr, offset, size = struct.unpack_from('<6I', elf, shoff + (i * shentsize))
+        if ((flags & SHF_ALLOC) != 0) and (sh_type != SHT_NOBITS) and (size != 0):
+            sections.append((addr, elf[offset:offset + size]))
+    return sections
+
+
+def read_string(sections, addr):
+    """Return the string at target address addr, or None if not in the ELF file"""
+    for base, data in sections:
+        if base <= addr < (base + len(data)):
+            end = data.find(b'\0', addr - base)
+            return data[addr - base:end if end >= 0 else len(data)].decode('latin-1')
+    return None
+
+
+def signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def format_record(fmt, args):
+    """Format a trace: same format parsing as the target (traceIF_binStrArgs())"""
+    out = []
+    i = 0
+    idx = 0
+    while i < len(fmt):
+        if fmt[i] != '%':
+            out.append(fmt[i])
+            i += 1
+            continue
+        j = i + 1
+        spec = ''
+        while (j < len(fmt)) and (fmt[j] in SPEC_CHARS):
+            if fmt[j] == '*':
+                spec += str(signed(args[idx]))
+                idx += 1
+            elif fmt[j] not in LENGTH_CHARS:
+                spec += fmt[j]
+            j += 1
+        if j >= len(fmt):
+            out.append(fmt[i:])
+            break
+        conv = fmt[j]
+        if conv == '%':
+            out.append('%')
+        elif conv == 's':
+            length = args[idx]
+            nb_words = (length + 3) // 4
+            data = b''.join(struct.pack('<I', w) for w in args[idx + 1:idx + 1 + nb_words])[:length]
+            idx += 1 + nb_words
+            out.append(('%' + spec + 's') % data.decode('latin-1'))
+        else:
+            value = args[idx]
+            idx += 1
+            if conv in 'di':
+                out.append(('%' + spec + 'd') % signed(value))
+            elif conv in 'ouxX':
+                out.append(('%' + spec + conv) % value)
+            elif conv == 'c':
+                out.append(('%' + spec + 'c') % chr(value & 0xFF))
+            elif conv == 'p':
+                out.append('0x%08x' % value)
+            else:
+                out.append('<%%%s: 0x%08x>' % (conv, value))
+        i = j + 1
+    return ''.join(out)
+
+
+def decode(sections, stream, timestamps):
+    """Decode the capture: yield text pieces"""
+    line_start = True
+    pos = 0
+    while pos < len(stream):
+        sync = stream.find(SYNC, pos)
+        end = sync if sync >= 0 else len(stream)
+        if end > pos:
+            text = stream[pos:end].decode('latin-1')
+            line_start = text.endswith('\n') or text.endswith('\r')
+            yield text
+        if (sync < 0) or ((sync + 4) > len(stream)):
+            break
+        chan = stream[sync + 2]
+        size = stream[sync + 3]
+        if (size < 3) or ((sync + (size * 4)) > len(stream)):
+            # truncated or corrupted record: skip the sync bytes
+            pos = sync + 2
+            continue
+        words = struct.unpack_from('<%dI' % size, stream, sync)
+        time_ms, fmt_addr, args = words[1], words[2], words[3:]
+        if fmt_addr == 0:
+            text = '<%d traces lost>\n\r' % args[0]
+        else:
+            fmt = read_string(sections, fmt_addr)
+            if fmt is None:
+                text = '<unknown format 0x%08x>\n\r' % fmt_addr
+            else:
+                try:
+                    text = format_record(fmt, args)
+                except IndexError:
+                    text = '<bad arguments for "%s">\n\r' % fmt.strip()
+        if timestamps and line_start:
+            text = '[%10d ms][%2d] %s' % (time_ms, chan, text)
+        line_start = text.endswith('\n') or text.endswith('\r')
+        yield text
+        pos = sync + (size * 4)
+
+
+def main(argv):
+    files = [a for a in argv[1:] if a != '-t']
+    if len(files) != 2:
+        sys.exit('usage: %s <application.elf> <capture.bin> [-t]' % argv[0])
+    sections = load_elf(files[0])
+    with open(files[1], 'rb') as f:
+        stream = f.read()
+    for text in decode(sections, stream, '-t' in argv[1:]):
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
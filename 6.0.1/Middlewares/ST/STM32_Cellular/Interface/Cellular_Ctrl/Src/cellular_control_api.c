@@ -151,13 +151,22 @@ static cellular_result_t cellular_api_register_general_cb(void)
   static bool cellular_api_global_cb_registered = false;
 
   cellular_result_t ret = CELLULAR_SUCCESS;
+  dc_com_res_mask_t res_mask;
 
   /* if global call back not already registered to Data Cache */
   if (cellular_api_global_cb_registered == false)
   {
-    /* register general call back to Data Cache  */
-    if (dc_com_register_gen_event_cb(&dc_com_db, cellular_api_general_data_cache_callback, (const void *)NULL) ==
-        DC_COM_INVALID_ENTRY)
+    /* register general call back to Data Cache, only for the entries reported to the application */
+    res_mask = DC_COM_RES_MASK(DC_CELLULAR_INFO)
+               | DC_COM_RES_MASK(DC_CELLULAR_SIGNAL_INFO)
+               | DC_COM_RES_MASK(DC_CELLULAR_SIM_INFO)
+               | DC_COM_RES_MASK(DC_CELLULAR_NFMC_INFO)
+               | DC_COM_RES_MASK(DC_CELLULAR_NIFMAN_INFO);
+#if (USE_LOW_POWER == 1)
+    res_mask |= DC_COM_RES_MASK(DC_CELLULAR_POWER_STATUS);
+#endif /* (USE_LOW_POWER == 1) */
+    if (dc_com_register_entry_cb(&dc_com_db, res_mask, cellular_api_general_data_cache_callback,
+                                 (const void *)NULL) == DC_COM_INVALID_ENTRY)
     {
       /* Data Cache registration returned an error */
       ret = CELLULAR_ERR_INTERNAL;
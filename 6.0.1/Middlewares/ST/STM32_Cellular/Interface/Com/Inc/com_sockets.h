@@ -347,6 +347,20 @@ int32_t com_send(int32_t sock,
                  const com_char_t *buf, int32_t len,
                  int32_t flags);
 
+/**
+  * @brief  Socket send data segments
+  * @note   Send data segments on already connected socket
+  *         segments are gathered to limit the number of low level sends
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  iov       - data segments to send
+  * @param  iovcnt    - number of data segments
+  * @param  flags     - options
+  * @retval int32_t   - number of bytes sent or error value
+  */
+int32_t com_sendmsg(int32_t sock,
+                    const com_iovec_t *iov, int32_t iovcnt,
+                    int32_t flags);
+
 /**
   * @brief  Socket send to data
   * @note   Send data to a remote host
@@ -401,6 +415,18 @@ int32_t com_recvfrom(int32_t sock,
   */
 int32_t com_closesocket(int32_t sock);
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until one of the requested events occurs on a set of sockets
+  * @param  fds       - set of sockets and requested events
+  * @note   revents is set for each socket (COM_POLLERR, COM_POLLHUP and COM_POLLNVAL are always reported)
+  * @param  nfds      - number of sockets in fds
+  * @param  timeout   - maximum time to wait (in ms)
+  * @note   0: no wait - negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 if timeout) or error value
+  */
+int32_t com_poll(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+
 
 /**
   * @}
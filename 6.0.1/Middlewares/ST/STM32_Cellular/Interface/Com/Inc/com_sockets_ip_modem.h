@@ -32,6 +32,7 @@ extern "C" {
 
 #include "com_common.h"
 #include "com_sockets_addr_compat.h"
+#include "com_sockets_net_compat.h"
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -201,6 +202,21 @@ int32_t com_send_ip_modem(int32_t sock,
                           const com_char_t *buf, int32_t len,
                           int32_t flags);
 
+/**
+  * @brief  Socket send data segments
+  * @note   Send data segments on already connected socket
+  *         segments are gathered in one modem data write
+  *         (up to modem maximum data size)
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  iov       - data segments to send
+  * @param  iovcnt    - number of data segments
+  * @param  flags     - options
+  * @retval int32_t   - number of bytes sent or error value
+  */
+int32_t com_sendmsg_ip_modem(int32_t sock,
+                             const com_iovec_t *iov, int32_t iovcnt,
+                             int32_t flags);
+
 /**
   * @brief  Socket send to data
   * @note   Send data to a remote host
@@ -240,6 +256,7 @@ int32_t com_sendto_ip_modem(int32_t sock,
   * @param  flags     - options
   * @note   - if flags = COM_MSG_DONTWAIT, application request to not wait
   *         until data are available at low level
+  *         (TCP socket with receive prefetch: COM_SOCKETS_ERR_WOULDBLOCK if no data available)
   *         - if flags = COM_MSG_WAIT, application accept to wait
   *         until data are available at low level with respect of potential
   *         timeout COM_SO_RCVTIMEO setting
@@ -287,6 +304,18 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
   */
 int32_t com_closesocket_ip_modem(int32_t sock);
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until one of the requested events occurs on a set of sockets
+  *         events are raised by modem data ready / socket closing indications
+  * @param  fds       - set of sockets and requested events
+  * @param  nfds      - number of sockets in fds
+  * @param  timeout   - maximum time to wait (in ms)
+  * @note   0: no wait - negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 if timeout) or error value
+  */
+int32_t com_poll_ip_modem(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+
 /**
   * @}
   */
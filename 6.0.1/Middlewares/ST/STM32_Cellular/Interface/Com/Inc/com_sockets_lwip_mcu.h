@@ -32,6 +32,7 @@ extern "C" {
 
 #include "com_common.h"
 #include "com_sockets_addr_compat.h"
+#include "com_sockets_net_compat.h"
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -176,6 +177,20 @@ int32_t com_send_lwip_mcu(int32_t sock,
                           const com_char_t *buf, int32_t len,
                           int32_t flags);
 
+/**
+  * @brief  Socket send data segments
+  * @note   Send data segments on already connected socket
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  iov       - data segments to send
+  * @param  iovcnt    - number of data segments
+  * @param  flags     - options
+  * @retval int32_t   - number of bytes sent or error value
+  */
+int32_t com_sendmsg_lwip_mcu(int32_t sock,
+                             const com_iovec_t *iov, int32_t iovcnt,
+                             int32_t flags);
+
 /**
   * @brief  Socket send to data
   * @note   Send data to a remote host
@@ -233,6 +248,18 @@ int32_t com_recvfrom_lwip_mcu(int32_t sock,
   */
 int32_t com_closesocket_lwip_mcu(int32_t sock);
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until one of the requested events occurs on a set of sockets
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  fds       - set of sockets and requested events
+  * @param  nfds      - number of sockets in fds
+  * @param  timeout   - maximum time to wait (in ms)
+  * @note   0: no wait - negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 if timeout) or error value
+  */
+int32_t com_poll_lwip_mcu(com_pollfd_t *fds, uint32_t nfds, int32_t timeout);
+
 /**
   * @}
   */
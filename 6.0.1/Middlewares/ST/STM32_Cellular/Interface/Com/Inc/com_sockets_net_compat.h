@@ -37,6 +37,21 @@ extern "C" {
 /** @note Next definition is to ensure compatibility with previous release */
 #define COM_SOCKET_INVALID_ID COM_HANDLE_INVALID_ID /*!< Socket invalid Id */
 
+/**
+  * @}
+  */
+
+/** @addtogroup COM_SOCKETS_Types
+  * @{
+  */
+/** @note Socket descriptor used with com_poll() */
+typedef struct
+{
+  int32_t sock;     /*!< socket handle obtained with com_socket - ignored if negative */
+  int16_t events;   /*!< requested events: COM_POLLIN and/or COM_POLLOUT */
+  int16_t revents;  /*!< returned events */
+} com_pollfd_t;
+
 /**
   * @}
   */
@@ -93,12 +108,31 @@ extern "C" {
 #define COM_MSG_WAIT       0x00    /*!< Blocking     */
 #define COM_MSG_DONTWAIT   0x01    /*!< Non blocking */
 
+/* Events used with poll. */
+#define COM_POLLIN         0x0001  /*!< Data can be received          */
+#define COM_POLLOUT        0x0002  /*!< Data can be sent              */
+#define COM_POLLERR        0x0004  /*!< Error (e.g: network down)     */
+#define COM_POLLNVAL       0x0008  /*!< Invalid socket descriptor     */
+#define COM_POLLHUP        0x0200  /*!< Connection closed by remote   */
+
 /**
   * @}
   */
 
 /* Exported types ------------------------------------------------------------*/
-/* None */
+/** @addtogroup COM_SOCKETS_Types
+  * @{
+  */
+/** @note Data segment used with com_sendmsg() */
+typedef struct
+{
+  void     *iov_base; /*!< segment data                */
+  uint32_t iov_len;   /*!< segment length (in bytes)   */
+} com_iovec_t;
+
+/**
+  * @}
+  */
 
 /* External variables --------------------------------------------------------*/
 /* None */
@@ -162,8 +196,15 @@ extern "C" {
 #define COM_MSG_WAIT       0x00
 #define COM_MSG_DONTWAIT   MSG_DONTWAIT
 
+/* Events used with poll. */
+#define COM_POLLIN         POLLIN
+#define COM_POLLOUT        POLLOUT
+#define COM_POLLERR        POLLERR
+#define COM_POLLNVAL       POLLNVAL
+#define COM_POLLHUP        POLLHUP /* not reported by LwIP: remote close is reported with COM_POLLIN */
+
 /* Exported types ------------------------------------------------------------*/
-/* None */
+typedef struct iovec com_iovec_t;
 
 /* External variables --------------------------------------------------------*/
 /* None */
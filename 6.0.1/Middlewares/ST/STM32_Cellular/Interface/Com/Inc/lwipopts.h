@@ -44,6 +44,10 @@
 
 #define PPP_NOTIFY_PHASE  1
 #define MEMP_NUM_PPP_PCB  2
+#if !defined PPPOS_FAST_HDLC
+#define PPPOS_FAST_HDLC   0   /* 1: PPPoS framing by runs of non-escaped characters with a 4 bytes FCS
+                                   (local patch of pppos.c using PPPosif/ppposif_hdlc.c, 2 KB of FCS tables) */
+#endif /* !defined PPPOS_FAST_HDLC */
 
 #define LWIP_COMPAT_MUTEX_ALLOWED  1
 
@@ -89,7 +89,7 @@ static cmd_status_t com_core_cmd(uint8_t *p_cmd_line)
 
   if (p_cmd != NULL)
   {
-    if (memcmp((const CRC_CHAR_t *)p_cmd, "comlib", crs_strlen(p_cmd)) == 0)
+    if (strncmp((const CRC_CHAR_t *)p_cmd, "comlib", crs_strlen(p_cmd)) == 0)
     {
       /* parameters parsing */
       for (argc = 0U; argc < COM_CORE_CMD_ARG_MAX_NB; argc++)
@@ -112,13 +112,13 @@ static cmd_status_t com_core_cmd(uint8_t *p_cmd_line)
       {
         /* cmd 'comlib' [help|stat] ? */
         len = crs_strlen(p_argv[0]);
-        if (memcmp((CRC_CHAR_t *)p_argv[0], "help", len) == 0)
+        if (strncmp((CRC_CHAR_t *)p_argv[0], "help", len) == 0)
         {
           /* cmd 'comlib help': display help */
           result = CMD_OK;
           com_core_cmd_help();
         }
-        else if (memcmp((CRC_CHAR_t *)p_argv[0], "stat", len) == 0)
+        else if (strncmp((CRC_CHAR_t *)p_argv[0], "stat", len) == 0)
         {
           /* cmd 'comlib stat': display statistics */
           result = CMD_OK;
@@ -839,7 +839,9 @@ bool com_icc_init(void)
 void com_icc_start(void)
 {
   /* Datacache registration for icc status */
-  (void)dc_com_core_register_gen_event_cb(&dc_com_db, com_icc_datacache_cb, (void *)NULL);
+  (void)dc_com_core_register_entry_cb(&dc_com_db,
+                                      DC_COM_RES_MASK(DC_CELLULAR_SIM_INFO) | DC_COM_RES_MASK(DC_CELLULAR_INFO),
+                                      com_icc_datacache_cb, (void *)NULL);
 }
 
 #endif /* USE_COM_ICC == 1 */
@@ -235,6 +235,32 @@ int32_t com_send(int32_t sock,
 }
 
 
+/**
+  * @brief  Socket send data segments
+  * @note   Send data segments on already connected socket
+  *         segments are gathered to limit the number of low level sends
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  iov       - data segments to send
+  * @param  iovcnt    - number of data segments
+  * @param  flags     - options
+  * @retval int32_t   - number of bytes sent or error value
+  */
+int32_t com_sendmsg(int32_t sock,
+                    const com_iovec_t *iov, int32_t iovcnt,
+                    int32_t flags)
+{
+  int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  result = com_sendmsg_ip_modem(sock, iov, iovcnt, flags);
+#else
+  result = com_sendmsg_lwip_mcu(sock, iov, iovcnt, flags);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+
+  return (result);
+}
+
+
 /**
   * @brief  Socket send to data
   * @note   Send data to a remote host
@@ -316,6 +342,28 @@ int32_t com_recvfrom(int32_t sock,
 }
 
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until one of the requested events occurs on a set of sockets
+  * @param  fds       - set of sockets and requested events
+  * @param  nfds      - number of sockets in fds
+  * @param  timeout   - maximum time to wait (in ms)
+  * @retval int32_t   - number of sockets with returned events (0 if timeout) or error value
+  */
+int32_t com_poll(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  int32_t result;
+
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+  result = com_poll_ip_modem(fds, nfds, timeout);
+#else
+  result = com_poll_lwip_mcu(fds, nfds, timeout);
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+
+  return (result);
+}
+
+
 /**
   * @brief  Socket close
   * @note   Close a socket and release socket handle
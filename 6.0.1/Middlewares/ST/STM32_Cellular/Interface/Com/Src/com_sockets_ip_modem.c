@@ -54,6 +54,8 @@
 #define COM_MODEM_MAX_RX_DATA_SIZE CONFIG_MODEM_MAX_SOCKET_RX_DATA_SIZE
 
 #define COM_SOCKET_LOCAL_ID_NB 1U /* Socket local id number : 1 for ping */
+/* Socket descriptor number: modem sockets then local sockets */
+#define COM_SOCKET_DESC_NB     (CELLULAR_MAX_SOCKETS + COM_SOCKET_LOCAL_ID_NB)
 
 #define COM_LOCAL_PORT_BEGIN  0xc000U /* 49152 */
 #define COM_LOCAL_PORT_END    0xffffU /* 65535 */
@@ -62,6 +64,20 @@
 #define COM_TIMER_INACTIVITY_MS 10000U /* in ms */
 #endif /* USE_LOW_POWER == 1 */
 
+#define COM_POLL_WAITER_NB    2U /* maximum number of tasks waiting in com_poll at the same time */
+
+#define COM_SENDMSG_IOV_MAX   8U /* maximum number of segments gathered in one modem data write */
+
+/* Receive prefetch: TCP data are read as soon as the modem indicates data are ready */
+#if (COM_SOCKETS_RCV_PREFETCH_SIZE > 0U)
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 0)
+#error COM_SOCKETS_RCV_PREFETCH_SIZE > 0 requires USE_CELLULAR_SERVICE_ASYNC_REQ == 1
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 0 */
+#define COM_RCV_PREFETCH (1)
+#else
+#define COM_RCV_PREFETCH (0)
+#endif /* COM_SOCKETS_RCV_PREFETCH_SIZE > 0U */
+
 /* Private typedef -----------------------------------------------------------*/
 typedef char CSIP_CHAR_t; /* used in stdio.h and string.h service call */
 
@@ -106,7 +122,20 @@ typedef struct _socket_desc_t
   uint32_t              rcv_timeout; /* timeout for receive cmd */
   osMessageQId          queue;       /* message queue for URC   */
   com_ping_rsp_t        *rsp;
-  struct _socket_desc_t *next;       /* chained list            */
+  bool                  rcv_ready;   /* data ready received and maybe not yet read */
+  uint8_t               index;       /* index in socket descriptor pool */
+  uint8_t               gen;         /* generation - changed each time the descriptor is released */
+#if (COM_RCV_PREFETCH == 1)
+  /* Receive prefetch buffer: written by the prefetch read completion, read by the application
+     (one byte is kept free to distinguish full from empty buffer) */
+  uint8_t               *rcv_buf;         /* prefetch buffer (COM_SOCKETS_RCV_PREFETCH_SIZE bytes) */
+  volatile uint32_t     rcv_head;         /* write index */
+  volatile uint32_t     rcv_tail;         /* read index */
+  int32_t               rcv_length;       /* length read by the ongoing prefetch read */
+  volatile uint32_t     rcv_state;        /* read state: COM_RCV_xxx flags | handle of the ongoing read */
+  volatile bool         rcv_error;        /* last prefetch read failed */
+  osSemaphoreId         rcv_stop_sem;     /* released at the end of the ongoing read when the close waits it */
+#endif /* COM_RCV_PREFETCH == 1 */
 } socket_desc_t;
 
 typedef struct
@@ -135,6 +164,23 @@ typedef enum
 
 #define COM_MIN(a,b) (((a)<(b)) ? (a) : (b))
 
+/* Socket handle provided to the application: descriptor generation (bits 8-15) | descriptor index (bits 0-7)
+   a handle still used after the socket close is so rejected */
+#define COM_SOCKET_HANDLE(index, gen)   ((int32_t)((((uint32_t)(gen)) << 8) | ((uint32_t)(index))))
+#define COM_SOCKET_HANDLE_INDEX(handle) (((uint32_t)(handle)) & 0x000000FFU)
+#define COM_SOCKET_HANDLE_GEN(handle)   ((uint8_t)((((uint32_t)(handle)) & 0x0000FF00U) >> 8))
+
+#if (COM_RCV_PREFETCH == 1)
+/* Receive prefetch read state: updated lock free by the application, the data ready callback (AT task)
+   and the read completion (Cellular Service request thread)
+   the handle of the descriptor use which started the ongoing read (bits 0-15) rejects a read completion
+   received after the descriptor is released */
+#define COM_RCV_HANDLE_MASK  0x0000FFFFU /* handle of the ongoing read */
+#define COM_RCV_PENDING      0x00010000U /* a prefetch or direct read is ongoing */
+#define COM_RCV_MORE         0x00020000U /* data may still be available in the modem */
+#define COM_RCV_STOP         0x00040000U /* socket close ongoing: no read can start */
+#endif /* COM_RCV_PREFETCH == 1 */
+
 /* Set socket error */
 #define SOCKET_SET_ERROR(socket, val) do {\
                                            if ((socket) != NULL) {\
@@ -167,16 +213,16 @@ socket_msg_t
 /* Private variables ---------------------------------------------------------*/
 
 /* Mutex to protect access to :
-   socket descriptor list,
-   socket local_id array */
+   socket descriptor allocation / release,
+   com_poll waiters */
 static osMutexId ComSocketsMutexHandle;
 
-static socket_desc_t *socket_desc_list; /* Socket descriptor list */
-
-/* Provide a socket local id - Used for Ping */
-static bool socket_local_id[COM_SOCKET_LOCAL_ID_NB]; /* false : unused, true  : in use  */
+/* Socket descriptor pool
+   index [0, CELLULAR_MAX_SOCKETS[ : modem socket, index = modem socket handle
+   index [CELLULAR_MAX_SOCKETS, COM_SOCKET_DESC_NB[ : local socket (used for Ping), index = local id + offset */
+static socket_desc_t socket_desc_pool[COM_SOCKET_DESC_NB];
 #if (USE_COM_PING == 1)
-static int32_t ping_socket_id; /* Ping socket id */
+static int32_t ping_socket_id; /* Ping socket handle */
 #endif /* USE_COM_PING  == 1 */
 
 static bool com_sockets_network_is_up; /* Network status is managed through Datacache */
@@ -195,6 +241,10 @@ static uint8_t com_nb_wake_up;
 static osMutexId ComTimerInactivityMutexHandle;
 #endif /* USE_LOW_POWER == 1 */
 
+/* com_poll waiters: one semaphore per task waiting in com_poll, released on each socket event */
+static osSemaphoreId com_poll_waiter_sem[COM_POLL_WAITER_NB];
+static bool com_poll_waiter_used[COM_POLL_WAITER_NB]; /* protected by ComSocketsMutexHandle */
+
 #if (UDP_SERVICE_SUPPORTED == 1U)
 /* Local port allocated - used when bind(local_port = 0U) */
 static uint16_t com_local_port; /* a value in [COM_LOCAL_PORT_BEGIN, COM_LOCAL_PORT_BEGIN] */
@@ -226,13 +276,15 @@ static void com_ip_modem_timer_inactivity_cb(void *p_argument);
 /* Initialize a socket descriptor */
 static void com_ip_modem_init_socket_desc(socket_desc_t *socket_desc);
 /* Create a socket descriptor */
-static socket_desc_t *com_ip_modem_create_socket_desc(void);
+static bool com_ip_modem_create_socket_desc(socket_desc_t *socket_desc, uint8_t index);
 /* Provide a free socket descriptor */
-static socket_desc_t *com_ip_modem_provide_socket_desc(bool local);
+static socket_desc_t *com_ip_modem_provide_socket_desc(bool local, socket_handle_t sock);
 /* Delete a socket descriptor - in fact reinitialize it */
-static void com_ip_modem_delete_socket_desc(int32_t sock, bool local);
+static void com_ip_modem_delete_socket_desc(socket_desc_t *socket_desc);
 /* Find a socket descriptor */
 static socket_desc_t *com_ip_modem_find_socket(int32_t sock, bool local);
+/* Find a socket from the modem socket handle */
+static socket_desc_t *com_ip_modem_find_modem_socket(socket_handle_t sock);
 
 /* Empty queue from all messages */
 static void com_ip_modem_empty_queue(osMessageQId queue);
@@ -269,6 +321,30 @@ static void com_ip_modem_idlemode_request(bool immediate);
 static bool com_ip_modem_are_all_sockets_invalid(void);
 #endif /* USE_LOW_POWER == 1U */
 
+/* Gather data segments for one modem data write */
+static uint8_t com_ip_modem_iov_gather(const com_iovec_t *iov, int32_t iovcnt,
+                                       int32_t *p_seg, uint32_t *p_offset,
+                                       CS_Iovec_t *p_cs_iov, uint32_t *p_length);
+
+/* Poll management */
+static void com_ip_modem_poll_signal(void);
+static int32_t com_ip_modem_poll_check(com_pollfd_t *fds, uint32_t nfds);
+
+#if (COM_RCV_PREFETCH == 1)
+/* Receive prefetch management */
+static uint32_t com_ip_modem_rcv_state_update(socket_desc_t *socket_desc, uint32_t clear, uint32_t set);
+static uint32_t com_ip_modem_rcv_claim(socket_desc_t *socket_desc, bool more);
+static uint32_t com_ip_modem_rcv_release(socket_desc_t *socket_desc, uint32_t set);
+static bool com_ip_modem_rcv_prefetch(socket_desc_t *socket_desc);
+static void com_ip_modem_rcv_prefetch_cb(CS_Status_t status, void *p_cb_ctx);
+static int32_t com_ip_modem_rcv_buf_read(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len);
+static bool com_ip_modem_rcv_direct(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len, int32_t *p_len_rcv);
+static void com_ip_modem_rcv_stop(socket_desc_t *socket_desc, bool stop);
+static int32_t com_ip_modem_recv_prefetch(socket_desc_t *socket_desc,
+                                          com_char_t *buf, uint32_t len,
+                                          int32_t flags, int32_t *p_len_rcv);
+#endif /* COM_RCV_PREFETCH == 1 */
+
 /* Private function Definition -----------------------------------------------*/
 
 /**
@@ -290,72 +366,96 @@ static void com_ip_modem_init_socket_desc(socket_desc_t *socket_desc)
   socket_desc->rcv_timeout      = RTOSAL_WAIT_FOREVER;
   socket_desc->snd_timeout      = RTOSAL_WAIT_FOREVER;
   socket_desc->error            = COM_SOCKETS_ERR_OK;
-  /* socket_desc->next is not re-initialize - element is let in the list at its place */
+  socket_desc->rcv_ready        = false;
+#if (COM_RCV_PREFETCH == 1)
+  socket_desc->rcv_head         = 0U;
+  socket_desc->rcv_tail         = 0U;
+  socket_desc->rcv_error        = false;
+  /* socket_desc->rcv_buf is not re-initialize - buffer is reused
+     the ongoing read is kept in the read state: it ends even if the descriptor is released */
+  (void)com_ip_modem_rcv_state_update(socket_desc, COM_RCV_MORE | COM_RCV_STOP, 0U);
+#endif /* COM_RCV_PREFETCH == 1 */
+  /* handles provided and prefetch read ongoing for the previous use of the descriptor are no more valid */
+  socket_desc->gen++;
+  /* socket_desc->index is not re-initialize - descriptor is let in the pool at its place */
   /* socket_desc->queue is not re-initialize - queue is reused */
 }
 
 /**
   * @brief  Create a socket descriptor
-  * @note   Allocate a new socket_desc_t and its queue
+  * @note   Allocate the socket_desc_t queue (and receive buffer for modem socket)
   *         and initialize the socket to default value
-  * @param  -
-  * @retval socket_desc_t or NULL (if not enough memory)
+  * @param  socket_desc - socket descriptor in the pool
+  * @param  index       - index of the socket descriptor in the pool
+  * @retval bool        - true/false creation ok/nok (if not enough memory)
   */
-static socket_desc_t *com_ip_modem_create_socket_desc(void)
+static bool com_ip_modem_create_socket_desc(socket_desc_t *socket_desc, uint8_t index)
 {
-  socket_desc_t *socket_desc;
+  bool result;
 
-  socket_desc = (socket_desc_t *)pvPortMalloc(sizeof(socket_desc_t));
-  if (socket_desc != NULL)
+  result = true;
+  socket_desc->index = index;
+  socket_desc->gen   = 0U;
+#if (COM_RCV_PREFETCH == 1)
+  socket_desc->rcv_buf      = NULL;
+  socket_desc->rcv_state    = 0U;
+  socket_desc->rcv_stop_sem = NULL;
+  /* Prefetch buffer only needed for modem socket */
+  if (index < CELLULAR_MAX_SOCKETS)
   {
-    socket_desc->queue = rtosalMessageQueueNew(NULL, 4U);
-    if (socket_desc->queue == NULL)
+    socket_desc->rcv_buf = (uint8_t *)pvPortMalloc(COM_SOCKETS_RCV_PREFETCH_SIZE);
+    /* Semaphore is created taken */
+    socket_desc->rcv_stop_sem = rtosalSemaphoreNew(NULL, 1U);
+    if ((socket_desc->rcv_buf == NULL) || (socket_desc->rcv_stop_sem == NULL))
     {
-      /* Not enough memory - Deallocate socket_desc */
-      vPortFree(socket_desc);
-      socket_desc = NULL;
+      result = false;
     }
     else
     {
-      socket_desc->next = NULL;
-      com_ip_modem_init_socket_desc(socket_desc);
+      (void)rtosalSemaphoreAcquire(socket_desc->rcv_stop_sem, RTOSAL_WAIT_FOREVER);
     }
   }
+#endif /* COM_RCV_PREFETCH == 1 */
+  socket_desc->queue = rtosalMessageQueueNew(NULL, 4U);
+  if (socket_desc->queue == NULL)
+  {
+    result = false;
+  }
+  com_ip_modem_init_socket_desc(socket_desc);
 
-  return socket_desc;
+  return result;
 }
 
 /**
   * @brief  Provide a socket descriptor
-  * @note   Search the first empty place in the chained socket list
-  *         or create a new socket and add it at the end of the chained list
+  * @note   Modem socket: descriptor at modem socket handle index
+  *         Local socket: first unused local descriptor
   * @param  local
   * @note   true/false socket is local (used for Ping) / network one
-  * @retval socket_desc_t or NULL (if not enough memory)
+  * @param  sock
+  * @note   modem socket handle (unused if local is true)
+  * @retval socket_desc_t or NULL (if no descriptor available)
   */
-static socket_desc_t *com_ip_modem_provide_socket_desc(bool local)
+static socket_desc_t *com_ip_modem_provide_socket_desc(bool local, socket_handle_t sock)
 {
-  /* Chained list will be changed */
-  (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
-
-  bool found;
   uint8_t i;
   socket_desc_t *socket_desc;
-  socket_desc_t *socket_desc_previous;
 
-  i = 0U;
-  found = false;
-  socket_desc = socket_desc_list;
+  socket_desc = NULL;
+
+  /* Descriptor allocation */
+  (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
 
-  /* If socket is local first check an id is still available in the table */
   if (local == true)
   {
-    while ((i < COM_SOCKET_LOCAL_ID_NB) && (found == false))
+    /* Search an unused local id */
+    i = 0U;
+    while ((i < COM_SOCKET_LOCAL_ID_NB) && (socket_desc == NULL))
     {
-      if (socket_local_id[i] == false)
+      if (socket_desc_pool[CELLULAR_MAX_SOCKETS + i].state == COM_SOCKET_INVALID)
       {
-        found = true; /* an unused local id has been found */
-        /* com_socket_local_id book is done only if socket is really created */
+        socket_desc = &socket_desc_pool[CELLULAR_MAX_SOCKETS + i];
+        socket_desc->id = (int32_t)i;
       }
       else
       {
@@ -363,64 +463,23 @@ static socket_desc_t *com_ip_modem_provide_socket_desc(bool local)
       }
     }
   }
+  else if ((sock >= 0)
+           && ((uint32_t)sock < CELLULAR_MAX_SOCKETS)
+           && (socket_desc_pool[sock].state == COM_SOCKET_INVALID))
+  {
+    socket_desc = &socket_desc_pool[sock];
+    socket_desc->id = sock;
+  }
   else
   {
-    found = true; /* if local == false no specific treatment to do */
+    /* Nothing to do - no descriptor available */
   }
 
-  if ((found == true) && (i < COM_SOCKET_LOCAL_ID_NB))
+  if (socket_desc != NULL)
   {
-    /* Need to create a new socket_desc ? */
-    while ((socket_desc->state != COM_SOCKET_INVALID)
-           && (socket_desc->next != NULL))
-    {
-      socket_desc = socket_desc->next; /* Check next descriptor */
-    }
-    /* Find an empty socket ? */
-    if (socket_desc->state != COM_SOCKET_INVALID)
-    {
-      /* No empty socket, save the last socket descriptor to attach the new one */
-      socket_desc_previous = socket_desc;
-      /* Create new socket descriptor */
-      socket_desc = com_ip_modem_create_socket_desc();
-      if (socket_desc != NULL)
-      {
-        PRINT_DBG("socket desc created %ld queue %p", socket_desc->id, socket_desc->queue)
-        /* Before to attach this new socket to the descriptor list finalize its initialization */
-        socket_desc->state = COM_SOCKET_CREATING;
-        socket_desc->local = local;
-        if (local == true)
-        {
-          /* even if an application create two sockets one local - one distant
-             no issue if id is same because it will be stored
-             in two variables at application level */
-          /* Don't need an OFFSET to not overlap Modem id */
-          socket_desc->id = (int32_t)i;
-          /*  Socket is really created - book com_socket_local_id */
-          socket_local_id[i] = true;
-        }
-        /* Initialization is finalized, socket can be attached to the list
-           and so visible to other functions
-           even the one accessing in read mode to socket descriptor list */
-        socket_desc_previous->next = socket_desc;
-      }
-    }
-    else
-    {
-      /* Find an empty place */
-      socket_desc->state = COM_SOCKET_CREATING;
-      socket_desc->local = local;
-      if (local == true)
-      {
-        /* even if an application create two sockets one local - one distant
-           no issue if id is same because it will be stored
-           in two variable s at application level */
-        /* Don't need an OFFSET to not overlap Modem id */
-        socket_desc->id = (int32_t)i;
-        /*  Socket is really created - book com_socket_local_id */
-        socket_local_id[i] = true;
-      }
-    }
+    socket_desc->local = local;
+    /* Descriptor is in use from now */
+    socket_desc->state = COM_SOCKET_CREATING;
   }
 
   (void)rtosalMutexRelease(ComSocketsMutexHandle);
@@ -431,60 +490,26 @@ static socket_desc_t *com_ip_modem_provide_socket_desc(bool local)
 
 /**
   * @brief  Delete a socket descriptor
-  * @note   Search the socket descriptor and reinitialze it to unused
-  * @param  sock
-  * @note   socket id
-  * @param  local
-  * @note   true/false
+  * @note   Reinitialize the socket descriptor to unused
+  * @param  socket_desc - socket descriptor to release
   * @retval -
   */
-static void com_ip_modem_delete_socket_desc(int32_t sock, bool local)
+static void com_ip_modem_delete_socket_desc(socket_desc_t *socket_desc)
 {
-  /* Chained list will be changed */
+  /* Descriptor release */
   (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
 
-  bool found;
-  socket_desc_t *socket_desc;
-
-  found = false;
-
-  socket_desc = socket_desc_list;
-
-  /* Search the socket descriptor */
-  while ((socket_desc != NULL)
-         && (found != true))
-  {
-    if ((socket_desc->id == sock)
-        && (socket_desc->local == local))
-    {
-      /* Socket descriptor is found */
-      found = true;
-    }
-    else
-    {
-      /* Not the searched one ... Next */
-      socket_desc = socket_desc->next;
-    }
-  }
-  if (found == true)
-  {
-    /* Always keep a created socket */
-    com_ip_modem_init_socket_desc(socket_desc);
-    if (local == true)
-    {
-      /* Free com_socket_local_id */
-      socket_local_id[sock] = false;
-    }
-  }
+  /* Always keep a created socket */
+  com_ip_modem_init_socket_desc(socket_desc);
 
   (void)rtosalMutexRelease(ComSocketsMutexHandle);
 }
 
 /**
   * @brief  Find a socket descriptor
-  * @note   Search the socket descriptor
+  * @note   Direct access to the descriptor from the handle provided to the application
   * @param  sock
-  * @note   socket id
+  * @note   socket handle
   * @param  local
   * @note   true/false
   * @retval socket_desc_t or NULL
@@ -493,36 +518,45 @@ static socket_desc_t *com_ip_modem_find_socket(int32_t sock, bool local)
 {
   socket_desc_t *socket_desc;
 
-  if (sock >= 0)
-  {
-    bool found;
-
-    socket_desc = socket_desc_list;
-    found = false;
+  socket_desc = NULL;
 
-    /* Search the socket descriptor */
-    while ((socket_desc != NULL)
-           && (found != true))
+  if ((sock >= 0)
+      && (COM_SOCKET_HANDLE_INDEX(sock) < COM_SOCKET_DESC_NB)
+      && (sock == COM_SOCKET_HANDLE(COM_SOCKET_HANDLE_INDEX(sock), COM_SOCKET_HANDLE_GEN(sock))))
+  {
+    socket_desc = &socket_desc_pool[COM_SOCKET_HANDLE_INDEX(sock)];
+    /* Descriptor must be in use and not released since the handle was provided */
+    if ((socket_desc->state == COM_SOCKET_INVALID)
+        || (socket_desc->local != local)
+        || (socket_desc->gen != COM_SOCKET_HANDLE_GEN(sock)))
     {
-      if ((socket_desc->id == sock)
-          && (socket_desc->local == local))
-      {
-        /* Socket descriptor is found */
-        found = true;
-      }
-      else
-      {
-        /* Not the searched one ... Next */
-        socket_desc = socket_desc->next;
-      }
+      socket_desc = NULL;
     }
   }
-  else
+
+  return socket_desc;
+}
+
+/**
+  * @brief  Find a socket descriptor from the modem socket handle
+  * @note   Used by the callbacks called by the AT task - no mutex needed
+  * @param  sock
+  * @note   modem socket handle
+  * @retval socket_desc_t or NULL
+  */
+static socket_desc_t *com_ip_modem_find_modem_socket(socket_handle_t sock)
+{
+  socket_desc_t *socket_desc;
+
+  socket_desc = NULL;
+
+  if ((sock >= 0)
+      && ((uint32_t)sock < CELLULAR_MAX_SOCKETS)
+      && (socket_desc_pool[sock].state != COM_SOCKET_INVALID))
   {
-    socket_desc = NULL;
+    socket_desc = &socket_desc_pool[sock];
   }
 
-  /* If found == false then socket_desc = NULL */
   return socket_desc;
 }
 
@@ -557,25 +591,25 @@ static void com_ip_modem_empty_queue(osMessageQId queue)
   */
 static bool com_ip_modem_are_all_sockets_invalid(void)
 {
-  socket_desc_t *socket_desc;
+  uint8_t i;
   bool result; /* false : at least one socket is still open
                   true : all sockets are Invalid */
 
-  socket_desc = socket_desc_list;
+  i = 0U;
   result = true;
 
   /* Search the socket descriptor */
-  while ((socket_desc != NULL)
+  while ((i < COM_SOCKET_DESC_NB)
          && (result != false))
   {
-    if (socket_desc->id > COM_SOCKET_INVALID_ID)
+    if (socket_desc_pool[i].id > COM_SOCKET_INVALID_ID)
     {
       result = false;
     }
     else
     {
       /* Socket is Invalid, check the next one */
-      socket_desc = socket_desc->next;
+      i++;
     }
   }
 
@@ -763,7 +797,7 @@ static uint16_t com_ip_modem_new_local_port(void)
   bool found;
   uint16_t iter;
   uint16_t result;
-  socket_desc_t *socket_desc;
+  uint8_t i;
 
   local_port_ok = false;
   iter = 0U;
@@ -779,21 +813,21 @@ static uint16_t com_ip_modem_new_local_port(void)
       com_local_port = COM_LOCAL_PORT_BEGIN;
     }
 
-    socket_desc = socket_desc_list;
+    i = 0U;
     found = false;
 
     /* See if a socket already created is not using this port */
-    while ((socket_desc != NULL)
+    while ((i < COM_SOCKET_DESC_NB)
            && (found != true))
     {
-      if (socket_desc->local_port == com_local_port)
+      if (socket_desc_pool[i].local_port == com_local_port)
       {
         /* Local port already used */
         found = true;
       }
       else
       {
-        socket_desc = socket_desc->next;
+        i++;
       }
     }
 
@@ -895,105 +929,685 @@ static int32_t com_ip_modem_connect_udp_service(socket_desc_t *socket_desc)
   {
     PRINT_ERR("socket internal connect - err state")
   }
-
-  return (result);
+
+  return (result);
+}
+#endif /* UDP_SERVICE_SUPPORTED == 1U */
+
+/**
+  * @brief  Request Idle mode
+  * @note   -
+  * @param  immediate - false/true
+  * @retval -
+  */
+static void com_ip_modem_idlemode_request(bool immediate)
+{
+#if (USE_LOW_POWER == 1)
+  (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
+
+  if (com_nb_wake_up <= 1U) /* only one socket in progress */
+  {
+    /* Are all sockets closed ?
+       If so, don't arm the timer, immediate request to go in idle */
+    if ((immediate == true)
+        && (com_ip_modem_are_all_sockets_invalid() == true)) /* Should be always true */
+    {
+      com_timer_inactivity_state = COM_TIMER_IDLE;
+      (void)rtosalTimerStop(ComTimerInactivityId);
+      if (com_ip_modem_is_network_up() == true) /* If network is up IdleMode can be requested */
+      {
+        PRINT_INFO("Inactivity: All sockets closed: Timer stopped and IdleMode requested because network is up")
+        if (CSP_DataIdle() == CELLULAR_OK)
+        {
+          PRINT_INFO("Inactivity: IdleMode request OK")
+        }
+        else
+        {
+          /* CSP_DataIdle may be NOK because CSP already in Idle */
+          PRINT_INFO("Inactivity: IdleMode request NOK")
+        }
+      }
+      else
+      {
+        PRINT_INFO("Inactivity: All sockets closed: Timer stopped but IdleMode NOT requested because network is down")
+      }
+    }
+    else
+    {
+      com_timer_inactivity_state = COM_TIMER_RUN;
+      /* Start or Restart timer */
+      (void)rtosalTimerStart(ComTimerInactivityId, COM_TIMER_INACTIVITY_MS);
+      PRINT_INFO("Inactivity: last command finished - Timer re/started")
+    }
+    com_nb_wake_up = 0U;
+  }
+  else /* at least one socket in transaction ping/send/recv... and another finished its action */
+  {
+    /* Improvement : do next treatment only if all sockets in INVALID/CREATING/CREATED state ? */
+    com_timer_inactivity_state = COM_TIMER_RUN;
+    /* Start or Restart timer */
+    (void)rtosalTimerStart(ComTimerInactivityId, COM_TIMER_INACTIVITY_MS);
+    PRINT_INFO("Inactivity: one command finished - Timer re/started")
+    com_nb_wake_up --;
+  }
+  (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
+
+#else /* USE_LOW_POWER == 0 */
+  UNUSED(immediate);
+  /* Nothing to do */
+#endif /* USE_LOW_POWER == 1 */
+}
+
+/**
+  * @brief  Request Wake-Up
+  * @note   -
+  * @param  -
+  * @retval -
+  */
+static void com_ip_modem_wakeup_request(void)
+{
+#if (USE_LOW_POWER == 1)
+  (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
+
+  com_timer_inactivity_state = COM_TIMER_IDLE;
+  (void)rtosalTimerStop(ComTimerInactivityId);
+  com_nb_wake_up++;
+  PRINT_INFO("Inactivity: WakeUp requested - Timer stopped")
+  if (CSP_DataWakeup(HOST_WAKEUP) == CELLULAR_OK)
+  {
+    PRINT_INFO("Inactivity: WakeUp request OK")
+  }
+  else
+  {
+    /* CSP_DataWakeUp may be NOK because CSP already WakeUp */
+    PRINT_INFO("Inactivity: WakeUp request NOK")
+  }
+
+  (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
+#else /* USE_LOW_POWER == 0 */
+  __NOP();
+#endif /* USE_LOW_POWER == 1 */
+}
+
+/**
+  * @brief  Gather data segments for one modem data write
+  * @note   Segments are not copied, a segment bigger than the remaining space is split
+  * @param  iov      - data segments provided by the application
+  * @param  iovcnt   - number of data segments
+  * @param  p_seg    - in: first segment to send - out: next segment to send
+  * @param  p_offset - in: offset in first segment - out: offset in next segment
+  * @param  p_cs_iov - segments to provide to the low level (COM_SENDMSG_IOV_MAX elements)
+  * @param  p_length - total length of the gathered segments
+  * @retval uint8_t  - number of gathered segments
+  */
+static uint8_t com_ip_modem_iov_gather(const com_iovec_t *iov, int32_t iovcnt,
+                                       int32_t *p_seg, uint32_t *p_offset,
+                                       CS_Iovec_t *p_cs_iov, uint32_t *p_length)
+{
+  uint8_t nb_seg;
+  uint32_t size;
+
+  nb_seg = 0U;
+  *p_length = 0U;
+
+  while ((*p_seg < iovcnt)
+         && (nb_seg < COM_SENDMSG_IOV_MAX)
+         && (*p_length < COM_MODEM_MAX_TX_DATA_SIZE))
+  {
+    size = COM_MIN((iov[*p_seg].iov_len - *p_offset), (COM_MODEM_MAX_TX_DATA_SIZE - *p_length));
+    if (size > 0U)
+    {
+      p_cs_iov[nb_seg].p_buf  = &((const CS_CHAR_t *)iov[*p_seg].iov_base)[*p_offset];
+      p_cs_iov[nb_seg].length = size;
+      nb_seg++;
+      *p_length += size;
+      *p_offset += size;
+    }
+    if (*p_offset == iov[*p_seg].iov_len)
+    {
+      /* Segment completely gathered */
+      (*p_seg)++;
+      *p_offset = 0U;
+    }
+  }
+
+  return nb_seg;
+}
+
+/**
+  * @brief  Signal a socket event to the tasks waiting in com_poll
+  * @note   Socket states are checked again by the woken up tasks
+  * @param  -
+  * @retval -
+  */
+static void com_ip_modem_poll_signal(void)
+{
+  for (uint8_t i = 0U; i < COM_POLL_WAITER_NB; i++)
+  {
+    if (com_poll_waiter_used[i] == true)
+    {
+      (void)rtosalSemaphoreRelease(com_poll_waiter_sem[i]);
+    }
+  }
+}
+
+/**
+  * @brief  Check readiness of a set of sockets
+  * @param  fds     - set of sockets and requested events - revents updated
+  * @param  nfds    - number of sockets in fds
+  * @retval int32_t - number of sockets with returned events
+  */
+static int32_t com_ip_modem_poll_check(com_pollfd_t *fds, uint32_t nfds)
+{
+  int32_t nb_ready;
+  int16_t revents;
+  bool readable;
+  bool writable;
+  socket_desc_t *socket_desc;
+
+  nb_ready = 0;
+
+  for (uint32_t i = 0U; i < nfds; i++)
+  {
+    revents = 0;
+
+    if (fds[i].sock >= 0)
+    {
+      socket_desc = com_ip_modem_find_socket(fds[i].sock, false);
+      if ((socket_desc == NULL)
+          || (socket_desc->state == COM_SOCKET_INVALID))
+      {
+        revents = (int16_t)COM_POLLNVAL;
+      }
+      else
+      {
+#if (COM_RCV_PREFETCH == 1)
+        if (socket_desc->type == (uint8_t)COM_SOCK_STREAM)
+        {
+          /* data in the buffer, or data in the modem and no read ongoing (read not queued) */
+          readable = ((socket_desc->rcv_head != socket_desc->rcv_tail) || (socket_desc->rcv_error == true)
+                      || ((socket_desc->rcv_state & (COM_RCV_MORE | COM_RCV_PENDING)) == COM_RCV_MORE));
+        }
+        else
+#endif /* COM_RCV_PREFETCH == 1 */
+        {
+          readable = socket_desc->rcv_ready;
+        }
+        /* UDP socket: connection is implicitly done at first send */
+        writable = ((socket_desc->closing == false)
+                    && (com_ip_modem_is_network_up() == true)
+                    && ((socket_desc->state == COM_SOCKET_CONNECTED)
+                        || ((socket_desc->type == (uint8_t)COM_SOCK_DGRAM)
+                            && (socket_desc->state == COM_SOCKET_CREATED))));
+
+        if ((readable == true) && ((fds[i].events & (int16_t)COM_POLLIN) != 0))
+        {
+          revents |= (int16_t)COM_POLLIN;
+        }
+        if ((writable == true) && ((fds[i].events & (int16_t)COM_POLLOUT) != 0))
+        {
+          revents |= (int16_t)COM_POLLOUT;
+        }
+        if ((socket_desc->closing == true) || (socket_desc->state == COM_SOCKET_CLOSING))
+        {
+          revents |= (int16_t)COM_POLLHUP;
+        }
+        if (com_ip_modem_is_network_up() == false)
+        {
+          revents |= (int16_t)COM_POLLERR;
+        }
+      }
+    }
+
+    fds[i].revents = revents;
+    if (revents != 0)
+    {
+      nb_ready++;
+    }
+  }
+
+  return nb_ready;
+}
+
+#if (COM_RCV_PREFETCH == 1)
+/**
+  * @brief  Update the read state of a socket
+  * @note   Lock free: exclusive load/store of the read state
+  * @param  socket_desc - socket descriptor
+  * @param  clear       - flags to clear
+  * @param  set         - flags to set
+  * @retval uint32_t    - read state before the update
+  */
+static uint32_t com_ip_modem_rcv_state_update(socket_desc_t *socket_desc, uint32_t clear, uint32_t set)
+{
+  uint32_t state;
+
+  do
+  {
+    state = __LDREXW(&socket_desc->rcv_state);
+  } while (__STREXW((state & ~clear) | set, &socket_desc->rcv_state) != 0U);
+
+  return state;
+}
+
+/**
+  * @brief  Claim the read of a socket
+  * @note   Lock free: called by the application and by the data ready callback (AT task)
+  *         the read is claimed if no read is ongoing and the socket is not closing (COM_RCV_STOP)
+  *         the read state then records the socket handle of the descriptor use
+  * @param  socket_desc - socket descriptor
+  * @param  more        - true: if a read is ongoing, a new read will be done at its end
+  * @retval uint32_t    - read state before the claim: read claimed if COM_RCV_PENDING and COM_RCV_STOP not set
+  */
+static uint32_t com_ip_modem_rcv_claim(socket_desc_t *socket_desc, bool more)
+{
+  uint32_t state;
+  uint32_t new_state;
+
+  do
+  {
+    state = __LDREXW(&socket_desc->rcv_state);
+    if ((state & COM_RCV_PENDING) == COM_RCV_PENDING)
+    {
+      new_state = (more == true) ? (state | COM_RCV_MORE) : state;
+    }
+    else if ((state & COM_RCV_STOP) == COM_RCV_STOP)
+    {
+      new_state = state;
+    }
+    else
+    {
+      /* A data ready received during the read will set COM_RCV_MORE again */
+      new_state = COM_RCV_PENDING | ((uint32_t)COM_SOCKET_HANDLE(socket_desc->index, socket_desc->gen)
+                                     & COM_RCV_HANDLE_MASK);
+    }
+  } while (__STREXW(new_state, &socket_desc->rcv_state) != 0U);
+
+  return state;
+}
+
+/**
+  * @brief  Release the read of a socket
+  * @note   Lock free: wake up the socket close waiting the end of the read
+  * @param  socket_desc - socket descriptor
+  * @param  set         - flags to set (COM_RCV_MORE: data may still be available in the modem)
+  * @retval uint32_t    - read state before the release
+  */
+static uint32_t com_ip_modem_rcv_release(socket_desc_t *socket_desc, uint32_t set)
+{
+  uint32_t state;
+
+  state = com_ip_modem_rcv_state_update(socket_desc, COM_RCV_PENDING | COM_RCV_HANDLE_MASK, set);
+  if ((state & COM_RCV_STOP) == COM_RCV_STOP)
+  {
+    /* COM_RCV_STOP set while the read was ongoing: com_ip_modem_rcv_stop() waits the end of the read */
+    (void)rtosalSemaphoreRelease(socket_desc->rcv_stop_sem);
+  }
+
+  return state;
+}
+
+/**
+  * @brief  Start a prefetch read
+  * @note   Data are read from the modem into the socket prefetch buffer
+  *         only one read is ongoing at a time and no read is done when the buffer is full
+  *         (read restarted when the application frees space in the buffer)
+  *         Lock free: called by the data ready callback (AT task)
+  * @param  socket_desc - socket descriptor
+  * @retval bool - true/false a read is ongoing (completion will be notified) / no read ongoing
+  */
+static bool com_ip_modem_rcv_prefetch(socket_desc_t *socket_desc)
+{
+  bool result;
+  uint32_t state;
+  uint32_t head;
+  uint32_t tail;
+  uint32_t length;
+
+  state = com_ip_modem_rcv_claim(socket_desc, true);
+
+  if ((state & COM_RCV_PENDING) == COM_RCV_PENDING)
+  {
+    /* a new read will be done at the end of the ongoing one */
+    result = true;
+  }
+  else if ((state & COM_RCV_STOP) == COM_RCV_STOP)
+  {
+    result = false;
+  }
+  else if ((socket_desc->closing == true)
+           || (socket_desc->state < COM_SOCKET_CONNECTED)
+           || (socket_desc->state == COM_SOCKET_CLOSING))
+  {
+    (void)com_ip_modem_rcv_release(socket_desc, state & COM_RCV_MORE);
+    result = false;
+  }
+  else
+  {
+    /* Contiguous free space from head - head only updated by the read owner */
+    head = socket_desc->rcv_head;
+    tail = socket_desc->rcv_tail;
+    if (head >= tail)
+    {
+      length = (tail == 0U) ? (COM_SOCKETS_RCV_PREFETCH_SIZE - 1U - head) : (COM_SOCKETS_RCV_PREFETCH_SIZE - head);
+    }
+    else
+    {
+      length = tail - head - 1U;
+    }
+    length = COM_MIN(length, COM_MODEM_MAX_RX_DATA_SIZE);
+
+    if (length == 0U)
+    {
+      /* Buffer full - backpressure: read restarted by the application */
+      (void)com_ip_modem_rcv_release(socket_desc, COM_RCV_MORE);
+      result = false;
+    }
+    else if (osCDS_socket_receive_async(socket_desc->id, (CS_CHAR_t *)&socket_desc->rcv_buf[head], length,
+                                        &socket_desc->rcv_length,
+                                        com_ip_modem_rcv_prefetch_cb, (void *)socket_desc) != CELLULAR_OK)
+    {
+      /* Read not queued - will be retried at next data ready or application read */
+      PRINT_ERR("rcv prefetch socket %ld NOK queue", socket_desc->id)
+      (void)com_ip_modem_rcv_release(socket_desc, COM_RCV_MORE);
+      result = false;
+      /* Application waiting for data reads them directly */
+      com_ip_modem_poll_signal();
+      if (socket_desc->state == COM_SOCKET_WAITING_RSP)
+      {
+        com_socket_msg_t msg_queue = 0U;
+        SET_SOCKET_MSG_TYPE(msg_queue, COM_SOCKET_MSG);
+        SET_SOCKET_MSG_ID(msg_queue, COM_DATA_RCV);
+        (void)rtosalMessageQueuePut(socket_desc->queue, msg_queue, 0U);
+      }
+    }
+    else
+    {
+      result = true;
+    }
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Callback called at the end of a prefetch read
+  * @note   Called by Cellular Service request thread
+  *         Continue to read while data are available in the modem and space is available in the buffer
+  * @param  status   - read status
+  * @param  p_cb_ctx - socket descriptor
+  * @retval -
+  */
+static void com_ip_modem_rcv_prefetch_cb(CS_Status_t status, void *p_cb_ctx)
+{
+  socket_desc_t    *socket_desc;
+  com_socket_msg_t msg_queue;
+  uint32_t         head;
+  uint32_t         set;
+  bool             more;
+
+  socket_desc = (socket_desc_t *)p_cb_ctx;
+  msg_queue = 0U;
+  set = 0U;
+
+  if ((socket_desc->rcv_state & COM_RCV_HANDLE_MASK)
+      != ((uint32_t)COM_SOCKET_HANDLE(socket_desc->index, socket_desc->gen) & COM_RCV_HANDLE_MASK))
+  {
+    /* Descriptor released since the read request: data are ignored */
+  }
+  else if ((status == CELLULAR_OK) && (socket_desc->rcv_length > 0))
+  {
+    head = socket_desc->rcv_head + (uint32_t)socket_desc->rcv_length;
+    socket_desc->rcv_head = (head == COM_SOCKETS_RCV_PREFETCH_SIZE) ? 0U : head;
+    /* Modem buffer maybe not empty: continue to read */
+    set = COM_RCV_MORE;
+  }
+  else
+  {
+    if (status != CELLULAR_OK)
+    {
+      socket_desc->rcv_error = true;
+    }
+  }
+  /* Read again if a data ready has been received during the read */
+  more = (((com_ip_modem_rcv_release(socket_desc, set) | set) & COM_RCV_MORE) == COM_RCV_MORE);
+
+  com_ip_modem_poll_signal();
+
+  if (socket_desc->state == COM_SOCKET_WAITING_RSP)
+  {
+    SET_SOCKET_MSG_TYPE(msg_queue, COM_SOCKET_MSG);
+    SET_SOCKET_MSG_ID(msg_queue, COM_DATA_RCV);
+    PRINT_DBG("cb socket %ld MSGput %lu queue %p", socket_desc->id, msg_queue, socket_desc->queue)
+    (void)rtosalMessageQueuePut(socket_desc->queue, msg_queue, 0U);
+  }
+
+  if (more == true)
+  {
+    (void)com_ip_modem_rcv_prefetch(socket_desc);
+  }
+}
+
+/**
+  * @brief  Read data from the socket prefetch buffer
+  * @note   Restart the prefetch read if it was stopped because the buffer was full
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - application data buffer
+  * @param  len         - size of application data buffer
+  * @retval int32_t     - number of bytes read
+  */
+static int32_t com_ip_modem_rcv_buf_read(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len)
+{
+  uint32_t head;
+  uint32_t tail;
+  uint32_t size;
+  uint32_t copied;
+
+  head = socket_desc->rcv_head;
+  tail = socket_desc->rcv_tail;
+  copied = 0U;
+
+  while ((tail != head) && (copied < len))
+  {
+    size = (head > tail) ? (head - tail) : (COM_SOCKETS_RCV_PREFETCH_SIZE - tail);
+    size = COM_MIN(size, len - copied);
+    (void)memcpy((void *)&buf[copied], (const void *)&socket_desc->rcv_buf[tail], size);
+    copied += size;
+    tail += size;
+    if (tail == COM_SOCKETS_RCV_PREFETCH_SIZE)
+    {
+      tail = 0U;
+    }
+  }
+  socket_desc->rcv_tail = tail;
+
+  if ((copied > 0U) && ((socket_desc->rcv_state & COM_RCV_MORE) == COM_RCV_MORE))
+  {
+    /* Space is available again in the buffer */
+    (void)com_ip_modem_rcv_prefetch(socket_desc);
+  }
+
+  return ((int32_t)copied);
+}
+
+/**
+  * @brief  Read data from the modem directly in the application buffer
+  * @note   Used when no prefetch read can be started (socket closing or request not queued)
+  *         The read is done only if the prefetch buffer is empty and no prefetch read is ongoing,
+  *         and no prefetch read can start during the read: data are received in order
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - application data buffer
+  * @param  len         - size of application data buffer
+  * @param  p_len_rcv   - number of bytes received or error value
+  * @retval bool        - true/false read done / not done because a prefetch read is ongoing or data are buffered
+  */
+static bool com_ip_modem_rcv_direct(socket_desc_t *socket_desc, com_char_t *buf, uint32_t len, int32_t *p_len_rcv)
+{
+  bool direct;
+  uint32_t state;
+
+  /* Direct read owns the read: a data ready received during the read only sets COM_RCV_MORE */
+  state = com_ip_modem_rcv_claim(socket_desc, false);
+  direct = ((state & (COM_RCV_PENDING | COM_RCV_STOP)) == 0U);
+  if ((direct == true) && (socket_desc->rcv_head != socket_desc->rcv_tail))
+  {
+    /* Data are buffered: read them first */
+    (void)com_ip_modem_rcv_release(socket_desc, state & COM_RCV_MORE);
+    direct = false;
+  }
+
+  if (direct == true)
+  {
+    *p_len_rcv = osCDS_socket_receive(socket_desc->id, buf, COM_MIN(len, COM_MODEM_MAX_RX_DATA_SIZE));
+
+    if ((com_ip_modem_rcv_release(socket_desc, 0U) & COM_RCV_MORE) == COM_RCV_MORE)
+    {
+      /* Data ready received during the read */
+      (void)com_ip_modem_rcv_prefetch(socket_desc);
+    }
+  }
+
+  return direct;
+}
+
+/**
+  * @brief  Stop / restart the prefetch reads of a socket to close
+  * @note   The prefetch reads are processed by the Cellular Service request thread, not in order with
+  *         the socket close: when stopping, wait the end of the ongoing read, so that it is not processed
+  *         after the modem socket is closed (and maybe re-allocated)
+  *         the end of the read releases rcv_stop_sem if COM_RCV_STOP was set while the read was ongoing
+  * @param  socket_desc - socket descriptor
+  * @param  stop        - true/false stop the reads before the close / restart them after a close failure
+  * @retval -
+  */
+static void com_ip_modem_rcv_stop(socket_desc_t *socket_desc, bool stop)
+{
+  uint32_t state;
+
+  if (stop == true)
+  {
+    state = com_ip_modem_rcv_state_update(socket_desc, 0U, COM_RCV_STOP);
+    if ((state & COM_RCV_PENDING) == COM_RCV_PENDING)
+    {
+      (void)rtosalSemaphoreAcquire(socket_desc->rcv_stop_sem, RTOSAL_WAIT_FOREVER);
+    }
+  }
+  else
+  {
+    state = com_ip_modem_rcv_state_update(socket_desc, COM_RCV_STOP, 0U);
+    if ((state & COM_RCV_MORE) == COM_RCV_MORE)
+    {
+      (void)com_ip_modem_rcv_prefetch(socket_desc);
+    }
+  }
 }
-#endif /* UDP_SERVICE_SUPPORTED == 1U */
 
 /**
-  * @brief  Request Idle mode
-  * @note   -
-  * @param  immediate - false/true
-  * @retval -
+  * @brief  Receive data using the socket prefetch buffer
+  * @note   Data are returned from the prefetch buffer without modem exchange if available
+  *         else, if application accepts to wait, wait for the end of the ongoing read
+  *         and for the next data ready (read directly if no prefetch read can be done)
+  * @param  socket_desc - socket descriptor
+  * @param  buf         - application data buffer
+  * @param  len         - size of application data buffer
+  * @param  flags       - COM_MSG_DONTWAIT or COM_MSG_WAIT
+  * @note   COM_MSG_DONTWAIT: COM_SOCKETS_ERR_WOULDBLOCK returned if no data is available,
+  *         data read by the ongoing prefetch read are returned by a next call
+  * @param  p_len_rcv   - number of bytes received
+  * @retval int32_t     - ok or error value
   */
-static void com_ip_modem_idlemode_request(bool immediate)
+static int32_t com_ip_modem_recv_prefetch(socket_desc_t *socket_desc,
+                                          com_char_t *buf, uint32_t len,
+                                          int32_t flags, int32_t *p_len_rcv)
 {
-#if (USE_LOW_POWER == 1)
-  (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
+  int32_t result;
+  bool read_ongoing;
+  bool wait;
+  uint32_t timeout;
+  com_socket_msg_t msg_queue;
+  rtosalStatus status_queue;
 
-  if (com_nb_wake_up <= 1U) /* only one socket in progress */
+  result = COM_SOCKETS_ERR_OK;
+  /* 1st wait: end of the ongoing read, next waits: next data ready */
+  timeout = RTOSAL_WAIT_FOREVER;
+  *p_len_rcv = com_ip_modem_rcv_buf_read(socket_desc, buf, len);
+
+  while ((*p_len_rcv == 0) && (result == COM_SOCKETS_ERR_OK))
   {
-    /* Are all sockets closed ?
-       If so, don't arm the timer, immediate request to go in idle */
-    if ((immediate == true)
-        && (com_ip_modem_are_all_sockets_invalid() == true)) /* Should be always true */
+    wait = true;
+    read_ongoing = com_ip_modem_rcv_prefetch(socket_desc);
+    if ((read_ongoing == false)
+        && (com_ip_modem_rcv_direct(socket_desc, buf, len, p_len_rcv) == true))
     {
-      com_timer_inactivity_state = COM_TIMER_IDLE;
-      (void)rtosalTimerStop(ComTimerInactivityId);
-      if (com_ip_modem_is_network_up() == true) /* If network is up IdleMode can be requested */
+      /* No read can be ongoing - buffer was empty: data read directly in application buffer */
+      if (*p_len_rcv != 0)
       {
-        PRINT_INFO("Inactivity: All sockets closed: Timer stopped and IdleMode requested because network is up")
-        if (CSP_DataIdle() == CELLULAR_OK)
+        result = (*p_len_rcv < 0) ? COM_SOCKETS_ERR_GENERAL : COM_SOCKETS_ERR_OK;
+        wait = false;
+      }
+      else
+      {
+        /* No data in the modem: wait for next data ready */
+        timeout = socket_desc->rcv_timeout;
+      }
+    }
+
+    if ((wait == true) && (flags == COM_MSG_DONTWAIT))
+    {
+      /* Application don't want to wait: data will be in the buffer at the end of the ongoing read */
+      result = COM_SOCKETS_ERR_WOULDBLOCK;
+      PRINT_INFO("rcv data DONTWAIT would block")
+    }
+    else if (wait == true)
+    {
+      msg_queue = 0U;
+      status_queue = rtosalMessageQueueGet(socket_desc->queue, &msg_queue, timeout);
+      timeout = socket_desc->rcv_timeout;
+      if (status_queue == osEventTimeout)
+      {
+        result = COM_SOCKETS_ERR_TIMEOUT;
+        PRINT_INFO("rcv data exit timeout")
+      }
+      else if ((msg_queue != 0U) && (GET_SOCKET_MSG_TYPE(msg_queue) == COM_SOCKET_MSG))
+      {
+        if (GET_SOCKET_MSG_ID(msg_queue) == COM_DATA_RCV)
         {
-          PRINT_INFO("Inactivity: IdleMode request OK")
+          /* Read completed or not queued: data in the buffer, else read again */
+          *p_len_rcv = com_ip_modem_rcv_buf_read(socket_desc, buf, len);
+          if ((*p_len_rcv == 0) && (socket_desc->rcv_error == true))
+          {
+            socket_desc->rcv_error = false;
+            result = COM_SOCKETS_ERR_GENERAL;
+          }
+        }
+        else if (GET_SOCKET_MSG_ID(msg_queue) == COM_CLOSING_RCV)
+        {
+          result = COM_SOCKETS_ERR_CLOSING;
+          PRINT_INFO("rcv data exit socket closing")
         }
         else
         {
-          /* CSP_DataIdle may be NOK because CSP already in Idle */
-          PRINT_INFO("Inactivity: IdleMode request NOK")
+          /* Impossible case */
+          result = COM_SOCKETS_ERR_GENERAL;
+          PRINT_ERR("rcv data exit NOK impossible case")
         }
       }
       else
       {
-        PRINT_INFO("Inactivity: All sockets closed: Timer stopped but IdleMode NOT requested because network is down")
+        /* Error or empty queue */
+        result = COM_SOCKETS_ERR_GENERAL;
+        PRINT_ERR("rcv data msg NOK or empty queue")
       }
     }
     else
     {
-      com_timer_inactivity_state = COM_TIMER_RUN;
-      /* Start or Restart timer */
-      (void)rtosalTimerStart(ComTimerInactivityId, COM_TIMER_INACTIVITY_MS);
-      PRINT_INFO("Inactivity: last command finished - Timer re/started")
+      /* Data read directly or read error */
     }
-    com_nb_wake_up = 0U;
-  }
-  else /* at least one socket in transaction ping/send/recv... and another finished its action */
-  {
-    /* Improvement : do next treatment only if all sockets in INVALID/CREATING/CREATED state ? */
-    com_timer_inactivity_state = COM_TIMER_RUN;
-    /* Start or Restart timer */
-    (void)rtosalTimerStart(ComTimerInactivityId, COM_TIMER_INACTIVITY_MS);
-    PRINT_INFO("Inactivity: one command finished - Timer re/started")
-    com_nb_wake_up --;
-  }
-  (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
-
-#else /* USE_LOW_POWER == 0 */
-  UNUSED(immediate);
-  /* Nothing to do */
-#endif /* USE_LOW_POWER == 1 */
-}
-
-/**
-  * @brief  Request Wake-Up
-  * @note   -
-  * @param  -
-  * @retval -
-  */
-static void com_ip_modem_wakeup_request(void)
-{
-#if (USE_LOW_POWER == 1)
-  (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
-
-  com_timer_inactivity_state = COM_TIMER_IDLE;
-  (void)rtosalTimerStop(ComTimerInactivityId);
-  com_nb_wake_up++;
-  PRINT_INFO("Inactivity: WakeUp requested - Timer stopped")
-  if (CSP_DataWakeup(HOST_WAKEUP) == CELLULAR_OK)
-  {
-    PRINT_INFO("Inactivity: WakeUp request OK")
-  }
-  else
-  {
-    /* CSP_DataWakeUp may be NOK because CSP already WakeUp */
-    PRINT_INFO("Inactivity: WakeUp request NOK")
   }
 
-  (void)rtosalMutexRelease(ComTimerInactivityMutexHandle);
-#else /* USE_LOW_POWER == 0 */
-  __NOP();
-#endif /* USE_LOW_POWER == 1 */
+  return result;
 }
+#endif /* COM_RCV_PREFETCH == 1 */
 
 /**
   * @brief  Callback called when URC data received raised
@@ -1008,12 +1622,24 @@ static void com_ip_modem_data_received_cb(socket_handle_t sock)
   socket_desc_t    *socket_desc;
 
   msg_queue = 0U;
-  socket_desc = com_ip_modem_find_socket(sock, false);
+  socket_desc = com_ip_modem_find_modem_socket(sock);
 
   if (socket_desc != NULL)
   {
+#if (COM_RCV_PREFETCH == 1)
+    if ((socket_desc->closing != true)
+        && (socket_desc->type == (uint8_t)COM_SOCK_STREAM))
+    {
+      /* Read data now - application is notified at the end of the read */
+      PRINT_INFO("cb socket %ld data ready called: prefetch", socket_desc->id)
+      (void)com_ip_modem_rcv_prefetch(socket_desc);
+    }
+    else
+#endif /* COM_RCV_PREFETCH == 1 */
     if (socket_desc->closing != true)
     {
+      socket_desc->rcv_ready = true;
+      com_ip_modem_poll_signal();
       if (socket_desc->state == COM_SOCKET_WAITING_RSP)
       {
         PRINT_INFO("cb socket %ld data ready called: waiting rsp", socket_desc->id)
@@ -1062,7 +1688,7 @@ static void com_ip_modem_closing_cb(socket_handle_t sock)
   socket_desc_t    *socket_desc;
 
   msg_queue = 0U;
-  socket_desc = com_ip_modem_find_socket(sock, false);
+  socket_desc = com_ip_modem_find_modem_socket(sock);
 
   if (socket_desc != NULL)
   {
@@ -1071,6 +1697,7 @@ static void com_ip_modem_closing_cb(socket_handle_t sock)
     {
       socket_desc->closing = true;
       PRINT_INFO("cb socket closing: close rqt")
+      com_ip_modem_poll_signal();
     }
     if ((socket_desc->state == COM_SOCKET_WAITING_RSP)
         || (socket_desc->state == COM_SOCKET_WAITING_FROM))
@@ -1119,6 +1746,7 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
         {
           com_sockets_network_is_up = true;
           com_sockets_statistic_update(COM_SOCKET_STAT_NWK_UP);
+          com_ip_modem_poll_signal();
 #if (USE_LOW_POWER == 1)
           (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
           com_timer_inactivity_state = COM_TIMER_RUN;
@@ -1135,6 +1763,7 @@ static void com_socket_datacache_cb(dc_com_event_id_t dc_event_id, const void *p
         {
           com_sockets_network_is_up = false;
           com_sockets_statistic_update(COM_SOCKET_STAT_NWK_DWN);
+          com_ip_modem_poll_signal();
 #if (USE_LOW_POWER == 1)
           (void)rtosalMutexAcquire(ComTimerInactivityMutexHandle, RTOSAL_WAIT_FOREVER);
           com_timer_inactivity_state = COM_TIMER_IDLE;
@@ -1396,8 +2025,8 @@ int32_t com_socket_ip_modem(int32_t family, int32_t type, int32_t protocol)
       socket_desc_t *socket_desc;
       PRINT_INFO("create socket ok low level")
 
-      /* Need to create a new socket_desc ? */
-      socket_desc = com_ip_modem_provide_socket_desc(false);
+      /* Descriptor of the modem socket */
+      socket_desc = com_ip_modem_provide_socket_desc(false, sock);
       if (socket_desc == NULL)
       {
         result = COM_SOCKETS_ERR_NOMEMORY;
@@ -1417,11 +2046,13 @@ int32_t com_socket_ip_modem(int32_t family, int32_t type, int32_t protocol)
       else
       {
         /* Update socket descriptor */
-        socket_desc->id    = sock;
         socket_desc->type  = (uint8_t)type;
         socket_desc->state = COM_SOCKET_CREATED;
+        /* From now socket is identified by its descriptor handle */
+        sock = COM_SOCKET_HANDLE(socket_desc->index, socket_desc->gen);
 
-        if (osCDS_socket_set_callbacks(sock, com_ip_modem_data_received_cb, NULL, com_ip_modem_closing_cb)
+        if (osCDS_socket_set_callbacks(socket_desc->id,
+                                       com_ip_modem_data_received_cb, NULL, com_ip_modem_closing_cb)
             == CELLULAR_OK)
         {
           result = COM_SOCKETS_ERR_OK;
@@ -1689,7 +2320,7 @@ int32_t com_bind_ip_modem(int32_t sock,
         result = COM_SOCKETS_ERR_GENERAL;
         PRINT_DBG("socket bind request")
 
-        if (osCDS_socket_bind(sock,
+        if (osCDS_socket_bind(socket_desc->id,
                               socket_addr.port)
             == CELLULAR_OK)
         {
@@ -2061,6 +2692,154 @@ int32_t com_send_ip_modem(int32_t sock,
 }
 
 
+/**
+  * @brief  Socket send data segments
+  * @note   Send data segments on already connected socket
+  *         segments are gathered in one modem data write
+  *         (up to modem maximum data size)
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  iov       - data segments to send
+  * @param  iovcnt    - number of data segments
+  * @param  flags     - options
+  * @note
+  *         - if flags = COM_MSG_DONTWAIT, only one modem data write is done
+  *         - if flags = COM_MSG_WAIT, modem data writes are done until all segments are sent
+  * @retval int32_t   - number of bytes sent or error value
+  */
+int32_t com_sendmsg_ip_modem(int32_t sock,
+                             const com_iovec_t *iov, int32_t iovcnt,
+                             int32_t flags)
+{
+  socket_desc_t *socket_desc;
+  int32_t result;
+  int32_t seg;
+  uint32_t offset;
+  uint32_t length_total;
+
+  result = COM_SOCKETS_ERR_PARAMETER;
+  socket_desc = com_ip_modem_find_socket(sock, false);
+  length_total = 0U;
+
+  if ((iov != NULL)
+      && (iovcnt > 0))
+  {
+    for (seg = 0; seg < iovcnt; seg++)
+    {
+      length_total += iov[seg].iov_len;
+    }
+  }
+
+  if ((socket_desc != NULL)
+      && (length_total > 0U)
+      && (length_total <= (uint32_t)INT32_MAX))
+  {
+    if (socket_desc->state == COM_SOCKET_CONNECTED)
+    {
+#if (UDP_SERVICE_SUPPORTED == 1U)
+      /* send() of a UDP socket is changed to sendto(): a datagram must be sent in one time */
+      if (socket_desc->type == (uint8_t)COM_SOCK_DGRAM)
+      {
+        result = COM_SOCKETS_ERR_UNSUPPORTED;
+        PRINT_ERR("sndmsg data NOK unsupported on UDP socket")
+      }
+      else
+#endif /* UDP_SERVICE_SUPPORTED == 1 */
+      /* closing maybe received, refuse to send data */
+      if (socket_desc->closing == true)
+      {
+        PRINT_ERR("sndmsg data NOK socket closing")
+        result = COM_SOCKETS_ERR_CLOSING;
+      }
+      /* network maybe down, refuse to send data */
+      else if (com_ip_modem_is_network_up() == false)
+      {
+        result = COM_SOCKETS_ERR_NONETWORK;
+        PRINT_ERR("sndmsg data NOK no network")
+      }
+      else
+      {
+        CS_Iovec_t cs_iov[COM_SENDMSG_IOV_MAX];
+        uint8_t nb_seg;
+        int32_t next_seg;
+        uint32_t next_offset;
+        uint32_t length_to_send;
+        uint32_t length_send;
+        bool exit;
+
+        com_ip_modem_wakeup_request();
+
+        seg = 0;
+        offset = 0U;
+        length_send = 0U;
+        exit = false;
+        socket_desc->state = COM_SOCKET_SENDING;
+
+        /* Send all segments - one modem data write for several segments */
+        while ((length_send != length_total)
+               && (exit == false)
+               && (socket_desc->closing == false)
+               && (com_ip_modem_is_network_up() == true)
+               && (socket_desc->state == COM_SOCKET_SENDING))
+        {
+          next_seg = seg;
+          next_offset = offset;
+          nb_seg = com_ip_modem_iov_gather(iov, iovcnt, &next_seg, &next_offset, &cs_iov[0], &length_to_send);
+          com_ip_modem_wakeup_request();
+          /* A tempo is already managed at low-level */
+          if (osCDS_socket_sendv(socket_desc->id, &cs_iov[0], nb_seg)
+              == CELLULAR_OK)
+          {
+            length_send += length_to_send;
+            seg = next_seg;
+            offset = next_offset;
+            PRINT_INFO("sndmsg data ok")
+          }
+          else
+          {
+            socket_desc->state = COM_SOCKET_CONNECTED;
+            PRINT_ERR("sndmsg data NOK at low level")
+          }
+          com_ip_modem_idlemode_request(false);
+          /* Application don't want to wait: only one modem data write */
+          exit = (flags == COM_MSG_DONTWAIT);
+        }
+        socket_desc->state = COM_SOCKET_CONNECTED;
+        result = (length_send > 0U) ? (int32_t)length_send : COM_SOCKETS_ERR_GENERAL;
+
+        com_ip_modem_idlemode_request(false);
+      }
+    }
+    else
+    {
+      PRINT_ERR("sndmsg data NOK err state")
+      if (socket_desc->state < COM_SOCKET_CONNECTED)
+      {
+        result = COM_SOCKETS_ERR_STATE;
+      }
+      else
+      {
+        result = (socket_desc->state == COM_SOCKET_CLOSING) ? \
+                 COM_SOCKETS_ERR_CLOSING : COM_SOCKETS_ERR_INPROGRESS;
+      }
+    }
+
+    /* Update statistic counter */
+    com_sockets_statistic_update((result >= 0) ? COM_SOCKET_STAT_SND_OK : COM_SOCKET_STAT_SND_NOK);
+  }
+
+  if (result >= 0)
+  {
+    SOCKET_SET_ERROR(socket_desc, COM_SOCKETS_ERR_OK);
+  }
+  else
+  {
+    SOCKET_SET_ERROR(socket_desc, result);
+  }
+
+  return (result);
+}
+
+
 /**
   * @brief  Socket send to data
   * @note   Send data to a remote host
@@ -2306,6 +3085,7 @@ int32_t com_sendto_ip_modem(int32_t sock,
   * @param  flags     - options
   * @note   - if flags = COM_MSG_DONTWAIT, application request to not wait
   *         until data are available at low level
+  *         (TCP socket with receive prefetch: COM_SOCKETS_ERR_WOULDBLOCK if no data available)
   *         - if flags = COM_MSG_WAIT, application accept to wait
   *         until data are available at low level with respect of potential
   *         timeout COM_SO_RCVTIMEO setting
@@ -2336,12 +3116,23 @@ int32_t com_recv_ip_modem(int32_t sock,
       uint32_t length_to_read;
       length_to_read = COM_MIN((uint32_t)len, COM_MODEM_MAX_RX_DATA_SIZE);
       socket_desc->state = COM_SOCKET_WAITING_RSP;
+      /* Set again by data ready indication received during the read */
+      socket_desc->rcv_ready = false;
 
       com_ip_modem_wakeup_request();
 
       /* Empty the queue from possible messages */
       com_ip_modem_empty_queue(socket_desc->queue);
 
+#if (COM_RCV_PREFETCH == 1)
+      if (socket_desc->type == (uint8_t)COM_SOCK_STREAM)
+      {
+        /* Data maybe already in prefetch buffer */
+        result = com_ip_modem_recv_prefetch(socket_desc, buf, (uint32_t)len, flags, &len_rcv);
+        socket_desc->state = (result == COM_SOCKETS_ERR_CLOSING) ? COM_SOCKET_CLOSING : COM_SOCKET_CONNECTED;
+      }
+      else
+#endif /* COM_RCV_PREFETCH == 1 */
       if (flags == COM_MSG_DONTWAIT)
       {
 
@@ -2430,6 +3221,12 @@ int32_t com_recv_ip_modem(int32_t sock,
       /* Empty the queue from possible messages */
       com_ip_modem_empty_queue(socket_desc->queue);
 
+      /* Application buffer full: data maybe still available in the modem */
+      if (len_rcv == (int32_t)length_to_read)
+      {
+        socket_desc->rcv_ready = true;
+      }
+
       com_ip_modem_idlemode_request(false);
     }
     else
@@ -2556,6 +3353,8 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
           uint32_t length_to_read;
           length_to_read = COM_MIN((uint32_t)len, COM_MODEM_MAX_RX_DATA_SIZE);
           socket_desc->state = COM_SOCKET_WAITING_FROM;
+          /* Set again by data ready indication received during the read */
+          socket_desc->rcv_ready = false;
 
           /* Empty the queue from possible messages */
           com_ip_modem_empty_queue(socket_desc->queue);
@@ -2658,6 +3457,12 @@ int32_t com_recvfrom_ip_modem(int32_t sock,
 
           /* Empty the queue from possible messages */
           com_ip_modem_empty_queue(socket_desc->queue);
+
+          /* A datagram has been read: others maybe still available in the modem */
+          if (len_rcv > 0)
+          {
+            socket_desc->rcv_ready = true;
+          }
         }
         else
         {
@@ -2724,16 +3529,22 @@ int32_t com_closesocket_ip_modem(int32_t sock)
     {
       result = COM_SOCKETS_ERR_GENERAL;
       com_ip_modem_wakeup_request();
-      if (osCDS_socket_close(sock, 0U)
+#if (COM_RCV_PREFETCH == 1)
+      com_ip_modem_rcv_stop(socket_desc, true);
+#endif /* COM_RCV_PREFETCH == 1 */
+      if (osCDS_socket_close(socket_desc->id, 0U)
           == CELLULAR_OK)
       {
-        com_ip_modem_delete_socket_desc(sock, false);
+        com_ip_modem_delete_socket_desc(socket_desc);
         result = COM_SOCKETS_ERR_OK;
         PRINT_INFO("close socket ok")
       }
       else
       {
         PRINT_INFO("close socket NOK low level")
+#if (COM_RCV_PREFETCH == 1)
+        com_ip_modem_rcv_stop(socket_desc, false);
+#endif /* COM_RCV_PREFETCH == 1 */
       }
       com_ip_modem_idlemode_request(true);
     }
@@ -2746,6 +3557,94 @@ int32_t com_closesocket_ip_modem(int32_t sock)
 }
 
 
+/**
+  * @brief  Socket poll
+  * @note   Wait until one of the requested events occurs on a set of sockets
+  *         events are raised by modem data ready / socket closing indications
+  *         and by network status change
+  * @param  fds       - set of sockets and requested events
+  * @param  nfds      - number of sockets in fds
+  * @param  timeout   - maximum time to wait (in ms)
+  * @note   0: no wait - negative value: wait forever
+  * @retval int32_t   - number of sockets with returned events (0 if timeout) or error value
+  */
+int32_t com_poll_ip_modem(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  int32_t result;
+  uint8_t waiter;
+  uint32_t start;
+  uint32_t elapsed;
+  bool exit;
+
+  if ((fds == NULL) || (nfds == 0U))
+  {
+    result = COM_SOCKETS_ERR_PARAMETER;
+  }
+  else
+  {
+    /* Reserve a waiter to be woken up on socket events */
+    (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+    waiter = 0U;
+    while ((waiter < COM_POLL_WAITER_NB)
+           && (com_poll_waiter_used[waiter] == true))
+    {
+      waiter++;
+    }
+    if (waiter < COM_POLL_WAITER_NB)
+    {
+      com_poll_waiter_used[waiter] = true;
+    }
+    (void)rtosalMutexRelease(ComSocketsMutexHandle);
+
+    if (waiter == COM_POLL_WAITER_NB)
+    {
+      PRINT_ERR("poll NOK too many waiting tasks")
+      result = COM_SOCKETS_ERR_NOMEMORY;
+    }
+    else
+    {
+      start = rtosalGetSysTimerCount();
+      exit = false;
+      result = 0;
+
+      while (exit == false)
+      {
+        /* Consume a previous event: socket states are checked just after */
+        (void)rtosalSemaphoreAcquire(com_poll_waiter_sem[waiter], 0U);
+
+        result = com_ip_modem_poll_check(fds, nfds);
+        if ((result > 0) || (timeout == 0))
+        {
+          exit = true;
+        }
+        else if (timeout < 0)
+        {
+          (void)rtosalSemaphoreAcquire(com_poll_waiter_sem[waiter], RTOSAL_WAIT_FOREVER);
+        }
+        else
+        {
+          elapsed = rtosalGetSysTimerCount() - start;
+          if (elapsed >= (uint32_t)timeout)
+          {
+            exit = true;
+          }
+          else
+          {
+            (void)rtosalSemaphoreAcquire(com_poll_waiter_sem[waiter], (uint32_t)timeout - elapsed);
+          }
+        }
+      }
+
+      (void)rtosalMutexAcquire(ComSocketsMutexHandle, RTOSAL_WAIT_FOREVER);
+      com_poll_waiter_used[waiter] = false;
+      (void)rtosalMutexRelease(ComSocketsMutexHandle);
+    }
+  }
+
+  return result;
+}
+
+
 /*** Other functionalities ****************************************************/
 
 /**
@@ -2862,8 +3761,8 @@ int32_t com_ping_ip_modem(void)
   int32_t result;
   socket_desc_t *socket_desc;
 
-  /* Need to create a new socket_desc ? */
-  socket_desc = com_ip_modem_provide_socket_desc(true);
+  /* Need a local socket_desc */
+  socket_desc = com_ip_modem_provide_socket_desc(true, CS_INVALID_SOCKET_HANDLE);
   if (socket_desc == NULL)
   {
     result = COM_SOCKETS_ERR_NOMEMORY;
@@ -2880,7 +3779,7 @@ int32_t com_ping_ip_modem(void)
     com_ip_modem_wakeup_request(); /* to avoid to be stopped by a close socket */
   }
 
-  return ((result == COM_SOCKETS_ERR_OK) ? socket_desc->id : result);
+  return ((result == COM_SOCKETS_ERR_OK) ? COM_SOCKET_HANDLE(socket_desc->index, socket_desc->gen) : result);
 }
 
 
@@ -2956,8 +3855,8 @@ int32_t com_ping_process_ip_modem(int32_t ping,
       }
       else
       {
-        /* No ping in progress => assign id to ping_socket_id */
-        ping_socket_id = socket_desc->id;
+        /* No ping in progress => assign handle to ping_socket_id */
+        ping_socket_id = ping;
         /* result already set to the correct value COM_SOCKETS_ERR_OK */
       }
       (void)rtosalMutexRelease(ComSocketsMutexHandle);
@@ -3109,7 +4008,7 @@ int32_t com_ping_process_ip_modem(int32_t ping,
 int32_t com_closeping_ip_modem(int32_t ping)
 {
   int32_t result;
-  const socket_desc_t *socket_desc;
+  socket_desc_t *socket_desc;
 
   result = COM_SOCKETS_ERR_PARAMETER;
   socket_desc = com_ip_modem_find_socket(ping, true);
@@ -3125,7 +4024,7 @@ int32_t com_closeping_ip_modem(int32_t ping)
     }
     else
     {
-      com_ip_modem_delete_socket_desc(ping, true);
+      com_ip_modem_delete_socket_desc(socket_desc);
       result = COM_SOCKETS_ERR_OK;
       PRINT_INFO("close ping ok")
       com_ip_modem_idlemode_request(true); /* same behavior than all sockets closed */
@@ -3161,20 +4060,37 @@ bool com_init_ip_modem(void)
   ping_socket_id = COM_SOCKET_INVALID_ID;
 #endif /* USE_COM_PING == 1 */
 
-  for (uint8_t i = 0U; i < COM_SOCKET_LOCAL_ID_NB; i++)
+  /* Initialize com_poll waiters - semaphores are created taken */
+  for (uint8_t i = 0U; i < COM_POLL_WAITER_NB; i++)
   {
-    socket_local_id[i] = false; /* set socket local id to unused */
+    com_poll_waiter_used[i] = false;
+    com_poll_waiter_sem[i] = rtosalSemaphoreNew(NULL, 1U);
+    if (com_poll_waiter_sem[i] != NULL)
+    {
+      (void)rtosalSemaphoreAcquire(com_poll_waiter_sem[i], RTOSAL_WAIT_FOREVER);
+    }
   }
 
-  /* Initialize Mutex to protect socket descriptor list access */
+  /* Initialize Mutex to protect socket descriptor allocation */
   ComSocketsMutexHandle = rtosalMutexNew(NULL);
   if (ComSocketsMutexHandle != NULL)
   {
-    /* Create always the first element of the list */
-    socket_desc_list = com_ip_modem_create_socket_desc();
-    if (socket_desc_list != NULL)
+    /* Create all the elements of the pool */
+    result = true;
+    for (uint8_t i = 0U; i < COM_SOCKET_DESC_NB; i++)
     {
-      result = true;
+      if (com_ip_modem_create_socket_desc(&socket_desc_pool[i], i) == false)
+      {
+        result = false;
+      }
+    }
+  }
+
+  for (uint8_t i = 0U; i < COM_POLL_WAITER_NB; i++)
+  {
+    if (com_poll_waiter_sem[i] == NULL)
+    {
+      result = false;
     }
   }
 
@@ -3213,7 +4129,8 @@ bool com_init_ip_modem(void)
 void com_start_ip_modem(void)
 {
   /* Datacache registration for netwok on/off status */
-  (void)dc_com_core_register_gen_event_cb(&dc_com_db, com_socket_datacache_cb, (void *)NULL);
+  (void)dc_com_core_register_entry_cb(&dc_com_db, DC_COM_RES_MASK(DC_CELLULAR_NIFMAN_INFO),
+                                      com_socket_datacache_cb, (void *)NULL);
 
 #if (UDP_SERVICE_SUPPORTED == 1U)
   uint32_t random;
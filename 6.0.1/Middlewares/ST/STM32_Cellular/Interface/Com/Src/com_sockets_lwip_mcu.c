@@ -21,9 +21,12 @@
 #include "com_sockets_lwip_mcu.h"
 
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
+#include <string.h>
+
 #include "rtosal.h"
 
 #include "com_sockets_net_compat.h"
+#include "com_sockets_err_compat.h"
 #include "com_trace.h"
 
 /* LwIP is a Third Party so MISRAC messages linked to it are ignored */
@@ -45,6 +48,9 @@
 #define COM_PING_RSP_LEN_MAX        80U /* in bytes */
 #endif /* USE_COM_PING == 1 */
 
+/* Maximum number of sockets polled in one com_poll call: one entry per netconn */
+#define COM_POLL_NFDS_MAX   ((uint32_t)MEMP_NUM_NETCONN)
+
 /* Private typedef -----------------------------------------------------------*/
 typedef char COM_SOCKETS_IP_CHAR_t; /* used in lwip service call */
 
@@ -199,6 +205,31 @@ int32_t com_send_lwip_mcu(int32_t sock,
 }
 
 
+/**
+  * @brief  Socket send data segments
+  * @note   Send data segments on already connected socket
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  sock      - socket handle obtained with com_socket
+  * @param  iov       - data segments to send
+  * @param  iovcnt    - number of data segments
+  * @param  flags     - options
+  * @retval int32_t   - number of bytes sent or error value
+  */
+int32_t com_sendmsg_lwip_mcu(int32_t sock,
+                             const com_iovec_t *iov, int32_t iovcnt,
+                             int32_t flags)
+{
+  struct msghdr msg;
+
+  (void)memset((void *)&msg, 0, sizeof(msg));
+  /* LwIP doesn't modify the segments */
+  msg.msg_iov    = (struct iovec *)iov;
+  msg.msg_iovlen = (int)iovcnt;
+
+  return lwip_sendmsg(sock, &msg, flags);
+}
+
+
 /**
   * @brief  Socket send to data
   * @note   Send data to a remote host
@@ -272,6 +303,46 @@ int32_t com_closesocket_lwip_mcu(int32_t sock)
 }
 
 
+/**
+  * @brief  Socket poll
+  * @note   Wait for readiness events on a set of sockets
+  *         Restrictions, if any, are linked to LwIP module used
+  * @param  fds       - array of sockets and requested events, revents updated on return
+  * @param  nfds      - number of elements in fds (max COM_POLL_NFDS_MAX)
+  * @param  timeout   - in ms, 0: no wait, < 0: wait forever
+  * @retval int32_t   - number of ready sockets, 0 on timeout or error value
+  */
+int32_t com_poll_lwip_mcu(com_pollfd_t *fds, uint32_t nfds, int32_t timeout)
+{
+  int32_t result;
+  uint32_t i;
+  struct pollfd lwip_fds[COM_POLL_NFDS_MAX];
+
+  if ((fds == NULL) || (nfds == 0U) || (nfds > COM_POLL_NFDS_MAX))
+  {
+    result = COM_SOCKETS_ERR_PARAMETER;
+  }
+  else
+  {
+    for (i = 0U; i < nfds; i++)
+    {
+      lwip_fds[i].fd = (int)fds[i].sock;
+      lwip_fds[i].events = (short)fds[i].events;
+      lwip_fds[i].revents = 0;
+    }
+
+    result = lwip_poll(lwip_fds, (nfds_t)nfds, (timeout < 0) ? -1 : (int)timeout);
+
+    for (i = 0U; i < nfds; i++)
+    {
+      fds[i].revents = (int16_t)lwip_fds[i].revents;
+    }
+  }
+
+  return result;
+}
+
+
 /*** Other functionalities ****************************************************/
 
 /**
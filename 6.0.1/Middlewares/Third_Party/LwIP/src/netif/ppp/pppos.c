@@ -51,6 +51,15 @@
 #include "netif/ppp/pppos.h"
 #include "netif/ppp/vj.h"
 
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#ifndef PPPOS_FAST_HDLC
+#define PPPOS_FAST_HDLC 0
+#endif /* PPPOS_FAST_HDLC */
+#if PPPOS_FAST_HDLC
+#include "ppposif_hdlc.h"
+#endif /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
+
 /* Memory pool */
 LWIP_MEMPOOL_DECLARE(PPPOS_PCB, MEMP_NUM_PPPOS_INTERFACES, sizeof(pppos_pcb), "PPPOS_PCB")
 
@@ -74,6 +83,11 @@ static void pppos_input_free_current_packet(pppos_pcb *pppos);
 static void pppos_input_drop(pppos_pcb *pppos);
 static err_t pppos_output_append(pppos_pcb *pppos, err_t err, struct pbuf *nb, u8_t c, u8_t accm, u16_t *fcs);
 static err_t pppos_output_last(pppos_pcb *pppos, err_t err, struct pbuf *nb, u16_t *fcs);
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#if PPPOS_FAST_HDLC
+static err_t pppos_output_append_block(pppos_pcb *pppos, err_t err, struct pbuf *nb, const u8_t *s, u16_t len, u16_t *fcs);
+#endif /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
 
 /* Callbacks structure for PPP core */
 static const struct link_callbacks pppos_callbacks = {
@@ -234,9 +248,17 @@ pppos_write(ppp_pcb *ppp, void *ctx, struct pbuf *p)
   fcs_out = PPP_INITFCS;
   s = (u8_t*)p->payload;
   n = p->len;
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#if PPPOS_FAST_HDLC
+  err = pppos_output_append_block(pppos, err, nb, s, n, &fcs_out);
+#else /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
   while (n-- > 0) {
     err = pppos_output_append(pppos, err,  nb, *s++, 1, &fcs_out);
   }
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#endif /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
 
   err = pppos_output_last(pppos, err, nb, &fcs_out);
   if (err == ERR_OK) {
@@ -295,9 +317,17 @@ pppos_netif_output(ppp_pcb *ppp, void *ctx, struct pbuf *pb, u16_t protocol)
     u16_t n = p->len;
     u8_t *s = (u8_t*)p->payload;
 
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#if PPPOS_FAST_HDLC
+    err = pppos_output_append_block(pppos, err, nb, s, n, &fcs_out);
+#else /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
     while (n-- > 0) {
       err = pppos_output_append(pppos, err,  nb, *s++, 1, &fcs_out);
     }
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#endif /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
   }
 
   err = pppos_output_last(pppos, err, nb, &fcs_out);
@@ -488,6 +518,28 @@ pppos_input(ppp_pcb *ppp, u8_t *s, int l)
 
   PPPDEBUG(LOG_DEBUG, ("pppos_input[%d]: got %d bytes\n", ppp->netif->num, l));
   while (l-- > 0) {
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#if PPPOS_FAST_HDLC
+    /* Data characters which are not escaped are copied by runs in the current pbuf */
+    if ((pppos->in_state == PDDATA) && !pppos->in_escaped && (pppos->in_tail != NULL)) {
+      u16_t run = 0;
+      PPPOS_PROTECT(lev);
+      if (pppos->open) {
+        run = (u16_t)ppposif_hdlc_unescaped_len(pppos->in_accm, s,
+                                                (u32_t)LWIP_MIN(l + 1, PBUF_POOL_BUFSIZE - pppos->in_tail->len));
+      }
+      PPPOS_UNPROTECT(lev);
+      if (run > 0) {
+        MEMCPY((u8_t*)pppos->in_tail->payload + pppos->in_tail->len, s, run);
+        pppos->in_tail->len += run;
+        pppos->in_fcs = ppposif_hdlc_fcs(pppos->in_fcs, s, run);
+        s += run;
+        l -= run - 1;
+        continue;
+      }
+    }
+#endif /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
     cur_char = *s++;
 
     PPPOS_PROTECT(lev);
@@ -853,6 +905,46 @@ pppos_output_append(pppos_pcb *pppos, err_t err, struct pbuf *nb, u8_t c, u8_t a
   return ERR_OK;
 }
 
+/* STMicroelectronics local patch begin: PPPOS_FAST_HDLC (see st_readme.txt) */
+#if PPPOS_FAST_HDLC
+/*
+ * pppos_output_append_block - append a block of data to the output buffer,
+ * escaping it with out_accm and updating fcs: same output as pppos_output_append()
+ * called for each character, the characters which are not escaped are copied by runs.
+ */
+static err_t
+pppos_output_append_block(pppos_pcb *pppos, err_t err, struct pbuf *nb, const u8_t *s, u16_t len, u16_t *fcs)
+{
+  u16_t room;
+  u16_t run;
+
+  if (err != ERR_OK) {
+    return err;
+  }
+
+  *fcs = ppposif_hdlc_fcs(*fcs, s, len);
+
+  while ((len > 0) && (err == ERR_OK)) {
+    /* pppos_output_append() sends the pbuf when less than 2 bytes are free */
+    room = (nb->len < (PBUF_POOL_BUFSIZE - 1)) ? (u16_t)(PBUF_POOL_BUFSIZE - 1 - nb->len) : 0;
+    run = (u16_t)ppposif_hdlc_unescaped_len(pppos->out_accm, s, LWIP_MIN(len, room));
+    if (run > 0) {
+      MEMCPY((u8_t*)nb->payload + nb->len, s, run);
+      nb->len += run;
+      s += run;
+      len -= run;
+    } else {
+      /* character to escape or output buffer full */
+      err = pppos_output_append(pppos, err, nb, *s++, 1, NULL);
+      len--;
+    }
+  }
+
+  return err;
+}
+#endif /* PPPOS_FAST_HDLC */
+/* STMicroelectronics local patch end */
+
 static err_t
 pppos_output_last(pppos_pcb *pppos, err_t err, struct pbuf *nb, u16_t *fcs)
 {
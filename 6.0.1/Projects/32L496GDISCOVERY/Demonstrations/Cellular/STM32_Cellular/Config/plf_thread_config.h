@@ -40,6 +40,18 @@ extern "C" {
 #define ATCORE_THREAD_STACK_PRIO           osPriorityNormal
 #define CELLULAR_SERVICE_THREAD_PRIO       osPriorityNormal
 
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+#define CELLULAR_SERVICE_REQ_THREAD_PRIO   osPriorityNormal
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
+
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+#define DC_COM_NOTIF_THREAD_PRIO           osPriorityBelowNormal
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
+
+#if (TRACE_IF_TRACES_BIN == 1U)
+#define TRACE_IF_BIN_THREAD_PRIO           osPriorityLow
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
 #define TCPIP_THREAD_PRIO                  osPriorityBelowNormal
 #define PPPOSIF_CLIENT_THREAD_PRIO         osPriorityHigh
@@ -62,12 +74,36 @@ extern "C" {
 #define FREERTOS_IDLE_THREAD_STACK_SIZE     (128U)
 #define FREERTOS_IDLE_THREAD_NB             (1U)
 
-#define ATCORE_THREAD_STACK_SIZE            (384U)
+#define ATCORE_THREAD_STACK_SIZE            (512U)
 #define ATCORE_THREAD_NB                    (1U)
 
 #define CELLULAR_SERVICE_THREAD_STACK_SIZE  (512U)
 #define CELLULAR_SERVICE_THREAD_NB          (1U)
 
+#if (USE_CELLULAR_SERVICE_ASYNC_REQ == 1)
+#define CELLULAR_SERVICE_REQ_THREAD_STACK_SIZE  (512U)
+#define CELLULAR_SERVICE_REQ_THREAD_NB          (1U)
+#else
+#define CELLULAR_SERVICE_REQ_THREAD_STACK_SIZE  (0U)
+#define CELLULAR_SERVICE_REQ_THREAD_NB          (0U)
+#endif /* USE_CELLULAR_SERVICE_ASYNC_REQ == 1 */
+
+#if (USE_DC_COM_DEFERRED_NOTIF == 1)
+#define DC_COM_NOTIF_THREAD_STACK_SIZE      (512U)
+#define DC_COM_NOTIF_THREAD_NB              (1U)
+#else
+#define DC_COM_NOTIF_THREAD_STACK_SIZE      (0U)
+#define DC_COM_NOTIF_THREAD_NB              (0U)
+#endif /* USE_DC_COM_DEFERRED_NOTIF == 1 */
+
+#if (TRACE_IF_TRACES_BIN == 1U)
+#define TRACE_IF_BIN_THREAD_STACK_SIZE      (256U)
+#define TRACE_IF_BIN_THREAD_NB              (1U)
+#else
+#define TRACE_IF_BIN_THREAD_STACK_SIZE      (0U)
+#define TRACE_IF_BIN_THREAD_NB              (0U)
+#endif /* TRACE_IF_TRACES_BIN == 1U */
+
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_LWIP)
 /* check value in FreeRTOSConfig.h */
 #define TCPIP_THREAD_STACK_SIZE             (512U)
@@ -116,6 +152,9 @@ extern "C" {
             +FREERTOS_IDLE_THREAD_STACK_SIZE       \
             +ATCORE_THREAD_STACK_SIZE              \
             +CELLULAR_SERVICE_THREAD_STACK_SIZE    \
+            +CELLULAR_SERVICE_REQ_THREAD_STACK_SIZE \
+            +DC_COM_NOTIF_THREAD_STACK_SIZE        \
+            +TRACE_IF_BIN_THREAD_STACK_SIZE        \
             +CMD_THREAD_STACK_SIZE                 \
             +TCPIP_THREAD_STACK_SIZE               \
             +PPPOSIF_CLIENT_THREAD_STACK_SIZE      )
@@ -125,6 +164,9 @@ extern "C" {
              +FREERTOS_IDLE_THREAD_NB              \
              +ATCORE_THREAD_NB                     \
              +CELLULAR_SERVICE_THREAD_NB           \
+             +CELLULAR_SERVICE_REQ_THREAD_NB       \
+             +DC_COM_NOTIF_THREAD_NB               \
+             +TRACE_IF_BIN_THREAD_NB               \
              +CMD_THREAD_NB                        \
              +TCPIP_THREAD_NB                      \
              +PPPOSIF_CLIENT_THREAD_NB             )
@@ -69,6 +69,32 @@ extern "C" {
 #define USE_COM_ICC               (1)  /* 0: not included, 1: included */
 #endif /* !defined USE_COM_ICC */
 
+/* If activated then ATCore task is signaled once for a burst of received AT messages (instead of once per message)
+   and parses all the complete messages available at each wake-up */
+#if !defined USE_AT_CORE_RX_BATCH
+#define USE_AT_CORE_RX_BATCH      (0)  /* 0: not activated, 1: activated */
+#endif /* !defined USE_AT_CORE_RX_BATCH */
+
+/* If activated then asynchronous osCDS services (with completion callback) are available:
+   requests are queued and executed by a dedicated thread, the synchronous variants of these services
+   are still executed by the calling thread */
+#if !defined USE_CELLULAR_SERVICE_ASYNC_REQ
+#define USE_CELLULAR_SERVICE_ASYNC_REQ (0)  /* 0: not activated, 1: activated */
+#endif /* !defined USE_CELLULAR_SERVICE_ASYNC_REQ */
+
+/* If activated then a control plane request of the Cellular Service (registration, attach, ...) lets the data plane
+   requests (socket operations) waiting for the lock run at the step boundaries of its AT transaction, instead of
+   keeping the modem until the end of the transaction (the modem decides which transactions can be suspended) */
+#if !defined USE_CELLULAR_SERVICE_CTRL_YIELD
+#define USE_CELLULAR_SERVICE_CTRL_YIELD (0)  /* 0: not activated, 1: activated */
+#endif /* !defined USE_CELLULAR_SERVICE_CTRL_YIELD */
+
+/* If activated then Data Cache application consumers are notified by a dedicated thread instead of the writing
+   thread: successive writes of an entry not yet notified produce one notification */
+#if !defined USE_DC_COM_DEFERRED_NOTIF
+#define USE_DC_COM_DEFERRED_NOTIF (0)  /* 0: not activated, 1: activated */
+#endif /* !defined USE_DC_COM_DEFERRED_NOTIF */
+
 /* ======================================= */
 /* END   -  Miscellaneous functionalities  */
 /* ======================================= */
@@ -35,6 +35,7 @@ extern "C" {
 #include "main.h"
 #include "plf_modem_config.h"
 #include "usart.h" /* for huartX */
+#include "rtc.h" /* for hrtc */
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -107,6 +108,9 @@ extern "C" {
 #define CS_DISP_PIN GPIO_PIN_2
 #define CS_DISP_GPIO_PORT GPIOB
 
+/* RTC: backup registers of the modem configuration cache (see MODEM_CFG_CACHE_RTC_BKP_FIRST) */
+#define MODEM_CFG_CACHE_RTC_HANDLE      hrtc
+
 /* Exported types ------------------------------------------------------------*/
 
 /* External variables --------------------------------------------------------*/
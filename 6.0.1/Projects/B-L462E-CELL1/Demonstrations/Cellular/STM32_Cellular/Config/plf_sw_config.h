@@ -39,6 +39,16 @@ extern "C" {
 #define USER_DEFINED_IPC_DEVICE_MODEM       (IPC_DEVICE_0)
 /* IPC config END */
 
+/* AT Core: max number of AT requests (AT_sendcmd, AT_sendcmd_async) queued at the same time */
+#if !defined ATCORE_REQ_NB
+#define ATCORE_REQ_NB                       (4U)
+#endif /* !defined ATCORE_REQ_NB */
+
+/* Cellular Service: max number of pending asynchronous requests (used if USE_CELLULAR_SERVICE_ASYNC_REQ == 1) */
+#if !defined CS_ASYNC_REQ_QUEUE_SIZE
+#define CS_ASYNC_REQ_QUEUE_SIZE             (4U)
+#endif /* !defined CS_ASYNC_REQ_QUEUE_SIZE */
+
 /* Polling modem period */
 #if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
 #define CST_MODEM_POLLING_PERIOD            (10000U)  /* Polling period = 10s */
@@ -57,6 +67,28 @@ extern "C" {
 #define COM_SOCKETS_STATISTIC               (1U) /* 0: not activated, 1: activated */
 #endif /* !defined COM_SOCKETS_STATISTIC */
 
+/* If COM_SOCKETS_RCV_PREFETCH_SIZE > 0 then for USE_SOCKETS_TYPE == USE_SOCKETS_MODEM
+   TCP data are read from the modem as soon as the modem indicates data are ready
+   and stored in a receive buffer of COM_SOCKETS_RCV_PREFETCH_SIZE bytes per socket
+   (requires USE_CELLULAR_SERVICE_ASYNC_REQ == 1) */
+#if !defined COM_SOCKETS_RCV_PREFETCH_SIZE
+#define COM_SOCKETS_RCV_PREFETCH_SIZE       (0U) /* 0: not activated, else buffer size in bytes */
+#endif /* !defined COM_SOCKETS_RCV_PREFETCH_SIZE */
+
+/* Modem configuration cache: modem settings already committed to the modem non-volatile memory
+   (PDN definition) are not sent again at modem init when they have not changed.
+   By default the cache is lost on MCU reset, to keep it over MCU reset place it in a RAM section
+   not initialized at startup (the section has to be defined in the linker file) */
+/* #define MODEM_CFG_CACHE_SECTION             __attribute__((section(".noinit"))) */
+/* or save it in the RTC backup registers (kept over MCU reset and in standby/shutdown while VDD or VBAT is present):
+   MODEM_CFG_CACHE_RTC_BKP_FIRST is the first register used, the cache uses (3 + 6 PDN configurations) = 9 registers
+   (23 to 31 of the 32 RTC backup registers), the 9 registers are rewritten after each PDN definition sent to the modem
+   and read once after MCU reset. The RTC (MODEM_CFG_CACHE_RTC_HANDLE in plf_hw_config.h) has to be initialized
+   with the backup domain write access enabled before the modem init. */
+#if !defined MODEM_CFG_CACHE_RTC_BKP_FIRST
+#define MODEM_CFG_CACHE_RTC_BKP_FIRST       (23U)
+#endif /* !defined MODEM_CFG_CACHE_RTC_BKP_FIRST */
+
 /* ======================= */
 /* END - Miscellaneous     */
 /* ======================= */
@@ -75,6 +107,10 @@ extern "C" {
 /* Trace channels: ITM, UART or Printf */
 #define TRACE_IF_TRACES_ITM                 (1U) /* trace_interface module send traces to ITM */
 #define TRACE_IF_TRACES_UART                (1U) /* trace_interface module send traces to UART */
+#if !defined TRACE_IF_TRACES_BIN
+#define TRACE_IF_TRACES_BIN                 (0U) /* if set to 1, traces recorded in binary and sent on UART by a low
+                                                    priority thread (decoded on host, see trace_interface.h) */
+#endif /* !defined TRACE_IF_TRACES_BIN */
 #define USE_PRINTF                          (0U) /* if set to 1, use printf instead of trace_interface module */
 
 /* Trace masks allowed */
@@ -110,6 +146,10 @@ extern "C" {
 /* Trace channels: ITM, UART or Printf */
 #define TRACE_IF_TRACES_ITM                 (1U) /* trace_interface module send traces to ITM */
 #define TRACE_IF_TRACES_UART                (1U) /* trace_interface module send traces to UART */
+#if !defined TRACE_IF_TRACES_BIN
+#define TRACE_IF_TRACES_BIN                 (0U) /* if set to 1, traces recorded in binary and sent on UART by a low
+                                                    priority thread (decoded on host, see trace_interface.h) */
+#endif /* !defined TRACE_IF_TRACES_BIN */
 #define USE_PRINTF                          (0U) /* if set to 1, use printf instead of trace_interface module */
 
 /* Trace masks allowed */
@@ -35,6 +35,7 @@ extern "C" {
 #include "main.h"
 #include "plf_modem_config.h"
 #include "usart.h" /* for huartX */
+#include "rtc.h" /* for hrtc */
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -132,6 +133,9 @@ extern "C" {
 #include "stm32l462e_cell1_env_sensors.h"
 #endif /* USE_SENSORS == 1 */
 
+/* RTC: backup registers of the modem configuration cache (see MODEM_CFG_CACHE_RTC_BKP_FIRST) */
+#define MODEM_CFG_CACHE_RTC_HANDLE      hrtc
+
 /* Exported types ------------------------------------------------------------*/
 
 /* External variables --------------------------------------------------------*/
@@ -48,6 +48,30 @@ extern "C" {
 /* IPC_RXBUF_MAXSIZE and IPC_RXBUF_STREAM_MAXSIZE are defined above */
 #define IPC_RXBUF_THRESHOLD  ((uint16_t) 20U)
 
+/* UART reception mode
+ * 0: one interrupt per received character (default)
+ * 1: circular DMA reception with half/full transfer and idle line events, characters are pushed to the RX queue
+ *    by blocks (requires a DMA channel configured in circular mode and linked to the modem UART hdmarx)
+ */
+#if !defined IPC_USE_UART_DMA_RX
+#define IPC_USE_UART_DMA_RX      (0U)
+#endif /* !defined IPC_USE_UART_DMA_RX */
+#define IPC_UART_DMA_RXBUF_SIZE  ((uint16_t) 256U) /* size of the circular DMA buffer (if used) */
+
+/* UART transmission mode
+ * 0: IPC_send() transmits the caller buffer, the caller waits for the TX complete callback (default)
+ * 1: IPC_send() copies data in a queue of IPC_TXQUEUE_NB buffers and returns as soon as they are queued,
+ *    the transmission of a buffer overlaps the preparation of the next one
+ *    (TX complete callback is called for each buffer sent, tasks sending on the same UART are serialized)
+ */
+#if !defined IPC_USE_TX_QUEUE
+#define IPC_USE_TX_QUEUE         (0U)
+#endif /* !defined IPC_USE_TX_QUEUE */
+#define IPC_TXQUEUE_NB           (2U)              /* number of TX buffers (if used) */
+#define IPC_TXQUEUE_BUF_SIZE     ((uint16_t) 800U) /* size of a TX buffer, bigger data use several buffers */
+#define IPC_USE_UART_DMA_TX      (0U) /* 1: TX buffers are sent by DMA (requires a DMA channel linked to the modem
+                                       *    UART hdmatx), 0: TX buffers are sent under interrupt */
+
 /* IPC interface */
 #define IPC_USE_UART (1U) /* UART activated by default */
 #define IPC_USE_SPI  (0U) /* SPI NOT SUPPORTED YET */
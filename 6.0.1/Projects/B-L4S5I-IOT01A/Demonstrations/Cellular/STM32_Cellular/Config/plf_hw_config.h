@@ -35,6 +35,7 @@ extern "C" {
 #include "main.h"
 #include "plf_modem_config.h"
 #include "usart.h" /* for huartX */
+#include "rtc.h" /* for hrtc */
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -110,6 +111,9 @@ extern "C" {
 #error Connector not specified
 #endif  /* defined(STM32L4S5xx) */
 
+/* RTC: backup registers of the modem configuration cache (see MODEM_CFG_CACHE_RTC_BKP_FIRST) */
+#define MODEM_CFG_CACHE_RTC_HANDLE      hrtc
+
 /* Exported types ------------------------------------------------------------*/
 
 /* External variables --------------------------------------------------------*/
@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS.h
+  * @author  MCD Application Team
+  * @brief   Host build: FreeRTOS definitions used outside of rtosal
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define configTICK_RATE_HZ      (1000U)  /* 1 tick = 1 ms, as on target */
+
+/* Exported types ------------------------------------------------------------*/
+typedef uint32_t StackType_t;
+typedef uint32_t TickType_t;
+
+/* Exported macros -----------------------------------------------------------*/
+#define configASSERT(x)         assert(x)
+
+/* Exported functions ------------------------------------------------------- */
+void *pvPortMalloc(size_t xWantedSize);
+void vPortFree(void *pv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_FREERTOS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,179 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_os.h
+  * @author  MCD Application Team
+  * @brief   Host build: subset of the CMSIS-RTOS V1 API used by rtosal.c,
+  *          implemented on top of POSIX threads in host_cmsis_os.c
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CMSIS_OS_H
+#define CMSIS_OS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+#include "FreeRTOS.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define osCMSIS           0x10002      /* same API version as the target CMSIS-RTOS V1 wrapper */
+#define osWaitForever     0xFFFFFFFF
+
+#define osKernelSysTickFrequency      (configTICK_RATE_HZ)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  osPriorityIdle          = -3,
+  osPriorityLow           = -2,
+  osPriorityBelowNormal   = -1,
+  osPriorityNormal        =  0,
+  osPriorityAboveNormal   = +1,
+  osPriorityHigh          = +2,
+  osPriorityRealtime      = +3,
+  osPriorityError         =  0x84
+} osPriority;
+
+typedef enum
+{
+  osOK                    =     0,
+  osEventSignal           =  0x08,
+  osEventMessage          =  0x10,
+  osEventMail             =  0x20,
+  osEventTimeout          =  0x40,
+  osErrorParameter        =  0x80,
+  osErrorResource         =  0x81,
+  osErrorTimeoutResource  =  0xC1,
+  osErrorISR              =  0x82,
+  osErrorISRRecursive     =  0x83,
+  osErrorPriority         =  0x84,
+  osErrorNoMemory         =  0x85,
+  osErrorValue            =  0x86,
+  osErrorOS               =  0xFF,
+  os_status_reserved      =  0x7FFFFFFF
+} osStatus;
+
+typedef enum
+{
+  osTimerOnce             =     0,
+  osTimerPeriodic         =     1
+} os_timer_type;
+
+typedef void (*os_pthread)(void const *argument);
+typedef void (*os_ptimer)(void const *argument);
+
+typedef struct host_os_thread    *osThreadId;
+typedef struct host_os_timer     *osTimerId;
+typedef struct host_os_semaphore *osMutexId;
+typedef struct host_os_semaphore *osSemaphoreId;
+typedef struct host_os_queue     *osMessageQId;
+
+typedef struct os_thread_def
+{
+  char                   *name;
+  os_pthread             pthread;
+  osPriority             tpriority;
+  uint32_t               instances;
+  uint32_t               stacksize;
+} osThreadDef_t;
+
+typedef struct os_timer_def
+{
+  os_ptimer              ptimer;
+} osTimerDef_t;
+
+typedef struct os_mutex_def
+{
+  uint32_t               dummy;
+} osMutexDef_t;
+
+typedef struct os_semaphore_def
+{
+  uint32_t               dummy;
+} osSemaphoreDef_t;
+
+typedef struct os_messageQ_def
+{
+  uint32_t               queue_sz;
+  uint32_t               item_sz;
+} osMessageQDef_t;
+
+typedef struct
+{
+  osStatus               status;
+  union
+  {
+    uint32_t             v;
+    void                 *p;
+    int32_t              signals;
+  } value;
+  union
+  {
+    osMessageQId         message_id;
+  } def;
+} osEvent;
+
+/* Exported macros -----------------------------------------------------------*/
+#define osTimerDef(name, function)  \
+  const osTimerDef_t os_timer_def_##name = { (function) }
+#define osTimer(name)      (&os_timer_def_##name)
+
+#define osMutexDef(name)   const osMutexDef_t os_mutex_def_##name = { 0 }
+#define osMutex(name)      (&os_mutex_def_##name)
+
+#define osSemaphoreDef(name)  const osSemaphoreDef_t os_semaphore_def_##name = { 0 }
+#define osSemaphore(name)  (&os_semaphore_def_##name)
+
+/* Exported functions ------------------------------------------------------- */
+osStatus osKernelInitialize(void);
+osStatus osKernelStart(void);
+uint32_t osKernelSysTick(void);
+
+osThreadId osThreadCreate(const osThreadDef_t *thread_def, void *argument);
+osThreadId osThreadGetId(void);
+osStatus osThreadTerminate(osThreadId thread_id);
+osStatus osDelay(uint32_t millisec);
+
+osTimerId osTimerCreate(const osTimerDef_t *timer_def, os_timer_type type, void *argument);
+osStatus osTimerStart(osTimerId timer_id, uint32_t millisec);
+osStatus osTimerStop(osTimerId timer_id);
+osStatus osTimerDelete(osTimerId timer_id);
+
+osMutexId osMutexCreate(const osMutexDef_t *mutex_def);
+osStatus osMutexWait(osMutexId mutex_id, uint32_t millisec);
+osStatus osMutexRelease(osMutexId mutex_id);
+osStatus osMutexDelete(osMutexId mutex_id);
+
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *semaphore_def, int32_t count);
+int32_t osSemaphoreWait(osSemaphoreId semaphore_id, uint32_t millisec);
+osStatus osSemaphoreRelease(osSemaphoreId semaphore_id);
+osStatus osSemaphoreDelete(osSemaphoreId semaphore_id);
+
+osMessageQId osMessageCreate(const osMessageQDef_t *queue_def, osThreadId thread_id);
+osStatus osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec);
+osEvent osMessageGet(osMessageQId queue_id, uint32_t millisec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CMSIS_OS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    host_ilp32.h
+  * @author  MCD Application Team
+  * @brief   Host build: forced include (-include) of the target sources.
+  *          The target is ILP32: the sources format and scan 32-bit integers
+  *          with %ld/%lu/%lx. On a LP64 host these conversions are 64-bit, so
+  *          the printf/scanf services used by the sources are redirected to
+  *          functions which handle a single 'l' length modifier as 32-bit.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_ILP32_H
+#define HOST_ILP32_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+
+/* Exported functions ------------------------------------------------------- */
+int host_ilp32_printf(const char *format, ...);
+int host_ilp32_sprintf(char *str, const char *format, ...);
+int host_ilp32_snprintf(char *str, size_t size, const char *format, ...);
+int host_ilp32_sscanf(const char *str, const char *format, ...);
+
+/* Exported macros -----------------------------------------------------------*/
+#if !defined HOST_ILP32_IMPLEMENTATION
+#define printf   host_ilp32_printf
+#define sprintf  host_ilp32_sprintf
+#define snprintf host_ilp32_snprintf
+#define sscanf   host_ilp32_sscanf
+#endif /* !defined HOST_ILP32_IMPLEMENTATION */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_ILP32_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    host_platform.h
+  * @author  MCD Application Team
+  * @brief   Host build: services of the emulated platform which have no
+  *          equivalent on target (statistics, virtual modem link, exit codes)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "stm32l4xx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Process exit codes */
+#define HOST_EXIT_OK             (0)
+#define HOST_EXIT_FAILURE        (1)
+#define HOST_EXIT_ERROR_HANDLER  (2)   /* Error_Handler() called            */
+#define HOST_EXIT_SYSTEM_RESET   (3)   /* NVIC_SystemReset() called         */
+
+/* Environment variables
+   - HOST_MODEM_FD   : file descriptor (inherited) connected to the virtual modem
+   - HOST_MODEM_TCP  : "host:port" of the virtual modem, used when HOST_MODEM_FD is not set
+   - HOST_UART_PACING: "0" to disable the MODEM UART baud rate emulation (default: paced at Init.BaudRate)
+   - HOST_RTC_BKP_FILE: file used to keep the RTC backup registers across runs (default: RAM only) */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t semaphore_release_overflow; /* releases refused because the semaphore was already full */
+  uint32_t mutex_release_not_owner;    /* mutex releases by a thread which does not own the mutex */
+} host_os_stats_t;
+
+typedef struct
+{
+  uint32_t tx_bytes;        /* bytes sent to the modem                       */
+  uint32_t rx_bytes;        /* bytes received from the modem                 */
+  uint32_t tx_transfers;    /* HAL_UART_Transmit* calls accepted             */
+  uint32_t tx_busy;         /* HAL_UART_Transmit_IT/DMA refused (HAL_BUSY)   */
+  uint32_t rx_callbacks;    /* RxCplt / RxEvent callbacks raised             */
+} host_uart_stats_t;
+
+/* Exported functions ------------------------------------------------------- */
+/* Platform */
+void host_platform_init(void);
+uint32_t host_tick_ms(void);
+bool host_irq_masked(void);
+
+/* OS */
+void host_os_wait_kernel_start(void);
+void host_os_get_stats(host_os_stats_t *p_stats);
+
+/* UART */
+void host_uart_get_stats(const UART_HandleTypeDef *huart, host_uart_stats_t *p_stats);
+void host_uart_connect_fd(UART_HandleTypeDef *huart, int rx_fd, int tx_fd, uint32_t pacing);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_PLATFORM_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
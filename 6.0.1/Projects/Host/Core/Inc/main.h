@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    main.h
+  * @author  MCD Application Team
+  * @brief   Host build: board pins, same names and values as 32L496GDISCOVERY so that its
+  *          STM32_Cellular/Config files are used unchanged
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32l4xx_hal.h"
+
+/* Exported functions prototypes ---------------------------------------------*/
+void Error_Handler(void);
+
+/* Private defines -----------------------------------------------------------*/
+#define STMOD_INT_Pin GPIO_PIN_2
+#define STMOD_INT_GPIO_Port GPIOH
+#define STMOD_INT_EXTI_IRQn EXTI2_IRQn
+#define USART1_TX_Pin GPIO_PIN_6
+#define USART1_TX_GPIO_Port GPIOB
+#define UART1_RX_Pin GPIO_PIN_10
+#define UART1_RX_GPIO_Port GPIOG
+#define UART1_CTS_Pin GPIO_PIN_11
+#define UART1_CTS_GPIO_Port GPIOG
+#define UART1_RTS_Pin GPIO_PIN_12
+#define UART1_RTS_GPIO_Port GPIOG
+#define MDM_RST_Pin GPIO_PIN_2
+#define MDM_RST_GPIO_Port GPIOB
+#define MDM_PWR_EN_Pin GPIO_PIN_3
+#define MDM_PWR_EN_GPIO_Port GPIOD
+#define MDM_DTR_Pin GPIO_PIN_0
+#define MDM_DTR_GPIO_Port GPIOA
+#define MDM_SIM_SELECT_0_Pin GPIO_PIN_2
+#define MDM_SIM_SELECT_0_GPIO_Port GPIOC
+#define MDM_SIM_SELECT_1_Pin GPIO_PIN_3
+#define MDM_SIM_SELECT_1_GPIO_Port GPIOI
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MAIN_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,353 @@
+/**
+  ******************************************************************************
+  * @file    stm32l4xx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host build: subset of the STM32L4 HAL used by the Cellular
+  *          middleware, board configuration and samples.
+  *          Peripherals are emulated in host_hal.c:
+  *          - MODEM UART (USART1) is connected to a virtual modem through a
+  *            file descriptor, RX/TX complete callbacks are raised from an
+  *            emulated interrupt context (see __disable_irq())
+  *          - TRACE UART (USART2) is connected to stdout / stdin
+  *          - GPIO, RTC, RNG and tick are emulated in RAM
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32L4xx_HAL_H
+#define STM32L4xx_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define HAL_MAX_DELAY                    0xFFFFFFFFU
+
+/* GPIO */
+#define GPIO_PIN_0                       ((uint16_t)0x0001)
+#define GPIO_PIN_1                       ((uint16_t)0x0002)
+#define GPIO_PIN_2                       ((uint16_t)0x0004)
+#define GPIO_PIN_3                       ((uint16_t)0x0008)
+#define GPIO_PIN_4                       ((uint16_t)0x0010)
+#define GPIO_PIN_5                       ((uint16_t)0x0020)
+#define GPIO_PIN_6                       ((uint16_t)0x0040)
+#define GPIO_PIN_7                       ((uint16_t)0x0080)
+#define GPIO_PIN_8                       ((uint16_t)0x0100)
+#define GPIO_PIN_9                       ((uint16_t)0x0200)
+#define GPIO_PIN_10                      ((uint16_t)0x0400)
+#define GPIO_PIN_11                      ((uint16_t)0x0800)
+#define GPIO_PIN_12                      ((uint16_t)0x1000)
+#define GPIO_PIN_13                      ((uint16_t)0x2000)
+#define GPIO_PIN_14                      ((uint16_t)0x4000)
+#define GPIO_PIN_15                      ((uint16_t)0x8000)
+
+#define GPIO_MODE_INPUT                  (0x00000000U)
+#define GPIO_MODE_OUTPUT_PP              (0x00000001U)
+#define GPIO_MODE_OUTPUT_OD              (0x00000011U)
+#define GPIO_MODE_AF_PP                  (0x00000002U)
+#define GPIO_MODE_IT_RISING_FALLING      (0x10310000U)
+#define GPIO_NOPULL                      (0x00000000U)
+#define GPIO_PULLUP                      (0x00000001U)
+#define GPIO_PULLDOWN                    (0x00000002U)
+#define GPIO_SPEED_FREQ_LOW              (0x00000000U)
+#define GPIO_SPEED_FREQ_VERY_HIGH        (0x00000003U)
+#define GPIO_AF7_USART1                  ((uint8_t)0x07)
+#define GPIO_AF7_USART2                  ((uint8_t)0x07)
+
+/* UART */
+#define UART_WORDLENGTH_8B               (0x00000000U)
+#define UART_STOPBITS_1                  (0x00000000U)
+#define UART_PARITY_NONE                 (0x00000000U)
+#define UART_MODE_TX_RX                  (0x0000000CU)
+#define UART_HWCONTROL_NONE              (0x00000000U)
+#define UART_HWCONTROL_RTS_CTS           (0x00000300U)
+#define UART_OVERSAMPLING_16             (0x00000000U)
+#define UART_ONE_BIT_SAMPLE_DISABLE      (0x00000000U)
+#define UART_ADVFEATURE_NO_INIT          (0x00000000U)
+
+/* RTC */
+#define RTC_FORMAT_BIN                   (0x00000000U)
+#define RTC_FORMAT_BCD                   (0x00000001U)
+#define RTC_HOURFORMAT12_AM              ((uint8_t)0x00)
+#define RTC_DAYLIGHTSAVING_NONE          (0x00000000U)
+#define RTC_STOREOPERATION_RESET         (0x00000000U)
+#define RTC_WEEKDAY_MONDAY               ((uint8_t)0x01)
+#define RTC_WEEKDAY_TUESDAY              ((uint8_t)0x02)
+#define RTC_WEEKDAY_WEDNESDAY            ((uint8_t)0x03)
+#define RTC_WEEKDAY_THURSDAY             ((uint8_t)0x04)
+#define RTC_WEEKDAY_FRIDAY               ((uint8_t)0x05)
+#define RTC_WEEKDAY_SATURDAY             ((uint8_t)0x06)
+#define RTC_WEEKDAY_SUNDAY               ((uint8_t)0x07)
+#define RTC_BKP_NUMBER                   (32U)
+
+/* ITM */
+#define ITM_TCR_ITMENA_Msk               (1UL)
+
+/* Exported types ------------------------------------------------------------*/
+#define __IO    volatile
+
+typedef enum
+{
+  HAL_OK       = 0x00,
+  HAL_ERROR    = 0x01,
+  HAL_BUSY     = 0x02,
+  HAL_TIMEOUT  = 0x03
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  RESET = 0,
+  SET = !RESET
+} FlagStatus, ITStatus;
+
+typedef enum
+{
+  DISABLE = 0,
+  ENABLE = !DISABLE
+} FunctionalState;
+
+typedef enum
+{
+  EXTI2_IRQn     = 8,
+  EXTI9_5_IRQn   = 23,
+  USART1_IRQn    = 37,
+  USART2_IRQn    = 38,
+  EXTI15_10_IRQn = 40
+} IRQn_Type;
+
+/* GPIO */
+typedef struct
+{
+  __IO uint32_t IDR;
+  __IO uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+/* DMA */
+typedef struct
+{
+  __IO uint32_t CNDTR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  DMA_Channel_TypeDef *Instance;
+} DMA_HandleTypeDef;
+
+/* UART */
+typedef struct
+{
+  uint32_t id;
+} USART_TypeDef;
+
+typedef struct
+{
+  uint32_t BaudRate;
+  uint32_t WordLength;
+  uint32_t StopBits;
+  uint32_t Parity;
+  uint32_t Mode;
+  uint32_t HwFlowCtl;
+  uint32_t OverSampling;
+  uint32_t OneBitSampling;
+} UART_InitTypeDef;
+
+typedef struct
+{
+  uint32_t AdvFeatureInit;
+} UART_AdvFeatureInitTypeDef;
+
+typedef enum
+{
+  HAL_UART_STATE_RESET      = 0x00U,
+  HAL_UART_STATE_READY      = 0x20U,
+  HAL_UART_STATE_BUSY       = 0x24U,
+  HAL_UART_STATE_BUSY_TX    = 0x21U,
+  HAL_UART_STATE_BUSY_RX    = 0x22U,
+  HAL_UART_STATE_BUSY_TX_RX = 0x23U,
+  HAL_UART_STATE_TIMEOUT    = 0xA0U,
+  HAL_UART_STATE_ERROR      = 0xE0U
+} HAL_UART_StateTypeDef;
+
+typedef struct __UART_HandleTypeDef
+{
+  USART_TypeDef              *Instance;
+  UART_InitTypeDef           Init;
+  UART_AdvFeatureInitTypeDef AdvancedInit;
+  uint8_t                    *pTxBuffPtr;
+  uint16_t                   TxXferSize;
+  __IO uint16_t              TxXferCount;
+  uint8_t                    *pRxBuffPtr;
+  uint16_t                   RxXferSize;
+  __IO uint16_t              RxXferCount;
+  DMA_HandleTypeDef          *hdmatx;
+  DMA_HandleTypeDef          *hdmarx;
+  __IO HAL_UART_StateTypeDef gState;
+  __IO HAL_UART_StateTypeDef RxState;
+  __IO uint32_t              ErrorCode;
+} UART_HandleTypeDef;
+
+/* RTC */
+typedef struct
+{
+  uint32_t dummy;
+} RTC_TypeDef;
+
+typedef struct
+{
+  RTC_TypeDef *Instance;
+} RTC_HandleTypeDef;
+
+typedef struct
+{
+  uint8_t  Hours;
+  uint8_t  Minutes;
+  uint8_t  Seconds;
+  uint8_t  TimeFormat;
+  uint32_t SubSeconds;
+  uint32_t SecondFraction;
+  uint32_t DayLightSaving;
+  uint32_t StoreOperation;
+} RTC_TimeTypeDef;
+
+typedef struct
+{
+  uint8_t WeekDay;
+  uint8_t Month;
+  uint8_t Date;
+  uint8_t Year;
+} RTC_DateTypeDef;
+
+/* RNG */
+typedef struct
+{
+  uint32_t RandomNumber;
+} RNG_HandleTypeDef;
+
+/* ITM */
+typedef struct
+{
+  __IO union
+  {
+    __IO uint8_t  u8;
+    __IO uint16_t u16;
+    __IO uint32_t u32;
+  } PORT[32U];
+  __IO uint32_t TER;
+  __IO uint32_t TCR;
+} ITM_Type;
+
+/* External variables --------------------------------------------------------*/
+extern GPIO_TypeDef host_gpio[9];
+extern USART_TypeDef host_usart[3];
+extern ITM_Type host_itm;
+
+/* Exported macros -----------------------------------------------------------*/
+#define GPIOA      (&host_gpio[0])
+#define GPIOB      (&host_gpio[1])
+#define GPIOC      (&host_gpio[2])
+#define GPIOD      (&host_gpio[3])
+#define GPIOE      (&host_gpio[4])
+#define GPIOF      (&host_gpio[5])
+#define GPIOG      (&host_gpio[6])
+#define GPIOH      (&host_gpio[7])
+#define GPIOI      (&host_gpio[8])
+
+#define USART1     (&host_usart[0])
+#define USART2     (&host_usart[1])
+#define USART3     (&host_usart[2])
+
+#define ITM        (&host_itm)
+
+#define UNUSED(X)  (void)X
+
+#define __HAL_DMA_GET_COUNTER(__HANDLE__)  ((__HANDLE__)->Instance->CNDTR)
+
+/* Cortex-M intrinsics:
+   - interrupts are emulated by host threads which run the HAL callbacks with a global recursive lock held,
+     __disable_irq()/__enable_irq() take/give this lock
+   - barriers map on the host full memory barrier */
+#define __NOP()    do {} while (0)
+#define __DMB()    __sync_synchronize()
+#define __DSB()    __sync_synchronize()
+#define __ISB()    __sync_synchronize()
+
+/* Exported functions ------------------------------------------------------- */
+void __disable_irq(void);
+void __enable_irq(void);
+uint32_t __LDREXW(volatile uint32_t *addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+void __CLREX(void);
+void NVIC_SystemReset(void);
+
+HAL_StatusTypeDef HAL_Init(void);
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart);
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+
+HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_GetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format);
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister, uint32_t Data);
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc, uint32_t BackupRegister);
+
+HAL_StatusTypeDef HAL_RNG_GenerateRandomNumber(RNG_HandleTypeDef *hrng, uint32_t *random32bit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STM32L4xx_HAL_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,28 @@
+/**
+  ******************************************************************************
+  * @file    task.h
+  * @author  MCD Application Team
+  * @brief   Host build: FreeRTOS task.h placeholder (OS services are in cmsis_os.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HOST_TASK_H
+#define HOST_TASK_H
+
+#include "FreeRTOS.h"
+
+#endif /* HOST_TASK_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
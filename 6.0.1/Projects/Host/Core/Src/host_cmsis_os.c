@@ -0,0 +1,693 @@
+/**
+  ******************************************************************************
+  * @file    host_cmsis_os.c
+  * @author  MCD Application Team
+  * @brief   Host build: CMSIS-RTOS V1 subset used by rtosal.c implemented on
+  *          POSIX threads, with the FreeRTOS semantics the Cellular code
+  *          relies on:
+  *          - threads created before osKernelStart() wait for it
+  *          - 1 tick = 1 ms, timeout 0 = poll, osWaitForever = infinite
+  *          - osSemaphoreCreate(1) is a binary semaphore, osSemaphoreCreate(n)
+  *            is a counting semaphore with max = initial = n: a release on a
+  *            full semaphore fails (and is counted, see host_os_get_stats())
+  *          - mutexes are NOT recursive: a second acquisition by the owner with
+  *            osWaitForever is reported and aborts instead of dead-locking
+  *          - timer callbacks run in a single timer service thread
+  * @note    Thread priorities are not emulated: all threads run concurrently.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "cmsis_os.h"
+#include "host_platform.h"
+
+/* Private typedef -----------------------------------------------------------*/
+struct host_os_thread
+{
+  pthread_t  tid;
+  os_pthread func;
+  void       *arg;
+  char       name[32];
+};
+
+struct host_os_semaphore
+{
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+  int32_t         count;
+  int32_t         max;
+  bool            is_mutex;
+  osThreadId      owner;
+};
+
+struct host_os_queue
+{
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+  uint32_t        *items;
+  uint32_t        size;
+  uint32_t        head;
+  uint32_t        nb;
+};
+
+struct host_os_timer
+{
+  os_ptimer            func;
+  void                 *arg;
+  os_timer_type        type;
+  uint32_t             period;
+  uint64_t             expiry;  /* 0: not running */
+  struct host_os_timer *next;
+};
+
+/* Private variables ---------------------------------------------------------*/
+static pthread_mutex_t host_os_kernel_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  host_os_kernel_cond = PTHREAD_COND_INITIALIZER;
+static bool            host_os_kernel_running = false;
+
+static pthread_mutex_t host_os_timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  host_os_timer_cond;
+static struct host_os_timer *host_os_timer_list = NULL;
+static bool            host_os_timer_thread_started = false;
+
+static __thread osThreadId host_os_current_thread = NULL;
+
+static host_os_stats_t host_os_stats;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t host_os_now_ms(void);
+static void host_os_deadline(uint32_t millisec, struct timespec *p_ts);
+static bool host_os_wait(pthread_cond_t *p_cond, pthread_mutex_t *p_lock, uint32_t millisec,
+                         const struct timespec *p_ts);
+static void *host_os_thread_entry(void *p_arg);
+static void *host_os_timer_thread(void *p_arg);
+static void host_os_timer_thread_start(void);
+
+/* Private function Definition -----------------------------------------------*/
+static uint64_t host_os_now_ms(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000U) + ((uint64_t)ts.tv_nsec / 1000000U);
+}
+
+static void host_os_deadline(uint32_t millisec, struct timespec *p_ts)
+{
+  (void)clock_gettime(CLOCK_MONOTONIC, p_ts);
+  p_ts->tv_sec += (time_t)(millisec / 1000U);
+  p_ts->tv_nsec += (long)(millisec % 1000U) * 1000000L;
+  if (p_ts->tv_nsec >= 1000000000L)
+  {
+    p_ts->tv_sec++;
+    p_ts->tv_nsec -= 1000000000L;
+  }
+}
+
+/* Wait on p_cond: returns false on timeout */
+static bool host_os_wait(pthread_cond_t *p_cond, pthread_mutex_t *p_lock, uint32_t millisec,
+                         const struct timespec *p_ts)
+{
+  bool ret = true;
+  if (millisec == osWaitForever)
+  {
+    (void)pthread_cond_wait(p_cond, p_lock);
+  }
+  else if (millisec == 0U)
+  {
+    ret = false;
+  }
+  else if (pthread_cond_timedwait(p_cond, p_lock, p_ts) == ETIMEDOUT)
+  {
+    ret = false;
+  }
+  else
+  {
+    /* woken up before timeout */
+  }
+  return ret;
+}
+
+static void *host_os_thread_entry(void *p_arg)
+{
+  osThreadId thread = (osThreadId)p_arg;
+
+  host_os_current_thread = thread;
+  host_os_wait_kernel_start();
+  thread->func(thread->arg);
+  return NULL;
+}
+
+static void *host_os_timer_thread(void *p_arg)
+{
+  (void)p_arg;
+  host_os_wait_kernel_start();
+
+  (void)pthread_mutex_lock(&host_os_timer_lock);
+  for (;;)
+  {
+    uint64_t now = host_os_now_ms();
+    uint64_t next = 0U;
+    struct host_os_timer *p_timer;
+    struct host_os_timer *p_expired = NULL;
+
+    for (p_timer = host_os_timer_list; p_timer != NULL; p_timer = p_timer->next)
+    {
+      if (p_timer->expiry != 0U)
+      {
+        if (p_timer->expiry <= now)
+        {
+          p_expired = p_timer;
+          break;
+        }
+        if ((next == 0U) || (p_timer->expiry < next))
+        {
+          next = p_timer->expiry;
+        }
+      }
+    }
+
+    if (p_expired != NULL)
+    {
+      os_ptimer func = p_expired->func;
+      void *arg = p_expired->arg;
+      p_expired->expiry = (p_expired->type == osTimerPeriodic) ? (p_expired->expiry + p_expired->period) : 0U;
+      /* callback may start/stop timers */
+      (void)pthread_mutex_unlock(&host_os_timer_lock);
+      func(arg);
+      (void)pthread_mutex_lock(&host_os_timer_lock);
+    }
+    else if (next == 0U)
+    {
+      (void)pthread_cond_wait(&host_os_timer_cond, &host_os_timer_lock);
+    }
+    else
+    {
+      struct timespec ts;
+      host_os_deadline((uint32_t)(next - now), &ts);
+      (void)pthread_cond_timedwait(&host_os_timer_cond, &host_os_timer_lock, &ts);
+    }
+  }
+  return NULL;
+}
+
+/* Called with host_os_timer_lock held */
+static void host_os_timer_thread_start(void)
+{
+  if (host_os_timer_thread_started == false)
+  {
+    pthread_t tid;
+    pthread_condattr_t attr;
+
+    (void)pthread_condattr_init(&attr);
+    (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    (void)pthread_cond_init(&host_os_timer_cond, &attr);
+    (void)pthread_condattr_destroy(&attr);
+    (void)pthread_create(&tid, NULL, host_os_timer_thread, NULL);
+    (void)pthread_detach(tid);
+    host_os_timer_thread_started = true;
+  }
+}
+
+static void host_os_cond_init(pthread_cond_t *p_cond)
+{
+  pthread_condattr_t attr;
+
+  (void)pthread_condattr_init(&attr);
+  (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  (void)pthread_cond_init(p_cond, &attr);
+  (void)pthread_condattr_destroy(&attr);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/*********************************** KERNEL ***********************************/
+osStatus osKernelInitialize(void)
+{
+  return osOK;
+}
+
+osStatus osKernelStart(void)
+{
+  (void)pthread_mutex_lock(&host_os_kernel_lock);
+  host_os_kernel_running = true;
+  (void)pthread_cond_broadcast(&host_os_kernel_cond);
+  (void)pthread_mutex_unlock(&host_os_kernel_lock);
+
+  /* As on target, osKernelStart() does not return */
+  for (;;)
+  {
+    (void)pause();
+  }
+  return osOK;
+}
+
+uint32_t osKernelSysTick(void)
+{
+  return host_tick_ms();
+}
+
+void host_os_wait_kernel_start(void)
+{
+  (void)pthread_mutex_lock(&host_os_kernel_lock);
+  while (host_os_kernel_running == false)
+  {
+    (void)pthread_cond_wait(&host_os_kernel_cond, &host_os_kernel_lock);
+  }
+  (void)pthread_mutex_unlock(&host_os_kernel_lock);
+}
+
+void host_os_get_stats(host_os_stats_t *p_stats)
+{
+  __atomic_load(&host_os_stats.semaphore_release_overflow, &p_stats->semaphore_release_overflow, __ATOMIC_SEQ_CST);
+  __atomic_load(&host_os_stats.mutex_release_not_owner, &p_stats->mutex_release_not_owner, __ATOMIC_SEQ_CST);
+}
+
+/*********************************** THREAD ***********************************/
+osThreadId osThreadCreate(const osThreadDef_t *thread_def, void *argument)
+{
+  osThreadId thread = (osThreadId)calloc(1U, sizeof(struct host_os_thread));
+
+  if (thread != NULL)
+  {
+    thread->func = thread_def->pthread;
+    thread->arg = argument;
+    if (thread_def->name != NULL)
+    {
+      (void)strncpy(thread->name, thread_def->name, sizeof(thread->name) - 1U);
+    }
+    if (pthread_create(&thread->tid, NULL, host_os_thread_entry, thread) != 0)
+    {
+      free(thread);
+      thread = NULL;
+    }
+    else
+    {
+      (void)pthread_detach(thread->tid);
+    }
+  }
+  return thread;
+}
+
+osThreadId osThreadGetId(void)
+{
+  if (host_os_current_thread == NULL)
+  {
+    /* thread not created by osThreadCreate (main, emulated interrupts) */
+    host_os_current_thread = (osThreadId)calloc(1U, sizeof(struct host_os_thread));
+    if (host_os_current_thread != NULL)
+    {
+      host_os_current_thread->tid = pthread_self();
+    }
+  }
+  return host_os_current_thread;
+}
+
+osStatus osThreadTerminate(osThreadId thread_id)
+{
+  osStatus status = osErrorOS;
+
+  if ((thread_id == NULL) || (thread_id == osThreadGetId()))
+  {
+    pthread_exit(NULL);
+  }
+  else if (pthread_cancel(thread_id->tid) == 0)
+  {
+    status = osOK;
+  }
+  else
+  {
+    /* status already set */
+  }
+  return status;
+}
+
+osStatus osDelay(uint32_t millisec)
+{
+  if (millisec == 0U)
+  {
+    (void)sched_yield();
+  }
+  else
+  {
+    struct timespec ts;
+    ts.tv_sec = (time_t)(millisec / 1000U);
+    ts.tv_nsec = (long)(millisec % 1000U) * 1000000L;
+    while (nanosleep(&ts, &ts) != 0)
+    {
+      /* interrupted: sleep remaining time */
+    }
+  }
+  return osOK;
+}
+
+/********************************* SEMAPHORE **********************************/
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *semaphore_def, int32_t count)
+{
+  osSemaphoreId sem = NULL;
+  (void)semaphore_def;
+
+  if (count > 0)
+  {
+    sem = (osSemaphoreId)calloc(1U, sizeof(struct host_os_semaphore));
+    if (sem != NULL)
+    {
+      (void)pthread_mutex_init(&sem->lock, NULL);
+      host_os_cond_init(&sem->cond);
+      sem->count = count;
+      sem->max = count;
+      sem->is_mutex = false;
+    }
+  }
+  return sem;
+}
+
+int32_t osSemaphoreWait(osSemaphoreId semaphore_id, uint32_t millisec)
+{
+  int32_t ret = (int32_t)osOK;
+  struct timespec ts;
+
+  if (semaphore_id == NULL)
+  {
+    ret = (int32_t)osErrorParameter;
+  }
+  else
+  {
+    host_os_deadline(millisec, &ts);
+    (void)pthread_mutex_lock(&semaphore_id->lock);
+    while ((semaphore_id->count == 0) && (ret == (int32_t)osOK))
+    {
+      if (host_os_wait(&semaphore_id->cond, &semaphore_id->lock, millisec, &ts) == false)
+      {
+        if (semaphore_id->count == 0)
+        {
+          ret = (int32_t)osErrorOS;
+        }
+      }
+    }
+    if (ret == (int32_t)osOK)
+    {
+      semaphore_id->count--;
+    }
+    (void)pthread_mutex_unlock(&semaphore_id->lock);
+  }
+  return ret;
+}
+
+osStatus osSemaphoreRelease(osSemaphoreId semaphore_id)
+{
+  osStatus status = osOK;
+
+  if (semaphore_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    (void)pthread_mutex_lock(&semaphore_id->lock);
+    if (semaphore_id->count >= semaphore_id->max)
+    {
+      /* xSemaphoreGive() on a full semaphore fails */
+      (void)__atomic_add_fetch(&host_os_stats.semaphore_release_overflow, 1U, __ATOMIC_SEQ_CST);
+      status = osErrorOS;
+    }
+    else
+    {
+      semaphore_id->count++;
+      (void)pthread_cond_signal(&semaphore_id->cond);
+    }
+    (void)pthread_mutex_unlock(&semaphore_id->lock);
+  }
+  return status;
+}
+
+osStatus osSemaphoreDelete(osSemaphoreId semaphore_id)
+{
+  osStatus status = osErrorParameter;
+
+  if (semaphore_id != NULL)
+  {
+    (void)pthread_cond_destroy(&semaphore_id->cond);
+    (void)pthread_mutex_destroy(&semaphore_id->lock);
+    free(semaphore_id);
+    status = osOK;
+  }
+  return status;
+}
+
+/*********************************** MUTEX ************************************/
+osMutexId osMutexCreate(const osMutexDef_t *mutex_def)
+{
+  osMutexId mutex = osSemaphoreCreate(NULL, 1);
+  (void)mutex_def;
+
+  if (mutex != NULL)
+  {
+    mutex->is_mutex = true;
+  }
+  return mutex;
+}
+
+osStatus osMutexWait(osMutexId mutex_id, uint32_t millisec)
+{
+  osStatus status;
+
+  if ((mutex_id != NULL) && (mutex_id->owner == osThreadGetId()) && (millisec == osWaitForever))
+  {
+    (void)fprintf(stderr, "host_os: non recursive mutex %p acquired twice by thread '%s'\n",
+                  (void *)mutex_id, osThreadGetId()->name);
+    abort();
+  }
+  status = (osStatus)osSemaphoreWait(mutex_id, millisec);
+  if (status == osOK)
+  {
+    mutex_id->owner = osThreadGetId();
+  }
+  return status;
+}
+
+osStatus osMutexRelease(osMutexId mutex_id)
+{
+  osStatus status;
+
+  if (mutex_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else if (mutex_id->owner != osThreadGetId())
+  {
+    (void)__atomic_add_fetch(&host_os_stats.mutex_release_not_owner, 1U, __ATOMIC_SEQ_CST);
+    status = osErrorOS;
+  }
+  else
+  {
+    mutex_id->owner = NULL;
+    status = osSemaphoreRelease(mutex_id);
+  }
+  return status;
+}
+
+osStatus osMutexDelete(osMutexId mutex_id)
+{
+  return osSemaphoreDelete(mutex_id);
+}
+
+/******************************* MESSAGE QUEUE ********************************/
+osMessageQId osMessageCreate(const osMessageQDef_t *queue_def, osThreadId thread_id)
+{
+  osMessageQId queue = (osMessageQId)calloc(1U, sizeof(struct host_os_queue));
+  (void)thread_id;
+
+  if (queue != NULL)
+  {
+    queue->items = (uint32_t *)calloc(queue_def->queue_sz, sizeof(uint32_t));
+    if (queue->items == NULL)
+    {
+      free(queue);
+      queue = NULL;
+    }
+    else
+    {
+      queue->size = queue_def->queue_sz;
+      (void)pthread_mutex_init(&queue->lock, NULL);
+      host_os_cond_init(&queue->cond);
+    }
+  }
+  return queue;
+}
+
+osStatus osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec)
+{
+  osStatus status = osOK;
+  struct timespec ts;
+
+  if (queue_id == NULL)
+  {
+    status = osErrorParameter;
+  }
+  else
+  {
+    host_os_deadline(millisec, &ts);
+    (void)pthread_mutex_lock(&queue_id->lock);
+    while ((queue_id->nb == queue_id->size) && (status == osOK))
+    {
+      if ((host_os_wait(&queue_id->cond, &queue_id->lock, millisec, &ts) == false)
+          && (queue_id->nb == queue_id->size))
+      {
+        status = osErrorOS;
+      }
+    }
+    if (status == osOK)
+    {
+      queue_id->items[(queue_id->head + queue_id->nb) % queue_id->size] = info;
+      queue_id->nb++;
+      (void)pthread_cond_broadcast(&queue_id->cond);
+    }
+    (void)pthread_mutex_unlock(&queue_id->lock);
+  }
+  return status;
+}
+
+osEvent osMessageGet(osMessageQId queue_id, uint32_t millisec)
+{
+  osEvent event;
+  struct timespec ts;
+
+  event.def.message_id = queue_id;
+  event.value.v = 0U;
+  if (queue_id == NULL)
+  {
+    event.status = osErrorParameter;
+  }
+  else
+  {
+    event.status = osEventMessage;
+    host_os_deadline(millisec, &ts);
+    (void)pthread_mutex_lock(&queue_id->lock);
+    while ((queue_id->nb == 0U) && (event.status == osEventMessage))
+    {
+      if ((host_os_wait(&queue_id->cond, &queue_id->lock, millisec, &ts) == false) && (queue_id->nb == 0U))
+      {
+        event.status = (millisec == 0U) ? osOK : osEventTimeout;
+      }
+    }
+    if (event.status == osEventMessage)
+    {
+      event.value.v = queue_id->items[queue_id->head];
+      queue_id->head = (queue_id->head + 1U) % queue_id->size;
+      queue_id->nb--;
+      (void)pthread_cond_broadcast(&queue_id->cond);
+    }
+    (void)pthread_mutex_unlock(&queue_id->lock);
+  }
+  return event;
+}
+
+/*********************************** TIMER ************************************/
+osTimerId osTimerCreate(const osTimerDef_t *timer_def, os_timer_type type, void *argument)
+{
+  osTimerId timer = (osTimerId)calloc(1U, sizeof(struct host_os_timer));
+
+  if (timer != NULL)
+  {
+    timer->func = timer_def->ptimer;
+    timer->arg = argument;
+    timer->type = type;
+    (void)pthread_mutex_lock(&host_os_timer_lock);
+    host_os_timer_thread_start();
+    timer->next = host_os_timer_list;
+    host_os_timer_list = timer;
+    (void)pthread_mutex_unlock(&host_os_timer_lock);
+  }
+  return timer;
+}
+
+osStatus osTimerStart(osTimerId timer_id, uint32_t millisec)
+{
+  osStatus status = osErrorParameter;
+
+  if ((timer_id != NULL) && (millisec != 0U))
+  {
+    (void)pthread_mutex_lock(&host_os_timer_lock);
+    timer_id->period = millisec;
+    timer_id->expiry = host_os_now_ms() + millisec;
+    (void)pthread_cond_signal(&host_os_timer_cond);
+    (void)pthread_mutex_unlock(&host_os_timer_lock);
+    status = osOK;
+  }
+  return status;
+}
+
+osStatus osTimerStop(osTimerId timer_id)
+{
+  osStatus status = osErrorParameter;
+
+  if (timer_id != NULL)
+  {
+    (void)pthread_mutex_lock(&host_os_timer_lock);
+    status = (timer_id->expiry != 0U) ? osOK : osErrorResource;
+    timer_id->expiry = 0U;
+    (void)pthread_mutex_unlock(&host_os_timer_lock);
+  }
+  return status;
+}
+
+osStatus osTimerDelete(osTimerId timer_id)
+{
+  osStatus status = osErrorParameter;
+
+  if (timer_id != NULL)
+  {
+    struct host_os_timer **pp_timer;
+
+    (void)pthread_mutex_lock(&host_os_timer_lock);
+    for (pp_timer = &host_os_timer_list; *pp_timer != NULL; pp_timer = &(*pp_timer)->next)
+    {
+      if (*pp_timer == timer_id)
+      {
+        *pp_timer = timer_id->next;
+        status = osOK;
+        break;
+      }
+    }
+    (void)pthread_mutex_unlock(&host_os_timer_lock);
+    if (status == osOK)
+    {
+      free(timer_id);
+    }
+  }
+  return status;
+}
+
+/*********************************** HEAP *************************************/
+void *pvPortMalloc(size_t xWantedSize)
+{
+  return malloc(xWantedSize);
+}
+
+void vPortFree(void *pv)
+{
+  free(pv);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,933 @@
+/**
+  ******************************************************************************
+  * @file    host_hal.c
+  * @author  MCD Application Team
+  * @brief   Host build: emulation of the STM32L4 HAL services declared in
+  *          stm32l4xx_hal.h.
+  *          Interrupts: each UART has an RX and a TX thread which play the
+  *          role of the UART/DMA interrupt handlers. HAL callbacks are called
+  *          from these threads with the global "interrupt" lock held, which is
+  *          also the lock taken by __disable_irq(): code protected by
+  *          __disable_irq()/__enable_irq() never runs concurrently with a
+  *          callback, as on target.
+  *          MODEM UART:
+  *          - bytes are delivered at the configured baud rate (10 bits/byte)
+  *          - HAL_UART_Receive_IT(): when no reception is armed, incoming bytes
+  *            are held (as with RTS/CTS flow control)
+  *          - HAL_UARTEx_ReceiveToIdle_DMA(): circular DMA, the RX event
+  *            callback is raised at half buffer, end of buffer and idle line
+  *            (end of each chunk received from the virtual modem), unread data
+  *            is overwritten as on target
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+
+#include "main.h"
+#include "usart.h"
+#include "rng.h"
+#include "rtc.h"
+#include "host_platform.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  HOST_UART_RX_NONE = 0,
+  HOST_UART_RX_IT,
+  HOST_UART_RX_DMA
+} host_uart_rx_mode_t;
+
+typedef struct
+{
+  UART_HandleTypeDef  *huart;
+  int                 rx_fd;
+  int                 tx_fd;
+  uint32_t            pacing;          /* baud rate used to pace the transfers, 0: no pacing */
+  bool                threads_started;
+  bool                irq_enabled;
+  pthread_mutex_t     lock;
+  pthread_cond_t      cond;
+  /* RX */
+  host_uart_rx_mode_t rx_mode;
+  uint8_t             *rx_buf;
+  uint16_t            rx_size;
+  uint16_t            rx_pos;
+  /* TX */
+  const uint8_t       *tx_buf;
+  uint16_t            tx_size;
+  bool                tx_pending;
+  bool                tx_aborted;
+  DMA_Channel_TypeDef dma_rx_channel;
+  DMA_HandleTypeDef   hdma_rx;
+  host_uart_stats_t   stats;
+} host_uart_t;
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_UART_NB            (2U)
+#define HOST_UART_RX_CHUNK      (64U)
+#define HOST_UART_BITS_PER_BYTE (10U)
+
+/* Private variables ---------------------------------------------------------*/
+static pthread_mutex_t host_irq_lock;
+static uint64_t        host_start_ns;
+static host_uart_t     host_uart[HOST_UART_NB];
+static uint32_t        host_rtc_bkp[RTC_BKP_NUMBER];
+static const char      *host_rtc_bkp_file = NULL;
+static int64_t         host_rtc_offset_s = 0;
+static uint32_t        host_rng_state = 0x12345678U;
+static __thread uint32_t host_ldrex_value;
+static __thread uint32_t host_irq_depth;  /* __disable_irq() nesting of the calling thread */
+
+/* Global variables ----------------------------------------------------------*/
+GPIO_TypeDef  host_gpio[9];
+USART_TypeDef host_usart[3] = {{1U}, {2U}, {3U}};
+ITM_Type      host_itm;
+
+UART_HandleTypeDef huart1;
+UART_HandleTypeDef huart2;
+RNG_HandleTypeDef  hrng;
+RTC_HandleTypeDef  hrtc;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t host_now_ns(void);
+static void host_sleep_until(uint64_t deadline_ns);
+static host_uart_t *host_uart_get(const UART_HandleTypeDef *huart);
+static void host_uart_start(host_uart_t *p_uart);
+static void *host_uart_rx_thread(void *p_arg);
+static void *host_uart_tx_thread(void *p_arg);
+static void host_rtc_bkp_load(void);
+
+/* Private function Definition -----------------------------------------------*/
+static uint64_t host_now_ns(void)
+{
+  struct timespec ts;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+static void host_sleep_until(uint64_t deadline_ns)
+{
+  struct timespec ts;
+  ts.tv_sec = (time_t)(deadline_ns / 1000000000U);
+  ts.tv_nsec = (long)(deadline_ns % 1000000000U);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+  {
+    /* interrupted: sleep again */
+  }
+}
+
+static host_uart_t *host_uart_get(const UART_HandleTypeDef *huart)
+{
+  host_uart_t *p_uart = NULL;
+
+  if ((huart != NULL) && (huart->Instance == USART1))
+  {
+    p_uart = &host_uart[0];
+  }
+  else if ((huart != NULL) && (huart->Instance == USART2))
+  {
+    p_uart = &host_uart[1];
+  }
+  else
+  {
+    /* unknown instance */
+  }
+  return p_uart;
+}
+
+static void host_uart_start(host_uart_t *p_uart)
+{
+  if (p_uart->threads_started == false)
+  {
+    pthread_t tid;
+
+    p_uart->threads_started = true;
+    (void)pthread_create(&tid, NULL, host_uart_rx_thread, p_uart);
+    (void)pthread_detach(tid);
+    (void)pthread_create(&tid, NULL, host_uart_tx_thread, p_uart);
+    (void)pthread_detach(tid);
+  }
+}
+
+static void *host_uart_rx_thread(void *p_arg)
+{
+  host_uart_t *p_uart = (host_uart_t *)p_arg;
+  uint8_t chunk[HOST_UART_RX_CHUNK];
+  uint64_t line_free_ns = 0U;
+  bool running = true;
+
+  host_os_wait_kernel_start();
+  while ((running == true) && (p_uart->rx_fd >= 0))
+  {
+    ssize_t len = read(p_uart->rx_fd, chunk, sizeof(chunk));
+    ssize_t i = 0;
+
+    if (len <= 0)
+    {
+      running = false;
+      len = 0;
+    }
+    else if (p_uart->pacing != 0U)
+    {
+      /* the chunk is available once all its bits are on the line */
+      uint64_t now = host_now_ns();
+      if (line_free_ns < now)
+      {
+        line_free_ns = now;
+      }
+      line_free_ns += ((uint64_t)len * HOST_UART_BITS_PER_BYTE * 1000000000U) / p_uart->pacing;
+      host_sleep_until(line_free_ns);
+    }
+    else
+    {
+      /* no pacing */
+    }
+
+    while (i < len)
+    {
+      bool cplt = false;
+      bool half = false;
+      bool idle = false;
+      uint16_t event_size = 0U;
+
+      /* wait for a reception to be armed and the interrupt enabled */
+      (void)pthread_mutex_lock(&p_uart->lock);
+      while ((p_uart->rx_mode == HOST_UART_RX_NONE) || (p_uart->irq_enabled == false))
+      {
+        (void)pthread_cond_wait(&p_uart->cond, &p_uart->lock);
+      }
+      (void)pthread_mutex_unlock(&p_uart->lock);
+
+      __disable_irq();
+      (void)pthread_mutex_lock(&p_uart->lock);
+      if (p_uart->rx_mode == HOST_UART_RX_IT)
+      {
+        p_uart->rx_buf[p_uart->rx_pos] = chunk[i];
+        p_uart->rx_pos++;
+        i++;
+        p_uart->stats.rx_bytes++;
+        if (p_uart->rx_pos == p_uart->rx_size)
+        {
+          p_uart->rx_mode = HOST_UART_RX_NONE;
+          p_uart->huart->RxState = HAL_UART_STATE_READY;
+          cplt = true;
+        }
+      }
+      else if (p_uart->rx_mode == HOST_UART_RX_DMA)
+      {
+        uint16_t half_pos = p_uart->rx_size / 2U;
+        uint16_t room = p_uart->rx_size - p_uart->rx_pos;
+        uint16_t nb = ((len - i) < (ssize_t)room) ? (uint16_t)(len - i) : room;
+
+        /* stop at half buffer to raise the half transfer event */
+        if ((p_uart->rx_pos < half_pos) && ((p_uart->rx_pos + nb) > half_pos))
+        {
+          nb = half_pos - p_uart->rx_pos;
+        }
+        (void)memcpy(&p_uart->rx_buf[p_uart->rx_pos], &chunk[i], nb);
+        p_uart->rx_pos += nb;
+        i += nb;
+        p_uart->stats.rx_bytes += nb;
+        if (p_uart->rx_pos == p_uart->rx_size)
+        {
+          event_size = p_uart->rx_size;
+          p_uart->rx_pos = 0U;
+          half = true;
+        }
+        else if (p_uart->rx_pos == half_pos)
+        {
+          event_size = half_pos;
+          half = true;
+        }
+        else if (i == len)
+        {
+          event_size = p_uart->rx_pos;
+          idle = true;
+        }
+        else
+        {
+          /* continue the copy */
+        }
+        p_uart->dma_rx_channel.CNDTR = (uint32_t)p_uart->rx_size - (uint32_t)p_uart->rx_pos;
+      }
+      else
+      {
+        /* reception aborted in the meantime */
+      }
+      (void)pthread_mutex_unlock(&p_uart->lock);
+
+      if (cplt == true)
+      {
+        p_uart->stats.rx_callbacks++;
+        HAL_UART_RxCpltCallback(p_uart->huart);
+      }
+      else if ((half == true) || (idle == true))
+      {
+        p_uart->stats.rx_callbacks++;
+        HAL_UARTEx_RxEventCallback(p_uart->huart, event_size);
+      }
+      else
+      {
+        /* no event */
+      }
+      __enable_irq();
+    }
+  }
+  return NULL;
+}
+
+static void *host_uart_tx_thread(void *p_arg)
+{
+  host_uart_t *p_uart = (host_uart_t *)p_arg;
+
+  host_os_wait_kernel_start();
+  for (;;)
+  {
+    const uint8_t *p_buf;
+    uint16_t size;
+    bool aborted;
+    uint64_t start_ns;
+
+    (void)pthread_mutex_lock(&p_uart->lock);
+    while (p_uart->tx_pending == false)
+    {
+      (void)pthread_cond_wait(&p_uart->cond, &p_uart->lock);
+    }
+    p_buf = p_uart->tx_buf;
+    size = p_uart->tx_size;
+    (void)pthread_mutex_unlock(&p_uart->lock);
+
+    start_ns = host_now_ns();
+    if (p_uart->tx_fd >= 0)
+    {
+      uint16_t done = 0U;
+      while (done < size)
+      {
+        ssize_t len = write(p_uart->tx_fd, &p_buf[done], (size_t)(size - done));
+        if (len <= 0)
+        {
+          break;
+        }
+        done += (uint16_t)len;
+      }
+    }
+    if (p_uart->pacing != 0U)
+    {
+      host_sleep_until(start_ns + (((uint64_t)size * HOST_UART_BITS_PER_BYTE * 1000000000U) / p_uart->pacing));
+    }
+
+    __disable_irq();
+    (void)pthread_mutex_lock(&p_uart->lock);
+    p_uart->tx_pending = false;
+    aborted = p_uart->tx_aborted;
+    p_uart->stats.tx_bytes += size;
+    if (p_uart->huart->gState == HAL_UART_STATE_BUSY_TX)
+    {
+      p_uart->huart->gState = HAL_UART_STATE_READY;
+    }
+    (void)pthread_cond_broadcast(&p_uart->cond);
+    (void)pthread_mutex_unlock(&p_uart->lock);
+    if (aborted == false)
+    {
+      HAL_UART_TxCpltCallback(p_uart->huart);
+    }
+    __enable_irq();
+  }
+  return NULL;
+}
+
+static void host_rtc_bkp_load(void)
+{
+  host_rtc_bkp_file = getenv("HOST_RTC_BKP_FILE");
+  if (host_rtc_bkp_file != NULL)
+  {
+    FILE *p_file = fopen(host_rtc_bkp_file, "rb");
+    if (p_file != NULL)
+    {
+      (void)fread(host_rtc_bkp, sizeof(host_rtc_bkp), 1U, p_file);
+      (void)fclose(p_file);
+    }
+  }
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/********************************** PLATFORM **********************************/
+void host_platform_init(void)
+{
+  pthread_mutexattr_t attr;
+  const char *p_env;
+  int modem_fd = -1;
+  uint32_t idx;
+
+  host_start_ns = host_now_ns();
+  (void)pthread_mutexattr_init(&attr);
+  (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  (void)pthread_mutex_init(&host_irq_lock, &attr);
+  (void)pthread_mutexattr_destroy(&attr);
+
+  for (idx = 0U; idx < HOST_UART_NB; idx++)
+  {
+    (void)pthread_mutex_init(&host_uart[idx].lock, NULL);
+    (void)pthread_cond_init(&host_uart[idx].cond, NULL);
+    host_uart[idx].rx_fd = -1;
+    host_uart[idx].tx_fd = -1;
+    host_uart[idx].irq_enabled = true;
+    host_uart[idx].hdma_rx.Instance = &host_uart[idx].dma_rx_channel;
+  }
+  host_uart[0].huart = &huart1;
+  host_uart[1].huart = &huart2;
+  huart1.Instance = USART1;
+  huart2.Instance = USART2;
+
+  /* MODEM UART: virtual modem link */
+  p_env = getenv("HOST_MODEM_FD");
+  if (p_env != NULL)
+  {
+    modem_fd = atoi(p_env);
+  }
+  else
+  {
+    p_env = getenv("HOST_MODEM_TCP");
+    if (p_env != NULL)
+    {
+      char host[64];
+      const char *p_port = strrchr(p_env, ':');
+      struct addrinfo hints;
+      struct addrinfo *p_res = NULL;
+
+      (void)memset(&hints, 0, sizeof(hints));
+      hints.ai_socktype = SOCK_STREAM;
+      if ((p_port != NULL) && ((size_t)(p_port - p_env) < sizeof(host)))
+      {
+        (void)memcpy(host, p_env, (size_t)(p_port - p_env));
+        host[p_port - p_env] = '\0';
+        if (getaddrinfo(host, p_port + 1, &hints, &p_res) == 0)
+        {
+          modem_fd = socket(p_res->ai_family, p_res->ai_socktype, p_res->ai_protocol);
+          if ((modem_fd >= 0) && (connect(modem_fd, p_res->ai_addr, p_res->ai_addrlen) != 0))
+          {
+            (void)close(modem_fd);
+            modem_fd = -1;
+          }
+          freeaddrinfo(p_res);
+        }
+      }
+    }
+  }
+  if (modem_fd < 0)
+  {
+    (void)fprintf(stderr, "host: no virtual modem (set HOST_MODEM_FD or HOST_MODEM_TCP)\n");
+  }
+  p_env = getenv("HOST_UART_PACING");
+  host_uart_connect_fd(&huart1, modem_fd, modem_fd, ((p_env != NULL) && (p_env[0] == '0')) ? 0U : 1U);
+
+  /* TRACE UART: console */
+  host_uart_connect_fd(&huart2, STDIN_FILENO, STDOUT_FILENO, 0U);
+
+  host_rtc_bkp_load();
+}
+
+uint32_t host_tick_ms(void)
+{
+  return (uint32_t)((host_now_ns() - host_start_ns) / 1000000U);
+}
+
+void Error_Handler(void)
+{
+  (void)fprintf(stderr, "host: Error_Handler() called\n");
+  exit(HOST_EXIT_ERROR_HANDLER);
+}
+
+/********************************** CORTEX ***********************************/
+void __disable_irq(void)
+{
+  (void)pthread_mutex_lock(&host_irq_lock);
+  host_irq_depth++;
+}
+
+void __enable_irq(void)
+{
+  host_irq_depth--;
+  (void)pthread_mutex_unlock(&host_irq_lock);
+}
+
+/* true if the calling thread runs between __disable_irq() and __enable_irq() (interrupt threads always do) */
+bool host_irq_masked(void)
+{
+  return (host_irq_depth != 0U);
+}
+
+uint32_t __LDREXW(volatile uint32_t *addr)
+{
+  host_ldrex_value = __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+  return host_ldrex_value;
+}
+
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+  uint32_t expected = host_ldrex_value;
+  return (__atomic_compare_exchange_n(addr, &expected, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) ? 0U : 1U;
+}
+
+void __CLREX(void)
+{
+  /* nothing to do: no exclusive monitor */
+}
+
+void NVIC_SystemReset(void)
+{
+  (void)fflush(stdout);
+  (void)fprintf(stderr, "host: NVIC_SystemReset() called\n");
+  exit(HOST_EXIT_SYSTEM_RESET);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  if (IRQn == USART1_IRQn)
+  {
+    (void)pthread_mutex_lock(&host_uart[0].lock);
+    host_uart[0].irq_enabled = true;
+    (void)pthread_cond_broadcast(&host_uart[0].cond);
+    (void)pthread_mutex_unlock(&host_uart[0].lock);
+  }
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  if (IRQn == USART1_IRQn)
+  {
+    (void)pthread_mutex_lock(&host_uart[0].lock);
+    host_uart[0].irq_enabled = false;
+    (void)pthread_mutex_unlock(&host_uart[0].lock);
+  }
+}
+
+/************************************ HAL *************************************/
+HAL_StatusTypeDef HAL_Init(void)
+{
+  return HAL_OK;
+}
+
+uint32_t HAL_GetTick(void)
+{
+  return host_tick_ms();
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  host_sleep_until(host_now_ns() + ((uint64_t)Delay * 1000000U));
+}
+
+/************************************ GPIO ************************************/
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  UNUSED(GPIOx);
+  UNUSED(GPIO_Init);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  return ((GPIOx->IDR & GPIO_Pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  if (PinState == GPIO_PIN_SET)
+  {
+    GPIOx->ODR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+  }
+}
+
+/************************************ UART ************************************/
+void host_uart_connect_fd(UART_HandleTypeDef *huart, int rx_fd, int tx_fd, uint32_t pacing)
+{
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if (p_uart != NULL)
+  {
+    p_uart->rx_fd = rx_fd;
+    p_uart->tx_fd = tx_fd;
+    /* pacing != 0: paced at Init.BaudRate, resolved in HAL_UART_Init() */
+    p_uart->pacing = pacing;
+  }
+}
+
+void host_uart_get_stats(const UART_HandleTypeDef *huart, host_uart_stats_t *p_stats)
+{
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if (p_uart != NULL)
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    *p_stats = p_uart->stats;
+    (void)pthread_mutex_unlock(&p_uart->lock);
+  }
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if (p_uart != NULL)
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    p_uart->huart = huart;
+    if ((p_uart->pacing != 0U) && (huart->Init.BaudRate != 0U))
+    {
+      p_uart->pacing = huart->Init.BaudRate;
+    }
+    huart->hdmarx = &p_uart->hdma_rx;
+    huart->gState = HAL_UART_STATE_READY;
+    huart->RxState = HAL_UART_STATE_READY;
+    p_uart->rx_mode = HOST_UART_RX_NONE;
+    (void)pthread_mutex_unlock(&p_uart->lock);
+    host_uart_start(p_uart);
+    status = HAL_OK;
+  }
+  return status;
+}
+
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if (p_uart != NULL)
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    p_uart->rx_mode = HOST_UART_RX_NONE;
+    huart->gState = HAL_UART_STATE_RESET;
+    huart->RxState = HAL_UART_STATE_RESET;
+    (void)pthread_mutex_unlock(&p_uart->lock);
+    status = HAL_OK;
+  }
+  return status;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+  UNUSED(Timeout);
+
+  if ((p_uart != NULL) && (pData != NULL))
+  {
+    if (p_uart->tx_fd >= 0)
+    {
+      (void)write(p_uart->tx_fd, pData, Size);
+    }
+    (void)pthread_mutex_lock(&p_uart->lock);
+    p_uart->stats.tx_transfers++;
+    p_uart->stats.tx_bytes += Size;
+    (void)pthread_mutex_unlock(&p_uart->lock);
+    status = HAL_OK;
+  }
+  return status;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if ((p_uart != NULL) && (pData != NULL) && (Size != 0U))
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    if (huart->gState != HAL_UART_STATE_READY)
+    {
+      p_uart->stats.tx_busy++;
+      status = HAL_BUSY;
+    }
+    else
+    {
+      huart->gState = HAL_UART_STATE_BUSY_TX;
+      p_uart->tx_buf = pData;
+      p_uart->tx_size = Size;
+      p_uart->tx_aborted = false;
+      p_uart->tx_pending = true;
+      p_uart->stats.tx_transfers++;
+      (void)pthread_cond_broadcast(&p_uart->cond);
+      status = HAL_OK;
+    }
+    (void)pthread_mutex_unlock(&p_uart->lock);
+  }
+  return status;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  return HAL_UART_Transmit_IT(huart, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if (p_uart != NULL)
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    if (p_uart->tx_pending == true)
+    {
+      /* bytes already handed to the host are sent, only the completion callback is cancelled */
+      p_uart->tx_aborted = true;
+    }
+    huart->gState = HAL_UART_STATE_READY;
+    (void)pthread_mutex_unlock(&p_uart->lock);
+    status = HAL_OK;
+  }
+  return status;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if ((p_uart != NULL) && (pData != NULL) && (Size != 0U))
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    if (huart->RxState != HAL_UART_STATE_READY)
+    {
+      status = HAL_BUSY;
+    }
+    else
+    {
+      huart->RxState = HAL_UART_STATE_BUSY_RX;
+      p_uart->rx_mode = HOST_UART_RX_IT;
+      p_uart->rx_buf = pData;
+      p_uart->rx_size = Size;
+      p_uart->rx_pos = 0U;
+      (void)pthread_cond_broadcast(&p_uart->cond);
+      status = HAL_OK;
+    }
+    (void)pthread_mutex_unlock(&p_uart->lock);
+  }
+  return status;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if ((p_uart != NULL) && (pData != NULL) && (Size != 0U))
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    if (huart->RxState != HAL_UART_STATE_READY)
+    {
+      status = HAL_BUSY;
+    }
+    else
+    {
+      huart->RxState = HAL_UART_STATE_BUSY_RX;
+      p_uart->rx_mode = HOST_UART_RX_DMA;
+      p_uart->rx_buf = pData;
+      p_uart->rx_size = Size;
+      p_uart->rx_pos = 0U;
+      p_uart->dma_rx_channel.CNDTR = Size;
+      (void)pthread_cond_broadcast(&p_uart->cond);
+      status = HAL_OK;
+    }
+    (void)pthread_mutex_unlock(&p_uart->lock);
+  }
+  return status;
+}
+
+HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+  host_uart_t *p_uart = host_uart_get(huart);
+
+  if (p_uart != NULL)
+  {
+    (void)pthread_mutex_lock(&p_uart->lock);
+    p_uart->rx_mode = HOST_UART_RX_NONE;
+    huart->RxState = HAL_UART_STATE_READY;
+    (void)pthread_mutex_unlock(&p_uart->lock);
+    status = HAL_OK;
+  }
+  return status;
+}
+
+/* Default callbacks, overridden by the application as with the HAL __weak ones */
+__attribute__((weak)) void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__attribute__((weak)) void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__attribute__((weak)) void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+}
+
+__attribute__((weak)) void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  UNUSED(huart);
+  UNUSED(Size);
+}
+
+/*********************************** BOARD ************************************/
+void MX_USART1_UART_Init(void)
+{
+  /* MODEM UART is initialized by the modem driver (sysctrl_specific.c) */
+}
+
+void MX_USART2_UART_Init(void)
+{
+  huart2.Instance = USART2;
+  huart2.Init.BaudRate = 115200U;
+  huart2.Init.WordLength = UART_WORDLENGTH_8B;
+  huart2.Init.StopBits = UART_STOPBITS_1;
+  huart2.Init.Parity = UART_PARITY_NONE;
+  huart2.Init.Mode = UART_MODE_TX_RX;
+  huart2.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+void MX_RTC_Init(void)
+{
+  hrtc.Instance = NULL;
+}
+
+void MX_RNG_Init(void)
+{
+  hrng.RandomNumber = 0U;
+}
+
+/************************************ RTC *************************************/
+HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc_in, RTC_TimeTypeDef *sTime, uint32_t Format)
+{
+  time_t now = time(NULL) + host_rtc_offset_s;
+  struct tm tm_now;
+  UNUSED(hrtc_in);
+  UNUSED(Format);
+
+  (void)gmtime_r(&now, &tm_now);
+  host_rtc_offset_s += ((int64_t)sTime->Hours - tm_now.tm_hour) * 3600
+                       + ((int64_t)sTime->Minutes - tm_now.tm_min) * 60
+                       + ((int64_t)sTime->Seconds - tm_now.tm_sec);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_GetTime(RTC_HandleTypeDef *hrtc_in, RTC_TimeTypeDef *sTime, uint32_t Format)
+{
+  time_t now = time(NULL) + host_rtc_offset_s;
+  struct tm tm_now;
+  UNUSED(hrtc_in);
+  UNUSED(Format);
+
+  (void)gmtime_r(&now, &tm_now);
+  (void)memset(sTime, 0, sizeof(RTC_TimeTypeDef));
+  sTime->Hours = (uint8_t)tm_now.tm_hour;
+  sTime->Minutes = (uint8_t)tm_now.tm_min;
+  sTime->Seconds = (uint8_t)tm_now.tm_sec;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc_in, RTC_DateTypeDef *sDate, uint32_t Format)
+{
+  time_t now = time(NULL) + host_rtc_offset_s;
+  struct tm tm_now;
+  struct tm tm_new;
+  UNUSED(hrtc_in);
+  UNUSED(Format);
+
+  (void)gmtime_r(&now, &tm_now);
+  tm_new = tm_now;
+  tm_new.tm_year = (int)sDate->Year + 100;
+  tm_new.tm_mon = (int)sDate->Month - 1;
+  tm_new.tm_mday = (int)sDate->Date;
+  host_rtc_offset_s += (int64_t)(timegm(&tm_new) - timegm(&tm_now));
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc_in, RTC_DateTypeDef *sDate, uint32_t Format)
+{
+  time_t now = time(NULL) + host_rtc_offset_s;
+  struct tm tm_now;
+  UNUSED(hrtc_in);
+  UNUSED(Format);
+
+  (void)gmtime_r(&now, &tm_now);
+  sDate->Year = (uint8_t)(tm_now.tm_year - 100);
+  sDate->Month = (uint8_t)(tm_now.tm_mon + 1);
+  sDate->Date = (uint8_t)tm_now.tm_mday;
+  sDate->WeekDay = (tm_now.tm_wday == 0) ? RTC_WEEKDAY_SUNDAY : (uint8_t)tm_now.tm_wday;
+  return HAL_OK;
+}
+
+void HAL_RTCEx_BKUPWrite(RTC_HandleTypeDef *hrtc_in, uint32_t BackupRegister, uint32_t Data)
+{
+  UNUSED(hrtc_in);
+  if (BackupRegister < RTC_BKP_NUMBER)
+  {
+    host_rtc_bkp[BackupRegister] = Data;
+    if (host_rtc_bkp_file != NULL)
+    {
+      FILE *p_file = fopen(host_rtc_bkp_file, "wb");
+      if (p_file != NULL)
+      {
+        (void)fwrite(host_rtc_bkp, sizeof(host_rtc_bkp), 1U, p_file);
+        (void)fclose(p_file);
+      }
+    }
+  }
+}
+
+uint32_t HAL_RTCEx_BKUPRead(RTC_HandleTypeDef *hrtc_in, uint32_t BackupRegister)
+{
+  UNUSED(hrtc_in);
+  return (BackupRegister < RTC_BKP_NUMBER) ? host_rtc_bkp[BackupRegister] : 0U;
+}
+
+/************************************ RNG *************************************/
+HAL_StatusTypeDef HAL_RNG_GenerateRandomNumber(RNG_HandleTypeDef *hrng_in, uint32_t *random32bit)
+{
+  UNUSED(hrng_in);
+  /* xorshift32: deterministic sequence, runs are reproducible */
+  __disable_irq();
+  host_rng_state ^= host_rng_state << 13;
+  host_rng_state ^= host_rng_state >> 17;
+  host_rng_state ^= host_rng_state << 5;
+  *random32bit = host_rng_state;
+  __enable_irq();
+  return HAL_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
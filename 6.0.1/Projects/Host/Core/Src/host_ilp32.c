@@ -0,0 +1,138 @@
+/**
+  ******************************************************************************
+  * @file    host_ilp32.c
+  * @author  MCD Application Team
+  * @brief   Host build: printf/scanf services of the target sources with the
+  *          ILP32 meaning of the 'l' length modifier (see host_ilp32.h)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#define HOST_ILP32_IMPLEMENTATION
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "host_ilp32.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define HOST_ILP32_FORMAT_MAX (256U)
+
+/* Private function prototypes -----------------------------------------------*/
+static const char *host_ilp32_format(const char *format, char *p_buf);
+
+/* Private function Definition -----------------------------------------------*/
+/* Remove a single 'l' before an integer conversion (d i u x X o n) */
+static const char *host_ilp32_format(const char *format, char *p_buf)
+{
+  const char *p_result = format;
+
+  if ((strchr(format, 'l') != NULL) && (strlen(format) < HOST_ILP32_FORMAT_MAX))
+  {
+    size_t in = 0U;
+    size_t out = 0U;
+
+    while (format[in] != '\0')
+    {
+      if (format[in] == '%')
+      {
+        /* copy the conversion up to its length modifier or conversion character */
+        p_buf[out] = format[in];
+        out++;
+        in++;
+        while ((format[in] != '\0') && (strchr("-+ #0123456789.*'", format[in]) != NULL))
+        {
+          p_buf[out] = format[in];
+          out++;
+          in++;
+        }
+        if ((format[in] == 'l') && (format[in + 1U] != 'l') && (format[in + 1U] != '\0')
+            && (strchr("diuxXon", format[in + 1U]) != NULL))
+        {
+          /* 32-bit on target */
+          in++;
+        }
+        else if ((format[in] == '%') || (format[in] == '\0'))
+        {
+          continue;
+        }
+        else
+        {
+          /* other conversions unchanged */
+        }
+      }
+      if (format[in] != '\0')
+      {
+        p_buf[out] = format[in];
+        out++;
+        in++;
+      }
+    }
+    p_buf[out] = '\0';
+    p_result = p_buf;
+  }
+  return p_result;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int host_ilp32_printf(const char *format, ...)
+{
+  char buf[HOST_ILP32_FORMAT_MAX];
+  va_list args;
+  int result;
+
+  va_start(args, format);
+  result = vprintf(host_ilp32_format(format, buf), args);
+  va_end(args);
+  return result;
+}
+
+int host_ilp32_sprintf(char *str, const char *format, ...)
+{
+  char buf[HOST_ILP32_FORMAT_MAX];
+  va_list args;
+  int result;
+
+  va_start(args, format);
+  result = vsprintf(str, host_ilp32_format(format, buf), args);
+  va_end(args);
+  return result;
+}
+
+int host_ilp32_snprintf(char *str, size_t size, const char *format, ...)
+{
+  char buf[HOST_ILP32_FORMAT_MAX];
+  va_list args;
+  int result;
+
+  va_start(args, format);
+  result = vsnprintf(str, size, host_ilp32_format(format, buf), args);
+  va_end(args);
+  return result;
+}
+
+int host_ilp32_sscanf(const char *str, const char *format, ...)
+{
+  char buf[HOST_ILP32_FORMAT_MAX];
+  va_list args;
+  int result;
+
+  va_start(args, format);
+  result = vsscanf(str, host_ilp32_format(format, buf), args);
+  va_end(args);
+  return result;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
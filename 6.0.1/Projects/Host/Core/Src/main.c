@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    main.c
+  * @author  MCD Application Team
+  * @brief   Host build: program entry, same initialization sequence as the
+  *          target main.c (peripherals, MX_FREERTOS_Init, scheduler start)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "main.h"
+#include "cmsis_os.h"
+#include "rng.h"
+#include "rtc.h"
+#include "usart.h"
+#include "host_platform.h"
+
+/* Private function prototypes -----------------------------------------------*/
+void MX_FREERTOS_Init(void);
+static void *host_stop_thread(void *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+/* SIGTERM/SIGINT: dump the platform statistics (read by the test scripts) and stop */
+static void *host_stop_thread(void *p_arg)
+{
+  sigset_t *p_set = (sigset_t *)p_arg;
+  host_os_stats_t os_stats;
+  host_uart_stats_t uart_stats;
+  int sig;
+
+  (void)sigwait(p_set, &sig);
+  host_os_get_stats(&os_stats);
+  host_uart_get_stats(&huart1, &uart_stats);
+  (void)fprintf(stderr, "host: os semaphore_release_overflow=%u mutex_release_not_owner=%u\n",
+                os_stats.semaphore_release_overflow, os_stats.mutex_release_not_owner);
+  (void)fprintf(stderr, "host: modem_uart tx_bytes=%u rx_bytes=%u tx_transfers=%u tx_busy=%u rx_callbacks=%u\n",
+                uart_stats.tx_bytes, uart_stats.rx_bytes, uart_stats.tx_transfers, uart_stats.tx_busy,
+                uart_stats.rx_callbacks);
+  exit(HOST_EXIT_OK);
+  return NULL;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  static sigset_t stop_set;
+  pthread_t stop_thread;
+
+  /* blocked in all the threads, handled by host_stop_thread() */
+  (void)sigemptyset(&stop_set);
+  (void)sigaddset(&stop_set, SIGTERM);
+  (void)sigaddset(&stop_set, SIGINT);
+  (void)pthread_sigmask(SIG_BLOCK, &stop_set, NULL);
+  (void)pthread_create(&stop_thread, NULL, host_stop_thread, &stop_set);
+
+  /* trace and console are line oriented */
+  (void)setvbuf(stdout, NULL, _IOLBF, 0U);
+
+  (void)HAL_Init();
+  host_platform_init();
+
+  /* Initialize all configured peripherals */
+  MX_USART2_UART_Init();
+  MX_RTC_Init();
+  MX_RNG_Init();
+
+  /* Call init function for freertos objects (in freertos.c) */
+  MX_FREERTOS_Init();
+
+  /* Start scheduler */
+  (void)osKernelStart();
+
+  /* We should never get here as control is now taken by the scheduler */
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * @file    app_com_icc.c
+  * @author  MCD Application Team
+  * @brief   Host application (replaces the Cellular sample): console command
+  *          "icc" opens a CSIM session, selects the Master File and prints
+  *          the result of com_icc_generic_access() (length of the answer or
+  *          COM_ERR_NOICC when the SIM is not available)
+  *          (Tests/Scenarios/test_icc_power_cycle.py).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#include <string.h>
+
+#include "cmd.h"
+#include "trace_interface.h"
+#include "com_icc.h"
+#include "cellular_control_api.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define ICC_SELECT_MF  "00A4000C023F00" /* select Master File */
+#define ICC_RSP_SIZE   (32U)
+
+#define PRINT_FORCE(format, args...)  TRACE_PRINT_FORCE(DBG_CHAN_APPLICATION, DBL_LVL_P0, format "\n\r", ## args)
+
+/* Private variables ---------------------------------------------------------*/
+static com_char_t icc_cmd[] = ICC_SELECT_MF;
+static com_char_t icc_rsp[ICC_RSP_SIZE + 1U];
+
+/* Private function prototypes -----------------------------------------------*/
+static cmd_status_t icc_cmd_cb(uint8_t *p_cmd_line);
+
+/* Private function Definition -----------------------------------------------*/
+/* icc */
+static cmd_status_t icc_cmd_cb(uint8_t *p_cmd_line)
+{
+  int32_t icc;
+  int32_t result;
+
+  UNUSED(p_cmd_line);
+
+  icc = com_icc(COM_AF_UNSPEC, COM_SOCK_SEQPACKET, COM_PROTO_CSIM);
+  if (icc >= 0)
+  {
+    result = com_icc_generic_access(icc, icc_cmd, (int32_t)strlen((CRC_CHAR_t *)icc_cmd),
+                                    icc_rsp, (int32_t)ICC_RSP_SIZE);
+    (void)com_closeicc(icc);
+  }
+  else
+  {
+    result = icc;
+  }
+  PRINT_FORCE("icc: access=%ld", result)
+
+  return CMD_OK;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+void application_init(void)
+{
+  cellular_init();
+}
+
+void application_start(void)
+{
+  /* after cellular_init: the console commands are initialized by cellular_init */
+  CMD_Declare((uint8_t *)"icc", icc_cmd_cb, (uint8_t *)"host ICC access");
+  cellular_start();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
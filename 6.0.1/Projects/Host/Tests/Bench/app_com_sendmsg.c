@@ -0,0 +1,220 @@
+/**
+  ******************************************************************************
+  * @file    app_com_sendmsg.c
+  * @author  MCD Application Team
+  * @brief   Host benchmark application (replaces the Cellular sample):
+  *          console command "bench <send|sendmsg> <payload size> <messages>"
+  *          sends messages made of a header and a payload on a TCP modem
+  *          socket, with one com_send() per segment (send) or one
+  *          com_sendmsg() per message (sendmsg), and reads the echo of each
+  *          message. The AT exchanges are counted by the virtual modem
+  *          (Tests/Bench/bench_com_sendmsg.py).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#include <string.h>
+#include <stdbool.h>
+
+#include "rtosal.h"
+#include "cmd.h"
+#include "trace_interface.h"
+#include "com_sockets.h"
+#include "cellular_control_api.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_HEADER_SIZE     (8U)      /* e.g. MQTT fixed header + topic length */
+#define BENCH_PAYLOAD_MAX     (1400U)
+#define BENCH_SERVER_NAME     "bench.server"
+#define BENCH_SERVER_PORT     (7U)      /* echo */
+#define BENCH_RCV_TIMEOUT     (10000U)  /* in ms */
+
+#define PRINT_FORCE(format, args...)  TRACE_PRINT_FORCE(DBG_CHAN_APPLICATION, DBL_LVL_P0, format "\n\r", ## args)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t bench_header[BENCH_HEADER_SIZE];
+static uint8_t bench_payload[BENCH_PAYLOAD_MAX];
+static uint8_t bench_rcv[BENCH_HEADER_SIZE + BENCH_PAYLOAD_MAX];
+static int32_t bench_socket = -1;
+static volatile bool bench_data_ready;
+
+/* Private function prototypes -----------------------------------------------*/
+static void bench_ip_info_cb(ca_event_type_t event_type, const cellular_ip_info_t *const p_ip_info,
+                             void *const p_callback_ctx);
+static bool bench_open(void);
+static bool bench_message(bool vectored, uint32_t payload_size);
+static cmd_status_t bench_cmd(uint8_t *p_cmd_line);
+
+/* Private function Definition -----------------------------------------------*/
+static void bench_ip_info_cb(ca_event_type_t event_type, const cellular_ip_info_t *const p_ip_info,
+                             void *const p_callback_ctx)
+{
+  UNUSED(p_callback_ctx);
+
+  if ((event_type == CA_IP_INFO_EVENT) && (p_ip_info != NULL))
+  {
+    bench_data_ready = (p_ip_info->ip_addr.addr != 0U);
+    if (bench_data_ready == true)
+    {
+      PRINT_FORCE("bench: ready")
+    }
+  }
+}
+
+/* open the echo socket at first use */
+static bool bench_open(void)
+{
+  com_sockaddr_in_t address;
+  uint32_t timeout = BENCH_RCV_TIMEOUT;
+
+  if (bench_socket < 0)
+  {
+    (void)memset(&address, 0, sizeof(address));
+    bench_socket = com_socket(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+    if ((bench_socket >= 0)
+        && ((com_setsockopt(bench_socket, COM_SOL_SOCKET, COM_SO_RCVTIMEO, &timeout, (int32_t)sizeof(timeout)) != 0)
+            || (com_gethostbyname((const com_char_t *)BENCH_SERVER_NAME, (com_sockaddr_t *)&address) != 0)))
+    {
+      (void)com_closesocket(bench_socket);
+      bench_socket = -1;
+    }
+    if (bench_socket >= 0)
+    {
+      address.sin_port = COM_HTONS(BENCH_SERVER_PORT);
+      if (com_connect(bench_socket, (const com_sockaddr_t *)&address, (int32_t)sizeof(address)) != 0)
+      {
+        (void)com_closesocket(bench_socket);
+        bench_socket = -1;
+      }
+    }
+  }
+
+  return (bench_socket >= 0);
+}
+
+/* send one message, header and payload, and read its echo */
+static bool bench_message(bool vectored, uint32_t payload_size)
+{
+  com_iovec_t iov[2];
+  uint32_t size = BENCH_HEADER_SIZE + payload_size;
+  int32_t sent;
+  int32_t ret;
+  uint32_t received = 0U;
+  bool result = true;
+
+  if (vectored == true)
+  {
+    iov[0].iov_base = bench_header;
+    iov[0].iov_len  = BENCH_HEADER_SIZE;
+    iov[1].iov_base = bench_payload;
+    iov[1].iov_len  = payload_size;
+    sent = com_sendmsg(bench_socket, iov, 2, COM_MSG_WAIT);
+  }
+  else
+  {
+    sent = com_send(bench_socket, bench_header, (int32_t)BENCH_HEADER_SIZE, COM_MSG_WAIT);
+    if (sent == (int32_t)BENCH_HEADER_SIZE)
+    {
+      ret = com_send(bench_socket, bench_payload, (int32_t)payload_size, COM_MSG_WAIT);
+      sent = (ret < 0) ? ret : (sent + ret);
+    }
+  }
+  if (sent != (int32_t)size)
+  {
+    result = false;
+  }
+
+  while ((result == true) && (received < size))
+  {
+    ret = com_recv(bench_socket, &bench_rcv[received], (int32_t)(size - received), COM_MSG_WAIT);
+    if (ret <= 0)
+    {
+      result = false;
+    }
+    else
+    {
+      received += (uint32_t)ret;
+    }
+  }
+  if ((result == true)
+      && ((memcmp(bench_rcv, bench_header, BENCH_HEADER_SIZE) != 0)
+          || (memcmp(&bench_rcv[BENCH_HEADER_SIZE], bench_payload, payload_size) != 0)))
+  {
+    result = false;
+  }
+
+  return result;
+}
+
+/* bench <send|sendmsg> <payload size> <messages> */
+static cmd_status_t bench_cmd(uint8_t *p_cmd_line)
+{
+  cmd_status_t result = CMD_SYNTAX_ERROR;
+  uint8_t *p_mode;
+  uint32_t payload_size = 0U;
+  uint32_t messages = 0U;
+  uint32_t ok = 0U;
+  uint32_t start;
+  uint32_t i;
+  bool vectored;
+
+  (void)strtok((CRC_CHAR_t *)p_cmd_line, " \t");
+  p_mode = (uint8_t *)strtok(NULL, " \t");
+  (void)CMD_GetValue((uint8_t *)strtok(NULL, " \t"), &payload_size);
+  (void)CMD_GetValue((uint8_t *)strtok(NULL, " \t"), &messages);
+
+  if ((p_mode != NULL) && (payload_size > 0U) && (payload_size <= BENCH_PAYLOAD_MAX) && (messages > 0U))
+  {
+    vectored = (strcmp((CRC_CHAR_t *)p_mode, "sendmsg") == 0);
+    if ((vectored == true) || (strcmp((CRC_CHAR_t *)p_mode, "send") == 0))
+    {
+      result = CMD_OK;
+      start = rtosalGetSysTimerCount();
+      if ((bench_data_ready == true) && (bench_open() == true))
+      {
+        for (i = 0U; i < messages; i++)
+        {
+          (void)memset(bench_header, (int32_t)('a' + (i % 26U)), BENCH_HEADER_SIZE);
+          (void)memset(bench_payload, (int32_t)('A' + (i % 26U)), payload_size);
+          if (bench_message(vectored, payload_size) == true)
+          {
+            ok++;
+          }
+        }
+      }
+      PRINT_FORCE("bench: mode=%s size=%lu msgs=%lu ok=%lu time_ms=%lu", (CRC_CHAR_t *)p_mode, payload_size,
+                  messages, ok, rtosalGetSysTimerCount() - start)
+    }
+  }
+
+  return result;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+void application_init(void)
+{
+  cellular_init();
+}
+
+void application_start(void)
+{
+  /* after cellular_init: the console commands are initialized by cellular_init */
+  CMD_Declare((uint8_t *)"bench", bench_cmd, (uint8_t *)"host benchmark commands");
+  (void)cellular_ip_info_cb_registration(bench_ip_info_cb, (void *)NULL);
+  cellular_start();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
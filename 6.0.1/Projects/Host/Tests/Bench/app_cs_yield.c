@@ -0,0 +1,238 @@
+/**
+  ******************************************************************************
+  * @file    app_cs_yield.c
+  * @author  MCD Application Team
+  * @brief   Host test application (replaces the Cellular sample):
+  *          console command "yield <control requests> <messages>" runs
+  *          network registrations (SID_CS_REGISTER_NET: several AT lines, the
+  *          control plane request can yield to the data plane at its step
+  *          boundaries) in a control thread while the console thread sends
+  *          messages on a TCP modem socket and reads their echo, then prints
+  *          the results of both planes and the control plane yields
+  *          (Tests/Scenarios/test_cs_yield.py).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "plf_config.h"
+
+#include <string.h>
+#include <stdbool.h>
+
+#include "rtosal.h"
+#include "cmd.h"
+#include "trace_interface.h"
+#include "com_sockets.h"
+#include "cellular_control_api.h"
+#include "cellular_service_os.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define YIELD_MSG_SIZE        (64U)
+#define YIELD_SERVER_NAME     "bench.server"
+#define YIELD_SERVER_PORT     (7U)      /* echo */
+#define YIELD_RCV_TIMEOUT     (10000U)  /* in ms */
+#define YIELD_THREAD_STACK    (1024U)
+
+#if (USE_CELLULAR_SERVICE_CTRL_YIELD != 1)
+#error "app_cs_yield must be built with USE_CELLULAR_SERVICE_CTRL_YIELD == 1"
+#endif /* USE_CELLULAR_SERVICE_CTRL_YIELD != 1 */
+
+#define PRINT_FORCE(format, args...)  TRACE_PRINT_FORCE(DBG_CHAN_APPLICATION, DBL_LVL_P0, format "\n\r", ## args)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t yield_msg[YIELD_MSG_SIZE];
+static uint8_t yield_rcv[YIELD_MSG_SIZE];
+static int32_t yield_socket = -1;
+static volatile bool yield_data_ready;
+static osSemaphoreId yield_ctrl_start_sem;
+static osSemaphoreId yield_ctrl_done_sem;
+static uint32_t yield_ctrl_nb;     /* control plane requests to run */
+static uint32_t yield_ctrl_ok;     /* control plane requests registered */
+
+/* Private function prototypes -----------------------------------------------*/
+static void yield_ip_info_cb(ca_event_type_t event_type, const cellular_ip_info_t *const p_ip_info,
+                             void *const p_callback_ctx);
+static void yield_ctrl_thread(void const *p_argument);
+static bool yield_open(void);
+static bool yield_message(uint32_t idx);
+static cmd_status_t yield_cmd(uint8_t *p_cmd_line);
+
+/* Private function Definition -----------------------------------------------*/
+static void yield_ip_info_cb(ca_event_type_t event_type, const cellular_ip_info_t *const p_ip_info,
+                             void *const p_callback_ctx)
+{
+  UNUSED(p_callback_ctx);
+
+  if ((event_type == CA_IP_INFO_EVENT) && (p_ip_info != NULL))
+  {
+    yield_data_ready = (p_ip_info->ip_addr.addr != 0U);
+    if (yield_data_ready == true)
+    {
+      PRINT_FORCE("yield: ready")
+    }
+  }
+}
+
+/* control plane: automatic network registration, yield_ctrl_nb times */
+static void yield_ctrl_thread(void const *p_argument)
+{
+  CS_OperatorSelector_t operator_sel;
+  CS_RegistrationStatus_t reg_status;
+  uint32_t i;
+
+  UNUSED(p_argument);
+
+  for (;;)
+  {
+    (void)rtosalSemaphoreAcquire(yield_ctrl_start_sem, RTOSAL_WAIT_FOREVER);
+    yield_ctrl_ok = 0U;
+    for (i = 0U; i < yield_ctrl_nb; i++)
+    {
+      (void)memset(&operator_sel, 0, sizeof(operator_sel));
+      (void)memset(&reg_status, 0, sizeof(reg_status));
+      operator_sel.mode = CS_NRM_AUTO;
+      if ((osCDS_register_net(&operator_sel, &reg_status) == CELLULAR_OK)
+          && (reg_status.EPS_NetworkRegState == CS_NRS_REGISTERED_HOME_NETWORK))
+      {
+        yield_ctrl_ok++;
+      }
+    }
+    (void)rtosalSemaphoreRelease(yield_ctrl_done_sem);
+  }
+}
+
+/* open the echo socket at first use */
+static bool yield_open(void)
+{
+  com_sockaddr_in_t address;
+  uint32_t timeout = YIELD_RCV_TIMEOUT;
+
+  if (yield_socket < 0)
+  {
+    (void)memset(&address, 0, sizeof(address));
+    yield_socket = com_socket(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+    if ((yield_socket >= 0)
+        && ((com_setsockopt(yield_socket, COM_SOL_SOCKET, COM_SO_RCVTIMEO, &timeout, (int32_t)sizeof(timeout)) != 0)
+            || (com_gethostbyname((const com_char_t *)YIELD_SERVER_NAME, (com_sockaddr_t *)&address) != 0)))
+    {
+      (void)com_closesocket(yield_socket);
+      yield_socket = -1;
+    }
+    if (yield_socket >= 0)
+    {
+      address.sin_port = COM_HTONS(YIELD_SERVER_PORT);
+      if (com_connect(yield_socket, (const com_sockaddr_t *)&address, (int32_t)sizeof(address)) != 0)
+      {
+        (void)com_closesocket(yield_socket);
+        yield_socket = -1;
+      }
+    }
+  }
+
+  return (yield_socket >= 0);
+}
+
+/* data plane: send message idx and read its echo */
+static bool yield_message(uint32_t idx)
+{
+  int32_t ret;
+  uint32_t received = 0U;
+  bool result;
+
+  (void)memset(yield_msg, (int32_t)('A' + (idx % 26U)), YIELD_MSG_SIZE);
+  result = (com_send(yield_socket, yield_msg, (int32_t)YIELD_MSG_SIZE, COM_MSG_WAIT) == (int32_t)YIELD_MSG_SIZE);
+
+  while ((result == true) && (received < YIELD_MSG_SIZE))
+  {
+    ret = com_recv(yield_socket, &yield_rcv[received], (int32_t)(YIELD_MSG_SIZE - received), COM_MSG_WAIT);
+    if (ret <= 0)
+    {
+      result = false;
+    }
+    else
+    {
+      received += (uint32_t)ret;
+    }
+  }
+
+  return ((result == true) && (memcmp(yield_rcv, yield_msg, YIELD_MSG_SIZE) == 0));
+}
+
+/* yield <control requests> <messages> */
+static cmd_status_t yield_cmd(uint8_t *p_cmd_line)
+{
+  cmd_status_t result = CMD_SYNTAX_ERROR;
+  osCS_lock_stats_t stats_before;
+  osCS_lock_stats_t stats_after;
+  uint32_t ctrl_nb = 0U;
+  uint32_t messages = 0U;
+  uint32_t ok = 0U;
+  uint32_t i;
+
+  (void)strtok((CRC_CHAR_t *)p_cmd_line, " \t");
+  (void)CMD_GetValue((uint8_t *)strtok(NULL, " \t"), &ctrl_nb);
+  (void)CMD_GetValue((uint8_t *)strtok(NULL, " \t"), &messages);
+
+  if ((ctrl_nb > 0U) && (messages > 0U))
+  {
+    result = CMD_OK;
+    if ((yield_data_ready == true) && (yield_open() == true))
+    {
+      osCS_get_lock_stats(&stats_before);
+      yield_ctrl_nb = ctrl_nb;
+      (void)rtosalSemaphoreRelease(yield_ctrl_start_sem);
+      for (i = 0U; i < messages; i++)
+      {
+        if (yield_message(i) == true)
+        {
+          ok++;
+        }
+      }
+      (void)rtosalSemaphoreAcquire(yield_ctrl_done_sem, RTOSAL_WAIT_FOREVER);
+      osCS_get_lock_stats(&stats_after);
+      PRINT_FORCE("yield: ctrl=%lu ctrl_ok=%lu msgs=%lu msgs_ok=%lu yields=%lu", ctrl_nb, yield_ctrl_ok,
+                  messages, ok, stats_after.ctrl_yield_nb - stats_before.ctrl_yield_nb)
+    }
+    else
+    {
+      PRINT_FORCE("yield: data not ready")
+    }
+  }
+
+  return result;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+void application_init(void)
+{
+  cellular_init();
+
+  /* semaphores created taken: released by the console thread and by the control thread */
+  yield_ctrl_start_sem = rtosalSemaphoreNew((const rtosal_char_t *)"YIELD_CTRL_START", 1U);
+  yield_ctrl_done_sem = rtosalSemaphoreNew((const rtosal_char_t *)"YIELD_CTRL_DONE", 1U);
+  (void)rtosalSemaphoreAcquire(yield_ctrl_start_sem, RTOSAL_WAIT_FOREVER);
+  (void)rtosalSemaphoreAcquire(yield_ctrl_done_sem, RTOSAL_WAIT_FOREVER);
+  (void)rtosalThreadNew((const rtosal_char_t *)"YieldCtrl", yield_ctrl_thread, osPriorityNormal,
+                        YIELD_THREAD_STACK, NULL);
+}
+
+void application_start(void)
+{
+  /* after cellular_init: the console commands are initialized by cellular_init */
+  CMD_Declare((uint8_t *)"yield", yield_cmd, (uint8_t *)"control plane yield test");
+  (void)cellular_ip_info_cb_registration(yield_ip_info_cb, (void *)NULL);
+  cellular_start();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,85 @@
+##############################################################################
+# @file    bench_boot.py
+# @author  MCD Application Team
+# @brief   Host benchmark: boot of the Cellular sample with the virtual BG96,
+#          AT command lines and commands sent until the data ready state and
+#          boot time, with a modem answer latency and with one error on each
+#          concatenated line (commands sent again one per line).
+#          "commands" is the number of lines sent without concatenation.
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import csv
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Scenarios"))
+
+from host_test import HostTestCase, HOST_DIR, DATA_READY, BOOT_TIMEOUT  # noqa: E402
+from test_concat_error import CONCAT_ERRORS  # noqa: E402
+from virtual_modem import split_command_line  # noqa: E402
+
+RESULTS = os.environ.get("HOST_BENCH_RESULTS", os.path.join(HOST_DIR, "build", "bench"))
+
+# (name, modem latency per command line in ms, injected errors)
+RUNS = (
+    ("nominal", 0, {}),
+    ("latency", 20, {}),
+    ("latency_concat_errors", 20, CONCAT_ERRORS),
+)
+
+
+class BenchBoot(HostTestCase):
+
+    def run_boot(self, name, latency_ms, errors):
+        host = self.run_host(latency_ms=latency_ms, errors=dict(errors))
+        _, ready_time, _ = host.wait_for(DATA_READY, BOOT_TIMEOUT + 10.0)
+        # data ready time in the modem time base
+        ready_time += host.start_time - host.modem.start_time
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+        with host.modem.lock:
+            first_time = host.modem.command_lines[0][0]
+            lines = [l for t, l in host.modem.command_lines if t <= ready_time]
+        commands = sum(len(split_command_line(l)) for l in lines)
+        return {"run": name, "latency_ms": latency_ms, "errors": len(errors),
+                "boot_ms": int((ready_time + host.modem.start_time - host.start_time) * 1000),
+                "at_ms": int((ready_time - first_time) * 1000),
+                "lines": len(lines), "commands": commands, "lines_saved": commands - len(lines),
+                "concat_lines": sum(1 for l in lines if ";" in l)}
+
+    def test_boot_lines_and_time(self):
+        results = [self.run_boot(*run) for run in RUNS]
+
+        os.makedirs(RESULTS, exist_ok=True)
+        with open(os.path.join(RESULTS, "bench_boot.csv"), "w", newline="") as f:
+            writer = csv.DictWriter(f, fieldnames=list(results[0].keys()))
+            writer.writeheader()
+            writer.writerows(results)
+        for r in results:
+            print("%(run)-22s latency=%(latency_ms)2dms boot_ms=%(boot_ms)5d at_ms=%(at_ms)5d lines=%(lines)3d "
+                  "commands=%(commands)3d saved=%(lines_saved)3d" % r)
+
+        nominal, latency, errors = results
+        self.assertGreater(nominal["lines_saved"], 0)
+        self.assertEqual(latency["lines"], nominal["lines"])
+        # each line answered in latency: the modem time grows with the number of lines
+        self.assertGreaterEqual(latency["at_ms"], latency["lines"] * latency["latency_ms"])
+        # a line in error costs the line and the commands sent again one per line
+        self.assertGreater(errors["lines"], latency["lines"])
+        self.assertGreaterEqual(errors["commands"], latency["commands"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,83 @@
+##############################################################################
+# @file    bench_com_sendmsg.py
+# @author  MCD Application Team
+# @brief   Host benchmark: AT exchanges per message sent as a header and a
+#          payload with one com_send() per segment or with one com_sendmsg()
+#          (Bench/app_com_sendmsg.c), counted by the virtual modem; results
+#          in build/bench/bench_com_sendmsg.csv
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import csv
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Scenarios"))
+
+from host_test import HostTestCase, HOST_DIR, DATA_READY, BOOT_TIMEOUT  # noqa: E402
+
+RESULTS = os.environ.get("HOST_BENCH_RESULTS", os.path.join(HOST_DIR, "build", "bench"))
+
+PAYLOAD_SIZES = (16, 256, 1024)
+MESSAGES = 20
+
+
+class BenchComSendmsg(HostTestCase):
+
+    def run_bench(self, host, mode, size):
+        with host.modem.lock:
+            lines = host.modem.stats["lines"]
+            qisend = host.modem.stats["per_command"]["+QISEND"]
+        start = len(host.output)
+        host.console("bench %s %d %d" % (mode, size, MESSAGES))
+        _, _, m = host.wait_for(r"bench: mode=%s size=%d msgs=%d ok=(\d+) time_ms=(\d+)" % (mode, size, MESSAGES),
+                                60.0, start=start)
+        with host.modem.lock:
+            lines = host.modem.stats["lines"] - lines
+            qisend = host.modem.stats["per_command"]["+QISEND"] - qisend
+        return {"mode": mode, "size": size, "msgs": MESSAGES, "ok": int(m.group(1)),
+                "at_lines_per_msg": lines / MESSAGES, "qisend_per_msg": qisend / MESSAGES,
+                "time_ms": int(m.group(2))}
+
+    def test_at_exchanges_per_message(self):
+        host = self.run_host(app="app_com_sendmsg")
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        host.wait_for(r"bench: ready", BOOT_TIMEOUT)
+        results = []
+        for size in PAYLOAD_SIZES:
+            for mode in ("send", "sendmsg"):
+                results.append(self.run_bench(host, mode, size))
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+
+        os.makedirs(RESULTS, exist_ok=True)
+        with open(os.path.join(RESULTS, "bench_com_sendmsg.csv"), "w", newline="") as f:
+            writer = csv.DictWriter(f, fieldnames=list(results[0].keys()))
+            writer.writeheader()
+            writer.writerows(results)
+        for r in results:
+            print("%(mode)-8s size=%(size)5d at_lines/msg=%(at_lines_per_msg)5.2f qisend/msg=%(qisend_per_msg)4.2f "
+                  "time_ms=%(time_ms)d" % r)
+
+        for send, sendmsg in zip(results[0::2], results[1::2]):
+            self.assertEqual(send["ok"], MESSAGES, send)
+            self.assertEqual(sendmsg["ok"], MESSAGES, sendmsg)
+            # one AT+QISEND per segment with com_send(), one per message with com_sendmsg()
+            self.assertEqual(send["qisend_per_msg"], 2.0, send)
+            self.assertEqual(sendmsg["qisend_per_msg"], 1.0, sendmsg)
+            self.assertLess(sendmsg["at_lines_per_msg"], send["at_lines_per_msg"])
+
+
+if __name__ == "__main__":
+    unittest.main()
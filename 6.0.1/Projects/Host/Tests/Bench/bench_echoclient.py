@@ -0,0 +1,78 @@
+##############################################################################
+# @file    bench_echoclient.py
+# @author  MCD Application Team
+# @brief   Host benchmark: EchoClt performance test of the Cellular sample
+#          (modem sockets) on the virtual modem, TCP and UDP, with
+#          Tools/echoclient_perf.py; results (throughput, latency percentiles,
+#          AT exchanges per KB) in build/bench/bench_echoclient.csv
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Scenarios"))
+
+from host_test import HostTestCase, HOST_DIR, DATA_READY, ECHO_OK, BOOT_TIMEOUT  # noqa: E402
+from echoclient_perf import run_perf, write_csv  # noqa: E402  (Tools, in sys.path of host_test)
+
+RESULTS = os.environ.get("HOST_BENCH_RESULTS", os.path.join(HOST_DIR, "build", "bench"))
+
+# 'echoclient perf <n>' minimum: a few iterations per size, the virtual modem is not the reference for timings
+ITERATIONS = 5
+
+
+class BenchEchoclient(HostTestCase):
+
+    def test_perf_tcp_udp(self):
+        host = self.run_host()
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        host.wait_for(ECHO_OK, 30.0)
+        header = None
+        results = []
+        for protocol in ("TCP", "UDP"):
+            with host.modem.lock:
+                lines = host.modem.stats["lines"]
+                qisend = host.modem.stats["per_command"]["+QISEND"]
+            header, rows = run_perf(host, protocol, ITERATIONS, 300.0)
+            with host.modem.lock:
+                lines = host.modem.stats["lines"] - lines
+                qisend = host.modem.stats["per_command"]["+QISEND"] - qisend
+
+            self.assertGreater(len(rows), 1)
+            for r in rows:
+                self.assertEqual(r["stack"], "modem", r)
+                self.assertTrue(r["protocol"].startswith(protocol), r)   # e.g. "UDP mode connected"
+                self.assertEqual(int(r["iter_ok"]), ITERATIONS, r)
+                self.assertGreater(int(r["at_cmd"]), 0, r)
+            # sizes doubled from 16 bytes: the AT exchanges per KB decrease with the size
+            sizes = [int(r["size"]) for r in rows]
+            self.assertEqual(sizes[0], 16)
+            self.assertEqual(sizes, sorted(sizes))
+            self.assertGreater(float(rows[0]["at_per_kb"]), float(rows[-1]["at_per_kb"]))
+            # counted by the AT core: commands and data buffers, counted by the modem: lines (data after '>')
+            self.assertLessEqual(sum(int(r["at_cmd"]) for r in rows), lines + qisend)
+            results += rows
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+
+        os.makedirs(RESULTS, exist_ok=True)
+        write_csv(os.path.join(RESULTS, "bench_echoclient.csv"), header, results)
+        for r in results:
+            print("%(stack)s %(protocol)-3s size=%(size)5s bytes_per_s=%(bytes_per_s)6s p50_ms=%(p50_ms)4s "
+                  "p99_ms=%(p99_ms)4s at_per_kb=%(at_per_kb)s" % r)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,74 @@
+##############################################################################
+# @file    host_test.py
+# @author  MCD Application Team
+# @brief   Base class of the host scenarios: run build/cellular_host with the
+#          virtual BG96 modem (Tools/virtual_modem.py)
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import os
+import sys
+import unittest
+
+HOST_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+sys.path.insert(0, os.path.join(HOST_DIR, "Tools"))
+
+from virtual_modem import HostRun  # noqa: E402
+
+# Console patterns of the Cellular sample
+DATA_READY = r"New State: MODEM_DATA_READY_STATE"
+ECHO_OK = r"Echoclt 1: RSP received OK"
+
+# Power on (SysCtrl waits 5.5s for the modem) + registration
+BOOT_TIMEOUT = 30.0
+
+
+class HostTestCase(unittest.TestCase):
+    """A test starts the host with run(); the host is stopped at the end of the test."""
+
+    binary = os.environ.get("HOST_BINARY", os.path.join(HOST_DIR, "build", "cellular_host"))
+    variants = os.environ.get("HOST_VARIANTS_DIR", os.path.join(HOST_DIR, "build", "variants"))
+    apps = os.environ.get("HOST_APPS_DIR", os.path.join(HOST_DIR, "build", "apps"))
+    logs = os.environ.get("HOST_TEST_LOGS", os.path.join(HOST_DIR, "build", "logs"))
+
+    def setUp(self):
+        self.host = None
+        self.host_stats = None
+
+    def tearDown(self):
+        if self.host is not None:
+            self.host.stop()
+
+    def run_host(self, env=None, variant=None, app=None, **modem_args):
+        """Start the host (or the sample variant, see HOST_VARIANTS in tests.mk, or the host application, see
+        HOST_APPS) connected to a new virtual modem, log in build/logs/<test>.log"""
+        os.makedirs(self.logs, exist_ok=True)
+        log_path = os.path.join(self.logs, self.id().split(".", 1)[-1] + ".log")
+        binary = self.binary
+        if variant is not None:
+            binary = os.path.join(self.variants, variant, "cellular_host")
+        elif app is not None:
+            binary = os.path.join(self.apps, app, "cellular_host")
+        self.host = HostRun(binary, env=env, log_path=log_path, **modem_args)
+        return self.host
+
+    def stop_host(self):
+        """Stop the host, return its platform statistics."""
+        stats = self.host.stop()
+        self.host = None
+        return stats
+
+    def assertPlatformClean(self, stats):
+        """No semaphore released while already full, no mutex released by a non owner."""
+        self.assertEqual(stats.get("semaphore_release_overflow"), 0, stats)
+        self.assertEqual(stats.get("mutex_release_not_owner"), 0, stats)
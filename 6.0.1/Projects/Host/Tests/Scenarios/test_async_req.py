@@ -0,0 +1,42 @@
+##############################################################################
+# @file    test_async_req.py
+# @author  MCD Application Team
+# @brief   Host scenario: sample variant with USE_CELLULAR_SERVICE_ASYNC_REQ=1,
+#          the synchronous socket, signal quality and DNS services of the echo
+#          client are processed by the calling thread while the Cellular
+#          Service request thread is running
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import unittest
+
+from host_test import HostTestCase, DATA_READY, ECHO_OK, BOOT_TIMEOUT
+
+
+class TestAsyncReq(HostTestCase):
+
+    def test_echo_with_request_thread(self):
+        host = self.run_host(variant="async_req")
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        idx, _, _ = host.wait_for(ECHO_OK, 30.0)
+        # several echo rounds: requests of the echo client and of the cellular service task interleave,
+        # none of them waits for the request thread
+        host.wait_for(ECHO_OK, 30.0, start=idx + 1)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+        self.assertGreater(host.modem.stats["socket_bytes_sent"], 0)
+        self.assertGreater(host.modem.stats["socket_bytes_received"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,37 @@
+##############################################################################
+# @file    test_boot.py
+# @author  MCD Application Team
+# @brief   Host scenario: the Cellular sample boots the virtual BG96, reaches
+#          the data ready state and the echo client exchanges data
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import unittest
+
+from host_test import HostTestCase, DATA_READY, ECHO_OK, BOOT_TIMEOUT
+
+
+class TestBoot(HostTestCase):
+
+    def test_data_ready_and_echo(self):
+        host = self.run_host()
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        host.wait_for(ECHO_OK, 30.0)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+        self.assertGreater(host.modem.stats["socket_bytes_sent"], 0)
+        self.assertGreater(host.modem.stats["socket_bytes_received"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
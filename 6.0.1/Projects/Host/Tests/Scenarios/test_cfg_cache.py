@@ -0,0 +1,74 @@
+##############################################################################
+# @file    test_cfg_cache.py
+# @author  MCD Application Team
+# @brief   Host scenario: the modem configuration cache is kept in the RTC
+#          backup registers over MCU reset (HOST_RTC_BKP_FILE): the PDN
+#          definition sent at the first boot is not sent again at the next
+#          boot, and is sent again when the backup registers are lost, when
+#          the modem is another one (IMEI) or when the modem has lost it
+#          (PDN activation rejected)
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import os
+import tempfile
+import unittest
+
+from host_test import HostTestCase, DATA_READY, BOOT_TIMEOUT
+
+# PDN definition (QICSGP context configuration) of the BG96 driver
+PDN_DEFINE = "AT+QICSGP=1,"
+# PDN activation failed, retried later by the Cellular Service
+PDN_ACTIVATE_NOK = r"CST_modem_activate_pdn_mngt NOK"
+
+
+class TestCfgCache(HostTestCase):
+
+    def boot_pdn_lines(self, env, expected=DATA_READY, **modem_args):
+        host = self.run_host(env=env, **modem_args)
+        host.wait_for(expected, BOOT_TIMEOUT)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+        return [l for _, l in host.modem.command_lines if l.startswith(PDN_DEFINE)]
+
+    def test_pdn_not_sent_again_after_reset(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            env = {"HOST_RTC_BKP_FILE": os.path.join(tmp, "rtc_bkp.bin")}
+            self.assertGreater(len(self.boot_pdn_lines(env)), 0)
+            # MCU reset, backup registers kept
+            self.assertEqual(self.boot_pdn_lines(env), [])
+            # backup domain lost (no VBAT)
+            os.remove(env["HOST_RTC_BKP_FILE"])
+            self.assertGreater(len(self.boot_pdn_lines(env)), 0)
+
+    def test_pdn_sent_again_to_other_modem(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            env = {"HOST_RTC_BKP_FILE": os.path.join(tmp, "rtc_bkp.bin")}
+            self.assertGreater(len(self.boot_pdn_lines(env)), 0)
+            # modem replaced while the backup domain is powered
+            self.assertGreater(len(self.boot_pdn_lines(env, imei="866425030000002")), 0)
+            self.assertEqual(self.boot_pdn_lines(env, imei="866425030000002"), [])
+
+    def test_pdn_sent_again_after_activation_rejected(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            env = {"HOST_RTC_BKP_FILE": os.path.join(tmp, "rtc_bkp.bin")}
+            self.assertGreater(len(self.boot_pdn_lines(env)), 0)
+            # the modem has lost its non-volatile settings: PDN not sent (cache), activation rejected
+            self.assertEqual(self.boot_pdn_lines(env, expected=PDN_ACTIVATE_NOK, pdn_stored=False), [])
+            # cache invalidated by the rejected activation: PDN sent again at next boot, activation accepted
+            self.assertGreater(len(self.boot_pdn_lines(env, pdn_stored=False)), 0)
+            self.assertEqual(self.boot_pdn_lines(env), [])
+
+
+if __name__ == "__main__":
+    unittest.main()
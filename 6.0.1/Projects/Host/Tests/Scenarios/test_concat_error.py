@@ -0,0 +1,57 @@
+##############################################################################
+# @file    test_concat_error.py
+# @author  MCD Application Team
+# @brief   Host scenario: an error answered to a line of concatenated AT
+#          commands is processed per command (the commands of the line are
+#          sent again one per line) and the sample reaches the data ready state
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import unittest
+
+from host_test import HostTestCase, DATA_READY, ECHO_OK, BOOT_TIMEOUT
+
+# one error on the last command of each concatenated line of the BG96 driver
+# (power on, modem init, registration and network status, signal quality)
+CONCAT_ERRORS = {"+CPSMS=0": 1, "+QINISTAT": 1, "+CGREG?": 1, "+QCSQ": 1}
+
+# line in error -> commands of this line sent one per line
+REPLAYED_LINES = {
+    "AT+CGMR;+CFUN=0,0;+CPSMS=0": ["AT+CGMR", "AT+CFUN=0,0", "AT+CPSMS=0"],
+    "AT+CFUN=4,0;+QCCID;+QINISTAT": ["AT+CFUN=4,0", "AT+QCCID", "AT+QINISTAT"],
+    "AT+CEREG?;+CREG?;+CGREG?": ["AT+CEREG?", "AT+CREG?", "AT+CGREG?"],
+    "AT+CSQ;+QCSQ": ["AT+CSQ", "AT+QCSQ"],
+}
+
+
+class TestConcatError(HostTestCase):
+
+    def test_error_on_concatenated_line(self):
+        host = self.run_host(errors=dict(CONCAT_ERRORS))
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        host.wait_for(ECHO_OK, 30.0)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+
+        self.assertEqual(dict(host.modem.stats["errors_injected"]), CONCAT_ERRORS)
+        lines = [l for _, l in host.modem.command_lines]
+        for line, replay in REPLAYED_LINES.items():
+            self.assertIn(line, lines)
+            idx = lines.index(line)
+            self.assertEqual(lines[idx + 1:idx + 1 + len(replay)], replay, "after %s" % line)
+        # the lines answered without error are still concatenated
+        self.assertGreater(lines.count("AT+CEREG?;+CREG?;+CGREG?;+COPS?"), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
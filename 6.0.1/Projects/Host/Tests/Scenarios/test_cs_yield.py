@@ -0,0 +1,84 @@
+##############################################################################
+# @file    test_cs_yield.py
+# @author  MCD Application Team
+# @brief   Host scenario: network registrations (SID_CS_REGISTER_NET, three
+#          AT lines) run by a control thread while the console thread sends
+#          messages on a TCP socket and reads their echo, the virtual modem
+#          answers each AT line after a delay (Bench/app_cs_yield.c): the
+#          control plane request yields to the socket requests at its step
+#          boundaries, both planes get correct results
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import re
+import unittest
+
+from host_test import HostTestCase, BOOT_TIMEOUT
+
+APP_READY = r"yield: ready"
+YIELD_RESULT = r"yield: ctrl=(\d+) ctrl_ok=(\d+) msgs=(\d+) msgs_ok=(\d+) yields=(\d+)"
+
+# lines of SID_CS_REGISTER_NET (BG96_SEQ_REGISTER_NET)
+REGISTER_FIRST = re.compile(r"^AT\+COPS\?$")
+REGISTER_LAST = re.compile(r"^AT\+CEREG\?;\+CREG\?;\+CGREG\?$")
+SOCKET_LINE = re.compile(r"^AT\+(QISEND|QIRD)=")
+
+CTRL_NB = 10
+MSG_NB = 40
+
+
+class TestCsYield(HostTestCase):
+
+    def run_yield(self, latency_ms):
+        """Run "yield" on app_cs_yield, return (result fields, AT command lines)."""
+        host = self.run_host(app="app_cs_yield", latency_ms=latency_ms)
+        idx, _, _ = host.wait_for(APP_READY, BOOT_TIMEOUT + 30.0)
+        host.console("yield %d %d" % (CTRL_NB, MSG_NB))
+        _, _, match = host.wait_for(YIELD_RESULT, 120.0, start=idx + 1)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+        with host.modem.lock:
+            lines = [line for _, line in host.modem.command_lines]
+        return [int(field) for field in match.groups()], lines
+
+    def registrations_interleaved(self, lines):
+        """Number of registrations with socket AT lines between their first and last line."""
+        interleaved = 0
+        in_register = False
+        socket_seen = False
+        for line in lines:
+            if REGISTER_FIRST.match(line):
+                in_register = True
+                socket_seen = False
+            elif REGISTER_LAST.match(line):
+                if in_register and socket_seen:
+                    interleaved += 1
+                in_register = False
+            elif in_register and SOCKET_LINE.match(line):
+                socket_seen = True
+        return interleaved
+
+    def test_registration_yields_to_socket(self):
+        (ctrl, ctrl_ok, msgs, msgs_ok, yields), lines = self.run_yield(latency_ms=10.0)
+        self.assertEqual((ctrl, msgs), (CTRL_NB, MSG_NB))
+        # control plane: every registration done, registered
+        self.assertEqual(ctrl_ok, CTRL_NB)
+        # data plane: every echo received unchanged
+        self.assertEqual(msgs_ok, MSG_NB)
+        self.assertGreater(yields, 0)
+        # the socket requests ran between the lines of a registration
+        self.assertGreater(self.registrations_interleaved(lines), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,38 @@
+##############################################################################
+# @file    test_dma_rx.py
+# @author  MCD Application Team
+# @brief   Host scenario: sample variant with IPC_USE_UART_DMA_RX=1, the
+#          modem answers are received by blocks with the circular DMA and
+#          the idle line event
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import unittest
+
+from host_test import HostTestCase, DATA_READY, ECHO_OK, BOOT_TIMEOUT
+
+
+class TestDmaRx(HostTestCase):
+
+    def test_echo_with_dma_rx(self):
+        host = self.run_host(variant="dma_rx")
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        idx, _, _ = host.wait_for(ECHO_OK, 30.0)
+        host.wait_for(ECHO_OK, 30.0, start=idx + 1)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+        self.assertGreater(host.modem.stats["socket_bytes_received"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
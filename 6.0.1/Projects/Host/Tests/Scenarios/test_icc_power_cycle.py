@@ -0,0 +1,59 @@
+##############################################################################
+# @file    test_icc_power_cycle.py
+# @author  MCD Application Team
+# @brief   Host scenario: the modem is stopped and started again from the
+#          console (cst targetstate off/full), the ICC (SIM) is not
+#          available while the modem is off and is available again once the
+#          SIM is ready (Bench/app_com_icc.c)
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import unittest
+
+from host_test import HostTestCase, DATA_READY, BOOT_TIMEOUT
+
+ICC_OK = r"icc: access=4\b"        # "9000" answered by the virtual modem
+ICC_NOICC = r"icc: access=-14\b"   # COM_ERR_NOICC
+ICC_ANY = r"icc: access=-?\d+"
+MODEM_OFF = r"modem state : CA_MODEM_POWER_OFF"
+
+
+class TestIccPowerCycle(HostTestCase):
+
+    def icc_access(self, host, start):
+        """Run the "icc" console command, return (line index, answer)."""
+        host.console("icc")
+        idx, _, match = host.wait_for(ICC_ANY, 10.0, start=start)
+        return idx, match.group(0)
+
+    def test_icc_after_power_cycle(self):
+        host = self.run_host(app="app_com_icc")
+        idx, _, _ = host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        idx, line = self.icc_access(host, idx + 1)
+        self.assertRegex(line, ICC_OK)
+
+        host.console("cst targetstate off")
+        idx, _, _ = host.wait_for(MODEM_OFF, 30.0, start=idx + 1)
+        idx, line = self.icc_access(host, idx + 1)
+        self.assertRegex(line, ICC_NOICC)
+
+        host.console("cst targetstate full")
+        idx, _, _ = host.wait_for(DATA_READY, BOOT_TIMEOUT, start=idx + 1)
+        idx, line = self.icc_access(host, idx + 1)
+        self.assertRegex(line, ICC_OK)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,43 @@
+##############################################################################
+# @file    test_rcv_prefetch.py
+# @author  MCD Application Team
+# @brief   Host scenario: sample variant with COM_SOCKETS_RCV_PREFETCH_SIZE > 0,
+#          the TCP data of the echo client are read by the COM sockets as soon
+#          as the virtual modem indicates them (+QIURC: "recv"), the echo
+#          client reads them from the prefetch buffer
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import unittest
+
+from host_test import HostTestCase, DATA_READY, ECHO_OK, BOOT_TIMEOUT
+
+
+class TestRcvPrefetch(HostTestCase):
+
+    def test_echo_with_prefetch(self):
+        host = self.run_host(variant="rcv_prefetch")
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        idx, _, _ = host.wait_for(ECHO_OK, 30.0)
+        # several echo rounds: data of each round received complete and in order
+        host.wait_for(ECHO_OK, 30.0, start=idx + 1)
+        # the data were read on the data ready indication, not by the echo client
+        host.wait_for("data ready called: prefetch", 1.0)
+        stats = self.stop_host()
+        self.assertPlatformClean(stats)
+        self.assertGreater(host.modem.stats["socket_bytes_sent"], 0)
+        self.assertGreater(host.modem.stats["socket_bytes_received"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
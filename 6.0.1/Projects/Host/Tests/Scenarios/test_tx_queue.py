@@ -0,0 +1,40 @@
+##############################################################################
+# @file    test_tx_queue.py
+# @author  MCD Application Team
+# @brief   Host scenario: sample variant with IPC_USE_TX_QUEUE=1, the AT
+#          commands and socket data are copied in the IPC TX queue and sent
+#          while the AT core waits for the answer
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import unittest
+
+from host_test import HostTestCase, DATA_READY, ECHO_OK, BOOT_TIMEOUT
+
+
+class TestTxQueue(HostTestCase):
+
+    def test_echo_through_tx_queue(self):
+        host = self.run_host(variant="tx_queue")
+        host.wait_for(DATA_READY, BOOT_TIMEOUT)
+        idx, _, _ = host.wait_for(ECHO_OK, 30.0)
+        host.wait_for(ECHO_OK, 30.0, start=idx + 1)
+        stats = self.stop_host()
+        # the TX complete callbacks do not release the send confirmation semaphore nobody waits for
+        self.assertPlatformClean(stats)
+        self.assertGreater(host.modem.stats["socket_bytes_sent"], 0)
+        self.assertGreater(host.modem.stats["socket_bytes_received"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file    lwipopts.h
+  * @author  MCD Application Team
+  * @brief   Host unit tests: LwIP configuration of the programs built with
+  *          LwIP sources (UNIT_<name>_INCLUDES), used instead of
+  *          Interface/Com/Inc/lwipopts.h: only the core services (pbuf, mem,
+  *          memp) and PPPoS, without OS. The PPPoS options and the pbuf sizes
+  *          are the ones of the target.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef LWIPOPTS_H
+#define LWIPOPTS_H
+
+/* No OS, no protocol above PPP */
+#define NO_SYS                  1
+#define SYS_LIGHTWEIGHT_PROT    0
+#define LWIP_TIMERS             0
+#define LWIP_SOCKET             0
+#define LWIP_NETCONN            0
+#define LWIP_TCP                0
+#define LWIP_UDP                0
+#define LWIP_ICMP               0
+#define LWIP_STATS              0
+
+/* PPP SUPPORT (as Interface/Com/Inc/lwipopts.h) */
+#define PPP_SUPPORT             1
+#define PPPOS_SUPPORT           1
+#define PPP_SERVER              1
+#define PPP_DEBUG               0
+#define PAP_SUPPORT             1
+#define MEMP_NUM_PPP_PCB        2
+
+/* pointers of the host (the target uses 4) */
+#define MEM_ALIGNMENT           8
+
+/* pbuf sizes (as Interface/Com/Inc/lwipopts.h), larger pool and heap for the tests */
+#define PBUF_POOL_BUFSIZE       512
+#define PBUF_POOL_SIZE          64
+#define MEM_SIZE                (64 * 1024)
+
+#endif /* LWIPOPTS_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
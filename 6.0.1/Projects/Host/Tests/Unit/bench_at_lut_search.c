@@ -0,0 +1,236 @@
+/**
+  ******************************************************************************
+  * @file    bench_at_lut_search.c
+  * @author  MCD Application Team
+  * @brief   Host micro-benchmark: search of a received command string in the
+  *          BG96 LUT (atcm_searchCmdInLUT), with the indexes built by
+  *          atcm_set_modem_LUT and with the linear search of the LUT.
+  *          Searched strings: every command string of the LUT and strings
+  *          which are not in the LUT. Both searches must give the same
+  *          result. A LUT too big to be indexed (more than 255 entries) must
+  *          find all its entries. Result (ns per search) written to the CSV
+  *          file given on the command line.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_platform.h"
+
+/* the BG96 modem context (with its LUT) is private: the driver source is part of this benchmark */
+#include "../../../../Drivers/BSP/X_STMOD_PLUS_MODEMS/BG96/AT_modem_bg96/Src/at_custom_modem_specific.c"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_ROUNDS         (2000U)   /* searches of each string */
+#define BENCH_MAX_STRINGS    (MODEM_LUT_MAX_SIZE + 8U)
+#define BENCH_MAX_STR_SIZE   (64U)
+#define BENCH_BIG_LUT_SIZE   (300U)    /* entries of the LUT which is not indexed */
+#define BENCH_BIG_LUT_CMD_ID (1000U)   /* cmd id of the first entry of this LUT */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  buffer[BENCH_MAX_STR_SIZE];
+  uint16_t size;
+} bench_string_t;
+
+/* Private variables ---------------------------------------------------------*/
+static bench_string_t bench_strings[BENCH_MAX_STRINGS];
+static uint32_t bench_strings_nb;
+
+/* strings received from the modem which are not in the LUT */
+static const char *const bench_unknown[] =
+{
+  "+QIURCX", "+UNKNOWN", "12345678", "AT", "ERRORS", "+QIRD1", "+C", "CONNECT OK",
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void bench_add_string(const char *p_str);
+static uint64_t bench_now_ns(void);
+static uint64_t bench_run(atcustom_modem_context_t *p_modem_ctxt, const atparser_context_t *p_atp_ctxt,
+                          uint32_t *p_results);
+static int bench_check_big_LUT(const atparser_context_t *p_atp_ctxt);
+
+/* Private function Definition -----------------------------------------------*/
+static void bench_add_string(const char *p_str)
+{
+  size_t size = strlen(p_str);
+
+  if ((size > 0U) && (size < BENCH_MAX_STR_SIZE) && (bench_strings_nb < BENCH_MAX_STRINGS))
+  {
+    /* copy: the searched string is in the received message, not in the LUT */
+    (void)memcpy(bench_strings[bench_strings_nb].buffer, p_str, size);
+    bench_strings[bench_strings_nb].buffer[size] = (uint8_t)':';
+    bench_strings[bench_strings_nb].size = (uint16_t)size;
+    bench_strings_nb++;
+  }
+}
+
+static uint64_t bench_now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/* search all the strings BENCH_ROUNDS times, returns the duration in ns, p_results: cmd id found for each string */
+static uint64_t bench_run(atcustom_modem_context_t *p_modem_ctxt, const atparser_context_t *p_atp_ctxt,
+                          uint32_t *p_results)
+{
+  IPC_RxMessage_t msg;
+  at_element_info_t element_infos;
+  uint64_t start = bench_now_ns();
+  uint32_t round;
+  uint32_t i;
+
+  (void)memset(&element_infos, 0, sizeof(element_infos));
+  for (round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    for (i = 0U; i < bench_strings_nb; i++)
+    {
+      msg.buffer = bench_strings[i].buffer;
+      msg.size = bench_strings[i].size + 1U;
+      element_infos.str_start_idx = 0U;
+      element_infos.str_size = bench_strings[i].size;
+      if (atcm_searchCmdInLUT(p_modem_ctxt, p_atp_ctxt, &msg, &element_infos) != ATSTATUS_OK)
+      {
+        element_infos.cmd_id_received = CMD_AT_INVALID;
+      }
+      p_results[i] = (uint32_t)element_infos.cmd_id_received;
+    }
+  }
+  return (bench_now_ns() - start);
+}
+
+/* LUT of BENCH_BIG_LUT_SIZE entries: linear search of the cmd ids and of the strings, returns HOST_EXIT_OK if all
+   the entries are found */
+static int bench_check_big_LUT(const atparser_context_t *p_atp_ctxt)
+{
+  static atcustom_LUT_t big_LUT[BENCH_BIG_LUT_SIZE];
+  static atcustom_modem_context_t big_ctxt;
+  IPC_RxMessage_t msg;
+  at_element_info_t element_infos;
+  uint8_t str[BENCH_MAX_STR_SIZE];
+  int ret = HOST_EXIT_OK;
+  uint32_t i;
+
+  for (i = 0U; i < BENCH_BIG_LUT_SIZE; i++)
+  {
+    big_LUT[i].cmd_id = BENCH_BIG_LUT_CMD_ID + i;
+    (void)snprintf((char *)big_LUT[i].cmd_str, sizeof(big_LUT[i].cmd_str), "+CMD%u", i);
+    big_LUT[i].cmd_timeout = i + 1U;
+    big_LUT[i].cmd_BuildFunc = fCmdBuild_NoParams;
+    big_LUT[i].rsp_AnalyzeFunc = fRspAnalyze_None;
+  }
+  atcm_set_modem_LUT(&big_ctxt, big_LUT, BENCH_BIG_LUT_SIZE);
+
+  (void)memset(&element_infos, 0, sizeof(element_infos));
+  for (i = 0U; i < BENCH_BIG_LUT_SIZE; i++)
+  {
+    msg.size = (uint16_t)snprintf((char *)str, sizeof(str), "+CMD%u:", i);
+    msg.buffer = str;
+    element_infos.str_start_idx = 0U;
+    element_infos.str_size = msg.size - 1U;
+    if ((atcm_get_CmdTimeout(&big_ctxt, BENCH_BIG_LUT_CMD_ID + i) != (i + 1U)) ||
+        (atcm_searchCmdInLUT(&big_ctxt, p_atp_ctxt, &msg, &element_infos) != ATSTATUS_OK) ||
+        (element_infos.cmd_id_received != (BENCH_BIG_LUT_CMD_ID + i)))
+    {
+      (void)printf("FAIL: LUT of %u entries: entry %u not found\n", BENCH_BIG_LUT_SIZE, i);
+      ret = HOST_EXIT_FAILURE;
+      break;
+    }
+  }
+
+  return ret;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  static atparser_context_t atp_ctxt;
+  static atcustom_modem_context_t linear_ctxt;
+  static uint32_t indexed_results[BENCH_MAX_STRINGS];
+  static uint32_t linear_results[BENCH_MAX_STRINGS];
+  uint64_t indexed_ns;
+  uint64_t linear_ns;
+  uint32_t lookups;
+  uint32_t i;
+  FILE *p_csv;
+  int ret = HOST_EXIT_OK;
+
+  ATCustom_BG96_init(&atp_ctxt);
+
+  for (i = 0U; i < BG96_ctxt.modem_LUT_size; i++)
+  {
+    bench_add_string((const char *)BG96_ctxt.p_modem_LUT[i].cmd_str);
+  }
+  for (i = 0U; i < (sizeof(bench_unknown) / sizeof(bench_unknown[0])); i++)
+  {
+    bench_add_string(bench_unknown[i]);
+  }
+
+  /* same LUT, not indexed: linear search */
+  linear_ctxt = BG96_ctxt;
+  linear_ctxt.LUT_index.indexed = 0U;
+
+  indexed_ns = bench_run(&BG96_ctxt, &atp_ctxt, indexed_results);
+  linear_ns = bench_run(&linear_ctxt, &atp_ctxt, linear_results);
+  lookups = BENCH_ROUNDS * bench_strings_nb;
+
+  for (i = 0U; i < bench_strings_nb; i++)
+  {
+    if (indexed_results[i] != linear_results[i])
+    {
+      (void)printf("FAIL: string %.*s: indexed search %u, linear search %u\n", (int)bench_strings[i].size,
+                   (const char *)bench_strings[i].buffer, indexed_results[i], linear_results[i]);
+      ret = HOST_EXIT_FAILURE;
+    }
+  }
+
+  if (bench_check_big_LUT(&atp_ctxt) != HOST_EXIT_OK)
+  {
+    ret = HOST_EXIT_FAILURE;
+  }
+
+  (void)printf("BG96 LUT: %u entries, %u strings searched %u times\n", BG96_ctxt.modem_LUT_size,
+               bench_strings_nb, BENCH_ROUNDS);
+  (void)printf("indexed search: %.1f ns, linear search: %.1f ns per string\n",
+               (double)indexed_ns / (double)lookups, (double)linear_ns / (double)lookups);
+
+  if (argc > 1)
+  {
+    p_csv = fopen(argv[1], "w");
+    if (p_csv != NULL)
+    {
+      (void)fprintf(p_csv, "search,lut_entries,lookups,ns_per_lookup\n");
+      (void)fprintf(p_csv, "indexed,%u,%u,%.1f\n", BG96_ctxt.modem_LUT_size, lookups,
+                    (double)indexed_ns / (double)lookups);
+      (void)fprintf(p_csv, "linear,%u,%u,%.1f\n", BG96_ctxt.modem_LUT_size, lookups,
+                    (double)linear_ns / (double)lookups);
+      (void)fclose(p_csv);
+    }
+  }
+  if (ret == HOST_EXIT_OK)
+  {
+    (void)printf("PASS\n");
+  }
+  return ret;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
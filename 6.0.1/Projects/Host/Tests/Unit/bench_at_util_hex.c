@@ -0,0 +1,300 @@
+/**
+  ******************************************************************************
+  * @file    bench_at_util_hex.c
+  * @author  MCD Application Team
+  * @brief   Host micro-benchmark: hexadecimal string conversions of the
+  *          Type1SC socket data, with the word conversions of at_util
+  *          (ATutil_convertBinToHexaString, ATutil_convertHexaStringToBin)
+  *          and with the per character conversions previously done by the
+  *          Type1SC driver (reproduced below). Both must give the same
+  *          result. Result (MB/s of binary data) written to the CSV file
+  *          given on the command line.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_platform.h"
+#include "at_core.h"
+#include "at_util.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define BENCH_SIZE           (1500U)   /* bytes: max. socket data of a Type1SC AT%SOCKETDATA command */
+#define BENCH_ROUNDS         (20000U)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  const char *p_name;
+  uint64_t    ns;
+} bench_result_t;
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t bench_bin[BENCH_SIZE];
+static uint8_t bench_hex[2U * BENCH_SIZE];
+static uint8_t bench_hex_ref[2U * BENCH_SIZE];
+static uint8_t bench_out[BENCH_SIZE];
+static uint8_t bench_out_ref[BENCH_SIZE];
+static volatile uint8_t bench_sink;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t convertToASCII(uint8_t nbr);
+static void convertCharToHEX(uint8_t val, uint8_t *p_msd, uint8_t *p_lsd);
+static at_status_t convertDigitToValue(uint8_t digit, uint8_t *p_res);
+static at_status_t convertHEXToChar(uint8_t msd, uint8_t lsd, uint8_t *p_conv);
+static void bench_ref_encode(const uint8_t *p_src, uint32_t size, uint8_t *p_dst);
+static bool bench_ref_decode(const uint8_t *p_src, uint32_t size, uint8_t *p_dst);
+static uint64_t bench_now_ns(void);
+static double bench_mbps(uint64_t ns);
+static void bench_toggle_case(uint8_t *p_digit);
+
+/* Private function Definition -----------------------------------------------*/
+/* previous per character conversions of the Type1SC driver (at_custom_modem_socket.c) */
+static uint8_t convertToASCII(uint8_t nbr)
+{
+  uint8_t ascii;
+
+  if (nbr <= 9U)
+  {
+    ascii = nbr + 48U;
+  }
+  else
+  {
+    ascii = nbr + 87U; /* 87 = 97 -10 (where 97 correspond to 'a') */
+  }
+  return (ascii);
+}
+
+static void convertCharToHEX(uint8_t val, uint8_t *p_msd, uint8_t *p_lsd)
+{
+  *p_msd = convertToASCII(val / 16U);
+  *p_lsd = convertToASCII(val % 16U);
+}
+
+static at_status_t convertDigitToValue(uint8_t digit, uint8_t *p_res)
+{
+  at_status_t retval = ATSTATUS_OK;
+
+  if ((digit >= 48U) && (digit <= 57U))
+  {
+    /* 0 to 9 */
+    *p_res = digit - 48U;
+  }
+  else if ((digit >= 97U) && (digit <= 102U))
+  {
+    /* a to f */
+    *p_res = digit - 87U; /* 87 = -97+10 */
+  }
+  else if ((digit >= 65U) && (digit <= 70U))
+  {
+    /* A to F */
+    *p_res = digit - 55U; /* 55 = -65+10*/
+  }
+  else
+  {
+    *p_res = 0;
+    retval = ATSTATUS_ERROR;
+  }
+  return (retval);
+}
+
+static at_status_t convertHEXToChar(uint8_t msd, uint8_t lsd, uint8_t *p_conv)
+{
+  at_status_t retval = ATSTATUS_OK;
+  uint8_t convMSD;
+  uint8_t convLSD;
+
+  /* convert Most significant digit */
+  if (convertDigitToValue(msd, &convMSD) == ATSTATUS_OK)
+  {
+    /* convert Less significant digit */
+    if (convertDigitToValue(lsd, &convLSD) == ATSTATUS_OK)
+    {
+      /* compute converted char value */
+      *p_conv = (convMSD << 4) + convLSD;
+    }
+    else
+    {
+      retval = ATSTATUS_ERROR;
+    }
+  }
+  else
+  {
+    retval = ATSTATUS_ERROR;
+  }
+  return (retval);
+}
+
+/* previous loops of the Type1SC driver: send command build and SOCKETDATA answer analysis (traces excluded) */
+static void bench_ref_encode(const uint8_t *p_src, uint32_t size, uint8_t *p_dst)
+{
+  uint32_t i;
+
+  for (i = 0U; i < size; i++)
+  {
+    uint8_t ms;
+    uint8_t ls;
+    convertCharToHEX(p_src[i], &ms, &ls);
+    (void)memcpy((void *)&p_dst[2U * i], (const void *)&ms, 1);
+    (void)memcpy((void *)&p_dst[(2U * i) + 1U], (const void *)&ls, 1);
+  }
+}
+
+static bool bench_ref_decode(const uint8_t *p_src, uint32_t size, uint8_t *p_dst)
+{
+  bool ok = true;
+  uint32_t i;
+
+  for (i = 0U; (i < size) && (ok == true); i++)
+  {
+    ok = (convertHEXToChar(p_src[2U * i], p_src[(2U * i) + 1U], &p_dst[i]) == ATSTATUS_OK);
+  }
+  return ok;
+}
+
+static uint64_t bench_now_ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/* binary data converted per second */
+static double bench_mbps(uint64_t ns)
+{
+  return ((double)BENCH_SIZE * (double)BENCH_ROUNDS * 1000.0) / (double)ns;
+}
+
+/* letter digit: lowercase <-> uppercase, the string stays valid */
+static void bench_toggle_case(uint8_t *p_digit)
+{
+  if (*p_digit >= (uint8_t)'A')
+  {
+    *p_digit ^= 0x20U;
+  }
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  bench_result_t results[4];
+  uint32_t state = 0x1234U;
+  uint64_t start;
+  uint32_t round;
+  uint32_t i;
+  bool ok = true;
+  FILE *p_csv;
+  int ret = HOST_EXIT_OK;
+
+  for (i = 0U; i < BENCH_SIZE; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    bench_bin[i] = (uint8_t)state;
+  }
+
+  /* each round converts the buffer modified by the previous round: the conversions cannot be hoisted */
+  results[0].p_name = "encode_per_char";
+  start = bench_now_ns();
+  for (round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    bench_bin[round % BENCH_SIZE] ^= 1U;
+    bench_ref_encode(bench_bin, BENCH_SIZE, bench_hex_ref);
+    bench_sink ^= bench_hex_ref[round % (2U * BENCH_SIZE)];
+  }
+  results[0].ns = bench_now_ns() - start;
+
+  results[1].p_name = "encode_word";
+  start = bench_now_ns();
+  for (round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    bench_bin[round % BENCH_SIZE] ^= 1U;
+    ATutil_convertBinToHexaString(bench_bin, BENCH_SIZE, bench_hex);
+    bench_sink ^= bench_hex[round % (2U * BENCH_SIZE)];
+  }
+  results[1].ns = bench_now_ns() - start;
+
+  results[2].p_name = "decode_per_char";
+  start = bench_now_ns();
+  for (round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    bench_toggle_case(&bench_hex_ref[round % (2U * BENCH_SIZE)]);
+    ok = ok && bench_ref_decode(bench_hex_ref, BENCH_SIZE, bench_out_ref);
+    bench_sink ^= bench_out_ref[round % BENCH_SIZE];
+  }
+  results[2].ns = bench_now_ns() - start;
+
+  results[3].p_name = "decode_word";
+  start = bench_now_ns();
+  for (round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    bench_toggle_case(&bench_hex[round % (2U * BENCH_SIZE)]);
+    ok = ok && ATutil_convertHexaStringToBin(bench_hex, BENCH_SIZE, bench_out);
+    bench_sink ^= bench_out[round % BENCH_SIZE];
+  }
+  results[3].ns = bench_now_ns() - start;
+
+  /* validation on the last buffer: same string, same decoded data, for lowercase and uppercase letters */
+  bench_ref_encode(bench_bin, BENCH_SIZE, bench_hex_ref);
+  ATutil_convertBinToHexaString(bench_bin, BENCH_SIZE, bench_hex);
+  ok = ok && (memcmp(bench_hex, bench_hex_ref, sizeof(bench_hex)) == 0);
+  for (i = 0U; i < (2U * BENCH_SIZE); i += 3U)
+  {
+    bench_toggle_case(&bench_hex[i]);
+    bench_toggle_case(&bench_hex_ref[i]);
+  }
+  ok = ok && bench_ref_decode(bench_hex_ref, BENCH_SIZE, bench_out_ref);
+  ok = ok && ATutil_convertHexaStringToBin(bench_hex, BENCH_SIZE, bench_out);
+  ok = ok && (memcmp(bench_out, bench_bin, sizeof(bench_out)) == 0)
+       && (memcmp(bench_out_ref, bench_bin, sizeof(bench_out_ref)) == 0);
+  if (ok == false)
+  {
+    (void)printf("FAIL: word conversions differ from the per character conversions\n");
+    ret = HOST_EXIT_FAILURE;
+  }
+
+  (void)printf("%u bytes converted %u times\n", BENCH_SIZE, BENCH_ROUNDS);
+  for (i = 0U; i < 4U; i++)
+  {
+    (void)printf("%-16s %8.1f MB/s\n", results[i].p_name, bench_mbps(results[i].ns));
+  }
+
+  if (argc > 1)
+  {
+    p_csv = fopen(argv[1], "w");
+    if (p_csv != NULL)
+    {
+      (void)fprintf(p_csv, "conversion,bytes,rounds,mb_per_s\n");
+      for (i = 0U; i < 4U; i++)
+      {
+        (void)fprintf(p_csv, "%s,%u,%u,%.1f\n", results[i].p_name, BENCH_SIZE, BENCH_ROUNDS,
+                      bench_mbps(results[i].ns));
+      }
+      (void)fclose(p_csv);
+    }
+  }
+  if (ret == HOST_EXIT_OK)
+  {
+    (void)printf("PASS\n");
+  }
+  return ret;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
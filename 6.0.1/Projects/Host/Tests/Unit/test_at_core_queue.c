@@ -0,0 +1,567 @@
+/**
+  ******************************************************************************
+  * @file    test_at_core_queue.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: queue of the AT requests processed by ATCore task.
+  *          The AT parser and the IPC are replaced by fakes: a request of
+  *          n steps sends n commands, the fake IPC answers each command at
+  *          once (final result code), except the command held by the test.
+  *          Checked:
+  *          - synchronous (AT_sendcmd) and asynchronous (AT_sendcmd_async)
+  *            requests queued while a transaction is ongoing are processed in
+  *            order, their commands built and sent by ATCore task, the
+  *            completion callbacks called by ATCore task;
+  *          - no free request context: AT_sendcmd_async refused, accepted
+  *            again when the contexts are freed;
+  *          - AT_sendcmd called by ATCore task (completion callback) refused;
+  *          - step boundary: transaction suspended, ATSTEP_YIELD called by
+  *            its client thread while another transaction is processed, then
+  *            resumed; no semaphore released while already full, no mutex
+  *            released by a non owner.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+#include "rtosal.h"
+
+/* request contexts, callbacks of the IPC and ATCore task id are private: the AT Core source is part of this test */
+#include "../../../../Middlewares/ST/STM32_Cellular/Core/AT_Core/Src/at_core.c"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_LOG_SIZE        (256U)
+#define TEST_TIMEOUT         (5000U)  /* in ms */
+#define TEST_SID_NONE        ((at_msg_t) 0U)
+
+/* Private typedef -----------------------------------------------------------*/
+/* fake parser: a request of steps commands, steps given by the first byte of the request parameters */
+typedef struct
+{
+  at_msg_t sid;
+  uint8_t  step;
+  uint8_t  steps;
+} test_parser_t;
+
+/* client thread: one synchronous request */
+typedef struct
+{
+  at_msg_t    sid;
+  at_buf_t    cmd_buf[ATCMD_MAX_BUF_SIZE];
+  at_buf_t    rsp_buf[ATCMD_MAX_BUF_SIZE];
+  at_status_t status;
+  osThreadId  thread_id;  /* set by the client thread */
+  osSemaphoreId done_sem; /* released when the request is done */
+} test_client_t;
+
+/* Private variables ---------------------------------------------------------*/
+static test_parser_t test_parser;
+static test_parser_t test_parser_suspended;
+static volatile uint32_t test_answers_nb;     /* answers received, not read yet */
+static volatile at_msg_t test_hold_sid;       /* answer of the first command of this SID held by the test */
+static volatile uint32_t test_held;           /* 1 when the held command has been sent */
+static volatile uint32_t test_not_atcore_nb;  /* commands not built by ATCore task */
+static char test_log[TEST_LOG_SIZE];          /* commands sent "<sid>.<step>", completion callbacks "c<sid>" */
+static volatile uint32_t test_callback_nb;
+static at_status_t test_callback_status[8];
+static at_status_t test_sendcmd_in_callback_status;
+static volatile uint32_t test_check_yield_nb;
+static volatile uint32_t test_check_yield_not_atcore_nb;
+static volatile uint32_t test_yield_nb;
+static bool test_yield_client_ok;
+
+static test_client_t test_client[2];
+static at_buf_t test_async_cmd_buf[ATCORE_REQ_NB + 1U][ATCMD_MAX_BUF_SIZE];
+static at_buf_t test_async_rsp_buf[ATCORE_REQ_NB + 1U][ATCMD_MAX_BUF_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value);
+static void test_log_add(const char *p_event, at_msg_t sid, uint8_t step);
+static void test_wait(const volatile uint32_t *p_value, uint32_t expected, const char *p_msg);
+static void test_check_log(const char *p_step, const char *p_expected);
+static uint32_t test_pending_nb(void);
+static void test_answer(void);
+static void test_client_start(test_client_t *p_client, at_msg_t sid, uint8_t steps);
+static void test_client_wait(test_client_t *p_client, const char *p_msg);
+static void test_client_thread(void const *p_arg);
+static at_status_t test_async(uint32_t idx, at_msg_t sid, uint8_t steps);
+static void test_req_callback(at_msg_t msg_id, at_status_t status, at_buf_t *p_rsp_buf, void *p_cb_ctx);
+static bool test_step_callback(at_msg_t msg_id, at_step_event_t event);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value)
+{
+  (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  exit(HOST_EXIT_FAILURE);
+}
+
+/* called by ATCore task only */
+static void test_log_add(const char *p_event, at_msg_t sid, uint8_t step)
+{
+  size_t len = strlen(test_log);
+
+  if (*p_event == 'c')
+  {
+    (void)snprintf(&test_log[len], TEST_LOG_SIZE - len, "%sc%u", (len != 0U) ? " " : "", sid);
+  }
+  else
+  {
+    (void)snprintf(&test_log[len], TEST_LOG_SIZE - len, "%s%u.%u", (len != 0U) ? " " : "", sid, step);
+  }
+}
+
+static void test_wait(const volatile uint32_t *p_value, uint32_t expected, const char *p_msg)
+{
+  uint32_t wait = 0U;
+
+  while ((*p_value != expected) && (wait < TEST_TIMEOUT))
+  {
+    (void)rtosalDelay(10U);
+    wait += 10U;
+  }
+  if (*p_value != expected)
+  {
+    test_fail(p_msg, *p_value);
+  }
+}
+
+static void test_check_log(const char *p_step, const char *p_expected)
+{
+  (void)printf("%s: %s\n", p_step, test_log);
+  if (strcmp(test_log, p_expected) != 0)
+  {
+    test_fail("order of the AT commands and of the completions, expected events", (uint32_t)strlen(p_expected));
+  }
+  test_log[0] = '\0';
+}
+
+static uint32_t test_pending_nb(void)
+{
+  uint32_t nb = 0U;
+
+  IRQ_DISABLE();
+  for (const atcore_req_t *p_req = p_atcore_req_head; p_req != NULL; p_req = p_req->p_next)
+  {
+    nb++;
+  }
+  IRQ_ENABLE();
+
+  return nb;
+}
+
+/* answer of the held command received */
+static void test_answer(void)
+{
+  IRQ_DISABLE();
+  test_answers_nb++;
+  IRQ_ENABLE();
+  msgReceivedCallback(&ipcHandleTab);
+}
+
+static void test_client_start(test_client_t *p_client, at_msg_t sid, uint8_t steps)
+{
+  p_client->sid = sid;
+  p_client->cmd_buf[0] = steps;
+  p_client->status = ATSTATUS_ERROR;
+  (void)rtosalThreadNew((const rtosal_char_t *)"client", test_client_thread, osPriorityNormal, 2048U,
+                        (void *)p_client);
+}
+
+static void test_client_wait(test_client_t *p_client, const char *p_msg)
+{
+  at_msg_t rsp_sid;
+
+  if (rtosalSemaphoreAcquire(p_client->done_sem, TEST_TIMEOUT) != osOK)
+  {
+    test_fail(p_msg, p_client->sid);
+  }
+  (void)memcpy(&rsp_sid, p_client->rsp_buf, sizeof(rsp_sid));
+  if ((p_client->status != ATSTATUS_OK) || (rsp_sid != p_client->sid))
+  {
+    test_fail("status or response of the synchronous request", p_client->sid);
+  }
+}
+
+static void test_client_thread(void const *p_arg)
+{
+  test_client_t *p_client = (test_client_t *)p_arg;
+
+  p_client->thread_id = rtosalThreadGetId();
+  p_client->status = AT_sendcmd(AT_HANDLE_MODEM, p_client->sid, p_client->cmd_buf, p_client->rsp_buf);
+  (void)rtosalSemaphoreRelease(p_client->done_sem);
+}
+
+static at_status_t test_async(uint32_t idx, at_msg_t sid, uint8_t steps)
+{
+  test_async_cmd_buf[idx][0] = steps;
+  return (AT_sendcmd_async(AT_HANDLE_MODEM, sid, test_async_cmd_buf[idx], test_async_rsp_buf[idx],
+                           test_req_callback, (void *)&test_callback_status[idx]));
+}
+
+static void test_req_callback(at_msg_t msg_id, at_status_t status, at_buf_t *p_rsp_buf, void *p_cb_ctx)
+{
+  at_msg_t rsp_sid;
+
+  (void)memcpy(&rsp_sid, p_rsp_buf, sizeof(rsp_sid));
+  *(at_status_t *)p_cb_ctx = ((status == ATSTATUS_OK) && (rsp_sid == msg_id)) ? ATSTATUS_OK : ATSTATUS_ERROR;
+  if (rtosalThreadGetId() != atcoreTaskId)
+  {
+    *(at_status_t *)p_cb_ctx = ATSTATUS_ERROR;
+  }
+  test_log_add("c", msg_id, 0U);
+
+  if (msg_id == (at_msg_t)111U)
+  {
+    /* a synchronous request from ATCore task would wait for itself */
+    test_sendcmd_in_callback_status = AT_sendcmd(AT_HANDLE_MODEM, (at_msg_t)119U, test_async_cmd_buf[0],
+                                                 test_async_rsp_buf[0]);
+  }
+  test_callback_nb++;
+}
+
+static bool test_step_callback(at_msg_t msg_id, at_step_event_t event)
+{
+  bool retval = false;
+
+  if (event == ATSTEP_CHECK_YIELD)
+  {
+    if (rtosalThreadGetId() != atcoreTaskId)
+    {
+      test_check_yield_not_atcore_nb++;
+    }
+    test_check_yield_nb++;
+    retval = (msg_id == (at_msg_t)130U);
+  }
+  else
+  {
+    /* client thread of the suspended transaction: another client is processed meanwhile */
+    test_yield_client_ok = (rtosalThreadGetId() == test_client[0].thread_id);
+    test_yield_nb++;
+    test_client_start(&test_client[1], (at_msg_t)131U, 2U);
+    test_client_wait(&test_client[1], "request processed during the yield");
+  }
+
+  return retval;
+}
+
+static void test_main(void const *p_arg)
+{
+  sysctrl_info_t device_infos;
+  host_os_stats_t os_stats;
+  uint32_t i;
+
+  (void)p_arg;
+
+  device_infos.type = DEVTYPE_MODEM_CELLULAR;
+  device_infos.ipc_device = IPC_DEVICE_0;
+  device_infos.ipc_interface = IPC_INTERFACE_UART;
+  if ((AT_init() != ATSTATUS_OK) || (AT_open(&device_infos, NULL) != AT_HANDLE_MODEM) ||
+      (atcore_task_start(osPriorityNormal, 2048U) != ATSTATUS_OK))
+  {
+    test_fail("AT Core init", 0U);
+  }
+
+  /* 1. requests queued while the first command of 101 waits for its answer: processed in order by ATCore task */
+  test_hold_sid = (at_msg_t)101U;
+  test_client_start(&test_client[0], (at_msg_t)101U, 2U);
+  test_wait(&test_held, 1U, "first command of 101 sent");
+  if ((test_async(0U, (at_msg_t)102U, 1U) != ATSTATUS_OK) || (test_async(1U, (at_msg_t)103U, 1U) != ATSTATUS_OK))
+  {
+    test_fail("asynchronous requests refused", 0U);
+  }
+  test_client_start(&test_client[1], (at_msg_t)104U, 1U);
+  while (test_pending_nb() != 3U)
+  {
+    (void)rtosalDelay(1U);
+  }
+  test_hold_sid = TEST_SID_NONE;
+  test_answer();
+  test_client_wait(&test_client[0], "101 not done");
+  test_client_wait(&test_client[1], "104 not done");
+  test_wait(&test_callback_nb, 2U, "completion callbacks");
+  test_check_log("queued", "101.0 101.1 102.0 c102 103.0 c103 104.0");
+  if ((test_callback_status[0] != ATSTATUS_OK) || (test_callback_status[1] != ATSTATUS_OK))
+  {
+    test_fail("status, response or thread of the asynchronous requests", 0U);
+  }
+
+  /* 2. no free request context: asynchronous request refused, synchronous request refused in ATCore task */
+  test_callback_nb = 0U;
+  test_held = 0U;
+  test_hold_sid = (at_msg_t)110U;
+  test_client_start(&test_client[0], (at_msg_t)110U, 1U);
+  test_wait(&test_held, 1U, "command of 110 sent");
+  for (i = 0U; i < (ATCORE_REQ_NB - 1U); i++)
+  {
+    if (test_async(i, (at_msg_t)(111U + i), 1U) != ATSTATUS_OK)
+    {
+      test_fail("asynchronous request refused with free contexts", i);
+    }
+  }
+  if (test_async(ATCORE_REQ_NB - 1U, (at_msg_t)118U, 1U) != ATSTATUS_ERROR)
+  {
+    test_fail("asynchronous request accepted without free context", ATCORE_REQ_NB);
+  }
+  test_hold_sid = TEST_SID_NONE;
+  test_answer();
+  test_client_wait(&test_client[0], "110 not done");
+  test_wait(&test_callback_nb, ATCORE_REQ_NB - 1U, "completion callbacks");
+  test_check_log("no free context", "110.0 111.0 c111 112.0 c112 113.0 c113");
+  if (test_sendcmd_in_callback_status != ATSTATUS_ERROR)
+  {
+    test_fail("AT_sendcmd accepted in ATCore task", 0U);
+  }
+  test_callback_nb = 0U;
+  if (test_async(0U, (at_msg_t)120U, 1U) != ATSTATUS_OK)
+  {
+    test_fail("asynchronous request refused after the contexts are freed", 0U);
+  }
+  test_wait(&test_callback_nb, 1U, "completion callback");
+  test_check_log("contexts freed", "120.0 c120");
+
+  /* 3. 130 suspended at its step boundary, 131 processed during the yield, then 130 resumed */
+  AT_set_step_callback(test_step_callback);
+  test_client_start(&test_client[0], (at_msg_t)130U, 2U);
+  test_client_wait(&test_client[0], "130 not done");
+  AT_set_step_callback(NULL);
+  test_check_log("step yield", "130.0 131.0 131.1 130.1");
+  if ((test_check_yield_nb != 1U) || (test_check_yield_not_atcore_nb != 0U) || (test_yield_nb != 1U) ||
+      (test_yield_client_ok == false))
+  {
+    test_fail("step callback calls or threads", test_check_yield_nb);
+  }
+
+  if (test_not_atcore_nb != 0U)
+  {
+    test_fail("commands not built by ATCore task", test_not_atcore_nb);
+  }
+  for (i = 0U; i < ATCORE_REQ_NB; i++)
+  {
+    if (atcore_req_tab[i].state != ATREQ_FREE)
+    {
+      test_fail("request context not freed", i);
+    }
+  }
+  host_os_get_stats(&os_stats);
+  if ((os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner) != 0U)
+  {
+    test_fail("semaphore or mutex misuse", os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner);
+  }
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/* fake AT parser */
+at_status_t ATParser_initParsers(sysctrl_device_type_t device_type)
+{
+  (void)device_type;
+  return ATSTATUS_OK;
+}
+
+void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback,
+                   IPC_CheckEndOfMsgBlockCallbackTypeDef *p_checkEndOfMsgBlockCallback)
+{
+  (void)p_at_ctxt;
+  (void)p_checkEndOfMsgCallback;
+  (void)p_checkEndOfMsgBlockCallback;
+}
+
+void ATParser_process_request(at_context_t *p_at_ctxt, at_msg_t msg_id, at_buf_t *p_cmd_buf)
+{
+  (void)p_at_ctxt;
+  test_parser.sid = msg_id;
+  test_parser.step = 0U;
+  test_parser.steps = p_cmd_buf[0];
+}
+
+at_action_send_t ATParser_get_ATcmd(at_context_t *p_at_ctxt, uint8_t *p_ATcmdBuf, uint16_t ATcmdBuf_maxSize,
+                                    uint16_t *p_ATcmdSize, uint32_t *p_ATcmdTimeout)
+{
+  at_action_send_t action = ATACTION_SEND_WAIT_MANDATORY_RSP;
+
+  (void)p_at_ctxt;
+  if (rtosalThreadGetId() != atcoreTaskId)
+  {
+    test_not_atcore_nb++;
+  }
+  *p_ATcmdSize = (uint16_t)snprintf((char *)p_ATcmdBuf, ATcmdBuf_maxSize, "AT%u.%u\r", test_parser.sid,
+                                    test_parser.step);
+  *p_ATcmdTimeout = TEST_TIMEOUT;
+  if ((test_parser.step + 1U) >= test_parser.steps)
+  {
+    action |= ATACTION_SEND_FLAG_LAST_CMD;
+  }
+  test_log_add("", test_parser.sid, test_parser.step);
+
+  return action;
+}
+
+at_action_rsp_t ATParser_parse_rsp(at_context_t *p_at_ctxt, IPC_RxMessage_t *p_message)
+{
+  (void)p_at_ctxt;
+  (void)p_message;
+  test_parser.step++;
+  return ((test_parser.step >= test_parser.steps) ? ATACTION_RSP_FRC_END : ATACTION_RSP_FRC_CONTINUE);
+}
+
+at_status_t ATParser_get_rsp(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf)
+{
+  (void)p_at_ctxt;
+  (void)memcpy(p_rsp_buf, &test_parser.sid, sizeof(test_parser.sid));
+  return ATSTATUS_OK;
+}
+
+at_status_t ATParser_get_urc(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf)
+{
+  (void)p_at_ctxt;
+  (void)p_rsp_buf;
+  return ATSTATUS_ERROR;
+}
+
+at_status_t ATParser_get_error(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf)
+{
+  (void)p_at_ctxt;
+  (void)p_rsp_buf;
+  return ATSTATUS_OK;
+}
+
+void ATParser_abort_request(at_context_t *p_at_ctxt)
+{
+  (void)p_at_ctxt;
+}
+
+at_status_t ATParser_suspend_request(at_context_t *p_at_ctxt)
+{
+  (void)p_at_ctxt;
+  test_parser_suspended = test_parser;
+  return ATSTATUS_OK;
+}
+
+void ATParser_resume_request(at_context_t *p_at_ctxt)
+{
+  (void)p_at_ctxt;
+  test_parser = test_parser_suspended;
+}
+
+/* fake IPC: every command is answered at once, except the one held by the test */
+IPC_Status_t IPC_open(IPC_Handle_t *const hipc, IPC_Device_t device, IPC_Mode_t mode,
+                      IPC_RxCallbackTypeDef pRxClientCallback, IPC_TxCallbackTypeDef pTxClientCallback,
+                      IPC_ErrCallbackTypeDef pErrorClientCallback, IPC_CheckEndOfMsgCallbackTypeDef pCheckEndOfMsg)
+{
+  (void)hipc;
+  (void)device;
+  (void)mode;
+  (void)pRxClientCallback;
+  (void)pTxClientCallback;
+  (void)pErrorClientCallback;
+  (void)pCheckEndOfMsg;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_setCheckEndOfMsgBlockCallback(IPC_Handle_t *const hipc,
+                                               IPC_CheckEndOfMsgBlockCallbackTypeDef pCheckEndOfMsgBlock)
+{
+  (void)hipc;
+  (void)pCheckEndOfMsgBlock;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_close(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_select(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_reset(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_abort(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Handle_t *IPC_get_other_channel(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return NULL;
+}
+
+IPC_Status_t IPC_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bufsize)
+{
+  (void)p_TxBuffer;
+  (void)bufsize;
+  msgSentCallback(hipc);
+  if ((test_parser.sid == test_hold_sid) && (test_parser.step == 0U))
+  {
+    test_held = 1U;
+  }
+  else
+  {
+    test_answer();
+  }
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_peek(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
+{
+  (void)hipc;
+  (void)p_msg;
+  return ((test_answers_nb != 0U) ? IPC_OK : IPC_ERROR);
+}
+
+IPC_Status_t IPC_release(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  IRQ_DISABLE();
+  test_answers_nb--;
+  IRQ_ENABLE();
+  return IPC_OK;
+}
+
+void IPC_DumpRXQueue(IPC_Handle_t *const hipc, uint8_t readable)
+{
+  (void)hipc;
+  (void)readable;
+}
+
+int main(void)
+{
+  host_platform_init();
+
+  for (uint32_t i = 0U; i < 2U; i++)
+  {
+    test_client[i].done_sem = rtosalSemaphoreNew(NULL, 1U);
+    (void)rtosalSemaphoreAcquire(test_client[i].done_sem, 0U);
+  }
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
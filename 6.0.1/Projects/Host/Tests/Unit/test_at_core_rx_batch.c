@@ -0,0 +1,465 @@
+/**
+  ******************************************************************************
+  * @file    test_at_core_rx_batch.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: batched parsing of the received messages by
+  *          ATCore task (USE_AT_CORE_RX_BATCH == 1). The AT parser and the
+  *          IPC are replaced by fakes: the fake IPC RX queue counts the
+  *          messages received and read, the fake parser checks each message
+  *          is parsed once, in the order of reception.
+  *          Checked:
+  *          - messages received in one burst before ATCore task wakes up: one
+  *            signal, all parsed in one wake-up, reception statistics
+  *            (wake-ups, messages, max messages per wake-up);
+  *          - message received while ATCore task parses the previous ones:
+  *            no new signal, parsed by the same wake-up;
+  *          - message received once the wake-up is over: signaled again;
+  *          - messages received in random bursts by another thread while
+  *            ATCore task parses: none lost, less wake-ups than messages.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+#include "rtosal.h"
+
+/* callback of the IPC and reception counters are private: the AT Core source is part of this test */
+#include "../../../../Middlewares/ST/STM32_Cellular/Core/AT_Core/Src/at_core.c"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_TIMEOUT         (5000U)  /* in ms */
+#define TEST_BURST_NB        (5U)     /* messages received before ATCore task wakes up */
+#define TEST_STRESS_NB       (10000U) /* messages received by the producer thread */
+#define TEST_STRESS_BURST    (8U)     /* max messages of a producer burst */
+#define TEST_UNREAD_MAX      (128U)   /* unread messages of the fake IPC RX queue (MsgReceived is 8-bit) */
+#define TEST_GATE_NONE       (0xFFFFFFFFU)
+
+#if (USE_AT_CORE_RX_BATCH != 1)
+#error "test_at_core_rx_batch must be built with USE_AT_CORE_RX_BATCH == 1"
+#endif /* USE_AT_CORE_RX_BATCH != 1 */
+
+/* Private variables ---------------------------------------------------------*/
+static volatile uint32_t test_rx_written;     /* messages received by the fake IPC */
+static volatile uint32_t test_rx_read;        /* messages released by ATCore task */
+static volatile uint32_t test_parsed_nb;      /* messages parsed */
+static volatile uint32_t test_order_errors;   /* messages not parsed in order, or parsed twice */
+static volatile uint32_t test_gate_msg;       /* parsing of this message waits for the test */
+static osSemaphoreId test_parsing_sem;        /* released when the parsing of the gate message starts */
+static osSemaphoreId test_gate_sem;           /* released by the test to end the parsing of the gate message */
+static osSemaphoreId test_producer_sem;       /* released when the producer thread is done */
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value);
+static void test_receive(void);
+static void test_wait_parsed(uint32_t expected, const char *p_msg);
+static void test_check_stats(const at_rx_stats_t *p_before, uint32_t wakeup_nb, uint32_t msg_nb, const char *p_msg);
+static void test_producer_thread(void const *p_arg);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value)
+{
+  (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  exit(HOST_EXIT_FAILURE);
+}
+
+/* one message received by the fake IPC */
+static void test_receive(void)
+{
+  IRQ_DISABLE();
+  test_rx_written++;
+  IRQ_ENABLE();
+  msgReceivedCallback(&ipcHandleTab);
+}
+
+/* wait the parsing of the expected messages, and the end of the ATCore task wake-up that parsed them */
+static void test_wait_parsed(uint32_t expected, const char *p_msg)
+{
+  uint32_t waited = 0U;
+  bool signaled;
+
+  do
+  {
+    IRQ_DISABLE();
+    signaled = (MsgSignaled != 0U);
+    IRQ_ENABLE();
+    if ((test_parsed_nb == expected) && (signaled == false))
+    {
+      break;
+    }
+    (void)rtosalDelay(1U);
+    waited++;
+  } while (waited < TEST_TIMEOUT);
+
+  if (waited >= TEST_TIMEOUT)
+  {
+    test_fail(p_msg, test_parsed_nb);
+  }
+  /* statistics are updated once the loop is left: let ATCore task wait for the next signal */
+  (void)rtosalDelay(10U);
+  if (test_parsed_nb != expected)
+  {
+    test_fail(p_msg, test_parsed_nb);
+  }
+}
+
+static void test_check_stats(const at_rx_stats_t *p_before, uint32_t wakeup_nb, uint32_t msg_nb, const char *p_msg)
+{
+  at_rx_stats_t stats;
+
+  AT_get_rx_stats(&stats);
+  if ((stats.wakeup_nb - p_before->wakeup_nb) != wakeup_nb)
+  {
+    (void)printf("%s: %u wake-ups\n", p_msg, stats.wakeup_nb - p_before->wakeup_nb);
+    test_fail("ATCore task wake-ups", stats.wakeup_nb - p_before->wakeup_nb);
+  }
+  if ((stats.msg_nb - p_before->msg_nb) != msg_nb)
+  {
+    (void)printf("%s: %u messages\n", p_msg, stats.msg_nb - p_before->msg_nb);
+    test_fail("messages counted", stats.msg_nb - p_before->msg_nb);
+  }
+}
+
+/* messages received in random bursts while ATCore task parses */
+static void test_producer_thread(void const *p_arg)
+{
+  uint32_t sent = 0U;
+  uint32_t burst;
+
+  (void)p_arg;
+  srand(1U);
+  while (sent < TEST_STRESS_NB)
+  {
+    burst = 1U + ((uint32_t)rand() % TEST_STRESS_BURST);
+    /* RX queue full: wait for ATCore task */
+    while ((test_rx_written - test_rx_read) > (TEST_UNREAD_MAX - TEST_STRESS_BURST))
+    {
+      (void)rtosalDelay(1U);
+    }
+    for (uint32_t i = 0U; (i < burst) && (sent < TEST_STRESS_NB); i++)
+    {
+      test_receive();
+      sent++;
+    }
+    if (((uint32_t)rand() % 8U) == 0U)
+    {
+      (void)rtosalDelay(1U);
+    }
+  }
+  (void)rtosalSemaphoreRelease(test_producer_sem);
+  (void)rtosalThreadTerminate(NULL);
+}
+
+static void test_main(void const *p_arg)
+{
+  sysctrl_info_t device_infos;
+  host_os_stats_t os_stats;
+  at_rx_stats_t before;
+  at_rx_stats_t stats;
+  uint32_t expected;
+
+  (void)p_arg;
+
+  test_gate_msg = TEST_GATE_NONE;
+  device_infos.type = DEVTYPE_MODEM_CELLULAR;
+  device_infos.ipc_device = IPC_DEVICE_0;
+  device_infos.ipc_interface = IPC_INTERFACE_UART;
+  if ((AT_init() != ATSTATUS_OK) || (AT_open(&device_infos, NULL) != AT_HANDLE_MODEM) ||
+      (atcore_task_start(osPriorityNormal, 2048U) != ATSTATUS_OK))
+  {
+    test_fail("AT Core init", 0U);
+  }
+  /* let ATCore task wait for a signal */
+  (void)rtosalDelay(10U);
+
+  /* 1. messages received in one burst of the emulated interrupt context: ATCore task wakes up once */
+  AT_get_rx_stats(&before);
+  IRQ_DISABLE();
+  for (uint32_t i = 0U; i < TEST_BURST_NB; i++)
+  {
+    test_receive();
+  }
+  if ((MsgReceived != TEST_BURST_NB) || (MsgSignaled != 1U))
+  {
+    test_fail("messages counted before the wake-up", MsgReceived);
+  }
+  IRQ_ENABLE();
+  expected = TEST_BURST_NB;
+  test_wait_parsed(expected, "burst parsed");
+  test_check_stats(&before, 1U, TEST_BURST_NB, "burst");
+  AT_get_rx_stats(&stats);
+  if (stats.max_msg_per_wakeup != TEST_BURST_NB)
+  {
+    test_fail("max messages per wake-up", stats.max_msg_per_wakeup);
+  }
+
+  /* 2. message received while ATCore task parses: parsed by the same wake-up, not signaled again */
+  AT_get_rx_stats(&before);
+  test_gate_msg = expected;
+  test_receive();
+  if (rtosalSemaphoreAcquire(test_parsing_sem, TEST_TIMEOUT) != osOK)
+  {
+    test_fail("parsing of the first message", test_parsed_nb);
+  }
+  test_receive();
+  test_receive();
+  if ((MsgReceived != 2U) || (MsgSignaled != 1U))
+  {
+    test_fail("messages counted during the parsing", MsgReceived);
+  }
+  (void)rtosalSemaphoreRelease(test_gate_sem);
+  expected += 3U;
+  test_wait_parsed(expected, "messages received during the parsing");
+  /* a signal sent during the parsing would wake up ATCore task again, with no message to parse */
+  test_check_stats(&before, 1U, 3U, "during the parsing");
+
+  /* 3. message received once the wake-up is over: ATCore task is signaled again */
+  AT_get_rx_stats(&before);
+  test_receive();
+  expected++;
+  test_wait_parsed(expected, "message received after the wake-up");
+  test_check_stats(&before, 1U, 1U, "after the wake-up");
+
+  /* 4. messages received by another thread while ATCore task parses: none lost */
+  AT_get_rx_stats(&before);
+  (void)rtosalThreadNew((const rtosal_char_t *)"producer", test_producer_thread, osPriorityNormal, 2048U, NULL);
+  if (rtosalSemaphoreAcquire(test_producer_sem, 60000U) != osOK)
+  {
+    test_fail("producer thread", 0U);
+  }
+  expected += TEST_STRESS_NB;
+  test_wait_parsed(expected, "messages received by the producer");
+  AT_get_rx_stats(&stats);
+  (void)printf("producer: %u messages, %u wake-ups, max %u messages per wake-up\n",
+               stats.msg_nb - before.msg_nb, stats.wakeup_nb - before.wakeup_nb, stats.max_msg_per_wakeup);
+  if ((stats.msg_nb - before.msg_nb) != TEST_STRESS_NB)
+  {
+    test_fail("messages counted", stats.msg_nb - before.msg_nb);
+  }
+  if ((stats.wakeup_nb - before.wakeup_nb) >= TEST_STRESS_NB)
+  {
+    test_fail("one wake-up per message", stats.wakeup_nb - before.wakeup_nb);
+  }
+
+  if ((test_order_errors != 0U) || (test_rx_read != test_rx_written) || (MsgReceived != 0U))
+  {
+    test_fail("messages parsed once and in order", test_order_errors);
+  }
+  host_os_get_stats(&os_stats);
+  if ((os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner) != 0U)
+  {
+    test_fail("semaphore or mutex misuse", os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner);
+  }
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/* fake AT parser: every message is a response to ignore */
+at_status_t ATParser_initParsers(sysctrl_device_type_t device_type)
+{
+  (void)device_type;
+  return ATSTATUS_OK;
+}
+
+void ATParser_init(at_context_t *p_at_ctxt, IPC_CheckEndOfMsgCallbackTypeDef *p_checkEndOfMsgCallback,
+                   IPC_CheckEndOfMsgBlockCallbackTypeDef *p_checkEndOfMsgBlockCallback)
+{
+  (void)p_at_ctxt;
+  (void)p_checkEndOfMsgCallback;
+  (void)p_checkEndOfMsgBlockCallback;
+}
+
+void ATParser_process_request(at_context_t *p_at_ctxt, at_msg_t msg_id, at_buf_t *p_cmd_buf)
+{
+  (void)p_at_ctxt;
+  (void)msg_id;
+  (void)p_cmd_buf;
+}
+
+at_action_send_t ATParser_get_ATcmd(at_context_t *p_at_ctxt, uint8_t *p_ATcmdBuf, uint16_t ATcmdBuf_maxSize,
+                                    uint16_t *p_ATcmdSize, uint32_t *p_ATcmdTimeout)
+{
+  (void)p_at_ctxt;
+  (void)p_ATcmdBuf;
+  (void)ATcmdBuf_maxSize;
+  *p_ATcmdSize = 0U;
+  *p_ATcmdTimeout = TEST_TIMEOUT;
+  return ATACTION_SEND_ERROR;
+}
+
+at_action_rsp_t ATParser_parse_rsp(at_context_t *p_at_ctxt, IPC_RxMessage_t *p_message)
+{
+  (void)p_at_ctxt;
+  (void)p_message;
+  /* message parsed is the first unread one */
+  if ((test_rx_read != test_parsed_nb) || (test_rx_read >= test_rx_written))
+  {
+    test_order_errors++;
+  }
+  if (test_parsed_nb == test_gate_msg)
+  {
+    test_gate_msg = TEST_GATE_NONE;
+    (void)rtosalSemaphoreRelease(test_parsing_sem);
+    (void)rtosalSemaphoreAcquire(test_gate_sem, RTOSAL_WAIT_FOREVER);
+  }
+  test_parsed_nb++;
+  return ATACTION_RSP_IGNORED;
+}
+
+at_status_t ATParser_get_rsp(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf)
+{
+  (void)p_at_ctxt;
+  (void)p_rsp_buf;
+  return ATSTATUS_OK;
+}
+
+at_status_t ATParser_get_urc(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf)
+{
+  (void)p_at_ctxt;
+  (void)p_rsp_buf;
+  return ATSTATUS_ERROR;
+}
+
+at_status_t ATParser_get_error(at_context_t *p_at_ctxt, at_buf_t *p_rsp_buf)
+{
+  (void)p_at_ctxt;
+  (void)p_rsp_buf;
+  return ATSTATUS_OK;
+}
+
+void ATParser_abort_request(at_context_t *p_at_ctxt)
+{
+  (void)p_at_ctxt;
+}
+
+at_status_t ATParser_suspend_request(at_context_t *p_at_ctxt)
+{
+  (void)p_at_ctxt;
+  return ATSTATUS_OK;
+}
+
+void ATParser_resume_request(at_context_t *p_at_ctxt)
+{
+  (void)p_at_ctxt;
+}
+
+/* fake IPC: RX queue of the messages received by the test, read in order by ATCore task */
+IPC_Status_t IPC_open(IPC_Handle_t *const hipc, IPC_Device_t device, IPC_Mode_t mode,
+                      IPC_RxCallbackTypeDef pRxClientCallback, IPC_TxCallbackTypeDef pTxClientCallback,
+                      IPC_ErrCallbackTypeDef pErrorClientCallback, IPC_CheckEndOfMsgCallbackTypeDef pCheckEndOfMsg)
+{
+  (void)hipc;
+  (void)device;
+  (void)mode;
+  (void)pRxClientCallback;
+  (void)pTxClientCallback;
+  (void)pErrorClientCallback;
+  (void)pCheckEndOfMsg;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_setCheckEndOfMsgBlockCallback(IPC_Handle_t *const hipc,
+                                               IPC_CheckEndOfMsgBlockCallbackTypeDef pCheckEndOfMsgBlock)
+{
+  (void)hipc;
+  (void)pCheckEndOfMsgBlock;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_close(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_select(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_reset(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Status_t IPC_abort(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return IPC_OK;
+}
+
+IPC_Handle_t *IPC_get_other_channel(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  return NULL;
+}
+
+IPC_Status_t IPC_send(IPC_Handle_t *const hipc, uint8_t *p_TxBuffer, uint16_t bufsize)
+{
+  (void)hipc;
+  (void)p_TxBuffer;
+  (void)bufsize;
+  return IPC_ERROR;
+}
+
+IPC_Status_t IPC_peek(IPC_Handle_t *const hipc, IPC_RxMessage_t *const p_msg)
+{
+  IPC_Status_t status;
+
+  (void)hipc;
+  (void)p_msg;
+  IRQ_DISABLE();
+  status = (test_rx_read != test_rx_written) ? IPC_OK : IPC_ERROR;
+  IRQ_ENABLE();
+  return status;
+}
+
+IPC_Status_t IPC_release(IPC_Handle_t *const hipc)
+{
+  (void)hipc;
+  IRQ_DISABLE();
+  test_rx_read++;
+  IRQ_ENABLE();
+  return IPC_OK;
+}
+
+void IPC_DumpRXQueue(IPC_Handle_t *const hipc, uint8_t readable)
+{
+  (void)hipc;
+  (void)readable;
+}
+
+int main(void)
+{
+  host_platform_init();
+
+  test_parsing_sem = rtosalSemaphoreNew(NULL, 1U);
+  (void)rtosalSemaphoreAcquire(test_parsing_sem, 0U);
+  test_gate_sem = rtosalSemaphoreNew(NULL, 1U);
+  (void)rtosalSemaphoreAcquire(test_gate_sem, 0U);
+  test_producer_sem = rtosalSemaphoreNew(NULL, 1U);
+  (void)rtosalSemaphoreAcquire(test_producer_sem, 0U);
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,393 @@
+/**
+  ******************************************************************************
+  * @file    test_at_eom_block_replay.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: BG96 block end of message scanner
+  *          (ATCustom_BG96_checkEndOfMsgBlockCallback) against the per character
+  *          automaton (ATCustom_BG96_checkEndOfMsgCallback).
+  *          The characters received by the host in a modem trace are replayed
+  *          through both callbacks; the blocks given to the block callback are
+  *          split at random positions. Both must report the same ends of
+  *          message and leave the automaton in the same state.
+  *          Traces: captured trace given on the command line
+  *          (Traces/bg96_echoclient.trc) and generated sessions with socket
+  *          data containing <CR>, <LF>, "+QIRD" and "> ".
+  *          The commands sent by the host update the socket context as the
+  *          BG96 driver does (AT+QIRD data request, AT+QISEND prompt).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+
+/* the automaton context of the BG96 driver is private: the driver source is part of this test */
+#include "../../../../Drivers/BSP/X_STMOD_PLUS_MODEMS/BG96/AT_modem_bg96/Src/at_custom_modem_specific.c"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_MAX_TRANSFERS   (4096U)
+#define TEST_MAX_BYTES       (256U * 1024U)
+#define TEST_MAX_EOM         (TEST_MAX_BYTES)
+#define TEST_SPLITS          (50U)    /* random splits of the blocks for each trace */
+#define TEST_SESSIONS        (200U)   /* generated sessions */
+#define TEST_SESSION_ITEMS   (40U)    /* exchanges per generated session */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  to_modem;     /* 1: sent by the host, 0: received by the host */
+  uint32_t offset;       /* in test_bytes */
+  uint32_t size;
+} test_transfer_t;
+
+typedef struct
+{
+  uint32_t state;         /* automaton state after each transfer received */
+  uint32_t rx_data_state;
+  uint32_t send_state;
+  uint32_t count;
+  uint32_t expected;
+} test_snapshot_t;
+
+typedef struct
+{
+  uint32_t        eom_nb;
+  uint32_t        eom[TEST_MAX_EOM];                 /* index of the last character of each message */
+  test_snapshot_t snapshot[TEST_MAX_TRANSFERS];
+} test_result_t;
+
+/* Private variables ---------------------------------------------------------*/
+static test_transfer_t test_transfers[TEST_MAX_TRANSFERS];
+static uint32_t test_transfers_nb;
+static uint8_t test_bytes[TEST_MAX_BYTES];
+static uint32_t test_bytes_nb;
+static test_result_t test_ref;
+static test_result_t test_blk;
+static uint32_t test_rand_state = 0x2468ACEU;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t test_rand(void);
+static void test_add(uint8_t to_modem, const uint8_t *p_data, uint32_t size);
+static void test_add_str(uint8_t to_modem, const char *p_str);
+static int test_load(const char *p_path);
+static void test_generate(void);
+static void test_context_reset(void);
+static void test_context_update(const test_transfer_t *p_transfer);
+static void test_snapshot(test_snapshot_t *p_snapshot);
+static void test_replay(test_result_t *p_result, uint8_t by_block);
+static int test_compare(const char *p_name, uint32_t split);
+
+/* Private function Definition -----------------------------------------------*/
+static uint32_t test_rand(void)
+{
+  uint32_t x = test_rand_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  test_rand_state = x;
+  return x;
+}
+
+static void test_add(uint8_t to_modem, const uint8_t *p_data, uint32_t size)
+{
+  if ((test_transfers_nb < TEST_MAX_TRANSFERS) && ((test_bytes_nb + size) <= TEST_MAX_BYTES))
+  {
+    test_transfers[test_transfers_nb].to_modem = to_modem;
+    test_transfers[test_transfers_nb].offset = test_bytes_nb;
+    test_transfers[test_transfers_nb].size = size;
+    (void)memcpy(&test_bytes[test_bytes_nb], p_data, size);
+    test_bytes_nb += size;
+    test_transfers_nb++;
+  }
+}
+
+static void test_add_str(uint8_t to_modem, const char *p_str)
+{
+  test_add(to_modem, (const uint8_t *)p_str, (uint32_t)strlen(p_str));
+}
+
+/* trace format: one transfer per line, "< hex" sent by the host, "> hex" received by the host, "#" comment */
+static int test_load(const char *p_path)
+{
+  static char line[2U * 4096U + 16U];
+  uint8_t data[4096];
+  FILE *p_file = fopen(p_path, "r");
+  int ret = 0;
+
+  if (p_file == NULL)
+  {
+    (void)printf("FAIL: can not open %s\n", p_path);
+    ret = -1;
+  }
+  else
+  {
+    while (fgets(line, (int)sizeof(line), p_file) != NULL)
+    {
+      uint32_t size = 0U;
+      const char *p_hex = &line[2];
+
+      if ((line[0] == '<') || (line[0] == '>'))
+      {
+        while ((size < sizeof(data)) && (sscanf(&p_hex[2U * size], "%2hhx", &data[size]) == 1))
+        {
+          size++;
+        }
+        test_add((line[0] == '<') ? 1U : 0U, data, size);
+      }
+    }
+    (void)fclose(p_file);
+  }
+  return ret;
+}
+
+/* socket sessions with payloads made of the characters significant for the automaton */
+static void test_generate(void)
+{
+  static const char alphabet[] = "\r\n\r\n+QIRD: 12>  OK,\"ab";
+  char text[128];
+  uint8_t payload[1500];
+  uint8_t frame[sizeof(payload)];
+  uint32_t header_size;
+  uint32_t item;
+
+  for (item = 0U; item < TEST_SESSION_ITEMS; item++)
+  {
+    uint32_t size = 1U + (test_rand() % sizeof(payload));
+    uint32_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+      payload[i] = ((test_rand() % 4U) == 0U) ? (uint8_t)test_rand()
+                   : (uint8_t)alphabet[test_rand() % (sizeof(alphabet) - 1U)];
+    }
+
+    switch (test_rand() % 4U)
+    {
+      case 0:
+        /* TCP read */
+        (void)sprintf(text, "AT+QIRD=1,%u\r", (unsigned int)size);
+        test_add_str(1U, text);
+        (void)sprintf(text, "\r\n+QIRD: %u\r\n", (unsigned int)size);
+        test_add_str(0U, text);
+        test_add(0U, payload, size);
+        test_add_str(0U, "\r\n\r\nOK\r\n");
+        break;
+      case 1:
+        /* UDP read, header and payload in the same transfer */
+        size = (size > (sizeof(payload) - sizeof(text))) ? (sizeof(payload) - sizeof(text)) : size;
+        (void)sprintf(text, "AT+QIRD=1,%u\r", (unsigned int)size);
+        test_add_str(1U, text);
+        header_size = (uint32_t)sprintf((char *)frame, "\r\n+QIRD: %u,\"10.10.10.10\",7\r\n", (unsigned int)size);
+        (void)memcpy(&frame[header_size], payload, size);
+        test_add(0U, frame, header_size + size);
+        test_add_str(0U, "\r\n\r\nOK\r\n");
+        break;
+      case 2:
+        /* send */
+        (void)sprintf(text, "AT+QISEND=1,%u\r", (unsigned int)size);
+        test_add_str(1U, text);
+        test_add_str(0U, "\r\n> ");
+        test_add(1U, payload, size);
+        test_add_str(0U, "\r\nSEND OK\r\n");
+        break;
+      default:
+        /* URC and command without socket data */
+        test_add_str(0U, "\r\n+QIURC: \"recv\",1\r\n");
+        test_add_str(1U, "AT+QIRD=1,0\r");
+        test_add_str(0U, "\r\n+QIRD: 42,0,42\r\n\r\nOK\r\n");
+        break;
+    }
+  }
+  test_add_str(1U, "AT\r");
+  test_add_str(0U, "\r\nOK\r\n");
+}
+
+static void test_context_reset(void)
+{
+  BG96_ctxt.state_SyntaxAutomaton = WAITING_FOR_INIT_CR;
+  atcm_reset_SOCKET_context(&BG96_ctxt);
+}
+
+/* socket context changes done by the BG96 driver when these commands are sent */
+static void test_context_update(const test_transfer_t *p_transfer)
+{
+  const char *p_cmd = (const char *)&test_bytes[p_transfer->offset];
+  unsigned int conn_id;
+  unsigned int size;
+
+  if ((p_transfer->size > 2U) && (memcmp(p_cmd, "AT", 2) == 0))
+  {
+    if ((p_transfer->size > 8U) && (memcmp(p_cmd, "AT+QIRD=", 8) == 0) &&
+        (sscanf(&p_cmd[8], "%u,%u", &conn_id, &size) == 2) && (size != 0U))
+    {
+      /* data request: wait for +QIRD header (at_custom_modem_socket.c) */
+      BG96_ctxt.socket_ctxt.socket_rx_expected_buf_size = size;
+      BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received = 0U;
+      BG96_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_waiting_header;
+    }
+    else
+    {
+      BG96_ctxt.socket_ctxt.socket_RxData_state = SocketRxDataState_not_started;
+    }
+
+    if ((p_transfer->size > 10U) && (memcmp(p_cmd, "AT+QISEND=", 10) == 0))
+    {
+      BG96_ctxt.socket_ctxt.socket_send_state = SocketSendState_WaitingPrompt1st_greaterthan;
+    }
+    else
+    {
+      BG96_ctxt.socket_ctxt.socket_send_state = SocketSendState_No_Activity;
+    }
+  }
+}
+
+static void test_snapshot(test_snapshot_t *p_snapshot)
+{
+  p_snapshot->state = (uint32_t)BG96_ctxt.state_SyntaxAutomaton;
+  p_snapshot->rx_data_state = (uint32_t)BG96_ctxt.socket_ctxt.socket_RxData_state;
+  p_snapshot->send_state = (uint32_t)BG96_ctxt.socket_ctxt.socket_send_state;
+  p_snapshot->count = BG96_ctxt.socket_ctxt.socket_rx_count_bytes_received;
+  p_snapshot->expected = BG96_ctxt.socket_ctxt.socket_rx_expected_buf_size;
+}
+
+/* by_block 0: per character callback, otherwise block callback on blocks of random size */
+static void test_replay(test_result_t *p_result, uint8_t by_block)
+{
+  uint32_t t;
+
+  test_context_reset();
+  p_result->eom_nb = 0U;
+
+  for (t = 0U; t < test_transfers_nb; t++)
+  {
+    const test_transfer_t *p_transfer = &test_transfers[t];
+    uint32_t pos = p_transfer->offset;
+    uint32_t end = p_transfer->offset + p_transfer->size;
+
+    if (p_transfer->to_modem == 1U)
+    {
+      test_context_update(p_transfer);
+    }
+    else if (by_block == 0U)
+    {
+      for (; pos < end; pos++)
+      {
+        if (ATCustom_BG96_checkEndOfMsgCallback(test_bytes[pos]) == 1U)
+        {
+          p_result->eom[p_result->eom_nb] = pos;
+          p_result->eom_nb++;
+        }
+      }
+    }
+    else
+    {
+      /* same calls as the RX FIFO: callback called again on the rest of the block after each end of message */
+      while (pos < end)
+      {
+        uint32_t block_end = pos + 1U + (test_rand() % (end - pos));
+        while (pos < block_end)
+        {
+          uint8_t end_of_msg;
+          pos += ATCustom_BG96_checkEndOfMsgBlockCallback(&test_bytes[pos], (uint16_t)(block_end - pos), &end_of_msg);
+          if (end_of_msg == 1U)
+          {
+            p_result->eom[p_result->eom_nb] = pos - 1U;
+            p_result->eom_nb++;
+          }
+        }
+      }
+    }
+    test_snapshot(&p_result->snapshot[t]);
+  }
+}
+
+static int test_compare(const char *p_name, uint32_t split)
+{
+  int ret = 0;
+  uint32_t i;
+
+  if (test_blk.eom_nb != test_ref.eom_nb)
+  {
+    (void)printf("FAIL: %s split %u: %u messages, %u expected\n", p_name, split, test_blk.eom_nb, test_ref.eom_nb);
+    ret = -1;
+  }
+  for (i = 0U; (i < test_ref.eom_nb) && (ret == 0); i++)
+  {
+    if (test_blk.eom[i] != test_ref.eom[i])
+    {
+      (void)printf("FAIL: %s split %u: message %u ends at %u, expected %u\n", p_name, split, i,
+                   test_blk.eom[i], test_ref.eom[i]);
+      ret = -1;
+    }
+  }
+  for (i = 0U; (i < test_transfers_nb) && (ret == 0); i++)
+  {
+    if (memcmp(&test_blk.snapshot[i], &test_ref.snapshot[i], sizeof(test_snapshot_t)) != 0)
+    {
+      (void)printf("FAIL: %s split %u: automaton state differs after transfer %u\n", p_name, split, i);
+      ret = -1;
+    }
+  }
+  return ret;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  static atparser_context_t atp_ctxt;
+  uint32_t messages = 0U;
+  uint32_t bytes = 0U;
+  uint32_t session;
+  uint32_t split;
+  int ret = 0;
+
+  ATCustom_BG96_init(&atp_ctxt);
+
+  /* session 0: captured trace, next ones: generated */
+  for (session = 0U; (session <= TEST_SESSIONS) && (ret == 0); session++)
+  {
+    test_transfers_nb = 0U;
+    test_bytes_nb = 0U;
+    if (session == 0U)
+    {
+      ret = (argc > 1) ? test_load(argv[1]) : -1;
+    }
+    else
+    {
+      test_generate();
+    }
+
+    test_replay(&test_ref, 0U);
+    for (split = 0U; (split < TEST_SPLITS) && (ret == 0); split++)
+    {
+      test_replay(&test_blk, 1U);
+      ret = test_compare((session == 0U) ? "captured trace" : "generated session", split);
+    }
+    messages += test_ref.eom_nb;
+    bytes += test_bytes_nb;
+  }
+
+  if (ret == 0)
+  {
+    (void)printf("%u traces, %u bytes, %u messages, %u splits per trace: same framing\n",
+                 TEST_SESSIONS + 1U, bytes, messages, TEST_SPLITS);
+    (void)printf("PASS\n");
+  }
+  return (ret == 0) ? HOST_EXIT_OK : HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,252 @@
+/**
+  ******************************************************************************
+  * @file    test_at_util_hex.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: hexadecimal string conversions of at_util
+  *          (ATutil_convertBinToHexaString, ATutil_convertHexaStringToBin)
+  *          against a per character reference.
+  *          Checked: every byte value is encoded, every pair of characters
+  *          is decoded or rejected as the reference does; random buffers of
+  *          any size and alignment are converted both ways unchanged; an
+  *          invalid character at any position of the string is rejected;
+  *          no byte is written out of the destination.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+#include "at_util.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_MAX_SIZE        (1500U)  /* bytes: max. socket data of a Type1SC AT%SOCKETDATA command */
+#define TEST_RANDOM_NB       (20000U)
+#define TEST_INVALID_SIZE    (40U)    /* bytes: invalid character tested at each position of the string */
+#define TEST_GUARD           (8U)     /* bytes checked before and after the destination */
+#define TEST_GUARD_VALUE     ((uint8_t)0xA5U)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t test_bin[TEST_MAX_SIZE + 4U];
+static uint8_t test_hex[(2U * TEST_MAX_SIZE) + 4U];
+static uint8_t test_out[TEST_MAX_SIZE + 4U + (2U * TEST_GUARD)];
+static uint8_t test_str[(2U * TEST_MAX_SIZE) + 4U + (2U * TEST_GUARD)];
+static uint32_t test_errors;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state);
+static int32_t test_ref_digit(uint8_t digit);
+static void test_check(bool condition, const char *p_msg, uint32_t value);
+static void test_check_guards(const uint8_t *p_buf, uint32_t size, const char *p_msg, uint32_t value);
+static void test_bytes(void);
+static void test_pairs(void);
+static void test_random(void);
+static void test_invalid(void);
+
+/* Private function Definition -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state)
+{
+  /* xorshift32 */
+  uint32_t x = *p_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *p_state = x;
+  return x;
+}
+
+/* reference: value of an hexadecimal digit, -1 if not an hexadecimal digit */
+static int32_t test_ref_digit(uint8_t digit)
+{
+  int32_t value = -1;
+
+  if ((digit >= (uint8_t)'0') && (digit <= (uint8_t)'9'))
+  {
+    value = (int32_t)digit - (int32_t)'0';
+  }
+  else if ((digit >= (uint8_t)'a') && (digit <= (uint8_t)'f'))
+  {
+    value = (int32_t)digit - (int32_t)'a' + 10;
+  }
+  else if ((digit >= (uint8_t)'A') && (digit <= (uint8_t)'F'))
+  {
+    value = (int32_t)digit - (int32_t)'A' + 10;
+  }
+  else
+  {
+    /* not an hexadecimal digit */
+  }
+  return value;
+}
+
+static void test_check(bool condition, const char *p_msg, uint32_t value)
+{
+  if ((condition == false) && (test_errors < 20U))
+  {
+    (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  }
+  test_errors += (condition == false) ? 1U : 0U;
+}
+
+/* TEST_GUARD bytes before and after the size bytes of p_buf are unchanged */
+static void test_check_guards(const uint8_t *p_buf, uint32_t size, const char *p_msg, uint32_t value)
+{
+  uint32_t i;
+
+  for (i = 0U; i < TEST_GUARD; i++)
+  {
+    test_check((p_buf[i] == TEST_GUARD_VALUE) && (p_buf[TEST_GUARD + size + i] == TEST_GUARD_VALUE), p_msg, value);
+  }
+}
+
+/* every byte value: 2 lowercase digits */
+static void test_bytes(void)
+{
+  char expected[3];
+  uint32_t value;
+
+  for (value = 0U; value < 256U; value++)
+  {
+    test_bin[0] = (uint8_t)value;
+    ATutil_convertBinToHexaString(test_bin, 1U, test_hex);
+    (void)snprintf(expected, sizeof(expected), "%02x", value);
+    test_check(memcmp(test_hex, expected, 2U) == 0, "encode byte", value);
+  }
+}
+
+/* every pair of characters: decoded as the reference or rejected */
+static void test_pairs(void)
+{
+  uint32_t pair;
+
+  for (pair = 0U; pair < 65536U; pair++)
+  {
+    int32_t msd = test_ref_digit((uint8_t)(pair >> 8));
+    int32_t lsd = test_ref_digit((uint8_t)pair);
+    bool valid = (msd >= 0) && (lsd >= 0);
+    uint32_t i;
+
+    /* same pair alone (tail of the string) and in each position of 4 pairs (word conversion) */
+    test_str[0] = (uint8_t)(pair >> 8);
+    test_str[1] = (uint8_t)pair;
+    test_check(ATutil_convertHexaStringToBin(test_str, 1U, test_out) == valid, "decode pair validity", pair);
+    test_check((valid == false) || (test_out[0] == (uint8_t)((msd << 4) | lsd)), "decode pair", pair);
+    for (i = 0U; i < 4U; i++)
+    {
+      (void)memcpy(test_str, "30313233", 8U);
+      test_str[2U * i] = (uint8_t)(pair >> 8);
+      test_str[(2U * i) + 1U] = (uint8_t)pair;
+      test_check(ATutil_convertHexaStringToBin(test_str, 4U, test_out) == valid, "decode word validity", pair);
+      test_check((valid == false) || (test_out[i] == (uint8_t)((msd << 4) | lsd)), "decode word", pair);
+    }
+  }
+}
+
+/* random sizes, contents, digit cases and alignments: converted both ways unchanged */
+static void test_random(void)
+{
+  uint32_t state = 0x1234U;
+  uint32_t n;
+
+  for (n = 0U; n < TEST_RANDOM_NB; n++)
+  {
+    uint32_t size = test_rand(&state) % (TEST_MAX_SIZE + 1U);
+    uint32_t src_offset = test_rand(&state) % 4U;
+    uint32_t dst_offset = test_rand(&state) % 4U;
+    uint8_t *p_bin = &test_bin[src_offset];
+    uint8_t *p_str = &test_str[TEST_GUARD + dst_offset];
+    uint8_t *p_out = &test_out[TEST_GUARD + dst_offset];
+    uint32_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+      p_bin[i] = (uint8_t)test_rand(&state);
+    }
+
+    /* encode */
+    (void)memset(test_str, TEST_GUARD_VALUE, sizeof(test_str));
+    ATutil_convertBinToHexaString(p_bin, size, p_str);
+    test_check_guards(&test_str[dst_offset], 2U * size, "encode out of destination, size", size);
+    for (i = 0U; i < size; i++)
+    {
+      test_check((test_ref_digit(p_str[2U * i]) == (int32_t)(p_bin[i] >> 4))
+                 && (test_ref_digit(p_str[(2U * i) + 1U]) == (int32_t)(p_bin[i] & 0x0FU))
+                 && (p_str[2U * i] < (uint8_t)'g') && (p_str[(2U * i) + 1U] < (uint8_t)'g'),
+                 "encode, size", size);
+    }
+
+    /* decode, with uppercase digits */
+    for (i = 0U; i < (2U * size); i++)
+    {
+      if (((test_rand(&state) & 1U) != 0U) && (p_str[i] >= (uint8_t)'a'))
+      {
+        p_str[i] -= (uint8_t)('a' - 'A');
+      }
+    }
+    (void)memset(test_out, TEST_GUARD_VALUE, sizeof(test_out));
+    test_check(ATutil_convertHexaStringToBin(p_str, size, p_out), "decode validity, size", size);
+    test_check(memcmp(p_out, p_bin, size) == 0, "decode, size", size);
+    test_check_guards(&test_out[dst_offset], size, "decode out of destination, size", size);
+  }
+}
+
+/* an invalid character at each position of the string is rejected */
+static void test_invalid(void)
+{
+  static const uint8_t invalid[] = {'/', ':', '@', 'G', '`', 'g', 'x', ' ', 0x00U, 0x80U, 0xB0U, 0xE1U, 0xFFU};
+  uint32_t state = 0xBEEFU;
+  uint32_t size;
+
+  for (size = 1U; size <= TEST_INVALID_SIZE; size++)
+  {
+    uint32_t pos;
+
+    for (pos = 0U; pos < (2U * size); pos++)
+    {
+      uint32_t i;
+
+      for (i = 0U; i < size; i++)
+      {
+        test_bin[i] = (uint8_t)test_rand(&state);
+      }
+      ATutil_convertBinToHexaString(test_bin, size, test_str);
+      test_str[pos] = invalid[test_rand(&state) % sizeof(invalid)];
+      test_check(ATutil_convertHexaStringToBin(test_str, size, test_out) == false, "invalid accepted, position",
+                 (size << 16) | pos);
+    }
+  }
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  test_bytes();
+  test_pairs();
+  test_random();
+  test_invalid();
+
+  (void)printf("256 bytes encoded, 65536 pairs decoded, %u random buffers of up to %u bytes, "
+               "invalid character at each position up to %u bytes: %u errors\n",
+               TEST_RANDOM_NB, TEST_MAX_SIZE, TEST_INVALID_SIZE, test_errors);
+  if (test_errors != 0U)
+  {
+    return HOST_EXIT_FAILURE;
+  }
+  (void)printf("PASS\n");
+  return HOST_EXIT_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,327 @@
+/**
+  ******************************************************************************
+  * @file    test_com_poll.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: com_poll of the COM modem sockets
+  *          (com_poll_ip_modem, COM_POLL_WAITER_NB tasks waiting at the same
+  *          time). The Cellular Service is replaced by a fake modem: the
+  *          data ready indication is sent by the test (thread playing the
+  *          role of the AT core task).
+  *          Checked: a task waiting in com_poll is woken up by the data ready
+  *          indication and returns the readable socket; without event com_poll
+  *          returns 0 after the timeout (no wait with a 0 timeout); a handle
+  *          not allocated returns COM_POLLNVAL; a task calling com_poll while
+  *          COM_POLL_WAITER_NB tasks are waiting gets COM_SOCKETS_ERR_NOMEMORY
+  *          and the waiters are available again at the end of the waits.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+#include "rtosal.h"
+
+/* com_poll waiters are private: the COM source is part of this test */
+#include "../../../../Middlewares/ST/STM32_Cellular/Interface/Com/Src/com_sockets_ip_modem.c"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_SOCKET_HANDLE   (0)
+#define TEST_POLL_TIMEOUT    (100)    /* in ms - poll without event */
+#define TEST_POLL_WAIT_MAX   (5000)   /* in ms - poll woken up by an event */
+#define TEST_EVENT_DELAY     (20U)    /* in ms - event sent after the poll entry */
+
+#if (COM_POLL_WAITER_NB != 2U)
+#error "test_com_poll is written for COM_POLL_WAITER_NB == 2"
+#endif /* COM_POLL_WAITER_NB != 2U */
+
+#if (COM_RCV_PREFETCH != 0)
+#error "test_com_poll must be built with COM_SOCKETS_RCV_PREFETCH_SIZE == 0"
+#endif /* COM_RCV_PREFETCH != 0 */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  int32_t       sock;
+  int32_t       timeout;
+  int32_t       result;
+  int16_t       revents;
+  uint32_t      elapsed;
+  osSemaphoreId done_sem;
+} test_poller_t;
+
+/* Private variables ---------------------------------------------------------*/
+static cellular_socket_data_ready_callback_t test_data_ready_cb;
+static test_poller_t test_poller[COM_POLL_WAITER_NB];
+
+/* datacache entry of the Cellular Service (network status set by the test) */
+dc_com_res_id_t DC_CELLULAR_NIFMAN_INFO = DC_COM_INVALID_ENTRY;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_fail(const char *p_msg);
+static int32_t test_poll(int32_t sock, int32_t timeout, int16_t *p_revents, uint32_t *p_elapsed);
+static void test_poller_thread(void const *p_arg);
+static void test_wait_waiters(uint8_t nb);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_fail(const char *p_msg)
+{
+  (void)printf("FAIL: %s\n", p_msg);
+  exit(HOST_EXIT_FAILURE);
+}
+
+/* com_poll of one socket for COM_POLLIN */
+static int32_t test_poll(int32_t sock, int32_t timeout, int16_t *p_revents, uint32_t *p_elapsed)
+{
+  com_pollfd_t fds;
+  uint32_t start;
+  int32_t result;
+
+  fds.sock = sock;
+  fds.events = (int16_t)COM_POLLIN;
+  fds.revents = 0;
+  start = rtosalGetSysTimerCount();
+  result = com_poll_ip_modem(&fds, 1U, timeout);
+  *p_elapsed = rtosalGetSysTimerCount() - start;
+  *p_revents = fds.revents;
+
+  return result;
+}
+
+static void test_poller_thread(void const *p_arg)
+{
+  test_poller_t *p_poller = (test_poller_t *)p_arg;
+
+  p_poller->result = test_poll(p_poller->sock, p_poller->timeout, &p_poller->revents, &p_poller->elapsed);
+  (void)rtosalSemaphoreRelease(p_poller->done_sem);
+  for (;;)
+  {
+    (void)rtosalDelay(1000U);
+  }
+}
+
+/* wait until nb tasks wait in com_poll */
+static void test_wait_waiters(uint8_t nb)
+{
+  uint8_t used;
+  uint32_t i = 0U;
+
+  do
+  {
+    used = 0U;
+    for (uint8_t j = 0U; j < COM_POLL_WAITER_NB; j++)
+    {
+      used += (com_poll_waiter_used[j] == true) ? 1U : 0U;
+    }
+    if (used != nb)
+    {
+      (void)rtosalDelay(1U);
+      i++;
+    }
+  } while ((used != nb) && (i < 1000U));
+
+  if (used != nb)
+  {
+    test_fail("tasks not waiting in com_poll");
+  }
+}
+
+static void test_main(void const *p_arg)
+{
+  com_sockaddr_in_t addr;
+  int32_t sock;
+  int32_t result;
+  int16_t revents;
+  uint32_t elapsed;
+  UNUSED(p_arg);
+
+  if (com_init_ip_modem() == false)
+  {
+    test_fail("com_init_ip_modem");
+  }
+  com_sockets_network_is_up = true;
+
+  sock = com_socket_ip_modem(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+  (void)memset(&addr, 0, sizeof(addr));
+  addr.sin_len = (uint8_t)sizeof(addr);
+  addr.sin_family = COM_AF_INET;
+  addr.sin_port = COM_HTONS(7U);
+  addr.sin_addr.s_addr = COM_INADDR_ANY + 0x01020304U;
+  if ((sock < 0)
+      || (com_connect_ip_modem(sock, (const com_sockaddr_t *)&addr, (int32_t)sizeof(addr)) != COM_SOCKETS_ERR_OK))
+  {
+    test_fail("socket creation / connection");
+  }
+
+  /* no event: 0 returned immediately with a 0 timeout, after the timeout else */
+  result = test_poll(sock, 0, &revents, &elapsed);
+  if ((result != 0) || (revents != 0) || (elapsed >= (uint32_t)TEST_POLL_TIMEOUT))
+  {
+    test_fail("poll without event, no timeout");
+  }
+  result = test_poll(sock, TEST_POLL_TIMEOUT, &revents, &elapsed);
+  (void)printf("timeout: %ld after %u ms\n", result, elapsed);
+  if ((result != 0) || (revents != 0) || (elapsed < (uint32_t)TEST_POLL_TIMEOUT))
+  {
+    test_fail("poll without event, timeout");
+  }
+  result = test_poll(sock + 1, 0, &revents, &elapsed);
+  if ((result != 1) || (revents != (int16_t)COM_POLLNVAL))
+  {
+    test_fail("poll of a socket not allocated");
+  }
+
+  /* COM_POLL_WAITER_NB tasks waiting: no more waiter */
+  for (uint8_t i = 0U; i < COM_POLL_WAITER_NB; i++)
+  {
+    test_poller[i].sock = sock;
+    test_poller[i].timeout = (i == 0U) ? -1 : TEST_POLL_WAIT_MAX;
+    test_poller[i].result = COM_SOCKETS_ERR_GENERAL;
+    test_poller[i].done_sem = rtosalSemaphoreNew(NULL, 1U);
+    (void)rtosalSemaphoreAcquire(test_poller[i].done_sem, RTOSAL_WAIT_FOREVER);
+    (void)rtosalThreadNew((const rtosal_char_t *)"poller", test_poller_thread, osPriorityNormal, 2048U,
+                          (void *)&test_poller[i]);
+  }
+  test_wait_waiters(COM_POLL_WAITER_NB);
+  result = test_poll(sock, TEST_POLL_TIMEOUT, &revents, &elapsed);
+  if (result != COM_SOCKETS_ERR_NOMEMORY)
+  {
+    test_fail("poll with all the waiters used");
+  }
+
+  /* data arrival: the waiting tasks are woken up */
+  (void)rtosalDelay(TEST_EVENT_DELAY);
+  test_data_ready_cb(TEST_SOCKET_HANDLE);
+  for (uint8_t i = 0U; i < COM_POLL_WAITER_NB; i++)
+  {
+    if (rtosalSemaphoreAcquire(test_poller[i].done_sem, (uint32_t)TEST_POLL_WAIT_MAX * 2U) != osOK)
+    {
+      test_fail("poll not woken up by the data ready");
+    }
+    (void)printf("poller %u: %ld revents 0x%x after %u ms\n", i, test_poller[i].result,
+                 (uint16_t)test_poller[i].revents, test_poller[i].elapsed);
+    if ((test_poller[i].result != 1) || (test_poller[i].revents != (int16_t)COM_POLLIN)
+        || (test_poller[i].elapsed < TEST_EVENT_DELAY) || (test_poller[i].elapsed >= (uint32_t)TEST_POLL_WAIT_MAX))
+    {
+      test_fail("poll woken up by the data ready");
+    }
+  }
+
+  /* waiters released: data still not read, returned without wait */
+  test_wait_waiters(0U);
+  result = test_poll(sock, TEST_POLL_TIMEOUT, &revents, &elapsed);
+  if ((result != 1) || (revents != (int16_t)COM_POLLIN) || (elapsed >= (uint32_t)TEST_POLL_TIMEOUT))
+  {
+    test_fail("poll after the waiters release");
+  }
+
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+socket_handle_t osCDS_socket_create(CS_IPaddrType_t addr_type, CS_TransportProtocol_t protocol,
+                                    CS_PDN_conf_id_t cid)
+{
+  UNUSED(addr_type);
+  UNUSED(protocol);
+  UNUSED(cid);
+  return TEST_SOCKET_HANDLE;
+}
+
+CS_Status_t osCDS_socket_set_callbacks(socket_handle_t sockHandle,
+                                       cellular_socket_data_ready_callback_t data_ready_cb,
+                                       cellular_socket_data_sent_callback_t data_sent_cb,
+                                       cellular_socket_closed_callback_t remote_close_cb)
+{
+  UNUSED(sockHandle);
+  UNUSED(data_sent_cb);
+  UNUSED(remote_close_cb);
+  test_data_ready_cb = data_ready_cb;
+  return CELLULAR_OK;
+}
+
+CS_Status_t osCDS_socket_connect(socket_handle_t sockHandle, CS_IPaddrType_t addr_type,
+                                 CS_CHAR_t *p_ip_addr_value, uint16_t remote_port)
+{
+  UNUSED(sockHandle);
+  UNUSED(addr_type);
+  UNUSED(p_ip_addr_value);
+  UNUSED(remote_port);
+  return CELLULAR_OK;
+}
+
+/* services of the COM modem sockets not used by the test */
+int32_t osCDS_socket_receive(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length)
+{
+  return -1;
+}
+
+int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length,
+                                 CS_IPaddrType_t *p_addr_type, CS_CHAR_t *p_ip_addr_value, uint16_t *p_remote_port)
+{
+  return -1;
+}
+
+CS_Status_t osCDS_socket_bind(socket_handle_t sockHandle, uint16_t local_port)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_socket_send(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_socket_sendv(socket_handle_t sockHandle, const CS_Iovec_t *p_iov, uint8_t iov_count)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_socket_sendto(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length,
+                                CS_IPaddrType_t addr_type, CS_CHAR_t *p_ip_addr_value, uint16_t remote_port)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_socket_close(socket_handle_t sockHandle, uint8_t force)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_dns_request(CS_PDN_conf_id_t cid, CS_DnsReq_t *dns_req, CS_DnsResp_t *dns_resp)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_ping(CS_PDN_conf_id_t cid, CS_Ping_params_t *ping_params,
+                       cellular_ping_response_callback_t cs_ping_rsp_cb)
+{
+  return CELLULAR_ERROR;
+}
+
+int main(void)
+{
+  (void)HAL_Init();
+  host_platform_init();
+
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,290 @@
+/**
+  ******************************************************************************
+  * @file    test_com_poll_lwip.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: com_poll of the COM LwIP sockets
+  *          (com_poll_lwip_mcu mapped on lwip_poll). The COM source is built
+  *          with the LwIP headers and the target LwIP configuration; LwIP
+  *          sockets are replaced by a scripted lwip_poll (the LwIP port of
+  *          the target does not run on a LP64 host).
+  *          Checked: the sockets and requested events of com_pollfd_t are
+  *          passed to lwip_poll, the events returned by lwip_poll are copied
+  *          back to the entry of each socket (readable socket, socket not
+  *          allocated), with the number of sockets with events; 0 is returned
+  *          at the timeout with no events; a negative timeout waits forever;
+  *          more sockets than netconns is refused without calling lwip_poll.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "host_platform.h"
+#include "com_sockets_lwip_mcu.h"
+#include "com_sockets_err_compat.h"
+
+#include "lwip/sockets.h"
+#include "lwip/api.h"
+#include "lwip/tcpip.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_NFDS_MAX   ((uint32_t)MEMP_NUM_NETCONN)
+
+#if (USE_SOCKETS_TYPE != USE_SOCKETS_LWIP)
+#error "test_com_poll_lwip must be built with USE_SOCKETS_TYPE == USE_SOCKETS_LWIP"
+#endif /* USE_SOCKETS_TYPE != USE_SOCKETS_LWIP */
+
+/* Private typedef -----------------------------------------------------------*/
+/* lwip_poll call: arguments received and result to return */
+typedef struct
+{
+  uint32_t      calls;
+  struct pollfd fds[MEMP_NUM_NETCONN];
+  nfds_t        nfds;
+  int           timeout;
+  int           ready_fd;      /* socket reported with ready_revents (-1: none) */
+  short         ready_revents;
+  int           result;
+} test_lwip_poll_t;
+
+/* Private variables ---------------------------------------------------------*/
+static test_lwip_poll_t test_lwip_poll;
+static uint32_t test_errors;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_check(bool condition, const char *p_msg);
+static void test_script(int ready_fd, short ready_revents, int result);
+static void test_ready(void);
+static void test_timeout(void);
+static void test_parameters(void);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_check(bool condition, const char *p_msg)
+{
+  if (condition == false)
+  {
+    (void)printf("FAIL: %s\n", p_msg);
+    test_errors++;
+  }
+}
+
+static void test_script(int ready_fd, short ready_revents, int result)
+{
+  (void)memset(&test_lwip_poll, 0, sizeof(test_lwip_poll));
+  test_lwip_poll.ready_fd = ready_fd;
+  test_lwip_poll.ready_revents = ready_revents;
+  test_lwip_poll.result = result;
+}
+
+/* data arrived on the second socket, third socket not allocated */
+static void test_ready(void)
+{
+  com_pollfd_t fds[3];
+  int32_t result;
+
+  fds[0].sock = 3;
+  fds[0].events = (int16_t)(COM_POLLIN | COM_POLLOUT);
+  fds[0].revents = (int16_t)COM_POLLERR;
+  fds[1].sock = 5;
+  fds[1].events = (int16_t)COM_POLLIN;
+  fds[1].revents = 0;
+  fds[2].sock = 9;
+  fds[2].events = (int16_t)COM_POLLIN;
+  fds[2].revents = 0;
+
+  test_script(5, POLLIN, 2);
+  result = com_poll_lwip_mcu(fds, 3U, 1000);
+
+  test_check(test_lwip_poll.calls == 1U, "ready: lwip_poll called once");
+  test_check((test_lwip_poll.nfds == 3U) && (test_lwip_poll.timeout == 1000), "ready: nfds / timeout");
+  test_check((test_lwip_poll.fds[0].fd == 3) && (test_lwip_poll.fds[0].events == (POLLIN | POLLOUT))
+             && (test_lwip_poll.fds[1].fd == 5) && (test_lwip_poll.fds[1].events == POLLIN)
+             && (test_lwip_poll.fds[2].fd == 9) && (test_lwip_poll.fds[2].events == POLLIN),
+             "ready: sockets and requested events");
+  test_check((test_lwip_poll.fds[0].revents == 0) && (test_lwip_poll.fds[1].revents == 0),
+             "ready: returned events reset before lwip_poll");
+  test_check(result == 2, "ready: number of sockets with events");
+  test_check((fds[0].revents == 0) && (fds[1].revents == (int16_t)COM_POLLIN)
+             && (fds[2].revents == (int16_t)COM_POLLNVAL), "ready: returned events");
+}
+
+/* no event until the timeout */
+static void test_timeout(void)
+{
+  com_pollfd_t fds;
+  int32_t result;
+
+  fds.sock = 3;
+  fds.events = (int16_t)COM_POLLIN;
+  fds.revents = (int16_t)COM_POLLIN;
+  test_script(-1, 0, 0);
+  result = com_poll_lwip_mcu(&fds, 1U, 100);
+  test_check((result == 0) && (fds.revents == 0) && (test_lwip_poll.timeout == 100), "timeout: no event");
+
+  test_script(-1, 0, 0);
+  result = com_poll_lwip_mcu(&fds, 1U, 0);
+  test_check((result == 0) && (test_lwip_poll.timeout == 0), "timeout: no wait");
+
+  /* negative value: wait forever */
+  test_script(3, POLLIN, 1);
+  result = com_poll_lwip_mcu(&fds, 1U, -5);
+  test_check((result == 1) && (fds.revents == (int16_t)COM_POLLIN) && (test_lwip_poll.timeout == -1),
+             "timeout: wait forever");
+}
+
+/* sockets set refused before lwip_poll */
+static void test_parameters(void)
+{
+  com_pollfd_t fds[MEMP_NUM_NETCONN + 1];
+
+  (void)memset(fds, 0, sizeof(fds));
+  test_script(-1, 0, 0);
+  test_check(com_poll_lwip_mcu(NULL, 1U, 0) == COM_SOCKETS_ERR_PARAMETER, "parameters: NULL");
+  test_check(com_poll_lwip_mcu(fds, 0U, 0) == COM_SOCKETS_ERR_PARAMETER, "parameters: no socket");
+  test_check(com_poll_lwip_mcu(fds, TEST_NFDS_MAX + 1U, 0) == COM_SOCKETS_ERR_PARAMETER,
+             "parameters: more sockets than netconns");
+  test_check(test_lwip_poll.calls == 0U, "parameters: lwip_poll not called");
+  test_check(com_poll_lwip_mcu(fds, TEST_NFDS_MAX, 0) == 0, "parameters: one socket per netconn");
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/* LwIP poll: scripted result */
+int lwip_poll(struct pollfd *fds, nfds_t nfds, int timeout)
+{
+  test_lwip_poll.calls++;
+  test_lwip_poll.nfds = nfds;
+  test_lwip_poll.timeout = timeout;
+  for (nfds_t i = 0U; i < nfds; i++)
+  {
+    test_lwip_poll.fds[i] = fds[i];
+    if (fds[i].fd == test_lwip_poll.ready_fd)
+    {
+      fds[i].revents = test_lwip_poll.ready_revents;
+    }
+    else if (fds[i].fd >= 8)
+    {
+      /* socket not allocated */
+      fds[i].revents = POLLNVAL;
+    }
+    else
+    {
+      /* no event */
+    }
+  }
+  return test_lwip_poll.result;
+}
+
+/* LwIP services of the COM LwIP sockets not used by the test */
+void tcpip_init(tcpip_init_done_fn tcpip_init_done, void *arg)
+{
+}
+
+int lwip_socket(int domain, int type, int protocol)
+{
+  return -1;
+}
+
+int lwip_setsockopt(int s, int level, int optname, const void *optval, socklen_t optlen)
+{
+  return -1;
+}
+
+int lwip_getsockopt(int s, int level, int optname, void *optval, socklen_t *optlen)
+{
+  return -1;
+}
+
+int lwip_bind(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  return -1;
+}
+
+int lwip_listen(int s, int backlog)
+{
+  return -1;
+}
+
+int lwip_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  return -1;
+}
+
+int lwip_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  return -1;
+}
+
+ssize_t lwip_send(int s, const void *dataptr, size_t size, int flags)
+{
+  return -1;
+}
+
+ssize_t lwip_sendmsg(int s, const struct msghdr *message, int flags)
+{
+  return -1;
+}
+
+ssize_t lwip_sendto(int s, const void *dataptr, size_t size, int flags, const struct sockaddr *to, socklen_t tolen)
+{
+  return -1;
+}
+
+ssize_t lwip_recv(int s, void *mem, size_t len, int flags)
+{
+  return -1;
+}
+
+ssize_t lwip_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from, socklen_t *fromlen)
+{
+  return -1;
+}
+
+int lwip_close(int s)
+{
+  return -1;
+}
+
+int lwip_getpeername(int s, struct sockaddr *name, socklen_t *namelen)
+{
+  return -1;
+}
+
+int lwip_getsockname(int s, struct sockaddr *name, socklen_t *namelen)
+{
+  return -1;
+}
+
+err_t netconn_gethostbyname(const char *name, ip_addr_t *addr)
+{
+  return ERR_ARG;
+}
+
+int main(void)
+{
+  test_ready();
+  test_timeout();
+  test_parameters();
+
+  (void)printf("poll mapping: %u errors\n", test_errors);
+  if (test_errors != 0U)
+  {
+    return HOST_EXIT_FAILURE;
+  }
+  (void)printf("PASS\n");
+  return HOST_EXIT_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
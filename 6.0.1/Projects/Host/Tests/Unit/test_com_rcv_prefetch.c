@@ -0,0 +1,505 @@
+/**
+  ******************************************************************************
+  * @file    test_com_rcv_prefetch.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: receive prefetch of the COM modem sockets
+  *          (COM_SOCKETS_RCV_PREFETCH_SIZE > 0, USE_CELLULAR_SERVICE_ASYNC_REQ == 1).
+  *          The Cellular Service is replaced by a scripted fake modem:
+  *          - a network thread writes a byte stream to the modem buffer in
+  *            chunks of random size and sends the data ready indication when
+  *            the modem buffer was empty (as the BG96 +QIURC: "recv"),
+  *          - asynchronous reads are processed in order by a request thread,
+  *            synchronous reads by the calling thread, one AT exchange at a
+  *            time, with random delays; some asynchronous reads are refused
+  *            (no free request context).
+  *          The application reads with random sizes, with COM_MSG_WAIT and
+  *          COM_MSG_DONTWAIT, then closes the socket while a prefetch read is
+  *          queued.
+  *          Checked: the stream is received once, in order, unchanged; no
+  *          direct read while a prefetch read is ongoing; COM_MSG_DONTWAIT
+  *          never waits and returns COM_SOCKETS_ERR_WOULDBLOCK if no data
+  *          is available; no socket close while a prefetch read is ongoing.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "host_platform.h"
+#include "rtosal.h"
+
+/* the waits of the COM sockets on the socket queue are checked by the test */
+rtosalStatus test_queue_get(osMessageQId queue_id, uint32_t *p_msg, uint32_t timeout);
+#define rtosalMessageQueueGet test_queue_get
+
+/* socket descriptors and prefetch management are private: the COM source is part of this test */
+#include "../../../../Middlewares/ST/STM32_Cellular/Interface/Com/Src/com_sockets_ip_modem.c"
+
+#undef rtosalMessageQueueGet
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_STREAM_SIZE     (200000U)  /* bytes sent by the network */
+#define TEST_CHUNK_MAX_SIZE  (400U)     /* network chunk */
+#define TEST_READ_MAX_SIZE   (300U)     /* application read */
+#define TEST_REQ_NB          (4U)       /* request contexts of the fake Cellular Service */
+#define TEST_SOCKET_HANDLE   (0)
+
+#if (COM_RCV_PREFETCH != 1)
+#error "test_com_rcv_prefetch must be built with COM_SOCKETS_RCV_PREFETCH_SIZE > 0"
+#endif /* COM_RCV_PREFETCH != 1 */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  bool                   used;
+  CS_CHAR_t              *p_buf;
+  uint32_t               length;
+  int32_t                *p_rcv_length;
+  osCDS_async_callback_t async_cb;
+  void                   *p_cb_ctx;
+} test_req_t;
+
+/* Private variables ---------------------------------------------------------*/
+static pthread_mutex_t test_modem_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t test_at_mutex = PTHREAD_MUTEX_INITIALIZER;    /* one AT exchange at a time */
+static uint32_t test_modem_written;   /* stream bytes written by the network */
+static uint32_t test_modem_read;      /* stream bytes read from the modem */
+static uint32_t test_async_ongoing;   /* asynchronous reads queued or processed */
+static uint32_t test_async_refused;
+static uint32_t test_direct_reads;
+static bool test_closed;
+static test_req_t test_req[TEST_REQ_NB];
+static osMessageQId test_req_queue;
+static cellular_socket_data_ready_callback_t test_data_ready_cb;
+static volatile bool test_in_dontwait;
+static volatile bool test_failed;
+
+/* datacache entry of the Cellular Service (network status set by the test) */
+dc_com_res_id_t DC_CELLULAR_NIFMAN_INFO = DC_COM_INVALID_ENTRY;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state);
+static uint8_t test_stream_byte(uint32_t idx);
+static void test_fail(const char *p_msg);
+static int32_t test_modem_receive(CS_CHAR_t *p_buf, uint32_t max_buf_length, uint32_t *p_delay_state);
+static test_req_t *test_req_alloc(void);
+static void test_req_thread(void const *p_arg);
+static void test_network(void const *p_arg);
+static void test_reader(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state)
+{
+  uint32_t x = *p_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *p_state = x;
+  return x;
+}
+
+/* byte idx of the stream: not periodic on the buffer and chunk sizes */
+static uint8_t test_stream_byte(uint32_t idx)
+{
+  return (uint8_t)((idx * 7U) ^ (idx >> 8) ^ (idx >> 16));
+}
+
+static void test_fail(const char *p_msg)
+{
+  (void)printf("FAIL: %s\n", p_msg);
+  test_failed = true;
+  exit(HOST_EXIT_FAILURE);
+}
+
+/* AT exchange reading the modem buffer: at most max_buf_length bytes of the stream */
+static int32_t test_modem_receive(CS_CHAR_t *p_buf, uint32_t max_buf_length, uint32_t *p_delay_state)
+{
+  uint32_t size;
+  uint32_t i;
+
+  (void)pthread_mutex_lock(&test_at_mutex);
+  /* AT exchange duration */
+  (void)usleep(test_rand(p_delay_state) % 200U);
+  (void)pthread_mutex_lock(&test_modem_mutex);
+  size = test_modem_written - test_modem_read;
+  size = (size < max_buf_length) ? size : max_buf_length;
+  for (i = 0U; i < size; i++)
+  {
+    p_buf[i] = (CS_CHAR_t)test_stream_byte(test_modem_read + i);
+  }
+  test_modem_read += size;
+  (void)pthread_mutex_unlock(&test_modem_mutex);
+  (void)pthread_mutex_unlock(&test_at_mutex);
+
+  return (int32_t)size;
+}
+
+static test_req_t *test_req_alloc(void)
+{
+  test_req_t *p_req = NULL;
+  uint32_t i;
+
+  (void)pthread_mutex_lock(&test_modem_mutex);
+  for (i = 0U; (i < TEST_REQ_NB) && (p_req == NULL); i++)
+  {
+    if (test_req[i].used == false)
+    {
+      test_req[i].used = true;
+      p_req = &test_req[i];
+    }
+  }
+  (void)pthread_mutex_unlock(&test_modem_mutex);
+
+  return p_req;
+}
+
+/* fake Cellular Service request thread: asynchronous requests processed in order */
+static void test_req_thread(void const *p_arg)
+{
+  uint32_t delay_state = 0x5EEDU;
+  uint32_t msg;
+  test_req_t *p_req;
+  UNUSED(p_arg);
+
+  for (;;)
+  {
+    if (rtosalMessageQueueGet(test_req_queue, &msg, RTOSAL_WAIT_FOREVER) == osEventMessage)
+    {
+      osCDS_async_callback_t async_cb;
+      void *p_cb_ctx;
+
+      p_req = &test_req[msg];
+      *p_req->p_rcv_length = test_modem_receive(p_req->p_buf, p_req->length, &delay_state);
+      async_cb = p_req->async_cb;
+      p_cb_ctx = p_req->p_cb_ctx;
+
+      (void)pthread_mutex_lock(&test_modem_mutex);
+      test_async_ongoing--;
+      p_req->used = false;
+      (void)pthread_mutex_unlock(&test_modem_mutex);
+      async_cb(CELLULAR_OK, p_cb_ctx);
+    }
+  }
+}
+
+/* network: stream written to the modem buffer, data ready indication if the modem buffer was empty
+   (thread playing the role of the AT core task for the indication) */
+static void test_network(void const *p_arg)
+{
+  uint32_t state = 0xCAFEU;
+  bool was_empty;
+  UNUSED(p_arg);
+
+  while ((test_modem_written < TEST_STREAM_SIZE) && (test_failed == false))
+  {
+    uint32_t chunk = 1U + (test_rand(&state) % TEST_CHUNK_MAX_SIZE);
+
+    (void)pthread_mutex_lock(&test_modem_mutex);
+    chunk = ((TEST_STREAM_SIZE - test_modem_written) < chunk) ? (TEST_STREAM_SIZE - test_modem_written) : chunk;
+    was_empty = (test_modem_written == test_modem_read);
+    test_modem_written += chunk;
+    (void)pthread_mutex_unlock(&test_modem_mutex);
+
+    if (was_empty == true)
+    {
+      /* URC received by the AT core task */
+      test_data_ready_cb(TEST_SOCKET_HANDLE);
+    }
+    (void)usleep(test_rand(&state) % 500U);
+  }
+  for (;;)
+  {
+    (void)rtosalDelay(1000U);
+  }
+}
+
+static void test_reader(void const *p_arg)
+{
+  static com_char_t buf[TEST_READ_MAX_SIZE];
+  uint32_t state = 0xBEEFU;
+  uint32_t received = 0U;
+  uint32_t wouldblock = 0U;
+  uint32_t dontwait_data = 0U;
+  com_sockaddr_in_t addr;
+  int32_t sock;
+  int32_t ret;
+  int32_t i;
+  UNUSED(p_arg);
+
+  if (com_init_ip_modem() == false)
+  {
+    test_fail("com_init_ip_modem");
+  }
+  com_sockets_network_is_up = true;
+
+  sock = com_socket_ip_modem(COM_AF_INET, COM_SOCK_STREAM, COM_IPPROTO_TCP);
+  (void)memset(&addr, 0, sizeof(addr));
+  addr.sin_len = (uint8_t)sizeof(addr);
+  addr.sin_family = COM_AF_INET;
+  addr.sin_port = COM_HTONS(7U);
+  addr.sin_addr.s_addr = COM_INADDR_ANY + 0x01020304U;
+  if ((sock < 0)
+      || (com_connect_ip_modem(sock, (const com_sockaddr_t *)&addr, (int32_t)sizeof(addr)) != COM_SOCKETS_ERR_OK))
+  {
+    test_fail("socket creation / connection");
+  }
+  (void)rtosalThreadNew((const rtosal_char_t *)"network", test_network, osPriorityNormal, 2048U, NULL);
+
+  while (received < TEST_STREAM_SIZE)
+  {
+    int32_t len = (int32_t)(1U + (test_rand(&state) % TEST_READ_MAX_SIZE));
+    bool dontwait = ((test_rand(&state) % 4U) == 0U);
+
+    test_in_dontwait = dontwait;
+    ret = com_recv_ip_modem(sock, buf, len, (dontwait == true) ? COM_MSG_DONTWAIT : COM_MSG_WAIT);
+    test_in_dontwait = false;
+
+    if (ret == COM_SOCKETS_ERR_WOULDBLOCK)
+    {
+      if (dontwait == false)
+      {
+        test_fail("COM_SOCKETS_ERR_WOULDBLOCK with COM_MSG_WAIT");
+      }
+      wouldblock++;
+      /* the application does something else */
+      (void)usleep(100U);
+    }
+    else if ((ret <= 0) || (ret > len))
+    {
+      (void)printf("FAIL: recv returned %ld after %u bytes\n", ret, received);
+      exit(HOST_EXIT_FAILURE);
+    }
+    else
+    {
+      for (i = 0; i < ret; i++)
+      {
+        if ((uint8_t)buf[i] != test_stream_byte(received + (uint32_t)i))
+        {
+          (void)printf("FAIL: byte %u: 0x%02x expected 0x%02x\n", received + (uint32_t)i, (uint8_t)buf[i],
+                       test_stream_byte(received + (uint32_t)i));
+          exit(HOST_EXIT_FAILURE);
+        }
+      }
+      received += (uint32_t)ret;
+      dontwait_data += (dontwait == true) ? 1U : 0U;
+      /* slow application from time to time: the prefetch buffer gets full */
+      if ((test_rand(&state) % 16U) == 0U)
+      {
+        (void)usleep(3000U);
+      }
+    }
+  }
+  (void)printf("%u bytes received, %u direct reads, %u prefetch reads refused, "
+               "DONTWAIT: %u with data, %u would block\n",
+               received, test_direct_reads, test_async_refused, dontwait_data, wouldblock);
+  if ((wouldblock == 0U) || (dontwait_data == 0U) || (test_direct_reads == 0U))
+  {
+    test_fail("DONTWAIT or direct read path not tested");
+  }
+
+  /* close while a prefetch read is queued: the close waits for the end of the read */
+  i = 0;
+  while ((test_async_ongoing == 0U) && (i < 16))
+  {
+    test_data_ready_cb(TEST_SOCKET_HANDLE);
+    i++;
+  }
+  if (test_async_ongoing == 0U)
+  {
+    test_fail("no prefetch read queued before the close");
+  }
+  if ((com_closesocket_ip_modem(sock) != COM_SOCKETS_ERR_OK) || (test_closed == false))
+  {
+    test_fail("socket close");
+  }
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/* com_recv with COM_MSG_DONTWAIT must not wait on the socket queue */
+rtosalStatus test_queue_get(osMessageQId queue_id, uint32_t *p_msg, uint32_t timeout)
+{
+  if ((test_in_dontwait == true) && (timeout != 0U))
+  {
+    test_fail("COM_MSG_DONTWAIT waits on the socket queue");
+  }
+  return (rtosalMessageQueueGet(queue_id, p_msg, timeout));
+}
+
+socket_handle_t osCDS_socket_create(CS_IPaddrType_t addr_type, CS_TransportProtocol_t protocol,
+                                    CS_PDN_conf_id_t cid)
+{
+  UNUSED(addr_type);
+  UNUSED(protocol);
+  UNUSED(cid);
+  return TEST_SOCKET_HANDLE;
+}
+
+CS_Status_t osCDS_socket_set_callbacks(socket_handle_t sockHandle,
+                                       cellular_socket_data_ready_callback_t data_ready_cb,
+                                       cellular_socket_data_sent_callback_t data_sent_cb,
+                                       cellular_socket_closed_callback_t remote_close_cb)
+{
+  UNUSED(sockHandle);
+  UNUSED(data_sent_cb);
+  UNUSED(remote_close_cb);
+  test_data_ready_cb = data_ready_cb;
+  return CELLULAR_OK;
+}
+
+CS_Status_t osCDS_socket_connect(socket_handle_t sockHandle, CS_IPaddrType_t addr_type,
+                                 CS_CHAR_t *p_ip_addr_value, uint16_t remote_port)
+{
+  UNUSED(sockHandle);
+  UNUSED(addr_type);
+  UNUSED(p_ip_addr_value);
+  UNUSED(remote_port);
+  return CELLULAR_OK;
+}
+
+/* synchronous read: processed by the calling thread, not in order with the queued requests */
+int32_t osCDS_socket_receive(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length)
+{
+  static uint32_t delay_state = 0xD1CEU;
+  UNUSED(sockHandle);
+
+  (void)pthread_mutex_lock(&test_modem_mutex);
+  if (test_async_ongoing != 0U)
+  {
+    /* data of the ongoing prefetch read would be returned after the data of this read */
+    (void)pthread_mutex_unlock(&test_modem_mutex);
+    test_fail("direct read while a prefetch read is ongoing");
+  }
+  test_direct_reads++;
+  (void)pthread_mutex_unlock(&test_modem_mutex);
+
+  return test_modem_receive(p_buf, max_buf_length, &delay_state);
+}
+
+CS_Status_t osCDS_socket_receive_async(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length,
+                                       int32_t *p_rcv_length, osCDS_async_callback_t async_cb, void *p_cb_ctx)
+{
+  static uint32_t refuse_state = 0xF00DU;
+  CS_Status_t status = CELLULAR_ERROR;
+  test_req_t *p_req = NULL;
+  uint32_t msg;
+  UNUSED(sockHandle);
+
+  (void)pthread_mutex_lock(&test_modem_mutex);
+  if ((test_rand(&refuse_state) % 4U) == 0U)
+  {
+    /* no free request context */
+    test_async_refused++;
+  }
+  else
+  {
+    test_async_ongoing++;
+    status = CELLULAR_OK;
+  }
+  (void)pthread_mutex_unlock(&test_modem_mutex);
+
+  if (status == CELLULAR_OK)
+  {
+    do
+    {
+      p_req = test_req_alloc();
+    } while (p_req == NULL);
+    p_req->p_buf = p_buf;
+    p_req->length = max_buf_length;
+    p_req->p_rcv_length = p_rcv_length;
+    p_req->async_cb = async_cb;
+    p_req->p_cb_ctx = p_cb_ctx;
+    msg = (uint32_t)(p_req - &test_req[0]);
+    (void)rtosalMessageQueuePut(test_req_queue, msg, RTOSAL_WAIT_FOREVER);
+  }
+
+  return status;
+}
+
+/* services of the COM modem sockets not used by the test */
+int32_t osCDS_socket_receivefrom(socket_handle_t sockHandle, CS_CHAR_t *p_buf, uint32_t max_buf_length,
+                                 CS_IPaddrType_t *p_addr_type, CS_CHAR_t *p_ip_addr_value, uint16_t *p_remote_port)
+{
+  return -1;
+}
+
+CS_Status_t osCDS_socket_bind(socket_handle_t sockHandle, uint16_t local_port)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_socket_send(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_socket_sendv(socket_handle_t sockHandle, const CS_Iovec_t *p_iov, uint8_t iov_count)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_socket_sendto(socket_handle_t sockHandle, const CS_CHAR_t *p_buf, uint32_t length,
+                                CS_IPaddrType_t addr_type, CS_CHAR_t *p_ip_addr_value, uint16_t remote_port)
+{
+  return CELLULAR_ERROR;
+}
+
+/* synchronous close: processed by the calling thread, not in order with the queued requests */
+CS_Status_t osCDS_socket_close(socket_handle_t sockHandle, uint8_t force)
+{
+  UNUSED(sockHandle);
+  UNUSED(force);
+
+  (void)pthread_mutex_lock(&test_modem_mutex);
+  if (test_async_ongoing != 0U)
+  {
+    /* the queued read would be processed on a closed (maybe re-allocated) modem socket */
+    (void)pthread_mutex_unlock(&test_modem_mutex);
+    test_fail("socket close while a prefetch read is ongoing");
+  }
+  test_closed = true;
+  (void)pthread_mutex_unlock(&test_modem_mutex);
+
+  return CELLULAR_OK;
+}
+
+CS_Status_t osCDS_dns_request(CS_PDN_conf_id_t cid, CS_DnsReq_t *dns_req, CS_DnsResp_t *dns_resp)
+{
+  return CELLULAR_ERROR;
+}
+
+CS_Status_t osCDS_ping(CS_PDN_conf_id_t cid, CS_Ping_params_t *ping_params,
+                       cellular_ping_response_callback_t cs_ping_rsp_cb)
+{
+  return CELLULAR_ERROR;
+}
+
+int main(void)
+{
+  (void)HAL_Init();
+  host_platform_init();
+
+  test_req_queue = rtosalMessageQueueNew(NULL, TEST_REQ_NB);
+  (void)rtosalThreadNew((const rtosal_char_t *)"req", test_req_thread, osPriorityNormal, 2048U, NULL);
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_reader, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
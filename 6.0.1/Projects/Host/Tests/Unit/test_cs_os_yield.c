@@ -0,0 +1,295 @@
+/**
+  ******************************************************************************
+  * @file    test_cs_os_yield.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: yield of a control plane request of the Cellular
+  *          Service to the data plane requests at its step boundaries.
+  *          The Cellular Service requests are replaced by scripted ones:
+  *          a network registration of three steps (control plane) and socket
+  *          connection status requests (data plane) A and B, A waiting for the
+  *          lock when the registration reaches its first step boundary, B
+  *          arriving after the yield and getting the lock before A (the RTOS
+  *          mutex does not give the lock to the waiting threads in order).
+  *          Checked: the registration yields once and resumes only when A is
+  *          done, not when B is done; every request is processed once; no
+  *          semaphore released while already full, no mutex released by a
+  *          non owner.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+#include "rtosal.h"
+#include "cellular_service_os.h"
+
+/* the requests of the Cellular Service and the lock taken by data plane request A are scripted by the test */
+CS_Status_t test_register_net(CS_OperatorSelector_t *p_operator, CS_RegistrationStatus_t *p_reg_status);
+CS_Status_t test_socket_cnx_status(socket_handle_t sockHandle, CS_SocketCnxInfos_t *infos);
+rtosalStatus test_mutex_acquire(osMutexId mutex_id, uint32_t timeout);
+#define CS_register_net        test_register_net
+#define CDS_socket_cnx_status  test_socket_cnx_status
+#define rtosalMutexAcquire     test_mutex_acquire
+
+/* lock, unlock and step callback are private: the Cellular Service OS source is part of this test */
+#include "../../../../Middlewares/ST/STM32_Cellular/Core/Cellular_Service/Src/cellular_service_os.c"
+
+#undef CS_register_net
+#undef CDS_socket_cnx_status
+#undef rtosalMutexAcquire
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_CTRL_STEPS      (3U)     /* AT lines of the BG96 SID_CS_REGISTER_NET */
+#define TEST_LOG_MAX         (16U)
+#define TEST_TIMEOUT         (5000U)  /* in ms */
+#define TEST_SETTLE          (100U)   /* in ms, to let an unexpected resume happen */
+
+#if (USE_CELLULAR_SERVICE_CTRL_YIELD != 1)
+#error "test_cs_os_yield must be built with USE_CELLULAR_SERVICE_CTRL_YIELD == 1"
+#endif /* USE_CELLULAR_SERVICE_CTRL_YIELD != 1 */
+
+/* Private variables ---------------------------------------------------------*/
+static osSemaphoreId test_ctrl_started_sem;  /* registration in its first step, lock taken */
+static osSemaphoreId test_ctrl_gate_sem;     /* end of the first step of the registration */
+static osSemaphoreId test_a_gate_sem;        /* lock given to A */
+static osSemaphoreId test_done_sem;          /* one per request done */
+static osThreadId test_thread_a;
+static volatile bool test_a_gated;
+static char test_log[TEST_LOG_MAX + 1U];     /* '1'..'3': steps of the registration, 'A', 'B': data plane */
+static volatile uint32_t test_log_nb;
+static uint32_t test_ctrl_ok;
+static uint32_t test_data_ok;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value);
+static void test_log_add(char event);
+static void test_wait(const volatile uint32_t *p_value, uint32_t expected, const char *p_msg);
+static void test_check_log(const char *p_step, const char *p_expected);
+static void test_ctrl_thread(void const *p_arg);
+static void test_data_thread(void const *p_arg);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value)
+{
+  (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  exit(HOST_EXIT_FAILURE);
+}
+
+/* called with the Cellular Service lock taken: one event at a time */
+static void test_log_add(char event)
+{
+  if (test_log_nb >= TEST_LOG_MAX)
+  {
+    test_fail("too many events", test_log_nb);
+  }
+  test_log[test_log_nb] = event;
+  test_log_nb++;
+}
+
+static void test_wait(const volatile uint32_t *p_value, uint32_t expected, const char *p_msg)
+{
+  uint32_t wait = 0U;
+
+  while ((*p_value != expected) && (wait < TEST_TIMEOUT))
+  {
+    (void)rtosalDelay(10U);
+    wait += 10U;
+  }
+  if (*p_value != expected)
+  {
+    test_fail(p_msg, *p_value);
+  }
+}
+
+static void test_check_log(const char *p_step, const char *p_expected)
+{
+  (void)printf("%s: %.*s\n", p_step, (int)test_log_nb, test_log);
+  if ((test_log_nb != strlen(p_expected)) || (memcmp(test_log, p_expected, test_log_nb) != 0))
+  {
+    test_fail("order of the requests, expected events", (uint32_t)strlen(p_expected));
+  }
+}
+
+static void test_ctrl_thread(void const *p_arg)
+{
+  CS_OperatorSelector_t operator_sel;
+  CS_RegistrationStatus_t reg_status;
+
+  (void)p_arg;
+
+  (void)memset(&operator_sel, 0, sizeof(operator_sel));
+  if (osCDS_register_net(&operator_sel, &reg_status) == CELLULAR_OK)
+  {
+    test_ctrl_ok++;
+  }
+  (void)rtosalSemaphoreRelease(test_done_sem);
+}
+
+/* data plane request named by p_arg ('A' or 'B') */
+static void test_data_thread(void const *p_arg)
+{
+  const char *p_name = (const char *)p_arg;
+  CS_SocketCnxInfos_t infos;
+
+  if (*p_name == 'A')
+  {
+    test_thread_a = rtosalThreadGetId();
+  }
+  if (osCDS_socket_cnx_status((socket_handle_t)*p_name, &infos) == CELLULAR_OK)
+  {
+    test_data_ok++;
+  }
+  (void)rtosalSemaphoreRelease(test_done_sem);
+}
+
+static void test_main(void const *p_arg)
+{
+  static const char name_a = 'A';
+  static const char name_b = 'B';
+  host_os_stats_t os_stats;
+  uint32_t i;
+
+  (void)p_arg;
+
+  if (osCDS_cellular_service_init() != CELLULAR_TRUE)
+  {
+    test_fail("osCDS_cellular_service_init", 0U);
+  }
+
+  /* the registration takes the lock, A waits for it */
+  test_a_gated = true;
+  (void)rtosalThreadNew((const rtosal_char_t *)"ctrl", test_ctrl_thread, osPriorityNormal, 2048U, NULL);
+  if (rtosalSemaphoreAcquire(test_ctrl_started_sem, TEST_TIMEOUT) != osOK)
+  {
+    test_fail("registration not started", 0U);
+  }
+  (void)rtosalThreadNew((const rtosal_char_t *)"data A", test_data_thread, osPriorityNormal, 2048U,
+                        (void *)&name_a);
+  test_wait(&cs_os_data_waiting, 1U, "data plane requests waiting before the step boundary");
+
+  /* first step boundary: the registration yields to A */
+  (void)rtosalSemaphoreRelease(test_ctrl_gate_sem);
+  test_wait(&cs_os_lock_stats.ctrl_yield_nb, 1U, "yields at the first step boundary");
+
+  /* B arrives after the yield and gets the lock first: the registration still waits for A */
+  (void)rtosalThreadNew((const rtosal_char_t *)"data B", test_data_thread, osPriorityNormal, 2048U,
+                        (void *)&name_b);
+  if (rtosalSemaphoreAcquire(test_done_sem, TEST_TIMEOUT) != osOK)
+  {
+    test_fail("B not done", 0U);
+  }
+  (void)rtosalDelay(TEST_SETTLE);
+  test_check_log("after B", "1B");
+  if (cs_os_yield_data_nb != 1U)
+  {
+    test_fail("data plane requests to run before the registration resumes", cs_os_yield_data_nb);
+  }
+
+  /* A done: the registration resumes, no other data plane request waiting at the second step boundary */
+  (void)rtosalSemaphoreRelease(test_a_gate_sem);
+  for (i = 0U; i < 2U; i++)
+  {
+    if (rtosalSemaphoreAcquire(test_done_sem, TEST_TIMEOUT) != osOK)
+    {
+      test_fail("requests not done", i);
+    }
+  }
+  test_check_log("after A", "1BA23");
+  if ((test_ctrl_ok != 1U) || (test_data_ok != 2U) || (cs_os_lock_stats.ctrl_yield_nb != 1U))
+  {
+    test_fail("results or yields", cs_os_lock_stats.ctrl_yield_nb);
+  }
+
+  host_os_get_stats(&os_stats);
+  if ((os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner) != 0U)
+  {
+    test_fail("semaphore or mutex misuse", os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner);
+  }
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+/* network registration: step boundaries handled as by AT_Core (see step_boundary() in at_core.c),
+   the test ends the first step */
+CS_Status_t test_register_net(CS_OperatorSelector_t *p_operator, CS_RegistrationStatus_t *p_reg_status)
+{
+  uint32_t step;
+
+  (void)p_operator;
+  (void)memset(p_reg_status, 0, sizeof(CS_RegistrationStatus_t));
+
+  for (step = 0U; step < TEST_CTRL_STEPS; step++)
+  {
+    /* msg_id not used by the Cellular Service */
+    if ((step != 0U) && (cs_os_step_callback((at_msg_t)0U, ATSTEP_CHECK_YIELD) == true))
+    {
+      (void)cs_os_step_callback((at_msg_t)0U, ATSTEP_YIELD);
+    }
+    test_log_add((char)('1' + step));
+    if (step == 0U)
+    {
+      (void)rtosalSemaphoreRelease(test_ctrl_started_sem);
+      (void)rtosalSemaphoreAcquire(test_ctrl_gate_sem, RTOSAL_WAIT_FOREVER);
+    }
+  }
+  p_reg_status->EPS_NetworkRegState = CS_NRS_REGISTERED_HOME_NETWORK;
+
+  return CELLULAR_OK;
+}
+
+CS_Status_t test_socket_cnx_status(socket_handle_t sockHandle, CS_SocketCnxInfos_t *infos)
+{
+  (void)memset(infos, 0, sizeof(CS_SocketCnxInfos_t));
+  test_log_add((char)sockHandle);
+
+  return CELLULAR_OK;
+}
+
+/* A gets the Cellular Service lock when the test releases it */
+rtosalStatus test_mutex_acquire(osMutexId mutex_id, uint32_t timeout)
+{
+  if ((mutex_id == CellularServiceMutexHandle) && (test_a_gated == true) && (rtosalThreadGetId() == test_thread_a))
+  {
+    test_a_gated = false;
+    (void)rtosalSemaphoreAcquire(test_a_gate_sem, RTOSAL_WAIT_FOREVER);
+  }
+  return (rtosalMutexAcquire(mutex_id, timeout));
+}
+
+int main(void)
+{
+  host_platform_init();
+
+  test_ctrl_started_sem = rtosalSemaphoreNew(NULL, 1U);
+  test_ctrl_gate_sem = rtosalSemaphoreNew(NULL, 1U);
+  test_a_gate_sem = rtosalSemaphoreNew(NULL, 1U);
+  test_done_sem = rtosalSemaphoreNew(NULL, 3U);
+  (void)rtosalSemaphoreAcquire(test_ctrl_started_sem, 0U);
+  (void)rtosalSemaphoreAcquire(test_ctrl_gate_sem, 0U);
+  (void)rtosalSemaphoreAcquire(test_a_gate_sem, 0U);
+  for (uint32_t i = 0U; i < 3U; i++)
+  {
+    (void)rtosalSemaphoreAcquire(test_done_sem, 0U);
+  }
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,257 @@
+/**
+  ******************************************************************************
+  * @file    test_dc_com_deferred_notif.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: Data Cache deferred notifications
+  *          (USE_DC_COM_DEFERRED_NOTIF == 1).
+  *          An application consumer blocks the notification thread in its
+  *          first callback while entries are written and events are sent.
+  *          Checked: the entries written before an event are notified before
+  *          it, the events are notified in order, several writes of an entry
+  *          with no event between them are notified once, dc_com_write_event
+  *          fails when DC_COM_NOTIF_EVENT_MAX events are not yet notified;
+  *          no semaphore released while already full, no mutex released by a
+  *          non owner.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+#include "rtosal.h"
+#include "dc_common.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_LOG_MAX         (32U)
+#define TEST_EVENT_ID        ((dc_com_event_id_t)100U)
+#define TEST_EVENT_MAX       (4U)     /* DC_COM_NOTIF_EVENT_MAX of dc_common.c */
+#define TEST_TIMEOUT         (5000U)  /* in ms */
+
+#if (USE_DC_COM_DEFERRED_NOTIF != 1)
+#error "test_dc_com_deferred_notif must be built with USE_DC_COM_DEFERRED_NOTIF=1"
+#endif /* USE_DC_COM_DEFERRED_NOTIF != 1 */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  dc_service_rt_header_t header;
+  dc_service_rt_state_t  rt_state;
+  uint32_t               value;
+} test_entry_t;
+
+/* Private variables ---------------------------------------------------------*/
+static test_entry_t test_entry_a;
+static test_entry_t test_entry_b;
+static dc_com_res_id_t test_res_a;
+static dc_com_res_id_t test_res_b;
+static osSemaphoreId test_entered_sem;
+static osSemaphoreId test_gate_sem;
+static volatile bool test_block;
+static dc_com_event_id_t test_log[TEST_LOG_MAX];
+static volatile uint32_t test_log_nb;
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value);
+static void test_consumer_cb(dc_com_event_id_t dc_event_id, const void *p_private_data);
+static void test_write(dc_com_res_id_t res_id, uint32_t value);
+static void test_block_thread(void);
+static void test_check_log(const char *p_step, const dc_com_event_id_t *p_expected, uint32_t expected_nb);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value)
+{
+  (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  exit(HOST_EXIT_FAILURE);
+}
+
+/* application consumer: logs the notifications, blocks the notification thread on request */
+static void test_consumer_cb(dc_com_event_id_t dc_event_id, const void *p_private_data)
+{
+  (void)p_private_data;
+
+  if (test_log_nb >= TEST_LOG_MAX)
+  {
+    test_fail("too many notifications", test_log_nb);
+  }
+  test_log[test_log_nb] = dc_event_id;
+  test_log_nb++;
+  if (test_block == true)
+  {
+    test_block = false;
+    (void)rtosalSemaphoreRelease(test_entered_sem);
+    (void)rtosalSemaphoreAcquire(test_gate_sem, RTOSAL_WAIT_FOREVER);
+  }
+}
+
+static void test_write(dc_com_res_id_t res_id, uint32_t value)
+{
+  test_entry_t entry;
+
+  (void)dc_com_read(&dc_com_db, res_id, &entry, sizeof(entry));
+  entry.rt_state = DC_SERVICE_ON;
+  entry.value = value;
+  if (dc_com_write(&dc_com_db, res_id, &entry, sizeof(entry)) != DC_COM_OK)
+  {
+    test_fail("dc_com_write, entry", res_id);
+  }
+}
+
+/* write entry a and wait until its notification blocks the notification thread */
+static void test_block_thread(void)
+{
+  static uint32_t value = 1000U;
+
+  test_log_nb = 0U;
+  test_block = true;
+  value++;
+  test_write(test_res_a, value);
+  if (rtosalSemaphoreAcquire(test_entered_sem, TEST_TIMEOUT) != osOK)
+  {
+    test_fail("notification thread not blocked", 0U);
+  }
+}
+
+/* release the notification thread and check the notifications */
+static void test_check_log(const char *p_step, const dc_com_event_id_t *p_expected, uint32_t expected_nb)
+{
+  uint32_t wait = 0U;
+
+  (void)rtosalSemaphoreRelease(test_gate_sem);
+  while ((test_log_nb < expected_nb) && (wait < TEST_TIMEOUT))
+  {
+    (void)rtosalDelay(10U);
+    wait += 10U;
+  }
+  /* let an unexpected notification arrive */
+  (void)rtosalDelay(50U);
+
+  (void)printf("%s:", p_step);
+  for (uint32_t i = 0U; i < test_log_nb; i++)
+  {
+    (void)printf(" %u", test_log[i]);
+  }
+  (void)printf("\n");
+  if (test_log_nb != expected_nb)
+  {
+    test_fail("number of notifications", test_log_nb);
+  }
+  for (uint32_t i = 0U; i < expected_nb; i++)
+  {
+    if (test_log[i] != p_expected[i])
+    {
+      test_fail("notification order, notification", i);
+    }
+  }
+}
+
+static void test_main(void const *p_arg)
+{
+  dc_com_stats_t stats;
+  host_os_stats_t os_stats;
+  uint32_t coalesced_nb;
+  uint32_t i;
+
+  (void)p_arg;
+
+  test_res_a = dc_com_register_serv(&dc_com_db, &test_entry_a, (uint16_t)sizeof(test_entry_a));
+  test_res_b = dc_com_register_serv(&dc_com_db, &test_entry_b, (uint16_t)sizeof(test_entry_b));
+  if ((test_res_a == DC_COM_INVALID_ENTRY) || (test_res_b == DC_COM_INVALID_ENTRY))
+  {
+    test_fail("dc_com_register_serv", 0U);
+  }
+  if (dc_com_register_entry_cb(&dc_com_db, DC_COM_RES_MASK(test_res_a) | DC_COM_RES_MASK(test_res_b),
+                               test_consumer_cb, NULL) == DC_COM_INVALID_ENTRY)
+  {
+    test_fail("dc_com_register_entry_cb", 0U);
+  }
+  dc_com_start(&dc_com_db);
+
+  /* step 1: writes and events while the thread is blocked */
+  {
+    const dc_com_event_id_t expected[] =
+    {
+      test_res_a,                                   /* blocking notification */
+      test_res_a, test_res_b, TEST_EVENT_ID,        /* a written twice: one notification */
+      test_res_a, (dc_com_event_id_t)(TEST_EVENT_ID + 1U),
+      test_res_b
+    };
+
+    test_block_thread();
+    (void)dc_com_get_stats(&dc_com_db, &stats);
+    coalesced_nb = stats.notif_coalesced_nb;
+    test_write(test_res_b, 1U);
+    test_write(test_res_a, 1U);
+    test_write(test_res_a, 2U);
+    (void)dc_com_write_event(&dc_com_db, TEST_EVENT_ID);
+    test_write(test_res_a, 3U);
+    (void)dc_com_write_event(&dc_com_db, (dc_com_event_id_t)(TEST_EVENT_ID + 1U));
+    test_write(test_res_b, 2U);
+    test_check_log("step 1", expected, (uint32_t)(sizeof(expected) / sizeof(expected[0])));
+    (void)dc_com_get_stats(&dc_com_db, &stats);
+    if ((stats.notif_coalesced_nb - coalesced_nb) != 1U)
+    {
+      test_fail("coalesced writes", stats.notif_coalesced_nb - coalesced_nb);
+    }
+  }
+
+  /* step 2: too many events not yet notified */
+  {
+    dc_com_event_id_t expected[TEST_EVENT_MAX + 1U];
+
+    test_block_thread();
+    expected[0] = test_res_a;
+    for (i = 0U; i < TEST_EVENT_MAX; i++)
+    {
+      expected[i + 1U] = (dc_com_event_id_t)(TEST_EVENT_ID + 10U + i);
+      if (dc_com_write_event(&dc_com_db, expected[i + 1U]) != DC_COM_OK)
+      {
+        test_fail("dc_com_write_event, event", i);
+      }
+    }
+    if (dc_com_write_event(&dc_com_db, (dc_com_event_id_t)(TEST_EVENT_ID + 20U)) != DC_COM_ERROR)
+    {
+      test_fail("dc_com_write_event with too many events not yet notified", 0U);
+    }
+    test_check_log("step 2", expected, TEST_EVENT_MAX + 1U);
+  }
+
+  host_os_get_stats(&os_stats);
+  if ((os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner) != 0U)
+  {
+    test_fail("semaphore or mutex misuse", os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner);
+  }
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  host_platform_init();
+  dc_com_init(&dc_com_db);
+
+  test_entered_sem = rtosalSemaphoreNew(NULL, 1U);
+  test_gate_sem = rtosalSemaphoreNew(NULL, 1U);
+  (void)rtosalSemaphoreAcquire(test_entered_sem, 0U);
+  (void)rtosalSemaphoreAcquire(test_gate_sem, 0U);
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
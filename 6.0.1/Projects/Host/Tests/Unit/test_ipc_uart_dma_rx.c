@@ -0,0 +1,312 @@
+/**
+  ******************************************************************************
+  * @file    test_ipc_uart_dma_rx.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: IPC reception by blocks with the circular DMA
+  *          (IPC_USE_UART_DMA_RX == 1U).
+  *          A writer thread sends messages of random size and content to the
+  *          emulated MODEM UART, in chunks of random size: the DMA half/full
+  *          and idle events fall at any position of a message. The reader is
+  *          randomly slow, so that the RX queue gets paused and the DMA
+  *          reception is stopped and restarted. The second half of the
+  *          messages is framed by a block end of message callback.
+  *          Checked: every message is received once, in order, unchanged,
+  *          contiguous in the RX queue (messages reaching the end of the queue
+  *          are moved to index 0); the reception is done by blocks (few RX
+  *          events per byte).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "main.h"
+#include "usart.h"
+#include "host_platform.h"
+#include "ipc_common.h"
+#include "ipc_uart.h"
+#include "rtosal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_MSG_NB          (20000U)
+#define TEST_MSG_MAX_SIZE    (300U)   /* payload, without the end of message character */
+#define TEST_CHUNK_MAX_SIZE  (700U)
+#define TEST_END_OF_MSG      ((uint8_t)'\n')
+#define TEST_SEED            (0x1234U)
+
+#if (IPC_USE_UART_DMA_RX != 1U)
+#error "test_ipc_uart_dma_rx must be built with IPC_USE_UART_DMA_RX=1U"
+#endif /* IPC_USE_UART_DMA_RX != 1U */
+
+/* Private variables ---------------------------------------------------------*/
+static IPC_Handle_t test_ipc;
+static osSemaphoreId test_rx_sem;
+static pthread_t test_reader_thread;
+static uint32_t test_rx_task_callbacks; /* client callbacks called by the reader task (IPC_release) */
+static int test_fds[2];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state);
+static uint16_t test_build_msg(uint32_t *p_state, uint8_t *p_msg);
+static uint8_t test_check_end_of_msg(uint8_t rxChar);
+static uint16_t test_check_end_of_msg_block(const uint8_t *p_data, uint16_t size, uint8_t *p_end_of_msg);
+static void test_rx_callback(IPC_Handle_t *hipc);
+static void test_tx_callback(IPC_Handle_t *hipc);
+static void test_err_callback(IPC_Handle_t *hipc);
+static void *test_writer(void *p_arg);
+static void test_reader(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state)
+{
+  /* xorshift32: same sequence for the writer and the reader */
+  uint32_t x = *p_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *p_state = x;
+  return x;
+}
+
+/* message n: random size, any byte value except the end of message character, then the end of message */
+static uint16_t test_build_msg(uint32_t *p_state, uint8_t *p_msg)
+{
+  uint16_t size = (uint16_t)(test_rand(p_state) % (TEST_MSG_MAX_SIZE + 1U));
+  uint16_t i;
+
+  for (i = 0U; i < size; i++)
+  {
+    uint8_t c = (uint8_t)test_rand(p_state);
+    p_msg[i] = (c == TEST_END_OF_MSG) ? (uint8_t)'\r' : c;
+  }
+  p_msg[size] = TEST_END_OF_MSG;
+  return (size + 1U);
+}
+
+static uint8_t test_check_end_of_msg(uint8_t rxChar)
+{
+  return (rxChar == TEST_END_OF_MSG) ? 1U : 0U;
+}
+
+static uint16_t test_check_end_of_msg_block(const uint8_t *p_data, uint16_t size, uint8_t *p_end_of_msg)
+{
+  uint16_t i = 0U;
+
+  *p_end_of_msg = 0U;
+  while ((i < size) && (*p_end_of_msg == 0U))
+  {
+    *p_end_of_msg = test_check_end_of_msg(p_data[i]);
+    i++;
+  }
+  return i;
+}
+
+static void test_rx_callback(IPC_Handle_t *hipc)
+{
+  UNUSED(hipc);
+  if (pthread_equal(pthread_self(), test_reader_thread) != 0)
+  {
+    /* notification of the messages completed when the reception is resumed: the RTOS services have to be
+       called with IT unmasked */
+    if (host_irq_masked() == true)
+    {
+      (void)printf("FAIL: client callback called by the task with IT masked\n");
+      exit(HOST_EXIT_FAILURE);
+    }
+    test_rx_task_callbacks++;
+  }
+  (void)rtosalSemaphoreRelease(test_rx_sem);
+}
+
+static void test_tx_callback(IPC_Handle_t *hipc)
+{
+  UNUSED(hipc);
+}
+
+static void test_err_callback(IPC_Handle_t *hipc)
+{
+  UNUSED(hipc);
+  (void)printf("FAIL: IPC error callback\n");
+  exit(HOST_EXIT_FAILURE);
+}
+
+static void *test_writer(void *p_arg)
+{
+  uint32_t msg_state = TEST_SEED;
+  uint32_t chunk_state = 0xCAFEU;
+  static uint8_t stream[TEST_CHUNK_MAX_SIZE + TEST_MSG_MAX_SIZE + 1U];
+  uint16_t pending = 0U;
+  uint32_t n;
+  UNUSED(p_arg);
+
+  for (n = 0U; n < TEST_MSG_NB; n++)
+  {
+    uint16_t chunk = (uint16_t)(1U + (test_rand(&chunk_state) % TEST_CHUNK_MAX_SIZE));
+
+    pending += test_build_msg(&msg_state, &stream[pending]);
+    while (pending >= chunk)
+    {
+      (void)write(test_fds[1], stream, chunk);
+      (void)memmove(stream, &stream[chunk], (size_t)pending - chunk);
+      pending -= chunk;
+      if ((test_rand(&chunk_state) % 8U) == 0U)
+      {
+        /* idle line */
+        (void)usleep(50U);
+      }
+    }
+  }
+  (void)write(test_fds[1], stream, pending);
+  return NULL;
+}
+
+static void test_reader(void const *p_arg)
+{
+  uint32_t state = TEST_SEED;
+  uint32_t delay_state = 0xBEEFU;
+  static uint8_t expected[TEST_MSG_MAX_SIZE + 1U];
+  const uint8_t *p_queue_end = &test_ipc.RxQueue.data[IPC_RXBUF_MAXSIZE];
+  const uint8_t *p_previous = NULL;
+  uint32_t received = 0U;
+  uint32_t paused = 0U;
+  uint32_t wrapped = 0U;
+  uint32_t bytes = 0U;
+  host_uart_stats_t stats;
+  pthread_t writer;
+  UNUSED(p_arg);
+
+  test_reader_thread = pthread_self();
+  (void)IPC_init(IPC_DEVICE_0, IPC_INTERFACE_UART, &huart1);
+  if (IPC_open(&test_ipc, IPC_DEVICE_0, IPC_MODE_UART_CHARACTER, test_rx_callback, test_tx_callback,
+               test_err_callback, test_check_end_of_msg) != IPC_OK)
+  {
+    (void)printf("FAIL: IPC_open\n");
+    exit(HOST_EXIT_FAILURE);
+  }
+  (void)pthread_create(&writer, NULL, test_writer, NULL);
+
+  while (received < TEST_MSG_NB)
+  {
+    IPC_RxMessage_t msg;
+
+    if (rtosalSemaphoreAcquire(test_rx_sem, 5000U) != osOK)
+    {
+      (void)printf("FAIL: timeout, %u messages received, IPC state %u, UART RX state 0x%x\n", received,
+                   test_ipc.State, huart1.RxState);
+      exit(HOST_EXIT_FAILURE);
+    }
+    while ((received < TEST_MSG_NB) && (IPC_peek(&test_ipc, &msg) == IPC_OK))
+    {
+      uint16_t size = test_build_msg(&state, expected);
+
+      if ((msg.size != size) || (memcmp(msg.buffer, expected, size) != 0))
+      {
+        (void)printf("FAIL: message %u: size %u expected %u\n", received, msg.size, size);
+        exit(HOST_EXIT_FAILURE);
+      }
+      if ((msg.buffer < test_ipc.RxQueue.data) || (&msg.buffer[msg.size] > p_queue_end))
+      {
+        (void)printf("FAIL: message %u not contiguous in the RX queue\n", received);
+        exit(HOST_EXIT_FAILURE);
+      }
+      if ((p_previous != NULL) && (msg.buffer < p_previous))
+      {
+        wrapped++;
+      }
+      p_previous = msg.buffer;
+      bytes += size;
+      received++;
+      /* slow reader from time to time: the RX queue fills up */
+      if ((test_rand(&delay_state) % 64U) == 0U)
+      {
+        (void)usleep(2000U);
+      }
+      if (test_ipc.State == IPC_STATE_PAUSED)
+      {
+        paused++;
+      }
+      (void)IPC_release(&test_ipc);
+      if (received == (TEST_MSG_NB / 2U))
+      {
+        (void)IPC_setCheckEndOfMsgBlockCallback(&test_ipc, test_check_end_of_msg_block);
+      }
+    }
+  }
+  (void)pthread_join(writer, NULL);
+
+  host_uart_get_stats(&huart1, &stats);
+  (void)printf("%u messages, %u bytes, %u RX events, RX queue paused %u times, %u messages notified on resume, "
+               "%u loops back to index 0\n", received, bytes, stats.rx_callbacks, paused, test_rx_task_callbacks,
+               wrapped);
+  if (paused == 0U)
+  {
+    (void)printf("FAIL: RX queue never paused, pause/resume path not tested\n");
+    exit(HOST_EXIT_FAILURE);
+  }
+  if (wrapped == 0U)
+  {
+    (void)printf("FAIL: RX queue never looped back to index 0\n");
+    exit(HOST_EXIT_FAILURE);
+  }
+  if (stats.rx_callbacks > (bytes / 8U))
+  {
+    (void)printf("FAIL: reception not done by blocks\n");
+    exit(HOST_EXIT_FAILURE);
+  }
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  IPC_UART_RxEventCallback(huart, Size);
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_RxCpltCallback(huart);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_TxCpltCallback(huart);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_ErrorCallback(huart);
+}
+
+int main(void)
+{
+  (void)HAL_Init();
+  host_platform_init();
+  (void)socketpair(AF_UNIX, SOCK_STREAM, 0, test_fds);
+  host_uart_connect_fd(&huart1, test_fds[0], test_fds[0], 0U);
+  huart1.Init.BaudRate = 921600U;
+  (void)HAL_UART_Init(&huart1);
+
+  test_rx_sem = rtosalSemaphoreNew(NULL, 1U);
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_reader, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * @file    test_ipc_uart_tx_queue.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: IPC transmission through the TX queue
+  *          (IPC_USE_TX_QUEUE == 1U).
+  *          Two tasks send messages of random size (up to several TX buffers)
+  *          on the same IPC channel, a reader thread checks the stream written
+  *          to the emulated MODEM UART.
+  *          Checked: every message is sent once, in order for each task,
+  *          unchanged and not interleaved with the other task messages;
+  *          IPC_send() returns while the previous buffer is still being sent;
+  *          one TX complete callback per buffer; no semaphore released while
+  *          already full, no mutex released by a non owner.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "main.h"
+#include "usart.h"
+#include "host_platform.h"
+#include "ipc_common.h"
+#include "ipc_uart.h"
+#include "rtosal.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_TASK_NB         (2U)
+#define TEST_MSG_NB          (300U)   /* per task */
+#define TEST_MSG_MAX_SIZE    (2000U)  /* payload, without the header */
+#define TEST_HEADER_SIZE     (3U)     /* task tag, payload size (little endian) */
+#define TEST_TAG             ((uint8_t)0xA0U)
+#define TEST_BAUDRATE        (2000000U)
+
+#if (IPC_USE_TX_QUEUE != 1U)
+#error "test_ipc_uart_tx_queue must be built with IPC_USE_TX_QUEUE=1U"
+#endif /* IPC_USE_TX_QUEUE != 1U */
+
+/* Private variables ---------------------------------------------------------*/
+static IPC_Handle_t test_ipc;
+static int test_fds[2];
+static osSemaphoreId test_done_sem;
+static osThreadId test_senders[TEST_TASK_NB];
+static volatile uint32_t test_tx_callbacks;
+static uint32_t test_tx_buffers[TEST_TASK_NB];
+static uint32_t test_overlaps[TEST_TASK_NB];
+static uint8_t test_queue_max;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state);
+static uint16_t test_build_msg(uint8_t task, uint32_t *p_state, uint8_t *p_msg);
+static uint8_t test_check_end_of_msg(uint8_t rxChar);
+static void test_rx_callback(IPC_Handle_t *hipc);
+static void test_tx_callback(IPC_Handle_t *hipc);
+static void test_err_callback(IPC_Handle_t *hipc);
+static void test_fail(const char *p_msg, uint32_t value);
+static void test_read(uint8_t *p_buf, uint32_t size);
+static void *test_reader(void *p_arg);
+static void test_sender(void const *p_arg);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static uint32_t test_rand(uint32_t *p_state)
+{
+  /* xorshift32: same sequence for the sender and the reader */
+  uint32_t x = *p_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *p_state = x;
+  return x;
+}
+
+/* message of a task: tag, random payload size, random payload */
+static uint16_t test_build_msg(uint8_t task, uint32_t *p_state, uint8_t *p_msg)
+{
+  uint16_t size = (uint16_t)(1U + (test_rand(p_state) % TEST_MSG_MAX_SIZE));
+  uint16_t i;
+
+  p_msg[0] = TEST_TAG | task;
+  p_msg[1] = (uint8_t)size;
+  p_msg[2] = (uint8_t)(size >> 8);
+  for (i = 0U; i < size; i++)
+  {
+    p_msg[TEST_HEADER_SIZE + i] = (uint8_t)test_rand(p_state);
+  }
+  return (uint16_t)(TEST_HEADER_SIZE + size);
+}
+
+static uint8_t test_check_end_of_msg(uint8_t rxChar)
+{
+  UNUSED(rxChar);
+  return 0U;
+}
+
+static void test_rx_callback(IPC_Handle_t *hipc)
+{
+  UNUSED(hipc);
+}
+
+static void test_tx_callback(IPC_Handle_t *hipc)
+{
+  UNUSED(hipc);
+  /* called under IT: one call per TX buffer sent */
+  test_tx_callbacks++;
+}
+
+static void test_err_callback(IPC_Handle_t *hipc)
+{
+  UNUSED(hipc);
+  test_fail("IPC error callback", 0U);
+}
+
+static void test_fail(const char *p_msg, uint32_t value)
+{
+  (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  exit(HOST_EXIT_FAILURE);
+}
+
+static void test_read(uint8_t *p_buf, uint32_t size)
+{
+  uint32_t done = 0U;
+
+  while (done < size)
+  {
+    ssize_t len = read(test_fds[1], &p_buf[done], (size_t)(size - done));
+    if (len <= 0)
+    {
+      test_fail("stream closed", done);
+    }
+    done += (uint32_t)len;
+  }
+}
+
+static void *test_reader(void *p_arg)
+{
+  uint32_t state[TEST_TASK_NB];
+  static uint8_t expected[TEST_HEADER_SIZE + TEST_MSG_MAX_SIZE];
+  static uint8_t msg[TEST_HEADER_SIZE + TEST_MSG_MAX_SIZE];
+  uint32_t total = 0U;
+  uint8_t task;
+  UNUSED(p_arg);
+
+  for (task = 0U; task < TEST_TASK_NB; task++)
+  {
+    state[task] = 0x1234U + task;
+  }
+
+  while (total < (TEST_TASK_NB * TEST_MSG_NB))
+  {
+    uint16_t size;
+
+    /* a message starts with the tag of one task: messages are not interleaved */
+    test_read(msg, TEST_HEADER_SIZE);
+    task = msg[0] & (uint8_t)~TEST_TAG;
+    if (((msg[0] & TEST_TAG) != TEST_TAG) || (task >= TEST_TASK_NB))
+    {
+      test_fail("bad message tag, message", total);
+    }
+    size = test_build_msg(task, &state[task], expected);
+    if (memcmp(msg, expected, TEST_HEADER_SIZE) != 0)
+    {
+      test_fail("bad message size, message", total);
+    }
+    test_read(&msg[TEST_HEADER_SIZE], (uint32_t)size - TEST_HEADER_SIZE);
+    if (memcmp(msg, expected, size) != 0)
+    {
+      test_fail("bad message content, message", total);
+    }
+    total++;
+  }
+  (void)rtosalSemaphoreRelease(test_done_sem);
+  return NULL;
+}
+
+static void test_sender(void const *p_arg)
+{
+  uint8_t task = (uint8_t)(uintptr_t)p_arg;
+  uint32_t state = 0x1234U + task;
+  uint8_t *p_msg = malloc(TEST_HEADER_SIZE + TEST_MSG_MAX_SIZE);
+  uint32_t n;
+
+  for (n = 0U; n < TEST_MSG_NB; n++)
+  {
+    uint16_t size = test_build_msg(task, &state, p_msg);
+
+    if (IPC_send(&test_ipc, p_msg, size) != IPC_OK)
+    {
+      test_fail("IPC_send, message", n);
+    }
+    test_tx_buffers[task] += ((uint32_t)size + IPC_TXQUEUE_BUF_SIZE - 1U) / IPC_TXQUEUE_BUF_SIZE;
+    /* data copied: the caller buffer is reused while the previous buffers are sent */
+    (void)memset(p_msg, 0, size);
+    if (huart1.gState == HAL_UART_STATE_BUSY_TX)
+    {
+      test_overlaps[task]++;
+    }
+    if (IPC_DevicesList[IPC_DEVICE_0].TxQueueCount > test_queue_max)
+    {
+      test_queue_max = IPC_DevicesList[IPC_DEVICE_0].TxQueueCount;
+    }
+  }
+  free(p_msg);
+  (void)rtosalSemaphoreRelease(test_done_sem);
+  (void)rtosalThreadTerminate(NULL);
+}
+
+static void test_main(void const *p_arg)
+{
+  host_os_stats_t os_stats;
+  host_uart_stats_t uart_stats;
+  pthread_t reader;
+  uint32_t buffers = 0U;
+  uint32_t overlaps = 0U;
+  uint32_t i;
+  UNUSED(p_arg);
+
+  (void)IPC_init(IPC_DEVICE_0, IPC_INTERFACE_UART, &huart1);
+  if (IPC_open(&test_ipc, IPC_DEVICE_0, IPC_MODE_UART_CHARACTER, test_rx_callback, test_tx_callback,
+               test_err_callback, test_check_end_of_msg) != IPC_OK)
+  {
+    test_fail("IPC_open", 0U);
+  }
+  (void)pthread_create(&reader, NULL, test_reader, NULL);
+  for (i = 0U; i < TEST_TASK_NB; i++)
+  {
+    test_senders[i] = rtosalThreadNew((const rtosal_char_t *)"sender", test_sender, osPriorityNormal, 2048U,
+                                      (void *)(uintptr_t)i);
+  }
+
+  /* senders and reader */
+  for (i = 0U; i < (TEST_TASK_NB + 1U); i++)
+  {
+    if (rtosalSemaphoreAcquire(test_done_sem, 30000U) != osOK)
+    {
+      test_fail("timeout, UART TX state", huart1.gState);
+    }
+  }
+  (void)pthread_join(reader, NULL);
+  /* TX complete callback of the last buffer is called after the last byte is written */
+  for (i = 0U; (i < 100U) && (IPC_DevicesList[IPC_DEVICE_0].TxQueueCount != 0U); i++)
+  {
+    (void)rtosalDelay(10U);
+  }
+
+  for (i = 0U; i < TEST_TASK_NB; i++)
+  {
+    buffers += test_tx_buffers[i];
+    overlaps += test_overlaps[i];
+  }
+  host_os_get_stats(&os_stats);
+  host_uart_get_stats(&huart1, &uart_stats);
+  (void)printf("%u messages, %u bytes, %u TX buffers, %u TX callbacks, %u sends returned during a transmission, "
+               "queue max %u\n", TEST_TASK_NB * TEST_MSG_NB, uart_stats.tx_bytes, buffers, test_tx_callbacks,
+               overlaps, test_queue_max);
+  if ((test_tx_callbacks != buffers) || (uart_stats.tx_transfers != buffers))
+  {
+    test_fail("one TX complete callback per TX buffer expected, callbacks", test_tx_callbacks);
+  }
+  if ((overlaps == 0U) || (test_queue_max != IPC_TXQUEUE_NB))
+  {
+    test_fail("transmission not overlapped with the sender, queue max", test_queue_max);
+  }
+  if ((os_stats.semaphore_release_overflow != 0U) || (os_stats.mutex_release_not_owner != 0U))
+  {
+    test_fail("semaphore or mutex misuse", os_stats.semaphore_release_overflow + os_stats.mutex_release_not_owner);
+  }
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_RxCpltCallback(huart);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_TxCpltCallback(huart);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_ErrorCallback(huart);
+}
+
+int main(void)
+{
+  (void)HAL_Init();
+  host_platform_init();
+  (void)socketpair(AF_UNIX, SOCK_STREAM, 0, test_fds);
+  host_uart_connect_fd(&huart1, test_fds[0], test_fds[0], 1U);
+  huart1.Init.BaudRate = TEST_BAUDRATE;
+  (void)HAL_UART_Init(&huart1);
+
+  test_done_sem = rtosalSemaphoreNew(NULL, TEST_TASK_NB + 1U);
+  for (uint32_t i = 0U; i < (TEST_TASK_NB + 1U); i++)
+  {
+    (void)rtosalSemaphoreAcquire(test_done_sem, 0U);
+  }
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
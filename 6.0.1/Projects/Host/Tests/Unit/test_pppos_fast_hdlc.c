@@ -0,0 +1,501 @@
+/**
+  ******************************************************************************
+  * @file    test_pppos_fast_hdlc.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: LwIP pppos.c with its PPPOS_FAST_HDLC local patch
+  *          (framing by runs, Core/PPPosif/Src/ppposif_hdlc.c) against the
+  *          LwIP pppos.c without the patch, linked in the same program.
+  *          Both PPPoS interfaces get the same random packets to send (PPP
+  *          write and netif output, chained pbufs, any character to escape),
+  *          ACCM and compression configurations, idle times, output errors,
+  *          disconnections; then the same received stream (the frames sent
+  *          with random corruptions, split in random chunks).
+  *          Checked, byte for byte: the buffers given to the serial output
+  *          (content and size of each write), the packets given to the PPP
+  *          core (content and pbuf segments).
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_platform.h"
+
+/* LwIP pppos.c without its local patch, renamed: the reference of the patched pppos.c linked with this test
+   (PPPOS_FAST_HDLC set by UNIT_test_pppos_fast_hdlc_DEFINES) */
+#undef PPPOS_FAST_HDLC
+#define PPPOS_FAST_HDLC 0
+#define pppos_create                pppos_upstream_create
+#define pppos_input                 pppos_upstream_input
+#define memp_PPPOS_PCB              memp_upstream_PPPOS_PCB
+#define memp_memory_PPPOS_PCB_base  memp_upstream_memory_PPPOS_PCB_base
+#include "../../../../Middlewares/Third_Party/LwIP/src/netif/ppp/pppos.c"
+#undef pppos_create
+#undef pppos_input
+#undef memp_PPPOS_PCB
+#undef memp_memory_PPPOS_PCB_base
+
+#include "lwip/mem.h"
+
+/* patched pppos.c */
+extern const struct memp_desc memp_PPPOS_PCB;
+ppp_pcb *pppos_create(struct netif *pppif, pppos_output_cb_fn output_cb, ppp_link_status_cb_fn link_status_cb,
+                      void *ctx_cb);
+void pppos_input(ppp_pcb *ppp, u8_t *s, int l);
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_ROUNDS          (4000U)
+#define TEST_MAX_PACKET      (1600U)         /* bytes: more than 3 pbufs of the pool */
+#define TEST_LOG_SIZE        (64U * 1024U)
+#define TEST_WIRE_SIZE       (256U * 1024U)
+#define TEST_UPSTREAM        (0U)            /* test_chan[] index: pppos.c without the local patch */
+#define TEST_PATCHED         (1U)            /* test_chan[] index: pppos.c with PPPOS_FAST_HDLC */
+#define TEST_LOG_END         (0xFFFFU)       /* end of a packet given to the PPP core */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  ppp_pcb  *p_ppp;
+  ppp_pcb  pcb;                  /* returned by ppp_new() */
+  struct netif netif;
+  uint8_t  out[TEST_LOG_SIZE];   /* serial output: size (2 bytes) and content of each write */
+  uint32_t out_len;
+  uint8_t  in[TEST_LOG_SIZE];    /* PPP core input: size (2 bytes) and content of each pbuf, TEST_LOG_END */
+  uint32_t in_len;
+  uint32_t out_calls;
+  uint32_t out_fail_at;          /* serial output write failing (1: first write of the operation), 0: none */
+  uint32_t packets;
+  bool     overflow;
+} test_chan_t;
+
+/* Private variables ---------------------------------------------------------*/
+static test_chan_t test_chan[2];
+static uint8_t test_wire[TEST_WIRE_SIZE];     /* frames sent, received back by the input operations */
+static uint32_t test_wire_len;
+static uint8_t test_rx[TEST_WIRE_SIZE];
+static uint8_t test_packet[TEST_MAX_PACKET];
+static uint32_t test_now;
+static uint32_t test_rand_state = 0x5EED1234U;
+static uint32_t test_errors;
+static uint32_t test_out_bytes;
+static uint32_t test_in_bytes;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t test_rand(void);
+static uint8_t test_rand_char(void);
+static u32_t test_rand_accm(void);
+static void test_log(test_chan_t *p_chan, uint8_t *p_log, uint32_t *p_len, const uint8_t *p_data, uint32_t len,
+                     uint16_t size);
+static u32_t test_output_cb(ppp_pcb *pcb, u8_t *data, u32_t len, void *ctx);
+static void test_status_cb(ppp_pcb *pcb, int err_code, void *ctx);
+static void test_compare(const char *p_op, uint32_t round);
+static void test_configure(void);
+static void test_write(void);
+static void test_netif_output(void);
+static void test_input(void);
+
+/* Private function Definition -----------------------------------------------*/
+static uint32_t test_rand(void)
+{
+  /* xorshift32 */
+  uint32_t x = test_rand_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  test_rand_state = x;
+  return x;
+}
+
+/* packet character: 1/4 of characters which may be escaped or have a meaning for the framing */
+static uint8_t test_rand_char(void)
+{
+  static const uint8_t special[] = {PPP_FLAG, PPP_ESCAPE, PPP_ALLSTATIONS, PPP_UI, 0x00U, 0x11U, 0x13U, 0x1FU,
+                                    0x20U, 0x5DU, 0x5EU, 0x7FU, 0x80U, 0xFEU
+                                   };
+  uint8_t c;
+
+  if ((test_rand() % 4U) == 0U)
+  {
+    c = special[test_rand() % sizeof(special)];
+  }
+  else if ((test_rand() % 8U) == 0U)
+  {
+    c = (uint8_t)(test_rand() % 0x20U);
+  }
+  else
+  {
+    c = (uint8_t)test_rand();
+  }
+  return c;
+}
+
+/* ACCM of the control characters: LCP default, none, XON/XOFF, random */
+static u32_t test_rand_accm(void)
+{
+  static const u32_t accm[] = {0xFFFFFFFFUL, 0x00000000UL, 0x000A0000UL};
+  u32_t value;
+
+  if ((test_rand() % 4U) == 0U)
+  {
+    value = test_rand() & test_rand();
+  }
+  else
+  {
+    value = accm[test_rand() % (sizeof(accm) / sizeof(accm[0]))];
+  }
+  return value;
+}
+
+static void test_log(test_chan_t *p_chan, uint8_t *p_log, uint32_t *p_len, const uint8_t *p_data, uint32_t len,
+                     uint16_t size)
+{
+  if ((*p_len + 2U + len) <= TEST_LOG_SIZE)
+  {
+    p_log[*p_len] = (uint8_t)(size >> 8);
+    p_log[*p_len + 1U] = (uint8_t)size;
+    if (len != 0U)
+    {
+      (void)memcpy(&p_log[*p_len + 2U], p_data, len);
+    }
+    *p_len += 2U + len;
+  }
+  else
+  {
+    p_chan->overflow = true;
+  }
+}
+
+/* serial output (pppos_create() output_cb) */
+static u32_t test_output_cb(ppp_pcb *pcb, u8_t *data, u32_t len, void *ctx)
+{
+  test_chan_t *p_chan = (test_chan_t *)ctx;
+  u32_t ret = len;
+
+  LWIP_UNUSED_ARG(pcb);
+  p_chan->out_calls++;
+  if (p_chan->out_calls == p_chan->out_fail_at)
+  {
+    ret = 0U;
+  }
+  test_log(p_chan, p_chan->out, &p_chan->out_len, data, len, (uint16_t)ret);
+  if ((p_chan == &test_chan[TEST_UPSTREAM]) && (ret == len) && ((test_wire_len + len) <= TEST_WIRE_SIZE))
+  {
+    (void)memcpy(&test_wire[test_wire_len], data, len);
+    test_wire_len += len;
+  }
+  return ret;
+}
+
+static void test_status_cb(ppp_pcb *pcb, int err_code, void *ctx)
+{
+  LWIP_UNUSED_ARG(pcb);
+  LWIP_UNUSED_ARG(err_code);
+  LWIP_UNUSED_ARG(ctx);
+}
+
+/* same serial output and same PPP core input for both interfaces */
+static void test_compare(const char *p_op, uint32_t round)
+{
+  const test_chan_t *p_up = &test_chan[TEST_UPSTREAM];
+  const test_chan_t *p_fast = &test_chan[TEST_PATCHED];
+  uint32_t i;
+
+  if ((p_up->overflow == true) || (p_fast->overflow == true)
+      || (p_up->out_len != p_fast->out_len) || (memcmp(p_up->out, p_fast->out, p_up->out_len) != 0)
+      || (p_up->in_len != p_fast->in_len) || (memcmp(p_up->in, p_fast->in, p_up->in_len) != 0)
+      || (p_up->packets != p_fast->packets))
+  {
+    if (test_errors < 10U)
+    {
+      (void)printf("FAIL: %s round %u: output %u/%u bytes, input %u/%u bytes, %u/%u packets\n", p_op, round,
+                   p_up->out_len, p_fast->out_len, p_up->in_len, p_fast->in_len, p_up->packets, p_fast->packets);
+    }
+    test_errors++;
+  }
+  test_out_bytes += p_up->out_len;
+  test_in_bytes += p_up->in_len;
+  for (i = 0U; i < 2U; i++)
+  {
+    test_chan[i].out_len = 0U;
+    test_chan[i].in_len = 0U;
+    test_chan[i].out_calls = 0U;
+    test_chan[i].out_fail_at = 0U;
+    test_chan[i].overflow = false;
+  }
+}
+
+/* ACCM and compressions (LCP), sometimes a new session */
+static void test_configure(void)
+{
+  u32_t send_accm = test_rand_accm();
+  /* the input drops the characters of its ACCM: mostly the ones escaped by the output, so that frames are received */
+  u32_t recv_accm = ((test_rand() % 8U) == 0U) ? test_rand_accm() : (send_accm & test_rand_accm());
+  int pcomp = (int)(test_rand() % 2U);
+  int accomp = (int)(test_rand() % 2U);
+  bool reconnect = ((test_rand() % 4U) == 0U);
+  uint32_t i;
+
+  for (i = 0U; i < 2U; i++)
+  {
+    ppp_pcb *p_ppp = test_chan[i].p_ppp;
+    if (reconnect == true)
+    {
+      p_ppp->link_cb->disconnect(p_ppp, p_ppp->link_ctx_cb);
+      p_ppp->link_cb->connect(p_ppp, p_ppp->link_ctx_cb);
+    }
+    p_ppp->link_cb->send_config(p_ppp, p_ppp->link_ctx_cb, send_accm, pcomp, accomp);
+    p_ppp->link_cb->recv_config(p_ppp, p_ppp->link_ctx_cb, recv_accm, pcomp, accomp);
+  }
+}
+
+/* PPP control packet with its header (address, control, protocol), pbuf freed by pppos_write.
+   Not empty as from the PPP core: LwIP pppos_input() dereferences a NULL pbuf when it receives an empty frame. */
+static void test_write(void)
+{
+  static const u16_t protocol[] = {PPP_LCP, PPP_PAP, PPP_IPCP};
+  uint32_t size = 4U + (test_rand() % (TEST_MAX_PACKET - 3U));
+  u16_t proto = protocol[test_rand() % (sizeof(protocol) / sizeof(protocol[0]))];
+  uint32_t fail_at = ((test_rand() % 16U) == 0U) ? (1U + (test_rand() % 4U)) : 0U;
+  uint32_t i;
+
+  test_packet[0] = PPP_ALLSTATIONS;
+  test_packet[1] = PPP_UI;
+  test_packet[2] = (uint8_t)(proto >> 8);
+  test_packet[3] = (uint8_t)proto;
+  for (i = 4U; i < size; i++)
+  {
+    test_packet[i] = test_rand_char();
+  }
+  for (i = 0U; i < 2U; i++)
+  {
+    ppp_pcb *p_ppp = test_chan[i].p_ppp;
+    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)size, PBUF_RAM);
+    if (p != NULL)
+    {
+      (void)memcpy(p->payload, test_packet, size);
+      test_chan[i].out_fail_at = fail_at;
+      (void)p_ppp->link_cb->write(p_ppp, p_ppp->link_ctx_cb, p);
+    }
+  }
+}
+
+/* network packet in 1 to 3 pbufs */
+static void test_netif_output(void)
+{
+  uint32_t size = test_rand() % (TEST_MAX_PACKET + 1U);
+  uint32_t split1 = (size == 0U) ? 0U : (test_rand() % (size + 1U));
+  uint32_t split2 = split1 + ((size == split1) ? 0U : (test_rand() % (size - split1 + 1U)));
+  uint32_t splits[4] = {0U, split1, split2, size};
+  u16_t protocol = ((test_rand() % 2U) == 0U) ? PPP_IP : (u16_t)(test_rand() & 0xFFFFU);
+  uint32_t fail_at = ((test_rand() % 16U) == 0U) ? (1U + (test_rand() % 4U)) : 0U;
+  uint32_t i;
+  uint32_t seg;
+
+  for (i = 0U; i < size; i++)
+  {
+    test_packet[i] = test_rand_char();
+  }
+  for (i = 0U; i < 2U; i++)
+  {
+    ppp_pcb *p_ppp = test_chan[i].p_ppp;
+    struct pbuf *p_head = NULL;
+    for (seg = 0U; seg < 3U; seg++)
+    {
+      uint32_t seg_size = splits[seg + 1U] - splits[seg];
+      if ((seg_size != 0U) || (seg == 0U))
+      {
+        struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)seg_size, PBUF_RAM);
+        if (p != NULL)
+        {
+          (void)memcpy(p->payload, &test_packet[splits[seg]], seg_size);
+          if (p_head == NULL)
+          {
+            p_head = p;
+          }
+          else
+          {
+            pbuf_cat(p_head, p);
+          }
+        }
+      }
+    }
+    if (p_head != NULL)
+    {
+      test_chan[i].out_fail_at = fail_at;
+      (void)p_ppp->link_cb->netif_output(p_ppp, p_ppp->link_ctx_cb, p_head, protocol);
+      (void)pbuf_free(p_head);
+    }
+  }
+}
+
+/* frames sent since the last input, with corruptions, received in random chunks */
+static void test_input(void)
+{
+  uint32_t len = 0U;
+  uint32_t i;
+
+  for (i = 0U; (i < test_wire_len) && (len < (TEST_WIRE_SIZE - 1U)); i++)
+  {
+    uint32_t r = test_rand() % 4096U;
+    if (r == 0U)
+    {
+      /* lost character */
+    }
+    else if (r == 1U)
+    {
+      test_rx[len] = (uint8_t)test_rand();
+      len++;
+    }
+    else if (r == 2U)
+    {
+      /* noise inserted */
+      test_rx[len] = test_rand_char();
+      test_rx[len + 1U] = test_wire[i];
+      len += 2U;
+    }
+    else
+    {
+      test_rx[len] = test_wire[i];
+      len++;
+    }
+  }
+  test_wire_len = 0U;
+
+  for (i = 0U; i < len;)
+  {
+    uint32_t chunk = 1U + (test_rand() % (((test_rand() % 4U) == 0U) ? 8U : 700U));
+    if (chunk > (len - i))
+    {
+      chunk = len - i;
+    }
+    pppos_upstream_input(test_chan[TEST_UPSTREAM].p_ppp, &test_rx[i], (int)chunk);
+    pppos_input(test_chan[TEST_PATCHED].p_ppp, &test_rx[i], (int)chunk);
+    i += chunk;
+  }
+}
+
+/* PPP core services used by pppos.c ----------------------------------------*/
+ppp_pcb *ppp_new(struct netif *pppif, const struct link_callbacks *callbacks, void *link_ctx_cb,
+                 ppp_link_status_cb_fn link_status_cb, void *ctx_cb)
+{
+  test_chan_t *p_chan = (test_chan_t *)ctx_cb;
+  ppp_pcb *pcb = &p_chan->pcb;
+
+  (void)memset(pcb, 0, sizeof(ppp_pcb));
+  pcb->netif = pppif;
+  pcb->link_cb = callbacks;
+  pcb->link_ctx_cb = link_ctx_cb;
+  pcb->link_status_cb = link_status_cb;
+  pcb->ctx_cb = ctx_cb;
+  return pcb;
+}
+
+void ppp_start(ppp_pcb *pcb)
+{
+  LWIP_UNUSED_ARG(pcb);
+}
+
+void ppp_link_end(ppp_pcb *pcb)
+{
+  LWIP_UNUSED_ARG(pcb);
+}
+
+void ppp_input(ppp_pcb *pcb, struct pbuf *pb)
+{
+  test_chan_t *p_chan = (test_chan_t *)pcb->ctx_cb;
+  struct pbuf *p;
+
+  for (p = pb; p != NULL; p = p->next)
+  {
+    test_log(p_chan, p_chan->in, &p_chan->in_len, (const uint8_t *)p->payload, p->len, p->len);
+  }
+  test_log(p_chan, p_chan->in, &p_chan->in_len, NULL, 0U, TEST_LOG_END);
+  p_chan->packets++;
+  (void)pbuf_free(pb);
+}
+
+u32_t sys_now(void)
+{
+  return test_now;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(void)
+{
+  uint32_t round;
+  uint32_t i;
+
+  mem_init();
+  memp_init();
+  memp_init_pool(&memp_upstream_PPPOS_PCB);
+  memp_init_pool(&memp_PPPOS_PCB);
+  test_chan[TEST_UPSTREAM].p_ppp = pppos_upstream_create(&test_chan[TEST_UPSTREAM].netif, test_output_cb,
+                                                         test_status_cb, &test_chan[TEST_UPSTREAM]);
+  test_chan[TEST_PATCHED].p_ppp = pppos_create(&test_chan[TEST_PATCHED].netif, test_output_cb, test_status_cb,
+                                               &test_chan[TEST_PATCHED]);
+  if ((test_chan[TEST_UPSTREAM].p_ppp == NULL) || (test_chan[TEST_PATCHED].p_ppp == NULL))
+  {
+    (void)printf("FAIL: pppos_create\n");
+    return HOST_EXIT_FAILURE;
+  }
+  for (i = 0U; i < 2U; i++)
+  {
+    ppp_pcb *p_ppp = test_chan[i].p_ppp;
+    p_ppp->link_cb->connect(p_ppp, p_ppp->link_ctx_cb);
+  }
+
+  for (round = 0U; round < TEST_ROUNDS; round++)
+  {
+    uint32_t op = test_rand() % 16U;
+
+    /* idle time: a flag is sent first after PPP_MAXIDLEFLAG ms */
+    test_now += test_rand() % (2U * PPP_MAXIDLEFLAG);
+    if (op == 0U)
+    {
+      test_configure();
+      test_compare("configure", round);
+    }
+    else if (op < 4U)
+    {
+      test_input();
+      test_compare("input", round);
+    }
+    else if (op < 10U)
+    {
+      test_write();
+      test_compare("write", round);
+    }
+    else
+    {
+      test_netif_output();
+      test_compare("netif_output", round);
+    }
+  }
+
+  (void)printf("%u rounds: %u bytes sent, %u bytes of %u packets received, %u errors\n", TEST_ROUNDS,
+               test_out_bytes, test_in_bytes, test_chan[TEST_UPSTREAM].packets, test_errors);
+  /* the received frames are not all dropped: the input path is covered */
+  if ((test_errors != 0U) || (test_chan[TEST_UPSTREAM].packets < (TEST_ROUNDS / 10U)))
+  {
+    return HOST_EXIT_FAILURE;
+  }
+  (void)printf("PASS\n");
+  return HOST_EXIT_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,432 @@
+/**
+  ******************************************************************************
+  * @file    test_ppposif_ipc_ring.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: zero-copy reception of ppposif_input() in the IPC
+  *          stream RX buffer (single-producer/single-consumer ring).
+  *          The characters are sent to the emulated UART of the PPP channel:
+  *          the RX interrupt writes the ring, the test task reads it with
+  *          ppposif_ipc_get_segment()/ppposif_ipc_release_segment() as
+  *          ppposif_input() does, and with ppposif_ipc_read().
+  *          Checked:
+  *          - empty ring: no segment, ppposif_ipc_get_segment() waits for the
+  *            reception;
+  *          - wrap-around: a segment never goes beyond the end of the ring,
+  *            the next one starts at index 0, partial releases, copy of both
+  *            parts by ppposif_ipc_read();
+  *          - full ring: one place kept free, the characters received meanwhile
+  *            are dropped and counted, the stored ones are unchanged;
+  *          - release ordering: the characters of a segment are not overwritten
+  *            before their release, their place is given back to the RX
+  *            interrupt only by the release.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "main.h"
+#include "usart.h"
+#include "host_platform.h"
+#include "rtosal.h"
+
+/* IPC handle of the PPP channel is private: the ppposif IPC source is part of this test */
+#include "../../../../Middlewares/ST/STM32_Cellular/Core/PPPosif/Src/ppposif_ipc.c"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_DEVICE          IPC_DEVICE_0
+#define TEST_RING_SIZE       ((uint32_t)IPC_RXBUF_STREAM_MAXSIZE)
+#define TEST_RING_FREE_MAX   (TEST_RING_SIZE - 1U)  /* one place kept free */
+#define TEST_TIMEOUT         (5000U)  /* in ms */
+#define TEST_CHUNK_SIZE      (700U)   /* not a divider of the ring size: the segments end anywhere */
+#define TEST_CHUNK_NB        (8U)
+#define TEST_RELEASE_MAX     (97U)    /* max characters released at once */
+#define TEST_HELD_SIZE       (500U)
+#define TEST_RELEASED_SIZE   (200U)   /* part of the held segment released */
+
+#if (IPC_USE_STREAM_MODE != 1U)
+#error "test_ppposif_ipc_ring must be built with USE_SOCKETS_TYPE == USE_SOCKETS_LWIP (IPC stream mode)"
+#endif /* IPC_USE_STREAM_MODE != 1U */
+
+/* Private variables ---------------------------------------------------------*/
+static int test_fds[2];
+static volatile uint32_t test_tx_seq;  /* sequence number of the next character sent */
+static uint32_t test_rx_seq;      /* sequence number of the next character expected */
+static uint32_t test_rx_count;    /* characters stored or dropped by the RX interrupt (32-bit) */
+static uint16_t test_last_count;  /* last value of total_rcv_count + overflow_count (16-bit counters) */
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value);
+static uint8_t test_char(uint32_t seq);
+static void test_send(uint32_t size);
+static void test_wait_rx(void);
+static uint32_t test_check_segment(const u8_t *p_data, int16_t size);
+static void test_sender_thread(void const *p_arg);
+static void test_empty(void);
+static void test_wrap_around(void);
+static void test_full(void);
+static void test_release_ordering(void);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value)
+{
+  (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  exit(HOST_EXIT_FAILURE);
+}
+
+/* content of the character seq of the stream: not periodic with the ring size */
+static uint8_t test_char(uint32_t seq)
+{
+  return (uint8_t)(seq ^ (seq >> 8));
+}
+
+static void test_send(uint32_t size)
+{
+  static uint8_t data[TEST_RING_SIZE + 200U];
+
+  for (uint32_t i = 0U; i < size; i++)
+  {
+    data[i] = test_char(test_tx_seq + i);
+  }
+  if (write(test_fds[1], data, size) != (ssize_t)size)
+  {
+    test_fail("UART write", size);
+  }
+  test_tx_seq += size;
+}
+
+/* wait until the RX interrupt has stored or dropped all the characters sent */
+static void test_wait_rx(void)
+{
+  uint32_t waited = 0U;
+  uint16_t count;
+
+  do
+  {
+    count = (uint16_t)(IPC_Handle[TEST_DEVICE].RxBuffer.total_rcv_count
+                       + IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count);
+    test_rx_count += (uint16_t)(count - test_last_count);
+    test_last_count = count;
+    if (test_rx_count == test_tx_seq)
+    {
+      break;
+    }
+    (void)rtosalDelay(1U);
+    waited++;
+  } while (waited < TEST_TIMEOUT);
+
+  if (test_rx_count != test_tx_seq)
+  {
+    test_fail("characters not received", test_tx_seq - test_rx_count);
+  }
+}
+
+/* segment returned by ppposif_ipc_get_segment(): in the ring, expected content; returns 1 if it ends the ring */
+static uint32_t test_check_segment(const u8_t *p_data, int16_t size)
+{
+  const uint8_t *p_ring = IPC_Handle[TEST_DEVICE].RxBuffer.data;
+
+  if ((size <= 0) || (p_data < p_ring) || (&p_data[size] > &p_ring[TEST_RING_SIZE]))
+  {
+    test_fail("segment out of the ring", (uint32_t)size);
+  }
+  for (int16_t i = 0; i < size; i++)
+  {
+    if (p_data[i] != test_char(test_rx_seq + (uint32_t)i))
+    {
+      test_fail("segment content", test_rx_seq + (uint32_t)i);
+    }
+  }
+  return (&p_data[size] == &p_ring[TEST_RING_SIZE]) ? 1U : 0U;
+}
+
+static void test_sender_thread(void const *p_arg)
+{
+  (void)p_arg;
+  (void)rtosalDelay(50U);
+  test_send(10U);
+  (void)rtosalThreadTerminate(NULL);
+}
+
+/* 1. empty ring: no segment, ppposif_ipc_get_segment() waits for the reception */
+static void test_empty(void)
+{
+  const uint8_t *p_data;
+  uint16_t len;
+  int16_t size;
+  uint32_t start;
+
+  if ((IPC_streamPeek(&IPC_Handle[TEST_DEVICE], &p_data, &len) != IPC_OK) || (len != 0U))
+  {
+    test_fail("empty ring: segment", len);
+  }
+  /* reception semaphore is created with all its tokens: take them, as the first calls of ppposif_input() */
+  while (rtosalSemaphoreAcquire(ppposif_ipc_ctx[TEST_DEVICE].rcvSemaphore, 0U) == osOK)
+  {
+  }
+  start = HAL_GetTick();
+  (void)rtosalThreadNew((const rtosal_char_t *)"sender", test_sender_thread, osPriorityNormal, 2048U, NULL);
+  size = ppposif_ipc_get_segment(TEST_DEVICE, &p_data);
+  if ((HAL_GetTick() - start) < 40U)
+  {
+    test_fail("empty ring: no wait for the reception", HAL_GetTick() - start);
+  }
+  /* woken up by the first character: the next ones may not be received yet */
+  while (test_tx_seq != 10U)
+  {
+    (void)rtosalDelay(1U);
+  }
+  test_wait_rx();
+  while (test_rx_seq != test_tx_seq)
+  {
+    if (size <= 0)
+    {
+      size = ppposif_ipc_get_segment(TEST_DEVICE, &p_data);
+    }
+    (void)test_check_segment(p_data, size);
+    ppposif_ipc_release_segment(TEST_DEVICE, size);
+    test_rx_seq += (uint32_t)size;
+    size = 0;
+  }
+}
+
+/* 2. wrap-around: chunks read by segments with partial releases, or copied by ppposif_ipc_read() */
+static void test_wrap_around(void)
+{
+  static u8_t buff[TEST_CHUNK_SIZE];
+  const u8_t *p_data;
+  uint32_t chunk;
+  uint32_t read;
+  uint32_t wrapped = 0U;
+  uint32_t copied_wrapped = 0U;
+  uint32_t ring_end;
+  int16_t size;
+
+  for (chunk = 0U; chunk < TEST_CHUNK_NB; chunk++)
+  {
+    test_send(TEST_CHUNK_SIZE);
+    test_wait_rx();
+    read = 0U;
+    if ((chunk % 2U) == 0U)
+    {
+      ring_end = 0U;
+      while (read < TEST_CHUNK_SIZE)
+      {
+        size = ppposif_ipc_get_segment(TEST_DEVICE, &p_data);
+        if (ring_end != 0U)
+        {
+          /* ring end reached by the previous segment: next one starts at index 0 */
+          if (p_data != IPC_Handle[TEST_DEVICE].RxBuffer.data)
+          {
+            test_fail("segment after the ring end", read);
+          }
+          wrapped++;
+        }
+        ring_end = test_check_segment(p_data, size);
+        if (size > (int16_t)TEST_RELEASE_MAX)
+        {
+          /* partial release: the next segment starts after the released characters */
+          size = (int16_t)TEST_RELEASE_MAX;
+          ring_end = 0U;
+        }
+        ppposif_ipc_release_segment(TEST_DEVICE, size);
+        test_rx_seq += (uint32_t)size;
+        read += (uint32_t)size;
+      }
+    }
+    else
+    {
+      if (((uint32_t)IPC_Handle[TEST_DEVICE].RxBuffer.index_read + TEST_CHUNK_SIZE) > TEST_RING_SIZE)
+      {
+        copied_wrapped++;
+      }
+      size = ppposif_ipc_read(TEST_DEVICE, buff, (int16_t)TEST_CHUNK_SIZE);
+      if (size != (int16_t)TEST_CHUNK_SIZE)
+      {
+        test_fail("ppposif_ipc_read size", (uint32_t)size);
+      }
+      for (uint32_t i = 0U; i < TEST_CHUNK_SIZE; i++)
+      {
+        if (buff[i] != test_char(test_rx_seq + i))
+        {
+          test_fail("ppposif_ipc_read content", test_rx_seq + i);
+        }
+      }
+      test_rx_seq += TEST_CHUNK_SIZE;
+    }
+  }
+  (void)printf("wrap-around: %u segments from index 0, %u copies in 2 parts\n", wrapped, copied_wrapped);
+  if ((wrapped == 0U) || (copied_wrapped == 0U))
+  {
+    test_fail("ring end never reached", wrapped);
+  }
+}
+
+/* 3. full ring: characters received meanwhile dropped, stored ones unchanged */
+static void test_full(void)
+{
+  const u8_t *p_data;
+  uint16_t overflow = IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count;
+  uint32_t read = 0U;
+  uint16_t len;
+  int16_t size;
+
+  test_send(TEST_RING_SIZE + 100U);
+  test_wait_rx();
+  overflow = IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count - overflow;
+  if (overflow != ((TEST_RING_SIZE + 100U) - TEST_RING_FREE_MAX))
+  {
+    test_fail("full ring: characters dropped", overflow);
+  }
+  while (read < TEST_RING_FREE_MAX)
+  {
+    size = ppposif_ipc_get_segment(TEST_DEVICE, &p_data);
+    (void)test_check_segment(p_data, size);
+    ppposif_ipc_release_segment(TEST_DEVICE, size);
+    test_rx_seq += (uint32_t)size;
+    read += (uint32_t)size;
+  }
+  if ((read != TEST_RING_FREE_MAX) || (IPC_streamPeek(&IPC_Handle[TEST_DEVICE], &p_data, &len) != IPC_OK)
+      || (len != 0U))
+  {
+    test_fail("full ring: characters stored", read);
+  }
+  /* dropped characters are lost for the reader */
+  test_rx_seq = test_tx_seq;
+}
+
+/* 4. release ordering: the place of a segment is given back to the RX interrupt by its release only */
+static void test_release_ordering(void)
+{
+  static uint8_t held[TEST_RING_SIZE];
+  const u8_t *p_data;
+  uint16_t overflow;
+  uint16_t len;
+  uint32_t fill_end;
+  uint32_t resumed;
+  int16_t size;
+
+  test_send(TEST_HELD_SIZE);
+  test_wait_rx();
+  size = ppposif_ipc_get_segment(TEST_DEVICE, &p_data);
+  (void)test_check_segment(p_data, size);
+  if (size < (int16_t)TEST_RELEASED_SIZE)
+  {
+    test_fail("held segment size", (uint32_t)size);
+  }
+  (void)memcpy(held, p_data, (size_t)size);
+
+  /* fill the rest of the ring while the segment is held, 50 characters more: dropped */
+  overflow = IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count;
+  fill_end = test_rx_seq + TEST_RING_FREE_MAX;
+  test_send((TEST_RING_FREE_MAX - TEST_HELD_SIZE) + 50U);
+  test_wait_rx();
+  if ((uint16_t)(IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count - overflow) != 50U)
+  {
+    test_fail("held segment: characters dropped", IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count - overflow);
+  }
+  if (memcmp(held, p_data, (size_t)size) != 0)
+  {
+    test_fail("held segment overwritten", (uint32_t)size);
+  }
+
+  /* release a part of the segment: as many characters accepted again, no more */
+  ppposif_ipc_release_segment(TEST_DEVICE, (int16_t)TEST_RELEASED_SIZE);
+  test_rx_seq += TEST_RELEASED_SIZE;
+  overflow = IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count;
+  resumed = test_tx_seq;
+  test_send(TEST_RELEASED_SIZE + 1U);
+  test_wait_rx();
+  if ((uint16_t)(IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count - overflow) != 1U)
+  {
+    test_fail("released place: characters dropped", IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count - overflow);
+  }
+
+  /* stored characters read in order: rest of the held segment and of the fill, then the ones sent after
+     the release (the characters dropped meanwhile are skipped) */
+  while (test_rx_seq != (resumed + TEST_RELEASED_SIZE))
+  {
+    size = ppposif_ipc_get_segment(TEST_DEVICE, &p_data);
+    if ((test_rx_seq < fill_end) && ((test_rx_seq + (uint32_t)size) > fill_end))
+    {
+      size = (int16_t)(fill_end - test_rx_seq);
+    }
+    (void)test_check_segment(p_data, size);
+    ppposif_ipc_release_segment(TEST_DEVICE, size);
+    test_rx_seq += (uint32_t)size;
+    if (test_rx_seq == fill_end)
+    {
+      test_rx_seq = resumed;
+    }
+  }
+  if ((IPC_streamPeek(&IPC_Handle[TEST_DEVICE], &p_data, &len) != IPC_OK) || (len != 0U))
+  {
+    test_fail("characters stored after the release", len);
+  }
+  test_rx_seq = test_tx_seq;
+}
+
+static void test_main(void const *p_arg)
+{
+  (void)p_arg;
+
+  (void)IPC_init(TEST_DEVICE, IPC_INTERFACE_UART, &huart1);
+  ppposif_ipc_init(TEST_DEVICE);
+
+  test_empty();
+  test_wrap_around();
+  test_full();
+  test_release_ordering();
+
+  (void)printf("%u characters received, %u dropped\n", test_rx_count, IPC_Handle[TEST_DEVICE].RxBuffer.overflow_count);
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_RxCpltCallback(huart);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_TxCpltCallback(huart);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  IPC_UART_ErrorCallback(huart);
+}
+
+int main(void)
+{
+  (void)HAL_Init();
+  host_platform_init();
+  (void)socketpair(AF_UNIX, SOCK_STREAM, 0, test_fds);
+  host_uart_connect_fd(&huart1, test_fds[0], test_fds[0], 0U);
+  huart1.Init.BaudRate = 921600U;
+  (void)HAL_UART_Init(&huart1);
+
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
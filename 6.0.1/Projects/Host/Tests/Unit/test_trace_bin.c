@@ -0,0 +1,484 @@
+/**
+  ******************************************************************************
+  * @file    test_trace_bin.c
+  * @author  MCD Application Team
+  * @brief   Host unit test: binary deferred traces (TRACE_IF_TRACES_BIN == 1).
+  *          Several threads record traces in a small ring drained on the
+  *          trace UART (huart2, connected to a temporary file): the ring is
+  *          full at times and records are lost.
+  *          Checked: each record is well formed, the records of a thread are
+  *          received in order, the strings are copied, received records plus
+  *          lost records reported equal the recorded traces; the capture
+  *          decoded by Trace/Tools/trace_bin_decode.py (with an ELF file
+  *          holding the format strings at their recorded addresses) equals the
+  *          traces formatted by the host.
+  *          Arguments: the command running the decoder.
+  *          Link without PIE: the recorded addresses are 32-bit.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under Ultimate Liberty license
+  * SLA0044, the "License"; You may not use this file except in compliance with
+  * the License. You may obtain a copy of the License at:
+  *                             www.st.com/SLA0044
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "host_platform.h"
+#include "usart.h"
+#include "rtosal.h"
+#include "trace_interface.h"
+
+/* Private defines -----------------------------------------------------------*/
+#define TEST_THREAD_NB       (4U)
+#define TEST_TRACE_NB        (2000U)  /* traces per thread */
+#define TEST_BURST_NB        (50U)    /* traces recorded without delay, then wait for a drain */
+#define TEST_TIMEOUT         (10000U) /* in ms */
+#define TEST_CHAN            DBG_CHAN_UTILITIES
+#define TEST_FORMAT_STR      "bin %lu %lu %s\n\r"
+#define TEST_FORMAT_INT      "bin %lu %lu %5ld %c %%\n\r"
+#define TEST_CMD_MAX         (1024U)
+#define TEST_PATH_MAX        (256U)
+
+#if (TRACE_IF_TRACES_BIN != 1U)
+#error "test_trace_bin must be built with TRACE_IF_TRACES_BIN=1U"
+#endif /* TRACE_IF_TRACES_BIN != 1U */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  *p_data;
+  uint32_t size;
+  uint32_t len;
+} test_buf_t;
+
+/* Private variables ---------------------------------------------------------*/
+/* static: the recorded addresses are 32-bit */
+static char test_str[TEST_THREAD_NB][32] =
+{
+  "", "abc", "abcd", "a string of 21 chars."
+};
+static osThreadId test_producer_id[TEST_THREAD_NB];
+static osSemaphoreId test_done_sem;
+static char test_capture_path[TEST_PATH_MAX];
+static char test_elf_path[TEST_PATH_MAX];
+static const char *test_decoder;
+/* format addresses recorded in the traces */
+static uint32_t test_format_addr[2];
+
+/* Private function prototypes -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value);
+static void test_append(test_buf_t *p_buf, const void *p_data, uint32_t len);
+static void test_append_u32(test_buf_t *p_buf, uint32_t value);
+static void test_append_u16(test_buf_t *p_buf, uint16_t value);
+static int test_temp_file(char *p_path, const char *p_name);
+static void test_write_elf(void);
+static void test_producer(void const *p_arg);
+static void test_check_capture(const test_buf_t *p_capture, test_buf_t *p_expected);
+static void test_check_decoder(const test_buf_t *p_expected);
+static void test_main(void const *p_arg);
+
+/* Private function Definition -----------------------------------------------*/
+static void test_fail(const char *p_msg, uint32_t value)
+{
+  (void)printf("FAIL: %s (%u)\n", p_msg, value);
+  if (test_capture_path[0] != '\0')
+  {
+    (void)printf("capture kept in %s\n", test_capture_path);
+  }
+  exit(HOST_EXIT_FAILURE);
+}
+
+static void test_append(test_buf_t *p_buf, const void *p_data, uint32_t len)
+{
+  if ((p_buf->len + len) > p_buf->size)
+  {
+    p_buf->size = (2U * p_buf->size) + len;
+    p_buf->p_data = realloc(p_buf->p_data, p_buf->size);
+    if (p_buf->p_data == NULL)
+    {
+      test_fail("realloc", p_buf->size);
+    }
+  }
+  (void)memcpy(&p_buf->p_data[p_buf->len], p_data, len);
+  p_buf->len += len;
+}
+
+static void test_append_u32(test_buf_t *p_buf, uint32_t value)
+{
+  const uint8_t bytes[4] =
+  {
+    (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)
+  };
+  test_append(p_buf, bytes, 4U);
+}
+
+static void test_append_u16(test_buf_t *p_buf, uint16_t value)
+{
+  const uint8_t bytes[2] = { (uint8_t)value, (uint8_t)(value >> 8) };
+  test_append(p_buf, bytes, 2U);
+}
+
+static int test_temp_file(char *p_path, const char *p_name)
+{
+  const char *p_dir = getenv("TMPDIR");
+  int fd;
+
+  (void)snprintf(p_path, TEST_PATH_MAX, "%s/%s_XXXXXX", (p_dir != NULL) ? p_dir : "/tmp", p_name);
+  fd = mkstemp(p_path);
+  if (fd < 0)
+  {
+    test_fail("mkstemp", 0U);
+  }
+  return fd;
+}
+
+/* ELF32 file with one loaded section per format string, at the address recorded in the traces */
+static void test_write_elf(void)
+{
+  const char *const formats[] =
+  {
+    (const char *)(uintptr_t)test_format_addr[0], (const char *)(uintptr_t)test_format_addr[1]
+  };
+  const uint32_t section_nb = 1U + (uint32_t)(sizeof(formats) / sizeof(formats[0]));
+  const uint8_t ident[16] = { 0x7FU, (uint8_t)'E', (uint8_t)'L', (uint8_t)'F', 1U, 1U, 1U };
+  test_buf_t elf = { NULL, 0U, 0U };
+  uint32_t offset = 52U;
+  uint32_t shoff = 52U;
+  uint32_t i;
+  int fd;
+
+  for (i = 0U; i < (section_nb - 1U); i++)
+  {
+    shoff += (uint32_t)strlen(formats[i]) + 1U;
+  }
+  shoff = (shoff + 3U) & ~3U;
+
+  /* header: ET_EXEC, EM_ARM */
+  test_append(&elf, ident, 16U);
+  test_append_u16(&elf, 2U);
+  test_append_u16(&elf, 40U);
+  test_append_u32(&elf, 1U);
+  test_append_u32(&elf, 0U);           /* entry */
+  test_append_u32(&elf, 0U);           /* phoff */
+  test_append_u32(&elf, shoff);
+  test_append_u32(&elf, 0U);           /* flags */
+  test_append_u16(&elf, 52U);          /* ehsize */
+  test_append_u16(&elf, 0U);           /* phentsize */
+  test_append_u16(&elf, 0U);           /* phnum */
+  test_append_u16(&elf, 40U);          /* shentsize */
+  test_append_u16(&elf, (uint16_t)section_nb);
+  test_append_u16(&elf, 0U);           /* shstrndx */
+
+  for (i = 0U; i < (section_nb - 1U); i++)
+  {
+    test_append(&elf, formats[i], (uint32_t)strlen(formats[i]) + 1U);
+  }
+  while (elf.len < shoff)
+  {
+    test_append(&elf, "", 1U);
+  }
+
+  /* section headers: null section then one SHT_PROGBITS SHF_ALLOC section per format string */
+  for (i = 0U; i < 10U; i++)
+  {
+    test_append_u32(&elf, 0U);
+  }
+  for (i = 0U; i < (section_nb - 1U); i++)
+  {
+    test_append_u32(&elf, 0U);         /* name */
+    test_append_u32(&elf, 1U);         /* type */
+    test_append_u32(&elf, 2U);         /* flags */
+    test_append_u32(&elf, (uint32_t)(uintptr_t)formats[i]);
+    test_append_u32(&elf, offset);
+    test_append_u32(&elf, (uint32_t)strlen(formats[i]) + 1U);
+    test_append_u32(&elf, 0U);         /* link */
+    test_append_u32(&elf, 0U);         /* info */
+    test_append_u32(&elf, 1U);         /* addralign */
+    test_append_u32(&elf, 0U);         /* entsize */
+    offset += (uint32_t)strlen(formats[i]) + 1U;
+  }
+
+  fd = test_temp_file(test_elf_path, "test_trace_bin_elf");
+  if (write(fd, elf.p_data, elf.len) != (ssize_t)elf.len)
+  {
+    test_fail("ELF file write", elf.len);
+  }
+  (void)close(fd);
+  free(elf.p_data);
+}
+
+/* records TEST_TRACE_NB traces by bursts, alternating a string trace and an integer trace */
+static void test_producer(void const *p_arg)
+{
+  uint32_t id = (uint32_t)(uintptr_t)p_arg;
+
+  for (uint32_t seq = 0U; seq < TEST_TRACE_NB; seq++)
+  {
+    if ((seq & 1U) == 0U)
+    {
+      TRACE_PRINT(TEST_CHAN, DBL_LVL_P0, TEST_FORMAT_STR, id, seq, test_str[id])
+    }
+    else
+    {
+      TRACE_PRINT(TEST_CHAN, DBL_LVL_P0, TEST_FORMAT_INT, id, seq, -(int32_t)seq, 'a' + id)
+    }
+    if (((seq + 1U) % TEST_BURST_NB) == 0U)
+    {
+      (void)rtosalDelay(TRACE_IF_BIN_DRAIN_PERIOD);
+    }
+  }
+  (void)rtosalSemaphoreRelease(test_done_sem);
+  (void)rtosalThreadTerminate(NULL);
+}
+
+/* parse the records of the capture, build the text expected from the decoder */
+static void test_check_capture(const test_buf_t *p_capture, test_buf_t *p_expected)
+{
+  int32_t last_seq[TEST_THREAD_NB];
+  uint32_t received = 0U;
+  uint32_t lost = 0U;
+  uint32_t lost_records = 0U;
+  uint32_t pos = 0U;
+  char text[128];
+
+  for (uint32_t i = 0U; i < TEST_THREAD_NB; i++)
+  {
+    last_seq[i] = -1;
+  }
+
+  while (pos < p_capture->len)
+  {
+    const uint8_t *p_record = &p_capture->p_data[pos];
+    uint32_t words[255];
+    uint32_t size;
+    uint32_t fmt;
+    uint32_t id;
+    uint32_t seq;
+
+    if (((p_capture->len - pos) < 12U) || (p_record[0] != 0x5AU) || (p_record[1] != 0xA5U))
+    {
+      test_fail("record sync, offset", pos);
+    }
+    size = p_record[3];
+    if ((size < 3U) || ((p_capture->len - pos) < (size * 4U)))
+    {
+      test_fail("record size, offset", pos);
+    }
+    for (uint32_t i = 0U; i < size; i++)
+    {
+      words[i] = (uint32_t)p_record[4U * i] | ((uint32_t)p_record[(4U * i) + 1U] << 8) |
+                 ((uint32_t)p_record[(4U * i) + 2U] << 16) | ((uint32_t)p_record[(4U * i) + 3U] << 24);
+    }
+    pos += size * 4U;
+    fmt = words[2];
+
+    if (fmt == 0U)
+    {
+      /* lost records */
+      if ((size != 4U) || (p_record[2] != 0U) || (words[3] == 0U))
+      {
+        test_fail("lost record, offset", pos);
+      }
+      lost += words[3];
+      lost_records++;
+      (void)snprintf(text, sizeof(text), "<%u traces lost>\n\r", words[3]);
+      test_append(p_expected, text, (uint32_t)strlen(text));
+      continue;
+    }
+
+    if ((p_record[2] != (uint8_t)TEST_CHAN) || (size < 5U))
+    {
+      test_fail("record channel or size, offset", pos);
+    }
+    id = words[3];
+    seq = words[4];
+    if ((id >= TEST_THREAD_NB) || (seq >= TEST_TRACE_NB) || ((int32_t)seq <= last_seq[id]))
+    {
+      test_fail("record order, offset", pos);
+    }
+    last_seq[id] = (int32_t)seq;
+
+    /* the recorded address is the one of the format string (same address space as the target: no PIE) */
+    if (strcmp((const char *)(uintptr_t)fmt, TEST_FORMAT_STR) == 0)
+    {
+      test_format_addr[0] = fmt;
+      uint32_t len = (uint32_t)strlen(test_str[id]);
+      if (((seq & 1U) != 0U) || (size != (6U + ((len + 3U) / 4U))) || (words[5] != len) ||
+          (memcmp(&p_record[24], test_str[id], len) != 0))
+      {
+        test_fail("string record, offset", pos);
+      }
+      (void)snprintf(text, sizeof(text), TEST_FORMAT_STR, id, seq, test_str[id]);
+    }
+    else if (strcmp((const char *)(uintptr_t)fmt, TEST_FORMAT_INT) == 0)
+    {
+      test_format_addr[1] = fmt;
+      if (((seq & 1U) == 0U) || (size != 7U) || (words[5] != (uint32_t)(-(int32_t)seq)) ||
+          (words[6] != ('a' + id)))
+      {
+        test_fail("integer record, offset", pos);
+      }
+      (void)snprintf(text, sizeof(text), TEST_FORMAT_INT, id, seq, -(int32_t)seq, (char)('a' + id));
+    }
+    else
+    {
+      test_fail("record format address", fmt);
+    }
+    test_append(p_expected, text, (uint32_t)strlen(text));
+    received++;
+  }
+
+  (void)printf("received %u, lost %u (%u lost records)\n", received, lost, lost_records);
+  if ((received + lost) != (TEST_THREAD_NB * TEST_TRACE_NB))
+  {
+    test_fail("received + lost", received + lost);
+  }
+  if ((received == 0U) || (lost == 0U))
+  {
+    test_fail("ring never full, lost", lost);
+  }
+  if ((test_format_addr[0] == 0U) || (test_format_addr[1] == 0U))
+  {
+    test_fail("trace format never received", 0U);
+  }
+}
+
+/* decode the capture with the host tool and compare with the expected text */
+static void test_check_decoder(const test_buf_t *p_expected)
+{
+  test_buf_t decoded = { NULL, 0U, 0U };
+  char cmd[TEST_CMD_MAX];
+  uint8_t buf[4096];
+  size_t len;
+  FILE *p_pipe;
+
+  test_write_elf();
+  (void)snprintf(cmd, sizeof(cmd), "%s '%s' '%s'", test_decoder, test_elf_path, test_capture_path);
+  p_pipe = popen(cmd, "r");
+  if (p_pipe == NULL)
+  {
+    test_fail("popen", 0U);
+  }
+  do
+  {
+    len = fread(buf, 1U, sizeof(buf), p_pipe);
+    test_append(&decoded, buf, (uint32_t)len);
+  } while (len != 0U);
+  if (pclose(p_pipe) != 0)
+  {
+    test_fail("decoder exit status", 0U);
+  }
+  (void)unlink(test_elf_path);
+
+  if ((decoded.len != p_expected->len) || (memcmp(decoded.p_data, p_expected->p_data, decoded.len) != 0))
+  {
+    uint32_t i = 0U;
+    while ((i < decoded.len) && (i < p_expected->len) && (decoded.p_data[i] == p_expected->p_data[i]))
+    {
+      i++;
+    }
+    test_fail("decoded text differs, offset", i);
+  }
+  free(decoded.p_data);
+}
+
+static void test_main(void const *p_arg)
+{
+  test_buf_t capture = { NULL, 0U, 0U };
+  test_buf_t expected = { NULL, 0U, 0U };
+  uint8_t buf[4096];
+  ssize_t len;
+  int fd;
+
+  (void)p_arg;
+
+  for (uint32_t i = 0U; i < TEST_THREAD_NB; i++)
+  {
+    test_producer_id[i] = rtosalThreadNew((const rtosal_char_t *)"producer", test_producer, osPriorityNormal, 1024U,
+                                          (void *)(uintptr_t)i);
+  }
+  for (uint32_t i = 0U; i < TEST_THREAD_NB; i++)
+  {
+    if (rtosalSemaphoreAcquire(test_done_sem, TEST_TIMEOUT) != osOK)
+    {
+      test_fail("producer not ended", i);
+    }
+  }
+  /* let the ring and the lost records be drained */
+  (void)rtosalDelay(10U * TRACE_IF_BIN_DRAIN_PERIOD);
+
+  fd = open(test_capture_path, O_RDONLY);
+  if (fd < 0)
+  {
+    test_fail("capture file open", 0U);
+  }
+  do
+  {
+    len = read(fd, buf, sizeof(buf));
+    if (len > 0)
+    {
+      test_append(&capture, buf, (uint32_t)len);
+    }
+  } while (len > 0);
+  (void)close(fd);
+
+  test_check_capture(&capture, &expected);
+  test_check_decoder(&expected);
+  (void)unlink(test_capture_path);
+  free(capture.p_data);
+  free(expected.p_data);
+
+  (void)printf("PASS\n");
+  exit(HOST_EXIT_OK);
+}
+
+/* Functions Definition ------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+  static char decoder[TEST_CMD_MAX];
+  int fd;
+
+  if (argc < 2)
+  {
+    (void)printf("usage: %s <decoder command>\n", argv[0]);
+    return HOST_EXIT_FAILURE;
+  }
+  decoder[0] = '\0';
+  for (int i = 1; i < argc; i++)
+  {
+    (void)snprintf(&decoder[strlen(decoder)], sizeof(decoder) - strlen(decoder), "%s'%s'",
+                   (i == 1) ? "" : " ", argv[i]);
+  }
+  test_decoder = decoder;
+
+  host_platform_init();
+  /* TRACE UART: capture file */
+  fd = test_temp_file(test_capture_path, "test_trace_bin_capture");
+  host_uart_connect_fd(&huart2, -1, fd, 0U);
+
+  traceIF_init();
+  traceIF_start();
+
+  test_done_sem = rtosalSemaphoreNew(NULL, TEST_THREAD_NB);
+  for (uint32_t i = 0U; i < TEST_THREAD_NB; i++)
+  {
+    (void)rtosalSemaphoreAcquire(test_done_sem, 0U);
+  }
+  (void)rtosalThreadNew((const rtosal_char_t *)"test", test_main, osPriorityNormal, 2048U, NULL);
+  (void)osKernelStart();
+  return HOST_EXIT_FAILURE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
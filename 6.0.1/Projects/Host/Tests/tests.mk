@@ -0,0 +1,245 @@
+##############################################################################
+# Host tests (included by ../Makefile)
+#
+# Unit/<name>.c       unit test or benchmark program, linked with the host
+#                     platform and the stack sources UNIT_<name>_SRC, compiled
+#                     for this program with UNIT_<name>_DEFINES (feature flags)
+#                     and the include directories UNIT_<name>_INCLUDES (searched
+#                     first), linked with UNIT_<name>_LDFLAGS, run with the
+#                     arguments UNIT_<name>_ARGS
+# Scenarios/test_*.py scenarios run on build/cellular_host with the virtual
+#                     modem (python unittest)
+# HOST_VARIANTS       sample built with other feature flags VARIANT_<name>_DEFINES
+#                     (build/variants/<name>/cellular_host), run by the scenarios
+# Bench/bench_*.py    benchmarks run on the sample or on HOST_APPS with the
+#                     virtual modem (python unittest), results in build/bench
+# HOST_APPS           Bench/<name>.c application replacing the sample
+#                     (build/apps/<name>/cellular_host), run by the benchmarks
+#                     and the scenarios, built with the feature flags
+#                     APP_<name>_DEFINES if any
+##############################################################################
+
+TESTS_DIR   := $(HOST)/Tests
+UNIT_DIR    := $(TESTS_DIR)/Unit
+LWIP        := $(ROOT)/Middlewares/Third_Party/LwIP
+BENCH_DIR   := $(TESTS_DIR)/Bench
+
+# Unit tests: UNIT_TESTS lists the programs run by "make check",
+# UNIT_BENCHS the programs run by "make bench"
+UNIT_TESTS  :=
+UNIT_BENCHS :=
+
+# Runtime services needed by every stack module (RTOS abstraction, traces, errors, console commands)
+UNIT_CORE_SRC := $(CELLULAR)/Core/Rtosal/Src/rtosal.c \
+                 $(CELLULAR)/Core/Trace/Src/trace_interface.c \
+                 $(CELLULAR)/Core/Runtime_Library/Src/cellular_runtime_standard.c \
+                 $(CELLULAR)/Core/Error/Src/error_handler.c \
+                 $(wildcard $(MISC)/Cmd/Src/*.c)
+
+# IPC: block reception with the circular DMA, pause/resume of the RX queue
+UNIT_TESTS                        += test_ipc_uart_dma_rx
+UNIT_test_ipc_uart_dma_rx_SRC     := $(wildcard $(CELLULAR)/Core/Ipc/Src/*.c) $(UNIT_CORE_SRC)
+UNIT_test_ipc_uart_dma_rx_DEFINES := -DIPC_USE_UART_DMA_RX=1U
+
+# IPC: TX queue, two tasks sending on the same channel, transmission overlapped with the senders
+UNIT_TESTS                        += test_ipc_uart_tx_queue
+UNIT_test_ipc_uart_tx_queue_SRC   := $(wildcard $(CELLULAR)/Core/Ipc/Src/*.c) $(UNIT_CORE_SRC)
+UNIT_test_ipc_uart_tx_queue_DEFINES := -DIPC_USE_TX_QUEUE=1U
+
+# AT: BG96 block end of message scanner against the per character automaton (driver source included by the test)
+UNIT_TESTS                        += test_at_eom_block_replay
+UNIT_test_at_eom_block_replay_SRC := $(filter-out %/at_custom_modem_specific.c,$(STACK_SRC))
+UNIT_test_at_eom_block_replay_ARGS := $(UNIT_DIR)/Traces/bg96_echoclient.trc
+
+# AT: requests queued and processed in order by ATCore task, asynchronous requests, step boundary yield
+# (AT Core source included by the test, AT parser and IPC replaced by fakes)
+UNIT_TESTS                        += test_at_core_queue
+UNIT_test_at_core_queue_SRC       := $(UNIT_CORE_SRC)
+UNIT_test_at_core_queue_DEFINES   := -DATCORE_REQ_NB=4U
+
+# AT: batched parsing of the received messages, one ATCore task wake-up for the messages received meanwhile
+# (AT Core source included by the test, AT parser and IPC replaced by fakes)
+UNIT_TESTS                        += test_at_core_rx_batch
+UNIT_test_at_core_rx_batch_SRC    := $(UNIT_CORE_SRC)
+UNIT_test_at_core_rx_batch_DEFINES := -DUSE_AT_CORE_RX_BATCH=1
+
+# AT: search of the received command strings in the BG96 LUT, indexed and linear (driver source included,
+# release version: no trace)
+UNIT_BENCHS                       += bench_at_lut_search
+UNIT_bench_at_lut_search_SRC      := $(filter-out %/at_custom_modem_specific.c,$(STACK_SRC))
+UNIT_bench_at_lut_search_DEFINES  := -DSW_DEBUG_VERSION=0U
+
+# AT: hexadecimal string conversions of the socket data (Type1SC), word conversions against per character ones
+UNIT_TESTS                        += test_at_util_hex
+UNIT_test_at_util_hex_SRC         := $(CELLULAR)/Core/AT_Core/Src/at_util.c $(UNIT_CORE_SRC)
+UNIT_BENCHS                       += bench_at_util_hex
+UNIT_bench_at_util_hex_SRC        := $(CELLULAR)/Core/AT_Core/Src/at_util.c $(UNIT_CORE_SRC)
+UNIT_bench_at_util_hex_DEFINES    := -DSW_DEBUG_VERSION=0U
+
+# PPPoS: LwIP pppos.c with the PPPOS_FAST_HDLC local patch against pppos.c without the patch (included by the
+# test), LwIP configured by Unit/LwIP/lwipopts.h
+UNIT_TESTS                        += test_pppos_fast_hdlc
+UNIT_test_pppos_fast_hdlc_SRC     := $(LWIP)/src/netif/ppp/pppos.c \
+                                     $(CELLULAR)/Core/PPPosif/Src/ppposif_hdlc.c \
+                                     $(addprefix $(LWIP)/src/core/,def.c mem.c memp.c pbuf.c)
+UNIT_test_pppos_fast_hdlc_DEFINES := -DPPPOS_FAST_HDLC=1
+UNIT_test_pppos_fast_hdlc_INCLUDES := -I$(UNIT_DIR)/LwIP -I$(LWIP)/src/include -I$(LWIP)/system
+
+# PPPosif: zero-copy reception of ppposif_input() in the IPC stream ring, wrap-around, full ring, release ordering
+# (ppposif IPC source included by the test, characters sent to the emulated UART)
+UNIT_TESTS                        += test_ppposif_ipc_ring
+UNIT_test_ppposif_ipc_ring_SRC    := $(wildcard $(CELLULAR)/Core/Ipc/Src/*.c) $(UNIT_CORE_SRC)
+UNIT_test_ppposif_ipc_ring_DEFINES := -DUSE_SOCKETS_TYPE=USE_SOCKETS_LWIP
+UNIT_test_ppposif_ipc_ring_INCLUDES := -I$(UNIT_DIR)/LwIP -I$(LWIP)/src/include -I$(LWIP)/src/include/netif/ppp \
+                                     -I$(LWIP)/system -I$(LWIP)/system/arch
+
+# COM: receive prefetch of the modem sockets with a scripted fake Cellular Service (COM source included by the test,
+# release version: no trace)
+UNIT_TESTS                        += test_com_rcv_prefetch
+UNIT_test_com_rcv_prefetch_SRC    := $(UNIT_CORE_SRC) \
+                                     $(CELLULAR)/Core/Data_Cache/Src/dc_common.c \
+                                     $(CELLULAR)/Interface/Com/Src/com_sockets_err_compat.c \
+                                     $(CELLULAR)/Interface/Com/Src/com_sockets_statistic.c
+UNIT_test_com_rcv_prefetch_DEFINES := -DUSE_CELLULAR_SERVICE_ASYNC_REQ=1 -DCOM_SOCKETS_RCV_PREFETCH_SIZE=512U \
+                                      -DSW_DEBUG_VERSION=0U
+
+# COM: com_poll of the modem sockets, wake-up on data ready, timeout and waiters exhaustion
+# (COM source included by the test, release version: no trace)
+UNIT_TESTS                        += test_com_poll
+UNIT_test_com_poll_SRC            := $(UNIT_CORE_SRC) \
+                                     $(CELLULAR)/Core/Data_Cache/Src/dc_common.c \
+                                     $(CELLULAR)/Interface/Com/Src/com_sockets_err_compat.c \
+                                     $(CELLULAR)/Interface/Com/Src/com_sockets_statistic.c
+UNIT_test_com_poll_DEFINES        := -DCOM_SOCKETS_RCV_PREFETCH_SIZE=0U -DSW_DEBUG_VERSION=0U
+
+# COM: com_poll of the LwIP sockets mapped on lwip_poll (COM source built with the LwIP headers and the target
+# LwIP configuration, scripted lwip_poll)
+UNIT_TESTS                        += test_com_poll_lwip
+UNIT_test_com_poll_lwip_SRC       := $(CELLULAR)/Interface/Com/Src/com_sockets_lwip_mcu.c \
+                                     $(CELLULAR)/Interface/Com/Src/com_sockets_err_compat.c
+UNIT_test_com_poll_lwip_DEFINES   := -DUSE_SOCKETS_TYPE=USE_SOCKETS_LWIP -DUSE_COM_PING=0 -DLWIP_NO_UNISTD_H=1
+UNIT_test_com_poll_lwip_INCLUDES  := -I$(LWIP)/src/include -I$(LWIP)/system
+
+# Cellular Service: yield of a control plane request to the data plane requests waiting at its step boundary,
+# not to a data plane request arrived after the yield (Cellular Service OS source included by the test)
+UNIT_TESTS                        += test_cs_os_yield
+UNIT_test_cs_os_yield_SRC         := $(filter-out %/cellular_service_os.c,$(STACK_SRC))
+UNIT_test_cs_os_yield_DEFINES     := -DUSE_CELLULAR_SERVICE_CTRL_YIELD=1
+
+# Data Cache: deferred notifications of the written entries and of the events, in write order
+UNIT_TESTS                        += test_dc_com_deferred_notif
+UNIT_test_dc_com_deferred_notif_SRC := $(CELLULAR)/Core/Data_Cache/Src/dc_common.c $(UNIT_CORE_SRC)
+UNIT_test_dc_com_deferred_notif_DEFINES := -DUSE_DC_COM_DEFERRED_NOTIF=1
+
+# Trace: binary deferred traces, ring shared by several threads (small ring: records lost) and host decoder
+# (no PIE: the addresses recorded by the traces are 32-bit)
+UNIT_TESTS                        += test_trace_bin
+UNIT_test_trace_bin_SRC           := $(UNIT_CORE_SRC)
+UNIT_test_trace_bin_DEFINES       := -DTRACE_IF_TRACES_BIN=1U -DTRACE_IF_BIN_RING_SIZE=256U
+UNIT_test_trace_bin_LDFLAGS       := -no-pie
+UNIT_test_trace_bin_ARGS          := $(PYTHON) $(CELLULAR)/Core/Trace/Tools/trace_bin_decode.py
+
+# Sample variants run by the scenarios
+HOST_VARIANTS :=
+
+# Cellular Service: asynchronous services available, synchronous services still processed by the calling thread
+HOST_VARIANTS                     += async_req
+VARIANT_async_req_DEFINES         := -DUSE_CELLULAR_SERVICE_ASYNC_REQ=1
+
+# COM: receive prefetch of the TCP modem sockets (reads queued on the Cellular Service request thread)
+HOST_VARIANTS                     += rcv_prefetch
+VARIANT_rcv_prefetch_DEFINES      := -DUSE_CELLULAR_SERVICE_ASYNC_REQ=1 -DCOM_SOCKETS_RCV_PREFETCH_SIZE=1500U
+
+# IPC: AT commands copied in the TX queue, sendToIPC() does not wait for the end of the transmission
+HOST_VARIANTS                     += tx_queue
+VARIANT_tx_queue_DEFINES          := -DIPC_USE_TX_QUEUE=1U
+
+# IPC: modem answers received by blocks with the circular DMA reception
+HOST_VARIANTS                     += dma_rx
+VARIANT_dma_rx_DEFINES            := -DIPC_USE_UART_DMA_RX=1U
+
+# Host applications run by the benchmarks and the scenarios
+HOST_APPS :=
+
+# COM: header and payload sent with one com_send() per segment or one com_sendmsg()
+HOST_APPS                         += app_com_sendmsg
+
+# COM: ICC access after a modem power off/on (Tests/Scenarios/test_icc_power_cycle.py)
+HOST_APPS                         += app_com_icc
+
+# Cellular Service: network registrations yielding to the socket echoes at their step boundaries
+# (Tests/Scenarios/test_cs_yield.py)
+HOST_APPS                         += app_cs_yield
+APP_app_cs_yield_DEFINES          := -DUSE_CELLULAR_SERVICE_CTRL_YIELD=1
+
+UNIT_BIN     = $(BUILD)/unit/$(1)
+VARIANT_BIN  = $(BUILD)/variants/$(1)/cellular_host
+APP_BIN      = $(BUILD)/apps/$(1)/cellular_host
+
+.PHONY: check check-unit check-scenarios
+
+check: check-unit check-scenarios
+
+check-unit: $(foreach t,$(UNIT_TESTS),$(call UNIT_BIN,$(t)))
+	@set -e; $(foreach t,$(UNIT_TESTS),echo "=== $(t)"; $(call UNIT_BIN,$(t)) $(UNIT_$(t)_ARGS);)
+
+check-scenarios: $(BUILD)/cellular_host $(foreach v,$(HOST_VARIANTS),$(call VARIANT_BIN,$(v))) \
+                 $(foreach a,$(HOST_APPS),$(call APP_BIN,$(a)))
+	HOST_BINARY=$(abspath $(BUILD)/cellular_host) HOST_VARIANTS_DIR=$(abspath $(BUILD)/variants) \
+	  HOST_APPS_DIR=$(abspath $(BUILD)/apps) HOST_TEST_LOGS=$(abspath $(BUILD)/logs) \
+	  $(PYTHON) -m unittest discover -s $(TESTS_DIR)/Scenarios -v $(if $(T),-k $(T))
+
+bench: $(foreach t,$(UNIT_BENCHS),$(call UNIT_BIN,$(t))) $(BUILD)/cellular_host \
+       $(foreach v,$(HOST_VARIANTS),$(call VARIANT_BIN,$(v))) $(foreach a,$(HOST_APPS),$(call APP_BIN,$(a)))
+	@mkdir -p $(BUILD)/bench
+	@set -e; for t in $(UNIT_BENCHS); do echo "=== $$t"; $(BUILD)/unit/$$t $(BUILD)/bench/$$t.csv; done
+	HOST_BINARY=$(abspath $(BUILD)/cellular_host) HOST_VARIANTS_DIR=$(abspath $(BUILD)/variants) \
+	  HOST_APPS_DIR=$(abspath $(BUILD)/apps) HOST_TEST_LOGS=$(abspath $(BUILD)/logs) \
+	  HOST_BENCH_RESULTS=$(abspath $(BUILD)/bench) \
+	  $(PYTHON) -m unittest discover -s $(BENCH_DIR) -p 'bench_*.py' -v $(if $(T),-k $(T))
+
+# a unit program has its own objects (its feature flags may differ from the sample ones)
+UNIT_OBJ = $(patsubst $(abspath $(ROOT))/%.c,$(BUILD)/unit_obj/$(1)/%.o,$(abspath $(2)))
+
+define UNIT_RULE
+$(BUILD)/unit_obj/$(1)/%.o: $(ROOT)/%.c
+	@mkdir -p $$(@D)
+	$$(CC) $$(HOST_CFLAGS) $$(CFLAGS) $$(DEFINES) $(UNIT_$(1)_DEFINES) $(UNIT_$(1)_INCLUDES) $$(INCLUDES) -MMD -MP \
+	  -c -o $$@ $$<
+
+$(call UNIT_BIN,$(1)): $(call UNIT_OBJ,$(1),$(UNIT_DIR)/$(1).c $(UNIT_$(1)_SRC)) $(PLATFORM_OBJ)
+	@mkdir -p $$(@D)
+	$$(CC) $$(LDFLAGS) $(UNIT_$(1)_LDFLAGS) -pthread -o $$@ $$^
+endef
+$(foreach t,$(sort $(UNIT_TESTS) $(UNIT_BENCHS)),$(eval $(call UNIT_RULE,$(t))))
+
+# a sample variant has its own objects
+VARIANT_OBJ = $(patsubst $(abspath $(ROOT))/%.c,$(BUILD)/variants/$(1)/obj/%.o,$(abspath $(2)))
+
+define VARIANT_RULE
+$(BUILD)/variants/$(1)/obj/%.o: $(ROOT)/%.c
+	@mkdir -p $$(@D)
+	$$(CC) $$(HOST_CFLAGS) $$(CFLAGS) $$(DEFINES) $(VARIANT_$(1)_DEFINES) $$(INCLUDES) -MMD -MP -c -o $$@ $$<
+
+$(call VARIANT_BIN,$(1)): $(call VARIANT_OBJ,$(1),$(STACK_SRC) $(APP_SRC)) $(PLATFORM_OBJ)
+	$$(CC) $$(LDFLAGS) -pthread -o $$@ $$^
+endef
+$(foreach v,$(HOST_VARIANTS),$(eval $(call VARIANT_RULE,$(v))))
+
+# a host application has the objects of the sample, except the sample application,
+# or its own objects if it has its own feature flags
+HOST_APP_SRC = $(STACK_SRC) $(HOST)/Core/Src/main.c $(MISC)/RTOS/FreeRTOS/Src/freertos.c $(BENCH_DIR)/$(1).c
+HOST_APP_OBJ = $(if $(APP_$(1)_DEFINES), \
+                 $(patsubst $(abspath $(ROOT))/%.c,$(BUILD)/apps/$(1)/obj/%.o,$(abspath $(call HOST_APP_SRC,$(1)))), \
+                 $(call OBJ,$(call HOST_APP_SRC,$(1))))
+
+define APP_RULE
+$(BUILD)/apps/$(1)/obj/%.o: $(ROOT)/%.c
+	@mkdir -p $$(@D)
+	$$(CC) $$(HOST_CFLAGS) $$(CFLAGS) $$(DEFINES) $(APP_$(1)_DEFINES) $$(INCLUDES) -MMD -MP -c -o $$@ $$<
+
+$(call APP_BIN,$(1)): $(PLATFORM_OBJ) $(call HOST_APP_OBJ,$(1))
+	@mkdir -p $$(@D)
+	$$(CC) $$(LDFLAGS) -pthread -o $$@ $$^
+endef
+$(foreach a,$(HOST_APPS),$(eval $(call APP_RULE,$(a))))
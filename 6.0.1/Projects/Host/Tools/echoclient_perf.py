@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+##############################################################################
+# @file    echoclient_perf.py
+# @author  MCD Application Team
+# @brief   Run the EchoClt performance test ('echoclient perf') for each
+#          protocol and collect its CSV results (trace lines "@perf@:").
+#
+# The socket stack (modem or LwIP) is selected at build time (USE_SOCKETS_TYPE)
+# and reported in the "stack" column: the TCP/UDP x modem/LwIP matrix is
+# obtained by running this script on a modem build and on a LwIP build with
+# --append to the same file.
+#
+# Target:         echoclient_perf.py --port /dev/ttyACM0 --out perf.csv
+# Virtual modem:  Tests/Bench/bench_echoclient.py (make bench)
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import argparse
+import csv
+import os
+import re
+import sys
+import termios
+import threading
+import time
+
+PERF_PREFIX = "@perf@:"
+
+# Console patterns of the Cellular sample
+ECHOCLIENT_STOPPED = r"Echoclt 1 STOPPED|Echoclt 1: Bad state to do this command \(current state: Off\)"
+PROTOCOL_SET = r"Echoclt 1: Protocol (change to %s\b.*done|already %s\b)"
+PERF_REFUSED = r"Performance already requested|NOT fully stopped|not yet obtain|Low power is activated"
+PERF_END = r"Echoclt Performance End"
+
+
+class SerialConsole:
+    """Console of the target on a serial port; same interface as virtual_modem.HostRun (wait_for, console)."""
+
+    def __init__(self, port, baudrate=115200):
+        self.fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+        attrs = termios.tcgetattr(self.fd)
+        speed = getattr(termios, "B%d" % baudrate)
+        attrs[0] = 0                                          # iflag: raw
+        attrs[1] = 0                                          # oflag: raw
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attrs[3] = 0                                          # lflag: no echo, no canonical mode
+        attrs[4] = speed
+        attrs[5] = speed
+        attrs[6][termios.VMIN] = 1
+        attrs[6][termios.VTIME] = 0
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        self.start_time = time.monotonic()
+        self.output = []                  # (time, line)
+        self.cond = threading.Condition()
+        self.running = True
+        self.reader = threading.Thread(target=self._read, daemon=True)
+        self.reader.start()
+
+    def _read(self):
+        pending = b""
+        while self.running:
+            try:
+                chunk = os.read(self.fd, 1024)
+            except OSError:
+                break
+            pending += chunk
+            *lines, pending = re.split(rb"\r?\n", pending)
+            with self.cond:
+                for raw in lines:
+                    self.output.append((time.monotonic() - self.start_time, raw.decode("latin-1").strip("\r")))
+                self.cond.notify_all()
+
+    def wait_for(self, pattern, timeout, start=0):
+        """Wait for a console line matching pattern; return (index, time, match) or raise TimeoutError."""
+        regex = re.compile(pattern)
+        deadline = time.monotonic() + timeout
+        idx = start
+        with self.cond:
+            while True:
+                while idx < len(self.output):
+                    m = regex.search(self.output[idx][1])
+                    if m:
+                        return idx, self.output[idx][0], m
+                    idx += 1
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    raise TimeoutError("'%s' not found, last lines:\n%s" %
+                                       (pattern, "\n".join(l for _, l in self.output[-20:])))
+                self.cond.wait(min(remaining, 0.5))
+
+    def console(self, command):
+        """Send a command to the console."""
+        os.write(self.fd, command.encode() + b"\r")
+
+    def close(self):
+        self.running = False
+        os.close(self.fd)
+
+
+def run_perf(console, protocol, iterations=0, timeout=3600.0):
+    """Stop EchoClt 1, set its protocol and run 'echoclient perf [<iterations>]' (0: firmware default).
+    Return the header and the rows of the "@perf@:" CSV block."""
+    start = len(console.output)
+    console.console("echoclient 1 off")
+    console.wait_for(ECHOCLIENT_STOPPED, 60.0, start=start)
+    start = len(console.output)
+    console.console("echoclient 1 protocol %s" % protocol)
+    console.wait_for(PROTOCOL_SET % (protocol, protocol), 10.0, start=start)
+    start = len(console.output)
+    console.console("echoclient perf" + (" %d" % iterations if iterations else ""))
+    idx, _, m = console.wait_for(PERF_END + "|" + PERF_REFUSED, timeout, start=start)
+    if not m.group(0).endswith("End"):
+        raise RuntimeError("performance test refused: %s" % console.output[idx][1])
+    header = None
+    rows = []
+    for _, line in console.output[start:idx + 1]:
+        # the console prompt may precede the trace on the same line
+        pos = line.find(PERF_PREFIX)
+        if pos >= 0:
+            fields = line[pos + len(PERF_PREFIX):].split(",")
+            if fields[0] == "stack":
+                header = fields
+            elif header is not None:
+                rows.append(dict(zip(header, fields)))
+    if header is None:
+        raise RuntimeError("no %s results" % PERF_PREFIX)
+    return header, rows
+
+
+def write_csv(path, header, rows, append=False):
+    """Write (or append) the results; the header is written in a new file only."""
+    exists = append and os.path.exists(path) and (os.path.getsize(path) > 0)
+    with open(path, "a" if append else "w", newline="") as f:
+        writer = csv.DictWriter(f, fieldnames=header, extrasaction="ignore")
+        if not exists:
+            writer.writeheader()
+        writer.writerows(rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the EchoClt performance test on a target console")
+    parser.add_argument("--port", required=True, help="console serial port, e.g. /dev/ttyACM0")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    parser.add_argument("--protocol", action="append", default=[], metavar="TCP|UDP",
+                        help="protocol to test (repeat the option), default TCP and UDP")
+    parser.add_argument("--iter", type=int, default=0, help="iterations per size [5,255], 0: firmware default")
+    parser.add_argument("--timeout", type=float, default=3600.0, help="maximum duration of one test (s)")
+    parser.add_argument("--out", required=True, help="CSV results file")
+    parser.add_argument("--append", action="store_true", help="append to the results file (e.g. LwIP build)")
+    args = parser.parse_args()
+
+    console = SerialConsole(args.port, args.baudrate)
+    append = args.append
+    try:
+        for protocol in (args.protocol or ["TCP", "UDP"]):
+            header, rows = run_perf(console, protocol.upper(), args.iter, args.timeout)
+            write_csv(args.out, header, rows, append)
+            append = True
+            for r in rows:
+                print(",".join(r.values()), flush=True)
+    finally:
+        console.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,681 @@
+#!/usr/bin/env python3
+##############################################################################
+# @file    virtual_modem.py
+# @author  MCD Application Team
+# @brief   Virtual Quectel BG96 modem for the host build of the STM32 Cellular
+#          middleware.
+#
+# The virtual modem answers the AT commands used by the BG96 driver
+# (Drivers/BSP/X_STMOD_PLUS_MODEMS/BG96) and emulates the modem sockets:
+# - TCP/UDP sockets opened with AT+QIOPEN are served by the modem itself:
+#   data sent with AT+QISEND is echoed back ("+QIURC: "recv"" then AT+QIRD),
+#   a TCP socket opened on port 13 receives a date/time string (daytime).
+# - DNS requests (AT+QIDNSGIP) resolve to VIRTUAL_SERVER_IP.
+# - AT+QPING answers with a fixed round trip time.
+# Each AT command of a line is counted (exchanges) and errors can be injected
+# per command (name, e.g. "+CGREG", or command, e.g. "+CGREG?") to check the
+# error handling of the driver.
+# The PDP contexts configured with AT+QICSGP are kept in non-volatile memory:
+# a modem created with pdn_stored=False has lost them (new modem, memory
+# erased) and rejects AT+QIACT until the context is configured again.
+#
+# Library use:      see HostRun (start the host binary connected to the modem)
+# Command line use: virtual_modem.py [options] -- build/cellular_host
+##############################################################################
+# @attention
+#
+# Copyright (c) 2021 STMicroelectronics.
+# All rights reserved.
+#
+# This software component is licensed by ST under Ultimate Liberty license
+# SLA0044, the "License"; You may not use this file except in compliance with
+# the License. You may obtain a copy of the License at:
+#                             www.st.com/SLA0044
+#
+##############################################################################
+
+import argparse
+import collections
+import os
+import re
+import signal
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+VIRTUAL_SERVER_IP = "10.10.10.10"
+VIRTUAL_MODEM_IP = "10.0.0.2"
+DAYTIME_PORT = 13
+FW_REVISION = "BG96MAR02A07M1G"
+
+
+def _split_params(params):
+    """Split AT command parameters on ',' outside of quotes, quotes removed."""
+    out = []
+    cur = ""
+    quoted = False
+    for c in params:
+        if c == '"':
+            quoted = not quoted
+        elif (c == ",") and not quoted:
+            out.append(cur)
+            cur = ""
+        else:
+            cur += c
+    out.append(cur)
+    return out
+
+
+def split_command_line(line):
+    """Split an AT command line into its commands.
+
+    "ATE0+CMEE=1;V1&D0" -> ["E0", "+CMEE=1", "V1", "&D0"]
+    "AT+CSQ;+QCSQ"      -> ["+CSQ", "+QCSQ"]
+    """
+    body = line[2:] if line[:2].upper() == "AT" else line
+    cmds = []
+    cur = ""
+    quoted = False
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c == '"':
+            quoted = not quoted
+            cur += c
+        elif quoted:
+            cur += c
+        elif c == ";":
+            if cur:
+                cmds.append(cur)
+            cur = ""
+        elif (c in "+&") and cur and not cur.startswith("+"):
+            # end of a basic command (E0, V1, ...)
+            cmds.append(cur)
+            cur = c
+        elif c.isalpha() and cur and not cur.startswith(("+", "&")) and cur[-1].isdigit():
+            # basic commands are one letter followed by a value: "E0V1"
+            cmds.append(cur)
+            cur = c
+        elif (c.isalpha() and cur.startswith("&") and len(cur) > 2 and cur[-1].isdigit()):
+            cmds.append(cur)
+            cur = c
+        else:
+            cur += c
+        i += 1
+    if cur:
+        cmds.append(cur)
+    if not cmds:
+        cmds = [""]
+    return cmds
+
+
+def command_name(cmd):
+    """Name of a command, used for statistics and error injection: "+QIOPEN", "E", "&D"..."""
+    m = re.match(r"([+&]?[A-Za-z]+)", cmd)
+    return m.group(1).upper() if m else ""
+
+
+class Socket:
+    def __init__(self, conn_id, proto, ip, port):
+        self.conn_id = conn_id
+        self.proto = proto
+        self.ip = ip
+        self.port = port
+        self.stream = bytearray()              # TCP
+        self.datagrams = collections.deque()   # UDP: (data, ip, port)
+        self.total = 0
+        self.read = 0
+
+    def unread(self):
+        if self.proto == "TCP":
+            return len(self.stream)
+        return sum(len(d[0]) for d in self.datagrams)
+
+
+class VirtualBG96:
+    """Virtual BG96 connected to one end of a stream socket."""
+
+    def __init__(self, sock, latency_ms=0.0, errors=None, daytime=None, log=None, trace=None,
+                 imei="866425030000001", pdn_stored=True):
+        self.sock = sock
+        self.latency = latency_ms / 1000.0
+        # command name or command (name and arguments) -> number of errors to inject (-1: always)
+        self.errors = dict(errors or {})
+        self.daytime = daytime
+        self.imei = imei
+        # PDP contexts configured (AT+QICSGP), None: all the contexts are configured in non-volatile memory
+        self.pdn_configured = None if pdn_stored else set()
+        self.log = log
+        # raw UART trace: "< hex" received from the host, "> hex" sent to the host (Tests/Unit replay tests)
+        self.trace = trace
+        self.lock = threading.RLock()
+        self.echo = True
+        self.cfun = 0
+        self.registered = False
+        self.pdp_active = False
+        self.sockets = {}
+        self.pending_send = None
+        self.running = True
+        self.start_time = time.monotonic()
+        self.first_command_time = None
+        self.stats = {
+            "lines": 0,                  # AT command lines received
+            "commands": 0,               # AT commands received (a line may contain several commands)
+            "urcs": 0,
+            "bytes_from_host": 0,
+            "bytes_to_host": 0,
+            "socket_bytes_sent": 0,      # payload of AT+QISEND
+            "socket_bytes_received": 0,  # payload of AT+QIRD
+            "per_command": collections.Counter(),
+            "errors_injected": collections.Counter(),
+            "qiact_rejected": 0,         # AT+QIACT on a context not configured
+        }
+        self.events = []                  # (time, name) for timing measurements
+        self.command_lines = []           # (time, line) AT command lines received
+        self.thread = threading.Thread(target=self._run, daemon=True)
+
+    # --- public -------------------------------------------------------------
+    def start(self):
+        self.thread.start()
+
+    def stop(self):
+        self.running = False
+        try:
+            self.sock.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        self.thread.join(5)
+        self.sock.close()
+
+    def event_time(self, name):
+        """Time (s, from start) of the first occurrence of an event, None if not occurred."""
+        for t, n in self.events:
+            if n == name:
+                return t
+        return None
+
+    def inject_error(self, name, count=-1):
+        with self.lock:
+            self.errors[name.upper()] = count
+
+    def push_socket_data(self, conn_id, data):
+        """Data received from the network on a socket (raise +QIURC "recv")."""
+        with self.lock:
+            s = self.sockets.get(conn_id)
+            if s is not None:
+                self._socket_input(s, data, s.ip, s.port)
+
+    # --- I/O ----------------------------------------------------------------
+    def _write(self, data):
+        if isinstance(data, str):
+            data = data.encode("latin-1")
+        with self.lock:
+            self.stats["bytes_to_host"] += len(data)
+            if self.log:
+                self.log.write("MDM> %r\n" % data)
+            if self.trace:
+                self.trace.write("> %s\n" % data.hex())
+            try:
+                self.sock.sendall(data)
+            except OSError:
+                self.running = False
+
+    def _lines(self, *lines):
+        self._write("".join("\r\n%s\r\n" % l for l in lines))
+
+    def _urc(self, text):
+        with self.lock:
+            self.stats["urcs"] += 1
+            self._lines(text)
+
+    def _later(self, delay, fn, *args):
+        t = threading.Timer(delay, self._locked, (fn,) + args)
+        t.daemon = True
+        t.start()
+
+    def _locked(self, fn, *args):
+        if self.running:
+            with self.lock:
+                fn(*args)
+
+    def _run(self):
+        buf = bytearray()
+        while self.running:
+            try:
+                chunk = self.sock.recv(4096)
+            except OSError:
+                break
+            if not chunk:
+                break
+            with self.lock:
+                self.stats["bytes_from_host"] += len(chunk)
+                if self.log:
+                    self.log.write("MDM< %r\n" % bytes(chunk))
+                if self.trace:
+                    self.trace.write("< %s\n" % bytes(chunk).hex())
+            buf += chunk
+            while buf:
+                if self.pending_send is not None:
+                    s, size, ip, port = self.pending_send
+                    if len(buf) < size:
+                        break
+                    data = bytes(buf[:size])
+                    del buf[:size]
+                    self.pending_send = None
+                    with self.lock:
+                        self._socket_sent(s, data, ip, port)
+                    continue
+                idx = buf.find(b"\r")
+                if idx < 0:
+                    break
+                line = bytes(buf[:idx]).decode("latin-1").strip("\n ")
+                del buf[:idx + 1]
+                if line:
+                    if self.latency:
+                        time.sleep(self.latency)
+                    with self.lock:
+                        self._command_line(line)
+        self.running = False
+
+    # --- AT commands --------------------------------------------------------
+    def _command_line(self, line):
+        now = time.monotonic() - self.start_time
+        if self.first_command_time is None:
+            self.first_command_time = now
+        if self.echo:
+            self._write(line + "\r")
+        if line[:2].upper() != "AT":
+            return
+        self.stats["lines"] += 1
+        self.command_lines.append((now, line))
+        cmds = split_command_line(line)
+        out = []
+        for cmd in cmds:
+            name = command_name(cmd)
+            self.stats["commands"] += 1
+            self.stats["per_command"][name or "AT"] += 1
+            self.events.append((now, name or "AT"))
+            key = cmd.upper() if cmd.upper() in self.errors else name
+            err = self.errors.get(key)
+            if err:
+                if err > 0:
+                    self.errors[key] = err - 1
+                self.stats["errors_injected"][key] += 1
+                out.append(None)
+                break
+            rsp = self._command(cmd, name)
+            if rsp is None:
+                out.append(None)
+                break
+            out.append(rsp)
+        if out and out[-1] is None:
+            # info lines of the previous commands are sent, then the error
+            for rsp in out[:-1]:
+                if rsp is not True and rsp[0]:
+                    self._lines(*rsp[0])
+            self._lines("ERROR")
+            return
+        final = "OK"
+        for rsp in out:
+            if rsp[0]:
+                self._lines(*rsp[0])
+            if rsp[1] is not None:
+                final = rsp[1]
+        if final:
+            self._lines(final)
+        for rsp in out:
+            if rsp[2] is not None:
+                rsp[2]()
+
+    def _command(self, cmd, name):
+        """Return (info lines, final result or None for OK, action after the final result) or None for ERROR."""
+        arg = cmd[len(name):]
+        is_read = arg.startswith("?")
+        is_test = arg.startswith("=?")
+        params = _split_params(arg[1:]) if arg.startswith("=") and not is_test else []
+        info = []
+        final = None
+        action = None
+
+        if name == "E":
+            self.echo = arg.startswith("1")
+        elif name in ("V", "&D", "Q", "X", "&F", "Z", "", "+IFC", "+CMEE", "+QINDCFG", "+CGEREP", "+QURCCFG",
+                      "+QIDNSCFG", "+QICSGP", "+CEREG", "+CREG", "+CGREG", "+COPS", "+CGDCONT", "+CPSMS",
+                      "+CEDRXS", "+QICFG", "+CSIM", "+QCFG", "+CGATT", "+QIDEACT", "+QPOWD", "+CTZR") \
+                and not is_read:
+            if name == "+CGATT" and params:
+                self.registered = params[0] == "1"
+            elif name == "+COPS" and params and params[0] in ("0", "1", "4"):
+                self.registered = True
+            elif name == "+QIDEACT":
+                self.pdp_active = False
+            elif name == "+QICSGP" and len(params) > 1 and self.pdn_configured is not None:
+                self.pdn_configured.add(params[0])
+            elif name == "+QCFG" and len(params) == 1:
+                info = self._qcfg_read(params[0])
+            elif name == "+CSIM" and params:
+                info = ['+CSIM: 4,"9000"']
+        elif name == "+QCFG" and is_read:
+            info = []
+        elif name == "+CGMR":
+            info = [FW_REVISION]
+        elif name == "+QGMR":
+            info = [FW_REVISION + "_01.016.01.016"]
+        elif name == "+CGMI":
+            info = ["Quectel"]
+        elif name == "+CGMM":
+            info = ["BG96"]
+        elif name in ("+CGSN", "+GSN"):
+            info = [self.imei]
+        elif name == "+CIMI":
+            info = ["208010000000001"]
+        elif name == "+QCCID":
+            info = ["+QCCID: 89330000000000000001"]
+        elif name == "+CFUN":
+            if is_read:
+                info = ["+CFUN: %d" % self.cfun]
+            elif params:
+                self.cfun = int(params[0] or 0)
+                if self.cfun == 1:
+                    self.events.append((time.monotonic() - self.start_time, "CFUN=1"))
+                    action = lambda: self._later(0.05, self._urc, "+CPIN: READY")
+        elif name == "+CPIN":
+            if is_read:
+                info = ["+CPIN: READY"]
+        elif name == "+QINISTAT":
+            info = ["+QINISTAT: 7"]
+        elif name == "+CGDCONT" and is_read:
+            info = ['+CGDCONT: 1,"IP","virtual","0.0.0.0",0,0,0,0']
+        elif name == "+CSQ":
+            info = ["+CSQ: 20,99"]
+        elif name == "+QCSQ":
+            info = ['+QCSQ: "eMTC",-80,-100,120,-10']
+        elif name in ("+CEREG", "+CREG", "+CGREG") and is_read:
+            stat = 1 if (self.registered and self.cfun == 1) else 2 if self.cfun == 1 else 0
+            info = ['%s: 2,%d,"1A2B","01ABCDEF",8' % (name, stat)] if stat == 1 else ["%s: 2,%d" % (name, stat)]
+        elif name == "+COPS" and is_read:
+            info = ['+COPS: 0,0,"Virtual",8'] if self.registered else ["+COPS: 0"]
+        elif name == "+CGATT" and is_read:
+            info = ["+CGATT: %d" % (1 if self.registered else 0)]
+        elif name == "+CPSMS" and is_read:
+            info = ['+CPSMS: 0,,,"00000100","00001111"']
+        elif name == "+CEDRXS" and is_read:
+            info = []
+        elif name == "+QNWINFO":
+            if self.registered:
+                info = ['+QNWINFO: "eMTC","20801","LTE BAND 20",6300']
+        elif name == "+QIACT":
+            if is_read:
+                if self.pdp_active:
+                    info = ['+QIACT: 1,1,1,"%s"' % VIRTUAL_MODEM_IP]
+            elif not self.registered:
+                return None
+            elif (self.pdn_configured is not None) and params and (params[0] not in self.pdn_configured):
+                self.stats["qiact_rejected"] += 1
+                return None
+            else:
+                self.pdp_active = True
+        elif name == "+CGPADDR":
+            if self.pdp_active:
+                info = ['+CGPADDR: 1,"%s"' % VIRTUAL_MODEM_IP]
+        elif name == "+QIDNSGIP":
+            if not self.pdp_active:
+                return None
+            action = lambda: self._later(0.01, self._dns_answer)
+        elif name == "+QPING":
+            if not self.pdp_active:
+                return None
+            ip = params[1] if len(params) > 1 else VIRTUAL_SERVER_IP
+            count = int(params[3]) if len(params) > 3 and params[3] else 4
+            action = lambda: self._later(0.02, self._ping_answer, ip, count)
+        elif name == "+QIOPEN":
+            return self._qiopen(params)
+        elif name == "+QICLOSE":
+            self.sockets.pop(int(params[0]) if params else -1, None)
+        elif name == "+QISEND":
+            return self._qisend(params)
+        elif name == "+QIRD":
+            return self._qird(params)
+        elif name == "+QISTATE":
+            for s in self.sockets.values():
+                info.append('+QISTATE: %d,"%s","%s",%d,0,2,1,%d,0,"uart1"' %
+                            (s.conn_id, s.proto, s.ip, s.port, s.conn_id))
+        else:
+            if self.log:
+                self.log.write("MDM: unknown command %r answered OK\n" % cmd)
+        return (info, final, action)
+
+    def _qcfg_read(self, param):
+        values = {
+            "band": '"band",0xf,0x80084,0x80084',
+            "iotopmode": '"iotopmode",2',
+            "nwscanseq": '"nwscanseq",020103',
+            "nwscanmode": '"nwscanmode",0',
+        }
+        v = values.get(param.strip('"'))
+        return ["+QCFG: %s" % v] if v else []
+
+    def _dns_answer(self):
+        self._urc('+QIURC: "dnsgip",0,1,600')
+        self._urc('+QIURC: "dnsgip","%s"' % VIRTUAL_SERVER_IP)
+
+    def _ping_answer(self, ip, count):
+        for _ in range(count):
+            self._urc('+QPING: 0,"%s",32,20,255' % ip)
+        self._urc("+QPING: 0,%d,%d,0,20,20,20" % (count, count))
+
+    # --- sockets ------------------------------------------------------------
+    def _qiopen(self, params):
+        # AT+QIOPEN=<contextID>,<connectID>,<service_type>,<IP_address>,<remote_port>,<local_port>,<access_mode>
+        if (not self.pdp_active) or (len(params) < 5):
+            return None
+        conn_id = int(params[1])
+        proto = params[2].upper()
+        s = Socket(conn_id, "TCP" if proto == "TCP" else "UDP", params[3], int(params[4] or 0))
+        s.service = proto == "UDP SERVICE"
+        self.sockets[conn_id] = s
+        self.events.append((time.monotonic() - self.start_time, "QIOPEN"))
+
+        def opened():
+            self._later(0.02, self._opened, s)
+        return ([], None, opened)
+
+    def _opened(self, s):
+        if self.sockets.get(s.conn_id) is s:
+            self._urc("+QIOPEN: %d,0" % s.conn_id)
+            if (s.proto == "TCP") and (s.port == DAYTIME_PORT):
+                text = self.daytime or time.strftime("%d %b %Y %H:%M:%S", time.gmtime())
+                self._socket_input(s, text.encode() + b"\n", s.ip, s.port)
+
+    def _qisend(self, params):
+        # AT+QISEND=<connectID>,<send_length>[,<remoteIP>,<remote_port>]
+        s = self.sockets.get(int(params[0])) if params and params[0] else None
+        if (s is None) or (len(params) < 2):
+            return None
+        size = int(params[1])
+        ip = params[2] if len(params) > 2 else s.ip
+        port = int(params[3]) if len(params) > 3 else s.port
+        self.pending_send = (s, size, ip, port)
+        self._write("\r\n> ")
+        return ([], "", None)
+
+    def _socket_sent(self, s, data, ip, port):
+        self.stats["socket_bytes_sent"] += len(data)
+        self._lines("SEND OK")
+        # the virtual server echoes the data
+        self._later(0.005, self._socket_input, s, data, ip, port)
+
+    def _socket_input(self, s, data, ip, port):
+        if self.sockets.get(s.conn_id) is not s:
+            return
+        was_empty = s.unread() == 0
+        if s.proto == "TCP":
+            s.stream += data
+        else:
+            s.datagrams.append((bytes(data), ip, port))
+        s.total += len(data)
+        if was_empty:
+            self._urc('+QIURC: "recv",%d' % s.conn_id)
+
+    def _qird(self, params):
+        # AT+QIRD=<connectID>,0 (size) or AT+QIRD=<connectID>,<read_length>
+        s = self.sockets.get(int(params[0])) if params and params[0] else None
+        if s is None:
+            return None
+        length = int(params[1]) if len(params) > 1 else 1500
+        if length == 0:
+            return (["+QIRD: %d,%d,%d" % (s.total, s.read, s.unread())], None, None)
+        if s.proto == "TCP":
+            data = bytes(s.stream[:length])
+            del s.stream[:length]
+            ip, port = s.ip, s.port
+        elif s.datagrams:
+            data, ip, port = s.datagrams.popleft()
+            data = data[:length]
+        else:
+            data, ip, port = b"", s.ip, s.port
+        s.read += len(data)
+        self.stats["socket_bytes_received"] += len(data)
+        header = "+QIRD: %d" % len(data)
+        if s.service and data:
+            header += ',"%s",%d' % (ip, port)
+        self._write(b"\r\n" + header.encode() + b"\r\n" + data + b"\r\n")
+        again = (s.unread() != 0)
+
+        def more():
+            if again and (self.sockets.get(s.conn_id) is s):
+                self._urc('+QIURC: "recv",%d' % s.conn_id)
+        return ([], None, more)
+
+
+class HostRun:
+    """Run the host binary connected to a VirtualBG96; console output is kept and can be waited for."""
+
+    def __init__(self, binary, env=None, log_path=None, trace_path=None, **modem_args):
+        host_end, modem_end = socket.socketpair()
+        self.log = open(log_path, "w") if log_path else None
+        self.trace = open(trace_path, "w") if trace_path else None
+        self.modem = VirtualBG96(modem_end, log=self.log, trace=self.trace, **modem_args)
+        run_env = dict(os.environ)
+        run_env.update(env or {})
+        run_env["HOST_MODEM_FD"] = str(host_end.fileno())
+        self.start_time = time.monotonic()
+        self.proc = subprocess.Popen([binary], stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+                                     stderr=subprocess.STDOUT, env=run_env, pass_fds=(host_end.fileno(),))
+        host_end.close()
+        self.modem.start()
+        self.output = []                  # (time, line)
+        self.cond = threading.Condition()
+        self.reader = threading.Thread(target=self._read, daemon=True)
+        self.reader.start()
+
+    def _read(self):
+        for raw in self.proc.stdout:
+            line = raw.decode("latin-1").strip("\r\n")
+            with self.cond:
+                self.output.append((time.monotonic() - self.start_time, line))
+                if self.log:
+                    self.log.write("HOST %8.3f %s\n" % (self.output[-1][0], line))
+                self.cond.notify_all()
+        with self.cond:
+            self.cond.notify_all()
+
+    def wait_for(self, pattern, timeout, start=0):
+        """Wait for a console line matching pattern; return (index, time, match) or raise TimeoutError."""
+        regex = re.compile(pattern)
+        deadline = time.monotonic() + timeout
+        idx = start
+        with self.cond:
+            while True:
+                while idx < len(self.output):
+                    m = regex.search(self.output[idx][1])
+                    if m:
+                        return idx, self.output[idx][0], m
+                    idx += 1
+                remaining = deadline - time.monotonic()
+                if (remaining <= 0) or (self.proc.poll() is not None and not self.reader.is_alive()):
+                    raise TimeoutError("'%s' not found (exit code %s), last lines:\n%s" %
+                                       (pattern, self.proc.poll(),
+                                        "\n".join(l for _, l in self.output[-20:])))
+                self.cond.wait(min(remaining, 0.5))
+
+    def console(self, command):
+        """Send a command to the console (TRACE UART)."""
+        self.proc.stdin.write(command.encode() + b"\r")
+        self.proc.stdin.flush()
+
+    def stop(self):
+        """Stop the host and return its platform statistics."""
+        if self.proc.poll() is None:
+            self.proc.send_signal(signal.SIGTERM)
+            try:
+                self.proc.wait(10)
+            except subprocess.TimeoutExpired:
+                self.proc.kill()
+                self.proc.wait()
+        self.reader.join(5)
+        self.modem.stop()
+        self.proc.stdin.close()
+        self.proc.stdout.close()
+        stats = {}
+        for _, line in self.output:
+            # the console prompt of the host may precede the statistics on the same line
+            if "host: " in line:
+                for k, v in re.findall(r"(\w+)=(\d+)", line[line.index("host: "):]):
+                    stats[k] = int(v)
+        if self.log:
+            self.log.close()
+            self.log = None
+        if self.trace:
+            self.trace.close()
+            self.trace = None
+        return stats
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the host build connected to a virtual BG96 modem")
+    parser.add_argument("--latency-ms", type=float, default=0.0, help="delay before each AT command is answered")
+    parser.add_argument("--error", action="append", default=[], metavar="CMD[:N]",
+                        help="answer ERROR to the command (N times, default always), e.g. +QCSQ:1 or +CGREG?:1")
+    parser.add_argument("--log", help="AT exchanges and console log file")
+    parser.add_argument("--trace", help="raw UART trace file (hex, one line per transfer)")
+    parser.add_argument("--duration", type=float, default=0.0, help="stop after this time (s), 0: never")
+    parser.add_argument("binary", help="host binary (build/cellular_host)")
+    args = parser.parse_args()
+
+    errors = {}
+    for e in args.error:
+        name, _, count = e.partition(":")
+        errors[name.upper()] = int(count) if count else -1
+    run = HostRun(args.binary, log_path=args.log, trace_path=args.trace, latency_ms=args.latency_ms, errors=errors)
+
+    def forward():
+        for line in sys.stdin:
+            run.console(line.rstrip("\n"))
+    if sys.stdin.isatty():
+        threading.Thread(target=forward, daemon=True).start()
+    printed = 0
+    deadline = time.monotonic() + args.duration if args.duration else None
+    try:
+        while run.proc.poll() is None and (deadline is None or time.monotonic() < deadline):
+            time.sleep(0.2)
+            with run.cond:
+                lines = run.output[printed:]
+                printed = len(run.output)
+            for _, l in lines:
+                print(l, flush=True)
+    except KeyboardInterrupt:
+        pass
+    stats = run.stop()
+    for _, l in run.output[printed:]:
+        print(l)
+    print("modem: %s" % {k: v for k, v in run.modem.stats.items() if not isinstance(v, dict)})
+    print("modem: commands %s" % dict(run.modem.stats["per_command"]))
+    print("host: %s" % stats)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
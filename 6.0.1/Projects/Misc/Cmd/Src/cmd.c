@@ -183,7 +183,7 @@ static void CMD_thread(const void *p_argument)
 
       cmd_size = i;
 
-      if (memcmp((CRC_CHAR_t *)"reset", (CRC_CHAR_t *)command_line, cmd_size) == 0)
+      if (strncmp((CRC_CHAR_t *)"reset", (CRC_CHAR_t *)command_line, cmd_size) == 0)
       {
         CMD_BoardReset();
       }
@@ -192,7 +192,7 @@ static void CMD_thread(const void *p_argument)
         /* not an empty line        */
         for (i = 0U; i < CMD_NbCmd ; i++)
         {
-          if (memcmp((CRC_CHAR_t *)CMD_a_cmd_list[i].CmdName, (CRC_CHAR_t *)command_line, cmd_size) == 0)
+          if (strncmp((CRC_CHAR_t *)CMD_a_cmd_list[i].CmdName, (CRC_CHAR_t *)command_line, cmd_size) == 0)
           {
             /* Command  found => call processing  */
             PRINT_FORCE("\r\n")
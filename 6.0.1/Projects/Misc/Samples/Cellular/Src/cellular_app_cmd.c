@@ -90,7 +90,7 @@ static void cellular_app_cmd_generic(cmd_status_t *p_cmd_status)
   {
     /* cmd 'cellularapp' [help] ? */
     len = crs_strlen(p_cellular_app_cmd_argv[0]);
-    if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "help", len) == 0)
+    if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "help", len) == 0)
     {
       *p_cmd_status = CMD_OK;
       /* cmd 'cellularapp help': display help */
@@ -129,13 +129,13 @@ static bool cellular_app_cmd_echoclient_generic(cmd_status_t *p_cmd_status)
   {
     /* cmd 'echoclient' [help|perf <n>|stat|stat reset|status] ? */
     len = crs_strlen(p_cellular_app_cmd_argv[0]);
-    if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "help", len) == 0)
+    if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "help", len) == 0)
     {
       *p_cmd_status = CMD_OK;
       /* cmd 'echoclient help': display echoclient help */
       cellular_app_cmd_echoclient_help();
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "perf", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "perf", len) == 0)
     {
 #if (USE_LOW_POWER == 1)
       *p_cmd_status = CMD_PROCESS_ERROR;
@@ -177,7 +177,7 @@ static bool cellular_app_cmd_echoclient_generic(cmd_status_t *p_cmd_status)
       }
 #endif /* USE_LOW_POWER == 1 */
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "stat", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "stat", len) == 0)
     {
       *p_cmd_status = CMD_OK;
       /* cmd 'echoclient stat ...' : echoclient statistics */
@@ -208,7 +208,7 @@ static bool cellular_app_cmd_echoclient_generic(cmd_status_t *p_cmd_status)
         }
         PRINT_FORCE("<<< End   %s Statistics >>>\r\n", trace_label)
       }
-      else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[1], "reset", len) == 0)
+      else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[1], "reset", len) == 0)
       {
         /* cmd 'echoclient stat reset' : reset echoclient statistics */
         for (uint8_t i = 0U; i < ECHOCLIENT_THREAD_NUMBER; i++)
@@ -224,7 +224,7 @@ static bool cellular_app_cmd_echoclient_generic(cmd_status_t *p_cmd_status)
       }
     }
     /* status must be after stat because len = length of the input */
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "status", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "status", len) == 0)
     {
       /* cmd 'echoclient status' : display status of echo
        * Distant Server Name and IP Port
@@ -287,7 +287,7 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
     /* Still some parameters to analyze */
     /* cmd 'echoclient ...' or cmd 'echoclient x ...' */
     len = (uint8_t)crs_strlen(p_cellular_app_cmd_argv[argv_index]);
-    if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "on", len) == 0)
+    if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "on", len) == 0)
     {
       /* cmd 'echoclient [i] on': start echoclient i if not already started */
       cellular_app_process_status_t process_status;
@@ -319,7 +319,7 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
           break;
       }
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "off", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "off", len) == 0)
     {
       /* cmd 'echoclient [i] off': stop echoclient i if previously started */
       cellular_app_process_status_t process_status;
@@ -352,7 +352,7 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
           break;
       }
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "size", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "size", len) == 0)
     {
       /* cmd 'echoclient [i] size xxx': for echoclient i, configure size of message to send */
       *p_cmd_status = CMD_SYNTAX_ERROR;
@@ -378,7 +378,7 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
         }
       }
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "period", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "period", len) == 0)
     {
       /* cmd 'echoclient [i] period xxx':  for echoclient i, configure period between two sends */
       *p_cmd_status = CMD_SYNTAX_ERROR;
@@ -410,7 +410,7 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
         PRINT_FORCE("%s: value for 'period' must be provided and > 0 !", trace_label)
       }
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "protocol", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "protocol", len) == 0)
     {
       /* cmd 'echoclient [i] protocol xxx': for echoclient i, configure protocol used to address the distant */
       *p_cmd_status = CMD_SYNTAX_ERROR;
@@ -421,15 +421,15 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
 
         /* Check protocol value */
         len = (uint8_t)crs_strlen(p_cellular_app_cmd_argv[argv_index]);
-        if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "TCP", len) == 0)
+        if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "TCP", len) == 0)
         {
           protocol = CELLULAR_APP_SOCKET_TCP_PROTO;
         }
-        else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "UDP", len) == 0)
+        else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "UDP", len) == 0)
         {
           protocol = CELLULAR_APP_SOCKET_UDP_PROTO;
         }
-        else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "UDPSERVICE", len) == 0)
+        else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "UDPSERVICE", len) == 0)
         {
           /* UDP not-connected mode supported:
            * in LwIP always
@@ -475,8 +475,8 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
 #endif /* (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM) && (UDP_SERVICE_SUPPORTED == 0U) */
       }
     }
-    else if ((memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "server", len) == 0)
-             || (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "distant", len) == 0))
+    else if ((strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "server", len) == 0)
+             || (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "distant", len) == 0))
     {
       /* cmd 'echoclient [i] server xxx': for echoclient i, configure server used */
       /* cmd 'echoclient [i] distant xxx': for echoclient i, configure distant used */
@@ -488,18 +488,18 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
         /* Check distant value */
         len = (uint8_t)crs_strlen(p_cellular_app_cmd_argv[argv_index]);
 
-        if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index],
-                   cellular_app_distant_string[CELLULAR_APP_DISTANT_MBED_TYPE], len) == 0)
+        if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index],
+                    (CRC_CHAR_t *)cellular_app_distant_string[CELLULAR_APP_DISTANT_MBED_TYPE], len) == 0)
         {
           distant = CELLULAR_APP_DISTANT_MBED_TYPE;
         }
-        else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index],
-                        cellular_app_distant_string[CELLULAR_APP_DISTANT_UBLOX_TYPE], len) == 0)
+        else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index],
+                         (CRC_CHAR_t *)cellular_app_distant_string[CELLULAR_APP_DISTANT_UBLOX_TYPE], len) == 0)
         {
           distant = CELLULAR_APP_DISTANT_UBLOX_TYPE;
         }
-        else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index],
-                        cellular_app_distant_string[CELLULAR_APP_DISTANT_LOCAL_TYPE], len) == 0)
+        else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index],
+                         (CRC_CHAR_t *)cellular_app_distant_string[CELLULAR_APP_DISTANT_LOCAL_TYPE], len) == 0)
         {
           distant = CELLULAR_APP_DISTANT_LOCAL_TYPE;
         }
@@ -530,7 +530,7 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
                     cellular_app_distant_string[CELLULAR_APP_DISTANT_LOCAL_TYPE])
       }
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "valid", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "valid", len) == 0)
     {
       *p_cmd_status = CMD_SYNTAX_ERROR;
       argv_index++; /* skip 'valid' */
@@ -538,7 +538,7 @@ static void cellular_app_cmd_echoclient_instance(cmd_status_t *p_cmd_status)
       {
         /* cmd 'echoclient valid xxx': use for automatic test to obtain the statistics */
         len = (uint8_t)crs_strlen(p_cellular_app_cmd_argv[argv_index]);
-        if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "stat", len) == 0)
+        if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[argv_index], "stat", len) == 0)
         {
           *p_cmd_status = CMD_OK;
           /* cmd 'echoclient [i] valid stat': use for automatic test to obtain the statistics for echoclient i */
@@ -643,13 +643,13 @@ static void cellular_app_cmd_pingclient(cmd_status_t *p_cmd_status)
   {
     /* cmd 'ping' [help|ip1|ip2|ddd.ddd.ddd.ddd|status] ? */
     len = crs_strlen(p_cellular_app_cmd_argv[0]);
-    if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "help", len) == 0)
+    if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "help", len) == 0)
     {
       *p_cmd_status = CMD_OK;
       /* cmd 'ping help': display pingclient help */
       cellular_app_cmd_pingclient_help();
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "ip1", crs_strlen(p_cellular_app_cmd_argv[0])) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "ip1", crs_strlen(p_cellular_app_cmd_argv[0])) == 0)
     {
       /* cmd 'ping ip1': cmd allowed only if no ping in progress */
       *p_cmd_status = CMD_PROCESS_ERROR;
@@ -669,7 +669,7 @@ static void cellular_app_cmd_pingclient(cmd_status_t *p_cmd_status)
         PRINT_FORCE("%s: Already in progress! Stop it or wait its end before to retry!", trace_label)
       }
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "ip2", crs_strlen(p_cellular_app_cmd_argv[0])) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "ip2", crs_strlen(p_cellular_app_cmd_argv[0])) == 0)
     {
       /* cmd 'ping ip2': cmd allowed only if no ping in progress */
       *p_cmd_status = CMD_PROCESS_ERROR;
@@ -689,7 +689,7 @@ static void cellular_app_cmd_pingclient(cmd_status_t *p_cmd_status)
         PRINT_FORCE("%s: Already in progress! Stop it or wait its end before to retry!", trace_label)
       }
     }
-    else if (memcmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "status", len) == 0)
+    else if (strncmp((CRC_CHAR_t *)p_cellular_app_cmd_argv[0], "status", len) == 0)
     {
       /* cmd 'ping status' : display status of ping
        * IP1 value
@@ -759,12 +759,12 @@ static cmd_status_t cellular_app_cmd_cb(uint8_t *p_cmd_line)
       }
     }
 
-    if (memcmp((const CRC_CHAR_t *)p_cmd, "cellularapp", len) == 0)
+    if (strncmp((const CRC_CHAR_t *)p_cmd, "cellularapp", len) == 0)
     {
       cellular_app_cmd_generic(&result);
     }
     /* Is it a command echoclient ? */
-    else if (memcmp((const CRC_CHAR_t *)p_cmd, "echoclient", len) == 0)
+    else if (strncmp((const CRC_CHAR_t *)p_cmd, "echoclient", len) == 0)
     {
       /* echoclient [help|perf <n>|stat|stat reset|status] */
       if (cellular_app_cmd_echoclient_generic(&result) == false)
@@ -774,7 +774,7 @@ static cmd_status_t cellular_app_cmd_cb(uint8_t *p_cmd_line)
       }
     }
     /* Is it a command pingclient ? */
-    else if (memcmp((const CRC_CHAR_t *)p_cmd, "ping", len) == 0)
+    else if (strncmp((const CRC_CHAR_t *)p_cmd, "ping", len) == 0)
     {
       /* ping [help|ip1|ip2|status|xxx] */
       cellular_app_cmd_pingclient(&result);
@@ -39,6 +39,7 @@
 #include "com_sockets.h" /* includes all other includes */
 
 #include "cellular_control_api.h"
+#include "at_core.h" /* AT exchanges counted during the performance test */
 #include "cellular_runtime_custom.h"
 
 /* Private typedef -----------------------------------------------------------*/
@@ -47,6 +48,9 @@ typedef struct
 {
   uint16_t iter_ok;
   uint32_t total_time;
+  uint32_t latency_p50; /* median snd/rcv transaction time in ms          */
+  uint32_t latency_p99; /* 99th percentile snd/rcv transaction time in ms */
+  uint32_t at_cmd_nb;   /* AT commands and data buffers sent to the modem */
 } echoclient_performance_result_t; /* ToDo: only used for EchoClt */
 
 /* Private defines -----------------------------------------------------------*/
@@ -61,6 +65,21 @@ typedef struct
 
 #define ECHOCLIENT_SND_RCV_MAX_SIZE            (uint16_t)(1500)  /* Send/Receive buffer size max in bytes. */
 
+/* Performance test: trame sizes are 16, 32, 64 ... up to the maximum size supported by the socket stack */
+#define ECHOCLIENT_PERFORMANCE_NB_ITER         (uint8_t)(8)      /* Maximum number of trame sizes tested       */
+#define ECHOCLIENT_PERFORMANCE_TRAME_MIN       (uint16_t)(16)    /* First trame size tested                    */
+#if (USE_SOCKETS_TYPE == USE_SOCKETS_MODEM)
+/* Last trame size tested: limited by the modem socket send size */
+#define ECHOCLIENT_PERFORMANCE_TRAME_MAX       ((CONFIG_MODEM_MAX_SOCKET_TX_DATA_SIZE < 1400U) ?            \
+                                                (uint16_t)CONFIG_MODEM_MAX_SOCKET_TX_DATA_SIZE : (uint16_t)(1400))
+#define ECHOCLIENT_PERFORMANCE_STACK_STRING    "modem"
+#else /* USE_SOCKETS_TYPE != USE_SOCKETS_MODEM */
+#define ECHOCLIENT_PERFORMANCE_TRAME_MAX       (uint16_t)(1400)
+#define ECHOCLIENT_PERFORMANCE_STACK_STRING    "lwip"
+#endif /* USE_SOCKETS_TYPE == USE_SOCKETS_MODEM */
+#define ECHOCLIENT_PERFORMANCE_LATENCY_NB      (uint16_t)(128)   /* Number of snd/rcv times kept to compute
+                                                                    latency percentiles (last ones kept) */
+
 #define ECHOCLIENT_NFM_ERROR_LIMIT_NB_MAX      (uint8_t)(5)      /* Maximum number of consecutive errors
                                                                     before to start NFM feature */
 
@@ -95,6 +114,8 @@ static osMutexId cellular_app_echoclient_index_mutex_handle;
 /* Current status of EchoClt performance */
 static bool cellular_app_echoclient_perf_start; /* false: inactive, true: active */
 static uint16_t cellular_app_echoclient_perf_iter_nb;
+/* Snd/Rcv times of the current performance iteration loop - used to compute latency percentiles */
+static uint32_t cellular_app_echoclient_perf_latency[ECHOCLIENT_PERFORMANCE_LATENCY_NB];
 
 #if (USE_RTC == 1)
 /* Set or not Date/Time => a specific request will be send to the EchoClt distant server */
@@ -114,6 +135,8 @@ static bool echoclient_process(uint8_t index, cellular_app_socket_desc_t *const
 static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p_socket,
                                              uint16_t iteration_nb, uint16_t trame_size,
                                              echoclient_performance_result_t *p_perf_result);
+static uint32_t echoclient_performance_percentile(uint16_t nb, uint8_t percent);
+static uint32_t echoclient_performance_at_per_kb(uint32_t at_cmd_nb, uint32_t data_bytes);
 static void echoclient_performance(cellular_app_socket_desc_t *const p_socket);
 static bool echoclient_is_blocked(uint8_t index);
 static uint8_t echoclient_get_app_index(void);
@@ -654,8 +677,11 @@ static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p
   bool exit;
   uint16_t i;
   uint32_t time_snd_rcv;
+  at_tx_stats_t at_tx_stats_start;
+  at_tx_stats_t at_tx_stats_end;
 
   i = 0U;
+  AT_get_tx_stats(&at_tx_stats_start);
 
   /* Update buffer with new data and potentially new length */
   p_socket->snd_buffer_len = echoclient_format_buffer(trame_size, p_socket->p_snd_buffer);
@@ -667,6 +693,9 @@ static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p
     {
       if (echoclient_process(1U, p_socket, &time_snd_rcv, NULL) == true)
       {
+        /* Keep the last ECHOCLIENT_PERFORMANCE_LATENCY_NB snd/rcv times */
+        cellular_app_echoclient_perf_latency[p_perf_result->iter_ok % ECHOCLIENT_PERFORMANCE_LATENCY_NB] =
+          time_snd_rcv;
         p_perf_result->iter_ok++;
         p_perf_result->total_time += time_snd_rcv;
       }
@@ -679,7 +708,72 @@ static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p
       }
       i++;
     }
+    /* AT exchanges of the iteration loop (including the modem polling done meanwhile) */
+    AT_get_tx_stats(&at_tx_stats_end);
+    p_perf_result->at_cmd_nb = at_tx_stats_end.cmd_nb - at_tx_stats_start.cmd_nb;
+    /* Compute latency percentiles on the snd/rcv times kept */
+    if (p_perf_result->iter_ok > ECHOCLIENT_PERFORMANCE_LATENCY_NB)
+    {
+      p_perf_result->latency_p50 = echoclient_performance_percentile(ECHOCLIENT_PERFORMANCE_LATENCY_NB, 50U);
+      p_perf_result->latency_p99 = echoclient_performance_percentile(ECHOCLIENT_PERFORMANCE_LATENCY_NB, 99U);
+    }
+    else
+    {
+      p_perf_result->latency_p50 = echoclient_performance_percentile(p_perf_result->iter_ok, 50U);
+      p_perf_result->latency_p99 = echoclient_performance_percentile(p_perf_result->iter_ok, 99U);
+    }
+  }
+}
+
+/**
+  * @brief  Compute a percentile of the snd/rcv times kept during a performance iteration loop
+  * @note   cellular_app_echoclient_perf_latency[0..nb-1] is sorted in place
+  * @param  nb      - number of snd/rcv times available
+  * @param  percent - percentile to compute (0 to 100)
+  * @retval uint32_t - percentile value in ms (0 if no snd/rcv time available)
+  */
+static uint32_t echoclient_performance_percentile(uint16_t nb, uint8_t percent)
+{
+  uint32_t result = 0U;
+  uint32_t value;
+  uint16_t i;
+  uint16_t j;
+
+  if (nb != 0U)
+  {
+    /* Insertion sort: nb is small and the array is already sorted on the second call */
+    for (i = 1U; i < nb; i++)
+    {
+      value = cellular_app_echoclient_perf_latency[i];
+      j = i;
+      while ((j > 0U) && (cellular_app_echoclient_perf_latency[j - 1U] > value))
+      {
+        cellular_app_echoclient_perf_latency[j] = cellular_app_echoclient_perf_latency[j - 1U];
+        j--;
+      }
+      cellular_app_echoclient_perf_latency[j] = value;
+    }
+    /* Nearest-rank percentile */
+    i = (uint16_t)((((uint32_t)nb * (uint32_t)percent) + 99U) / 100U);
+    if (i != 0U)
+    {
+      i--;
+    }
+    result = cellular_app_echoclient_perf_latency[i];
   }
+
+  return (result);
+}
+
+/**
+  * @brief  Compute the AT exchanges per KB of data sent and received during a performance iteration loop
+  * @param  at_cmd_nb  - AT commands and data buffers sent to the modem
+  * @param  data_bytes - data sent and received
+  * @retval uint32_t   - AT exchanges per KB x 100 (0 if no data)
+  */
+static uint32_t echoclient_performance_at_per_kb(uint32_t at_cmd_nb, uint32_t data_bytes)
+{
+  return ((data_bytes != 0U) ? ((at_cmd_nb * 1024U * 100U) / data_bytes) : 0U);
 }
 
 /**
@@ -689,17 +783,6 @@ static void echoclient_performance_iteration(cellular_app_socket_desc_t *const p
   */
 static void echoclient_performance(cellular_app_socket_desc_t *const p_socket)
 {
-#define ECHOCLIENT_PERFORMANCE_NB_ITER 8U
-#define ECHOCLIENT_PERFORMANCE_TCP_TRAME_MAX ((uint16_t)(1400U))
-#define ECHOCLIENT_PERFORMANCE_UDP_TRAME_MAX ((uint16_t)(1400U))
-  uint16_t trame_size_in_TCP[ECHOCLIENT_PERFORMANCE_NB_ITER] =
-  {
-    16U, 32U, 64U, 128U, 256U, 512U, 1024U, ECHOCLIENT_PERFORMANCE_TCP_TRAME_MAX
-  };
-  uint16_t trame_size_in_UDP[ECHOCLIENT_PERFORMANCE_NB_ITER] =
-  {
-    16U, 32U, 64U, 128U, 256U, 512U, 1024U, ECHOCLIENT_PERFORMANCE_UDP_TRAME_MAX
-  };
   uint16_t iter[ECHOCLIENT_PERFORMANCE_NB_ITER] =
   {
     1000U, 1000U, 1000U, 1000U, 200U, 100U, 100U, 100U
@@ -707,24 +790,36 @@ static void echoclient_performance(cellular_app_socket_desc_t *const p_socket)
   uint16_t iter_ok;
   uint16_t iter_total;
   echoclient_performance_result_t perf_result[ECHOCLIENT_PERFORMANCE_NB_ITER];
+  uint16_t trame_size[ECHOCLIENT_PERFORMANCE_NB_ITER];
   uint16_t *p_trame_size;
-
-  if (p_socket->protocol == CELLULAR_APP_SOCKET_TCP_PROTO)
+  uint8_t trame_nb;
+  uint32_t throughput;
+  uint32_t at_per_kb; /* AT exchanges per KB of data sent and received, 2 decimals */
+
+  /* Trame sizes: ECHOCLIENT_PERFORMANCE_TRAME_MIN doubled until ECHOCLIENT_PERFORMANCE_TRAME_MAX,
+   * ECHOCLIENT_PERFORMANCE_TRAME_MAX is always the last size tested */
+  trame_nb = 0U;
+  trame_size[0] = ECHOCLIENT_PERFORMANCE_TRAME_MIN;
+  while ((trame_size[trame_nb] < ECHOCLIENT_PERFORMANCE_TRAME_MAX)
+         && (trame_nb < (ECHOCLIENT_PERFORMANCE_NB_ITER - 1U)))
   {
-    p_trame_size = &trame_size_in_TCP[0];
-  }
-  else
-  {
-    p_trame_size = &trame_size_in_UDP[0];
+    trame_size[trame_nb + 1U] = trame_size[trame_nb] * 2U;
+    trame_nb++;
   }
+  trame_size[trame_nb] = ECHOCLIENT_PERFORMANCE_TRAME_MAX;
+  trame_nb++;
+  p_trame_size = &trame_size[0];
 
   /* perf_result initialization */
   for (uint8_t i = 0U; i < ECHOCLIENT_PERFORMANCE_NB_ITER; i++)
   {
-    perf_result[i].iter_ok    = 0U;
-    perf_result[i].total_time = 0U;
+    perf_result[i].iter_ok     = 0U;
+    perf_result[i].total_time  = 0U;
+    perf_result[i].latency_p50 = 0U;
+    perf_result[i].latency_p99 = 0U;
+    perf_result[i].at_cmd_nb   = 0U;
   }
-  for (uint8_t i = 0U; i < ECHOCLIENT_PERFORMANCE_NB_ITER; i++)
+  for (uint8_t i = 0U; i < trame_nb; i++)
   {
     if (cellular_app_echoclient_perf_iter_nb == 0U)
     {
@@ -760,30 +855,51 @@ static void echoclient_performance(cellular_app_socket_desc_t *const p_socket)
   iter_ok = 0U;
   iter_total = 0U;
 
-  PRINT_FORCE("%s: Size  IterMax  IterOK   Data(B)   Time(ms) Throughput(Byte/s)", p_cellular_app_echoclient_trace)
+  PRINT_FORCE("%s: Size  IterMax  IterOK   Data(B)   Time(ms) Throughput(Byte/s) P50(ms) P99(ms)  AT/KB",
+              p_cellular_app_echoclient_trace)
 
-  for (uint8_t i = 0U; i < ECHOCLIENT_PERFORMANCE_NB_ITER; i++)
+  for (uint8_t i = 0U; i < trame_nb; i++)
   {
     uint32_t data_snd_rcv = (uint32_t)(p_trame_size[i]) * 2U * (uint32_t)(perf_result[i].iter_ok);
+    throughput = (perf_result[i].total_time != 0U) ? ((data_snd_rcv * 1000U) / (perf_result[i].total_time)) : 0U;
+    at_per_kb = echoclient_performance_at_per_kb(perf_result[i].at_cmd_nb, data_snd_rcv);
     if (cellular_app_echoclient_perf_iter_nb == 0U)
     {
-      PRINT_FORCE("%s: %5d\t%5d\t%5d\t%7ld   %7ld      %6ld", p_cellular_app_echoclient_trace,
+      PRINT_FORCE("%s: %5d\t%5d\t%5d\t%7ld   %7ld      %6ld    %5ld   %5ld %3ld.%02ld", p_cellular_app_echoclient_trace,
                   p_trame_size[i], iter[i], perf_result[i].iter_ok, data_snd_rcv, perf_result[i].total_time,
-                  ((data_snd_rcv * 1000U) / (perf_result[i].total_time)))
+                  throughput, perf_result[i].latency_p50, perf_result[i].latency_p99, at_per_kb / 100U,
+                  at_per_kb % 100U)
       /* Update trace valid data */
       iter_total += iter[i];
       iter_ok    += perf_result[i].iter_ok;
     }
     else
     {
-      PRINT_FORCE("%s: %5d\t%5d\t%5d\t%7ld   %7ld      %6ld", p_cellular_app_echoclient_trace,
+      PRINT_FORCE("%s: %5d\t%5d\t%5d\t%7ld   %7ld      %6ld    %5ld   %5ld %3ld.%02ld", p_cellular_app_echoclient_trace,
                   p_trame_size[i], cellular_app_echoclient_perf_iter_nb, perf_result[i].iter_ok, data_snd_rcv,
-                  perf_result[i].total_time, ((data_snd_rcv * 1000U) / (perf_result[i].total_time)))
+                  perf_result[i].total_time, throughput, perf_result[i].latency_p50, perf_result[i].latency_p99,
+                  at_per_kb / 100U, at_per_kb % 100U)
       /* Update trace valid data */
       iter_total += cellular_app_echoclient_perf_iter_nb;
       iter_ok    += perf_result[i].iter_ok;
     }
   }
+
+  /* Same results in CSV format: one line per trame size, lines prefixed by @perf@ to be extracted from the trace */
+  TRACE_VALID("@perf@:stack,protocol,size,iter_max,iter_ok,data_bytes,time_ms,bytes_per_s,p50_ms,p99_ms,"
+              "at_cmd,at_per_kb\n\r")
+  for (uint8_t i = 0U; i < trame_nb; i++)
+  {
+    uint32_t data_snd_rcv = (uint32_t)(p_trame_size[i]) * 2U * (uint32_t)(perf_result[i].iter_ok);
+    throughput = (perf_result[i].total_time != 0U) ? ((data_snd_rcv * 1000U) / (perf_result[i].total_time)) : 0U;
+    at_per_kb = echoclient_performance_at_per_kb(perf_result[i].at_cmd_nb, data_snd_rcv);
+    TRACE_VALID("@perf@:%s,%s,%d,%d,%d,%ld,%ld,%ld,%ld,%ld,%ld,%ld.%02ld\n\r", ECHOCLIENT_PERFORMANCE_STACK_STRING,
+                cellular_app_protocol_string[p_socket->protocol], p_trame_size[i],
+                ((cellular_app_echoclient_perf_iter_nb == 0U) ? iter[i] : cellular_app_echoclient_perf_iter_nb),
+                perf_result[i].iter_ok, data_snd_rcv, perf_result[i].total_time, throughput,
+                perf_result[i].latency_p50, perf_result[i].latency_p99, perf_result[i].at_cmd_nb,
+                at_per_kb / 100U, at_per_kb % 100U)
+  }
   TRACE_VALID("@valid@:echoclient:stat:%d/%d\n\r", iter_ok, iter_total)
 }
 
@@ -35,6 +35,7 @@ extern "C" {
 #include "main.h"
 #include "plf_modem_config.h"
 #include "usart.h" /* for huartX and hlpuartX */
+#include "rtc.h" /* for hrtc */
 
 /* Exported constants --------------------------------------------------------*/
 
@@ -101,6 +102,9 @@ extern "C" {
 #define TRACE_INTERFACE_INSTANCE        ((USART_TypeDef *)USART2)
 
 
+/* RTC: backup registers of the modem configuration cache (see MODEM_CFG_CACHE_RTC_BKP_FIRST) */
+#define MODEM_CFG_CACHE_RTC_HANDLE      hrtc
+
 /* Exported types ------------------------------------------------------------*/
 
 /* External variables --------------------------------------------------------*/